@@ -0,0 +1,28 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Helmholtz 2D CG with P=7, sparse direct sc</description>
+    <executable>Helmholtz2D</executable>
+    <parameters>-I GlobalSysSoln=DirectSparseStaticCond Helmholtz2D_P7_AllBCs.xml</parameters>
+    <files>
+        <file description="Session File">Helmholtz2D_P7_AllBCs.xml</file>
+    </files>
+
+    <metrics>
+        <metric type="L2" id="1">
+            <value tolerance="1e-7">0.00888037</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value tolerance="1e-6">0.0101781</value>
+        </metric>
+        <metric type="Regex" id="3">
+            <regex>^\s*Sparse Cholesky:\s*(\d+) rows.*</regex>
+            <matches>
+                <match>
+                    <field>442</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
+
+
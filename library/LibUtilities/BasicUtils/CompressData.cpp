@@ -0,0 +1,273 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+//  File: CompressData.cpp
+//
+//  For more information, please see: http://www.nektar.info/
+//
+//  The MIT License
+//
+//  Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+//  Department of Aeronautics, Imperial College London (UK), and Scientific
+//  Computing and Imaging Institute, University of Utah (USA).
+//
+//  License for the specific language governing rights and limitations under
+//  Permission is hereby granted, free of charge, to any person obtaining a
+//  copy of this software and associated documentation files (the "Software"),
+//  to deal in the Software without restriction, including without limitation
+//  the rights to use, copy, modify, merge, publish, distribute, sublicense,
+//  and/or sell copies of the Software, and to permit persons to whom the
+//  Software is furnished to do so, subject to the following conditions:
+//
+//  The above copyright notice and this permission notice shall be included
+//  in all copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+//  OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+//  THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+//  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+//  DEALINGS IN THE SOFTWARE.
+//
+//  Description: Base64 encoded, zlib compressed binary blocks in XML files.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TIXML_USE_STL
+#define TIXML_USE_STL
+#endif
+
+#include <LibUtilities/BasicUtils/CompressData.h>
+
+#include <tinyxml/tinyxml.h>
+#include "zlib.h"
+
+#include <cctype>
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/archive/iterators/base64_from_binary.hpp>
+#include <boost/archive/iterators/binary_from_base64.hpp>
+#include <boost/archive/iterators/transform_width.hpp>
+
+// Buffer size for zlib compression/decompression
+#define CHUNK 262144
+
+// Largest block of input handed to zlib in one call.
+#define MAX_ZLIB_INPUT (1u << 30)
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        namespace CompressData
+        {
+            /**
+             * The string encodes the byte order of this machine, since the
+             * records are stored in their native binary representation.
+             */
+            std::string GetCompressString()
+            {
+                union
+                {
+                    boost::uint32_t value;
+                    char            bytes[4];
+                } endian = {0x01020304};
+
+                return endian.bytes[0] == 0x04 ? "B64Z-LittleEndian"
+                                               : "B64Z-BigEndian";
+            }
+
+
+            /**
+             * Tags without a COMPRESSED attribute hold plain text. A tag
+             * written on a machine of a different byte order is rejected.
+             */
+            bool IsCompressed(const TiXmlElement *elmt)
+            {
+                const char *attr = elmt->Attribute("COMPRESSED");
+                if (!attr)
+                {
+                    return false;
+                }
+
+                ASSERTL0(boost::iequals(std::string(attr), GetCompressString()),
+                         "Compressed data in tag " + elmt->ValueStr() +
+                         " is stored as " + std::string(attr) +
+                         " but only " + GetCompressString() +
+                         " can be read on this machine.");
+                return true;
+            }
+
+
+            /**
+             * The compressed data is padded with zeros to a multiple of
+             * three bytes, so that the base64 string needs no padding
+             * characters. The zeros follow the end of the zlib stream and
+             * are ignored on decompression.
+             */
+            void ZlibEncodeToBase64Str(
+                const char  *in,
+                size_t       nBytes,
+                std::string &out64)
+            {
+                int ret;
+                z_stream strm;
+                std::string buffer(CHUNK, '\0');
+                std::string compressed;
+
+                strm.zalloc = Z_NULL;
+                strm.zfree  = Z_NULL;
+                strm.opaque = Z_NULL;
+                ret = deflateInit(&strm, Z_DEFAULT_COMPRESSION);
+                ASSERTL0(ret == Z_OK, "Error initializing zlib.");
+
+                // Feed the input in blocks which fit zlib's counters.
+                size_t offset = 0;
+                int    flush;
+                do
+                {
+                    size_t n = std::min(nBytes - offset,
+                                        (size_t) MAX_ZLIB_INPUT);
+                    strm.avail_in = n;
+                    strm.next_in  = (Bytef *)(in + offset);
+                    offset += n;
+                    flush = offset == nBytes ? Z_FINISH : Z_NO_FLUSH;
+
+                    do
+                    {
+                        strm.avail_out = CHUNK;
+                        strm.next_out  = (Bytef *)(&buffer[0]);
+
+                        ret = deflate(&strm, flush);
+                        ASSERTL0(ret != Z_STREAM_ERROR, "Zlib stream error.");
+
+                        compressed.append(buffer, 0, CHUNK - strm.avail_out);
+                    } while (strm.avail_out == 0);
+
+                    ASSERTL0(strm.avail_in == 0, "Not all input was used.");
+                } while (flush != Z_FINISH);
+
+                ASSERTL0(ret == Z_STREAM_END, "Stream not finished.");
+                (void)deflateEnd(&strm);
+
+                compressed.append((3 - compressed.size() % 3) % 3, '\0');
+
+                typedef boost::archive::iterators::base64_from_binary<
+                    boost::archive::iterators::transform_width<
+                        std::string::const_iterator, 6, 8> > base64_t;
+
+                out64.assign(base64_t(compressed.begin()),
+                             base64_t(compressed.end()));
+            }
+
+
+            /**
+             * Whitespace in @a in64 is ignored. Padding characters, which
+             * are not written by ZlibEncodeToBase64Str, are accepted and
+             * decode to trailing zeros after the end of the zlib stream.
+             */
+            void ZlibDecodeFromBase64Str(
+                const std::string &in64,
+                std::string       &out)
+            {
+                std::string clean;
+                clean.reserve(in64.size());
+                for (std::string::const_iterator c = in64.begin();
+                     c != in64.end(); ++c)
+                {
+                    if (!std::isspace(*c))
+                    {
+                        clean += *c == '=' ? 'A' : *c;
+                    }
+                }
+                clean.append((4 - clean.size() % 4) % 4, 'A');
+
+                typedef boost::archive::iterators::transform_width<
+                    boost::archive::iterators::binary_from_base64<
+                        std::string::const_iterator>, 8, 6> binary_t;
+
+                std::string compressed(binary_t(clean.begin()),
+                                       binary_t(clean.end()));
+
+                int ret;
+                z_stream strm;
+                std::string buffer(CHUNK, '\0');
+
+                strm.zalloc   = Z_NULL;
+                strm.zfree    = Z_NULL;
+                strm.opaque   = Z_NULL;
+                strm.avail_in = 0;
+                strm.next_in  = Z_NULL;
+                ret = inflateInit(&strm);
+                ASSERTL0(ret == Z_OK, "Error initializing zlib decompression.");
+
+                out.clear();
+                size_t offset = 0;
+                do
+                {
+                    if (strm.avail_in == 0)
+                    {
+                        if (offset == compressed.size())
+                        {
+                            (void)inflateEnd(&strm);
+                            ASSERTL0(false, "Compressed data is truncated.");
+                        }
+
+                        size_t n = std::min(compressed.size() - offset,
+                                            (size_t) MAX_ZLIB_INPUT);
+                        strm.avail_in = n;
+                        strm.next_in  = (Bytef *)(&compressed[offset]);
+                        offset += n;
+                    }
+
+                    strm.avail_out = CHUNK;
+                    strm.next_out  = (Bytef *)(&buffer[0]);
+
+                    ret = inflate(&strm, Z_NO_FLUSH);
+
+                    switch (ret)
+                    {
+                        case Z_NEED_DICT:
+                        case Z_DATA_ERROR:
+                        case Z_MEM_ERROR:
+                        case Z_STREAM_ERROR:
+                            (void)inflateEnd(&strm);
+                            ASSERTL0(false, "Failed to decompress data.");
+                    }
+
+                    out.append(buffer, 0, CHUNK - strm.avail_out);
+                } while (ret != Z_STREAM_END);
+
+                (void)inflateEnd(&strm);
+            }
+
+
+            void SetCompressedText(
+                TiXmlElement      *elmt,
+                const std::string &in64)
+            {
+                elmt->SetAttribute("COMPRESSED", GetCompressString());
+                elmt->LinkEndChild(new TiXmlText(in64));
+            }
+
+
+            std::string GetCompressedText(const TiXmlElement *elmt)
+            {
+                std::string text;
+                const TiXmlNode *child = elmt->FirstChild();
+                while (child)
+                {
+                    if (child->Type() == TiXmlNode::TEXT)
+                    {
+                        text += child->ToText()->ValueStr();
+                    }
+                    child = child->NextSibling();
+                }
+
+                ASSERTL0(!text.empty(), "Compressed data in tag " +
+                         elmt->ValueStr() + " is empty.");
+                return text;
+            }
+        }
+    }
+}
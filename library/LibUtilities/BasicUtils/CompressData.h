@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File CompressData.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Base64 encoded, zlib compressed binary blocks in XML files.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_COMPRESSDATA_H
+#define NEKTAR_LIB_UTILITIES_BASIC_UTILS_COMPRESSDATA_H
+
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+class TiXmlElement;
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        /**
+         * Arrays of plain records are stored in an XML tag as a single
+         * zlib compressed block of their binary representation, encoded in
+         * base64. The tag carries a COMPRESSED attribute naming the encoding
+         * and the byte order of the machine which wrote it; data can only be
+         * read on a machine of the same byte order.
+         */
+        namespace CompressData
+        {
+            /// Returns the value of the COMPRESSED attribute for this machine.
+            LIB_UTILITIES_EXPORT std::string GetCompressString();
+
+            /// Returns whether @a elmt holds compressed data, checking that
+            /// the data can be read on this machine.
+            LIB_UTILITIES_EXPORT bool IsCompressed(const TiXmlElement *elmt);
+
+            /// Compresses @a nBytes bytes of @a in and encodes them in
+            /// base64.
+            LIB_UTILITIES_EXPORT void ZlibEncodeToBase64Str(
+                    const char  *in,
+                    size_t       nBytes,
+                    std::string &out64);
+
+            /// Decodes and decompresses the base64 string @a in64.
+            LIB_UTILITIES_EXPORT void ZlibDecodeFromBase64Str(
+                    const std::string &in64,
+                    std::string       &out);
+
+            /// Sets the text of @a elmt to the compressed data @a in64 and
+            /// marks it as compressed.
+            LIB_UTILITIES_EXPORT void SetCompressedText(
+                    TiXmlElement      *elmt,
+                    const std::string &in64);
+
+            /// Returns the concatenated text of @a elmt.
+            LIB_UTILITIES_EXPORT std::string GetCompressedText(
+                    const TiXmlElement *elmt);
+
+            /// Compresses an array of records into a base64 string.
+            template<class T>
+            void ZlibEncodeToBase64Str(const std::vector<T> &in,
+                                       std::string          &out64)
+            {
+                ZlibEncodeToBase64Str(
+                    in.empty() ? 0 : reinterpret_cast<const char *>(&in[0]),
+                    in.size() * sizeof(T), out64);
+            }
+
+            /// Decompresses a base64 string into an array of records.
+            template<class T>
+            void ZlibDecodeFromBase64Str(const std::string &in64,
+                                         std::vector<T>    &out)
+            {
+                std::string data;
+                ZlibDecodeFromBase64Str(in64, data);
+
+                ASSERTL0(data.size() % sizeof(T) == 0,
+                         "Size of the compressed data does not match the "
+                         "size of its records.");
+
+                out.resize(data.size() / sizeof(T));
+                if (!out.empty())
+                {
+                    std::copy(data.begin(), data.end(),
+                              reinterpret_cast<char *>(&out[0]));
+                }
+            }
+
+            /// Writes an array of records as the compressed text of @a elmt.
+            template<class T>
+            void WriteCompressedData(TiXmlElement         *elmt,
+                                     const std::vector<T> &in)
+            {
+                std::string data64;
+                ZlibEncodeToBase64Str(in, data64);
+                SetCompressedText(elmt, data64);
+            }
+
+            /// Reads an array of records from the compressed text of @a elmt.
+            template<class T>
+            void ReadCompressedData(const TiXmlElement *elmt,
+                                    std::vector<T>     &out)
+            {
+                ZlibDecodeFromBase64Str(GetCompressedText(elmt), out);
+            }
+        }
+    }
+}
+
+#endif
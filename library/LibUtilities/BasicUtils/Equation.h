@@ -191,6 +191,60 @@ namespace Nektar
                 }
             }
 
+            /// Evaluates the parts of the expression which do not depend on
+            /// time at the given points, for use by #EvaluateCached.
+            LIB_UTILITIES_EXPORT void EvaluateSpatial(
+                    const Array<OneD, const NekDouble>& x,
+                    const Array<OneD, const NekDouble>& y,
+                    const Array<OneD, const NekDouble>& z,
+                    Array<OneD, NekDouble>& cache) const
+            {
+                try
+                {
+                    if (m_expr_id != -1)
+                    {
+                        m_evaluator.EvaluateSpatial(m_expr_id, x, y, z, cache);
+                    }
+                }
+                catch (const std::runtime_error& e)
+                {
+                    std::string msg(std::string("Equation::EvaluateSpatial fails on expression [") + m_expr + std::string("]\n"));
+                    ASSERTL0(false, msg + std::string("ERROR: ") + e.what());
+                }
+                catch (const std::string& e)
+                {
+                    std::string msg(std::string("Equation::EvaluateSpatial fails on expression [") + m_expr + std::string("]\n"));
+                    ASSERTL0(false, msg + std::string("ERROR: ") + e);
+                }
+            }
+
+            /// Evaluates the expression at time @a t at @a npoints points,
+            /// reusing the values stored by #EvaluateSpatial.
+            LIB_UTILITIES_EXPORT void EvaluateCached(
+                    const int npoints,
+                    const Array<OneD, const NekDouble>& cache,
+                    const NekDouble t,
+                    Array<OneD, NekDouble>& result) const
+            {
+                try
+                {
+                    if (m_expr_id != -1)
+                    {
+                        m_evaluator.EvaluateCached(m_expr_id, npoints, cache, t, result);
+                    }
+                }
+                catch (const std::runtime_error& e)
+                {
+                    std::string msg(std::string("Equation::EvaluateCached fails on expression [") + m_expr + std::string("]\n"));
+                    ASSERTL0(false, msg + std::string("ERROR: ") + e.what());
+                }
+                catch (const std::string& e)
+                {
+                    std::string msg(std::string("Equation::EvaluateCached fails on expression [") + m_expr + std::string("]\n"));
+                    ASSERTL0(false, msg + std::string("ERROR: ") + e);
+                }
+            }
+
             LIB_UTILITIES_EXPORT void SetParameter(const std::string& name, NekDouble value)
             {
                 m_evaluator.SetParameter(name, value);
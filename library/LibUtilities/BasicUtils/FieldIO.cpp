@@ -44,9 +44,15 @@
 
 #include "zlib.h"
 #include <set>
+#include <fstream>
+#include <cstring>
+#include <climits>
+#include <boost/cstdint.hpp>
+#include <boost/algorithm/string/predicate.hpp>
 
 #ifdef NEKTAR_USE_MPI
 #include <mpi.h>
+#include <LibUtilities/Communication/CommMpi.h>
 #endif
 
 // Buffer size for zlib compression/decompression
@@ -64,6 +70,203 @@ namespace Nektar
 {
     namespace LibUtilities
     {
+        namespace
+        {
+            /// Identifier at the start of a binary field file.
+            const char kBinaryMagic[8] = {'N','E','K','T','A','R','F','B'};
+
+            /// Version of the binary field file layout.
+            const boost::uint32_t kBinaryVersion = 1;
+
+            /// Written as is, to detect files from a different byte order.
+            const boost::uint32_t kBinaryByteOrder = 1;
+
+            /// Size of the fixed header of a binary field file.
+            const boost::uint64_t kBinaryHeaderSize = 32;
+
+            /// Location of the data written by one process in a binary
+            /// field file.
+            struct BinaryPartition
+            {
+                boost::uint64_t m_defsOffset;
+                boost::uint64_t m_defsLength;
+                boost::uint64_t m_idsOffset;
+                boost::uint64_t m_numIds;
+                boost::uint64_t m_dataOffset;
+                boost::uint64_t m_numData;
+            };
+
+            /// Rounds an offset up to a multiple of eight bytes.
+            boost::uint64_t PadOffset(boost::uint64_t offset)
+            {
+                return (offset + 7) & ~((boost::uint64_t) 7);
+            }
+
+            /**
+             * Positioned access to a binary field file. MPI-IO is used when
+             * the communicator is an MPI communicator, and a standard file
+             * stream otherwise. Files opened for writing are opened
+             * collectively; files opened for reading are opened by each
+             * process independently, so that Import need not be called by
+             * all processes.
+             */
+            class BinaryFieldFile
+            {
+            public:
+                BinaryFieldFile(CommSharedPtr      pComm,
+                                const std::string &filename,
+                                bool               write)
+                    : m_filename(filename)
+                {
+#ifdef NEKTAR_USE_MPI
+                    boost::shared_ptr<CommMpi> comm =
+                        boost::dynamic_pointer_cast<CommMpi>(pComm);
+                    m_useMpi = comm ? true : false;
+                    if (m_useMpi)
+                    {
+                        int mode = write ? MPI_MODE_CREATE | MPI_MODE_WRONLY
+                                         : MPI_MODE_RDONLY;
+                        int err = MPI_File_open(
+                            write ? comm->GetComm() : MPI_COMM_SELF,
+                            const_cast<char *>(filename.c_str()),
+                            mode, MPI_INFO_NULL, &m_mpiFile);
+                        ASSERTL0(err == MPI_SUCCESS,
+                                 "Unable to open file: " + filename);
+                        return;
+                    }
+#endif
+                    m_file.open(filename.c_str(), std::ios::binary |
+                        (write ? std::ios::out | std::ios::trunc
+                               : std::ios::in));
+                    ASSERTL0(m_file.good(),
+                             "Unable to open file: " + filename);
+                }
+
+                ~BinaryFieldFile()
+                {
+#ifdef NEKTAR_USE_MPI
+                    if (m_useMpi)
+                    {
+                        MPI_File_close(&m_mpiFile);
+                        return;
+                    }
+#endif
+                    m_file.close();
+                }
+
+                /// Writes a block at a given offset. Collective writes must
+                /// be called by all processes.
+                void WriteAt(boost::uint64_t  offset,
+                             const void      *buf,
+                             boost::uint64_t  len,
+                             bool             collective)
+                {
+#ifdef NEKTAR_USE_MPI
+                    if (m_useMpi)
+                    {
+                        ASSERTL0(len <= INT_MAX, "Block too large to write "
+                                 "to file: " + m_filename);
+                        MPI_Status status;
+                        int err = collective
+                            ? MPI_File_write_at_all(m_mpiFile,
+                                  (MPI_Offset) offset, const_cast<void *>(buf),
+                                  (int) len, MPI_BYTE, &status)
+                            : MPI_File_write_at(m_mpiFile,
+                                  (MPI_Offset) offset, const_cast<void *>(buf),
+                                  (int) len, MPI_BYTE, &status);
+                        ASSERTL0(err == MPI_SUCCESS,
+                                 "Failed to write to file: " + m_filename);
+                        return;
+                    }
+#endif
+                    if (len > 0)
+                    {
+                        m_file.seekp(offset);
+                        m_file.write((const char *) buf, len);
+                        ASSERTL0(m_file.good(),
+                                 "Failed to write to file: " + m_filename);
+                    }
+                }
+
+                /// Reads a block at a given offset.
+                void ReadAt(boost::uint64_t  offset,
+                            void            *buf,
+                            boost::uint64_t  len)
+                {
+#ifdef NEKTAR_USE_MPI
+                    if (m_useMpi)
+                    {
+                        ASSERTL0(len <= INT_MAX, "Block too large to read "
+                                 "from file: " + m_filename);
+                        MPI_Status status;
+                        int err = MPI_File_read_at(m_mpiFile,
+                            (MPI_Offset) offset, buf, (int) len, MPI_BYTE,
+                            &status);
+                        ASSERTL0(err == MPI_SUCCESS,
+                                 "Failed to read from file: " + m_filename);
+                        return;
+                    }
+#endif
+                    if (len > 0)
+                    {
+                        m_file.seekg(offset);
+                        m_file.read((char *) buf, len);
+                        ASSERTL0(m_file.good(),
+                                 "Failed to read from file: " + m_filename);
+                    }
+                }
+
+            private:
+                std::string  m_filename;
+#ifdef NEKTAR_USE_MPI
+                bool         m_useMpi;
+                MPI_File     m_mpiFile;
+#endif
+                std::fstream m_file;
+            };
+
+            /// Reads the header, partition table and metadata of a binary
+            /// field file.
+            void ReadBinaryHeader(BinaryFieldFile              &file,
+                                  std::vector<BinaryPartition> &partitions,
+                                  std::string                  &metadata)
+            {
+                char            magic[8];
+                boost::uint32_t byteOrder, version;
+                boost::uint64_t numPartitions, metadataLength;
+
+                file.ReadAt(0,  magic,           8);
+                file.ReadAt(8,  &byteOrder,      4);
+                file.ReadAt(12, &version,        4);
+                file.ReadAt(16, &numPartitions,  8);
+                file.ReadAt(24, &metadataLength, 8);
+
+                ASSERTL0(memcmp(magic, kBinaryMagic, 8) == 0,
+                         "Not a binary field file.");
+                ASSERTL0(byteOrder == kBinaryByteOrder,
+                         "Binary field file was written with a different "
+                         "byte order.");
+                ASSERTL0(version == kBinaryVersion,
+                         "Unsupported binary field file version.");
+
+                partitions.resize(numPartitions);
+                if (numPartitions > 0)
+                {
+                    file.ReadAt(kBinaryHeaderSize, &partitions[0],
+                                numPartitions*sizeof(BinaryPartition));
+                }
+
+                metadata.resize(metadataLength);
+                if (metadataLength > 0)
+                {
+                    file.ReadAt(kBinaryHeaderSize +
+                                numPartitions*sizeof(BinaryPartition),
+                                &metadata[0], metadataLength);
+                }
+            }
+        }
+
+
         /**
          * This function allows for data to be written to an FLD file when a
          * session and/or communicator is not instantiated. Typically used in
@@ -138,12 +341,39 @@ namespace Nektar
          *
          */
         FieldIO::FieldIO(
-                LibUtilities::CommSharedPtr pComm)
-            : m_comm(pComm)
+                LibUtilities::CommSharedPtr pComm,
+                FieldIOFormat pFormat)
+            : m_comm(pComm),
+              m_format(pFormat)
         {
         }
 
 
+        /**
+         * The output format is taken from the IOFormat solver info, which
+         * may be either Xml (default) or Binary.
+         */
+        FieldIO::FieldIO(
+                const LibUtilities::SessionReaderSharedPtr &pSession)
+            : m_comm(pSession->GetComm()),
+              m_format(eFieldIOXml)
+        {
+            if (pSession->DefinesSolverInfo("IOFormat"))
+            {
+                std::string format = pSession->GetSolverInfo("IOFormat");
+                if (boost::iequals(format, "Binary"))
+                {
+                    m_format = eFieldIOBinary;
+                }
+                else
+                {
+                    ASSERTL0(boost::iequals(format, "Xml"),
+                             "Unknown IOFormat '" + format + "'.");
+                }
+            }
+        }
+
+
         /**
          *
          */
@@ -166,6 +396,12 @@ namespace Nektar
                          "Invalid size of fielddata vector.");
             }
 
+            if (m_format == eFieldIOBinary)
+            {
+                WriteBinary(outFile, fielddefs, fielddata, fieldmetadatamap);
+                return;
+            }
+
             // Prepare to write out data. In parallel, we must create directory
             // and determine the full pathname to the file to write out.
             // Any existing file/directory which is in the way is removed.
@@ -185,195 +421,210 @@ namespace Nektar
             {
                 //---------------------------------------------
                 // Write ELEMENTS
-                TiXmlElement * elemTag = new TiXmlElement("ELEMENTS");
-                root->LinkEndChild(elemTag);
+                TiXmlElement * elemTag =
+                    WriteFieldDefinition(root, fielddefs[f]);
+
+                std::string compressedDataString;
+                ASSERTL0(Z_OK == Deflate(fielddata[f], compressedDataString),
+                        "Failed to compress field data.");
+
+                // If the string length is not divisible by 3,
+                // pad it. There is a bug in transform_width
+                // that will make it reference past the end
+                // and crash.
+                switch (compressedDataString.length() % 3)
+                {
+                case 1:
+                    compressedDataString += '\0';
+                case 2:
+                    compressedDataString += '\0';
+                    break;
+                }
 
-                // Write FIELDS
-                std::string fieldsString;
+                // Convert from binary to base64.
+                typedef boost::archive::iterators::base64_from_binary<
+                        boost::archive::iterators::transform_width<
+                        std::string::const_iterator, 6, 8> > base64_t;
+                std::string base64string(base64_t(compressedDataString.begin()),
+                        base64_t(compressedDataString.end()));
+                elemTag->LinkEndChild(new TiXmlText(base64string));
+
+            }
+            doc.SaveFile(filename);
+        }
+
+
+        /**
+         * Creates an ELEMENTS tag holding the attributes of a field
+         * definition. The field data is not written.
+         */
+        TiXmlElement *FieldIO::WriteFieldDefinition(
+                TiXmlElement * root,
+                const FieldDefinitionsSharedPtr &fielddef)
+        {
+            TiXmlElement * elemTag = new TiXmlElement("ELEMENTS");
+            root->LinkEndChild(elemTag);
+
+            // Write FIELDS
+            std::string fieldsString;
+            {
+                std::stringstream fieldsStringStream;
+                bool first = true;
+                for (std::vector<int>::size_type i = 0; i
+                < fielddef->m_fields.size(); i++)
                 {
-                    std::stringstream fieldsStringStream;
-                    bool first = true;
-                    for (std::vector<int>::size_type i = 0; i
-                    < fielddefs[f]->m_fields.size(); i++)
-                    {
-                        if (!first)
-                            fieldsStringStream << ",";
-                        fieldsStringStream << fielddefs[f]->m_fields[i];
-                        first = false;
-                    }
-                    fieldsString = fieldsStringStream.str();
+                    if (!first)
+                        fieldsStringStream << ",";
+                    fieldsStringStream << fielddef->m_fields[i];
+                    first = false;
                 }
-                elemTag->SetAttribute("FIELDS", fieldsString);
+                fieldsString = fieldsStringStream.str();
+            }
+            elemTag->SetAttribute("FIELDS", fieldsString);
 
-                // Write SHAPE
-                std::string shapeString;
+            // Write SHAPE
+            std::string shapeString;
+            {
+                std::stringstream shapeStringStream;
+                shapeStringStream << ShapeTypeMap[fielddef->m_shapeType];
+                if(fielddef->m_numHomogeneousDir == 1)
                 {
-                    std::stringstream shapeStringStream;
-                    shapeStringStream << ShapeTypeMap[fielddefs[f]->m_shapeType];
-                    if(fielddefs[f]->m_numHomogeneousDir == 1)
-                    {
-                        shapeStringStream << "-HomogenousExp1D";
-                    }
-                    else if (fielddefs[f]->m_numHomogeneousDir == 2)
-                    {
-                        shapeStringStream << "-HomogenousExp2D";
-                    }
+                    shapeStringStream << "-HomogenousExp1D";
+                }
+                else if (fielddef->m_numHomogeneousDir == 2)
+                {
+                    shapeStringStream << "-HomogenousExp2D";
+                }
+
+                shapeString = shapeStringStream.str();
+            }
+            elemTag->SetAttribute("SHAPE", shapeString);
 
-                    shapeString = shapeStringStream.str();
+            // Write BASIS
+            std::string basisString;
+            {
+                std::stringstream basisStringStream;
+                bool first = true;
+                for (std::vector<BasisType>::size_type i = 0; i < fielddef->m_basis.size(); i++)
+                {
+                    if (!first)
+                        basisStringStream << ",";
+                    basisStringStream
+                    << BasisTypeMap[fielddef->m_basis[i]];
+                    first = false;
                 }
-                elemTag->SetAttribute("SHAPE", shapeString);
+                basisString = basisStringStream.str();
+            }
+            elemTag->SetAttribute("BASIS", basisString);
 
-                // Write BASIS
-                std::string basisString;
+            // Write homogeneuous length details
+            if(fielddef->m_numHomogeneousDir)
+            {
+                std::string homoLenString;
                 {
-                    std::stringstream basisStringStream;
+                    std::stringstream homoLenStringStream;
                     bool first = true;
-                    for (std::vector<BasisType>::size_type i = 0; i < fielddefs[f]->m_basis.size(); i++)
+                    for (int i = 0; i < fielddef->m_numHomogeneousDir; ++i)
                     {
                         if (!first)
-                            basisStringStream << ",";
-                        basisStringStream
-                        << BasisTypeMap[fielddefs[f]->m_basis[i]];
+                            homoLenStringStream << ",";
+                        homoLenStringStream
+                        << fielddef->m_homogeneousLengths[i];
                         first = false;
                     }
-                    basisString = basisStringStream.str();
+                    homoLenString = homoLenStringStream.str();
                 }
-                elemTag->SetAttribute("BASIS", basisString);
-
-                // Write homogeneuous length details
-                if(fielddefs[f]->m_numHomogeneousDir)
+                elemTag->SetAttribute("HOMOGENEOUSLENGTHS", homoLenString);
+            }
+				
+            // Write homogeneuous planes/lines details
+            if(fielddef->m_numHomogeneousDir)
+            {
+                if(fielddef->m_homogeneousYIDs.size() > 0)
                 {
-                    std::string homoLenString;
+                    std::string homoYIDsString;
                     {
-                        std::stringstream homoLenStringStream;
+                        std::stringstream homoYIDsStringStream;
                         bool first = true;
-                        for (int i = 0; i < fielddefs[f]->m_numHomogeneousDir; ++i)
+                        for(unsigned int i = 0; i < fielddef->m_homogeneousYIDs.size(); i++)
                         {
                             if (!first)
-                                homoLenStringStream << ",";
-                            homoLenStringStream
-                            << fielddefs[f]->m_homogeneousLengths[i];
+                                homoYIDsStringStream << ",";
+                            homoYIDsStringStream << fielddef->m_homogeneousYIDs[i];
                             first = false;
                         }
-                        homoLenString = homoLenStringStream.str();
-                    }
-                    elemTag->SetAttribute("HOMOGENEOUSLENGTHS", homoLenString);
-                }
-				
-                // Write homogeneuous planes/lines details
-                if(fielddefs[f]->m_numHomogeneousDir)
-                {
-                    if(fielddefs[f]->m_homogeneousYIDs.size() > 0)
-                    {
-                        std::string homoYIDsString;
-                        {
-                            std::stringstream homoYIDsStringStream;
-                            bool first = true;
-                            for(int i = 0; i < fielddefs[f]->m_homogeneousYIDs.size(); i++)
-                            {
-                                if (!first)
-                                    homoYIDsStringStream << ",";
-                                homoYIDsStringStream << fielddefs[f]->m_homogeneousYIDs[i];
-                                first = false;
-                            }
-                            homoYIDsString = homoYIDsStringStream.str();
-                        }
-                        elemTag->SetAttribute("HOMOGENEOUSYIDS", homoYIDsString);
-                    }
-                    
-                    if(fielddefs[f]->m_homogeneousZIDs.size() > 0)
-                    {
-                        std::string homoZIDsString;
-                        {
-                            std::stringstream homoZIDsStringStream;
-                            bool first = true;
-                            for(int i = 0; i < fielddefs[f]->m_homogeneousZIDs.size(); i++)
-                            {
-                                if (!first)
-                                    homoZIDsStringStream << ",";
-                                homoZIDsStringStream << fielddefs[f]->m_homogeneousZIDs[i];
-                                first = false;
-                            }
-                            homoZIDsString = homoZIDsStringStream.str();
-                        }
-                        elemTag->SetAttribute("HOMOGENEOUSZIDS", homoZIDsString);
+                        homoYIDsString = homoYIDsStringStream.str();
                     }
+                    elemTag->SetAttribute("HOMOGENEOUSYIDS", homoYIDsString);
                 }
                 
-                // Write NUMMODESPERDIR
-                std::string numModesString;
+                if(fielddef->m_homogeneousZIDs.size() > 0)
                 {
-                    std::stringstream numModesStringStream;
-
-                    if (fielddefs[f]->m_uniOrder)
-                    {
-                        numModesStringStream << "UNIORDER:";
-                        // Just dump single definition
-                        bool first = true;
-                        for (std::vector<int>::size_type i = 0; i
-                                 < fielddefs[f]->m_basis.size(); i++)
-                        {
-                            if (!first)
-                                numModesStringStream << ",";
-                            numModesStringStream << fielddefs[f]->m_numModes[i];
-                            first = false;
-                        }
-                    }
-                    else
+                    std::string homoZIDsString;
                     {
-                        numModesStringStream << "MIXORDER:";
+                        std::stringstream homoZIDsStringStream;
                         bool first = true;
-                        for (std::vector<int>::size_type i = 0; i
-                                 < fielddefs[f]->m_numModes.size(); i++)
+                        for(unsigned int i = 0; i < fielddef->m_homogeneousZIDs.size(); i++)
                         {
                             if (!first)
-                                numModesStringStream << ",";
-                            numModesStringStream << fielddefs[f]->m_numModes[i];
+                                homoZIDsStringStream << ",";
+                            homoZIDsStringStream << fielddef->m_homogeneousZIDs[i];
                             first = false;
                         }
+                        homoZIDsString = homoZIDsStringStream.str();
                     }
-                    
-                    numModesString = numModesStringStream.str();
+                    elemTag->SetAttribute("HOMOGENEOUSZIDS", homoZIDsString);
                 }
-                elemTag->SetAttribute("NUMMODESPERDIR", numModesString);
+            }
+            
+            // Write NUMMODESPERDIR
+            std::string numModesString;
+            {
+                std::stringstream numModesStringStream;
 
-                // Write ID
-                // Should ideally look at ways of compressing this stream
-                // if just sequential;
-                std::string idString;
+                if (fielddef->m_uniOrder)
                 {
-                    std::stringstream idStringStream;
-                    GenerateSeqString(fielddefs[f]->m_elementIDs,idString);
+                    numModesStringStream << "UNIORDER:";
+                    // Just dump single definition
+                    bool first = true;
+                    for (std::vector<int>::size_type i = 0; i
+                             < fielddef->m_basis.size(); i++)
+                    {
+                        if (!first)
+                            numModesStringStream << ",";
+                        numModesStringStream << fielddef->m_numModes[i];
+                        first = false;
+                    }
                 }
-                elemTag->SetAttribute("ID", idString);
-
-                std::string compressedDataString;
-                ASSERTL0(Z_OK == Deflate(fielddata[f], compressedDataString),
-                        "Failed to compress field data.");
-
-                // If the string length is not divisible by 3,
-                // pad it. There is a bug in transform_width
-                // that will make it reference past the end
-                // and crash.
-                switch (compressedDataString.length() % 3)
+                else
                 {
-                case 1:
-                    compressedDataString += '\0';
-                case 2:
-                    compressedDataString += '\0';
-                    break;
+                    numModesStringStream << "MIXORDER:";
+                    bool first = true;
+                    for (std::vector<int>::size_type i = 0; i
+                             < fielddef->m_numModes.size(); i++)
+                    {
+                        if (!first)
+                            numModesStringStream << ",";
+                        numModesStringStream << fielddef->m_numModes[i];
+                        first = false;
+                    }
                 }
+                
+                numModesString = numModesStringStream.str();
+            }
+            elemTag->SetAttribute("NUMMODESPERDIR", numModesString);
 
-                // Convert from binary to base64.
-                typedef boost::archive::iterators::base64_from_binary<
-                        boost::archive::iterators::transform_width<
-                        std::string::const_iterator, 6, 8> > base64_t;
-                std::string base64string(base64_t(compressedDataString.begin()),
-                        base64_t(compressedDataString.end()));
-                elemTag->LinkEndChild(new TiXmlText(base64string));
-
+            // Write ID
+            // Should ideally look at ways of compressing this stream
+            // if just sequential;
+            std::string idString;
+            {
+                std::stringstream idStringStream;
+                GenerateSeqString(fielddef->m_elementIDs,idString);
             }
-            doc.SaveFile(filename);
+            elemTag->SetAttribute("ID", idString);
+
+            return elemTag;
         }
 
 
@@ -387,6 +638,13 @@ namespace Nektar
                     const Array<OneD, int> ElementIDs)
         {
 
+            if (IsBinaryFile(infilename))
+            {
+                ImportBinary(infilename, fielddefs, fielddata,
+                             fieldmetadatamap, ElementIDs);
+                return;
+            }
+
             std::string infile = infilename;
 
             fs::path pinfilename(infilename);            
@@ -497,6 +755,286 @@ namespace Nektar
         }
 
 
+        /**
+         * The binary format stores the data of all processes in a single
+         * file, written collectively. The file contains
+         * - a fixed header holding an identifier, the byte order, the
+         *   format version, the number of partitions (one per writing
+         *   process) and the length of the metadata;
+         * - a table giving, for each partition, the offset and length of
+         *   its field definitions, element IDs and coefficients;
+         * - the metadata, as XML;
+         * - the element IDs of all partitions, stored contiguously so that
+         *   readers may find the partitions they need in a single read;
+         * - for each partition, its field definitions as XML ELEMENTS tags
+         *   followed by the raw coefficient data.
+         */
+        void FieldIO::WriteBinary(const std::string &outFile,
+                   std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                   std::vector<std::vector<NekDouble> > &fielddata,
+                   const FieldMetaDataMap &fieldmetadatamap)
+        {
+            int i;
+            unsigned int f;
+            int nprocs = m_comm->GetSize();
+            int rank   = m_comm->GetRank();
+
+            // Field definitions, element IDs and data of this process.
+            std::string                  defs;
+            std::vector<boost::uint32_t> ids;
+            std::vector<NekDouble>       data;
+
+            if (fielddefs.size() > 0)
+            {
+                TiXmlDocument doc;
+                TiXmlElement * root = new TiXmlElement("NEKTAR");
+                doc.LinkEndChild(root);
+
+                for (f = 0; f < fielddefs.size(); ++f)
+                {
+                    WriteFieldDefinition(root, fielddefs[f]);
+                    ids.insert(ids.end(), fielddefs[f]->m_elementIDs.begin(),
+                                          fielddefs[f]->m_elementIDs.end());
+                    data.insert(data.end(), fielddata[f].begin(),
+                                            fielddata[f].end());
+                }
+
+                TiXmlPrinter printer;
+                doc.Accept(&printer);
+                defs = printer.CStr();
+            }
+
+            // Metadata is written by the root process only.
+            std::string metadata;
+            if (rank == 0)
+            {
+                TiXmlDocument doc;
+                TiXmlElement * root = new TiXmlElement("NEKTAR");
+                doc.LinkEndChild(root);
+                AddInfoTag(root, fieldmetadatamap);
+
+                TiXmlPrinter printer;
+                doc.Accept(&printer);
+                metadata = printer.CStr();
+            }
+            int metadataLength = metadata.size();
+            m_comm->AllReduce(metadataLength, LibUtilities::ReduceMax);
+
+            // Share the size of the data of each process and compute the
+            // layout of the file.
+            Array<OneD, int> sizes(3*nprocs, 0);
+            sizes[3*rank  ] = defs.size();
+            sizes[3*rank+1] = ids.size();
+            sizes[3*rank+2] = data.size();
+            m_comm->AllReduce(sizes, LibUtilities::ReduceSum);
+
+            std::vector<BinaryPartition> partitions(nprocs);
+            boost::uint64_t offset = PadOffset(kBinaryHeaderSize +
+                nprocs*sizeof(BinaryPartition) + metadataLength);
+
+            for (i = 0; i < nprocs; ++i)
+            {
+                partitions[i].m_idsOffset = offset;
+                partitions[i].m_numIds    = sizes[3*i+1];
+                offset += partitions[i].m_numIds*sizeof(boost::uint32_t);
+            }
+
+            for (i = 0; i < nprocs; ++i)
+            {
+                offset = PadOffset(offset);
+                partitions[i].m_defsOffset = offset;
+                partitions[i].m_defsLength = sizes[3*i];
+                offset = PadOffset(offset + partitions[i].m_defsLength);
+                partitions[i].m_dataOffset = offset;
+                partitions[i].m_numData    = sizes[3*i+2];
+                offset += partitions[i].m_numData*sizeof(NekDouble);
+            }
+
+            // Remove any existing file or directory which is in the way.
+            if (rank == 0)
+            {
+                try
+                {
+                    fs::remove_all(fs::path(outFile));
+                }
+                catch (fs::filesystem_error& e)
+                {
+                    ASSERTL0(e.code().value() ==
+                                 berrc::no_such_file_or_directory,
+                             "Filesystem error: " + string(e.what()));
+                }
+            }
+            m_comm->Block();
+
+            BinaryFieldFile file(m_comm, outFile, true);
+
+            if (rank == 0)
+            {
+                boost::uint64_t numPartitions  = nprocs;
+                boost::uint64_t metaLength     = metadataLength;
+
+                file.WriteAt(0,  kBinaryMagic,      8, false);
+                file.WriteAt(8,  &kBinaryByteOrder, 4, false);
+                file.WriteAt(12, &kBinaryVersion,   4, false);
+                file.WriteAt(16, &numPartitions,    8, false);
+                file.WriteAt(24, &metaLength,       8, false);
+                file.WriteAt(kBinaryHeaderSize, &partitions[0],
+                             nprocs*sizeof(BinaryPartition), false);
+                file.WriteAt(kBinaryHeaderSize +
+                             nprocs*sizeof(BinaryPartition),
+                             metadata.c_str(), metadataLength, false);
+            }
+
+            const BinaryPartition &part = partitions[rank];
+            file.WriteAt(part.m_idsOffset,  ids.size()  ? &ids[0]  : 0,
+                         part.m_numIds*sizeof(boost::uint32_t), true);
+            file.WriteAt(part.m_defsOffset, defs.c_str(),
+                         part.m_defsLength, true);
+            file.WriteAt(part.m_dataOffset, data.size() ? &data[0] : 0,
+                         part.m_numData*sizeof(NekDouble), true);
+        }
+
+
+        /**
+         * When @a ElementIDs is given, only the partitions containing these
+         * elements are read.
+         */
+        void FieldIO::ImportBinary(const std::string& infilename,
+                    std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                    std::vector<std::vector<NekDouble> > &fielddata,
+                    FieldMetaDataMap &fieldmetadatamap,
+                    const Array<OneD, int> ElementIDs)
+        {
+            unsigned int i;
+            boost::uint64_t j;
+            BinaryFieldFile file(m_comm, infilename, false);
+
+            std::vector<BinaryPartition> partitions;
+            std::string metadata;
+            ReadBinaryHeader(file, partitions, metadata);
+
+            TiXmlDocument metaDoc;
+            metaDoc.Parse(metadata.c_str());
+            ASSERTL0(!metaDoc.Error(), "Unable to parse metadata of binary "
+                     "field file: " + infilename);
+            ImportFieldMetaData(metaDoc, fieldmetadatamap);
+
+            // Determine which partitions to load.
+            std::set<int> loadPartitions;
+            if (ElementIDs == NullInt1DArray)
+            {
+                for (i = 0; i < partitions.size(); ++i)
+                {
+                    loadPartitions.insert(i);
+                }
+            }
+            else if (partitions.size() > 0)
+            {
+                boost::uint64_t numIds = 0;
+                for (i = 0; i < partitions.size(); ++i)
+                {
+                    numIds += partitions[i].m_numIds;
+                }
+
+                std::vector<boost::uint32_t> ids(numIds);
+                if (numIds > 0)
+                {
+                    file.ReadAt(partitions[0].m_idsOffset, &ids[0],
+                                numIds*sizeof(boost::uint32_t));
+                }
+
+                map<int,int> FileIDs;
+                boost::uint64_t cnt = 0;
+                for (i = 0; i < partitions.size(); ++i)
+                {
+                    for (j = 0; j < partitions[i].m_numIds; ++j)
+                    {
+                        FileIDs[ids[cnt++]] = i;
+                    }
+                }
+
+                for (i = 0; i < ElementIDs.num_elements(); ++i)
+                {
+                    ASSERTL1(FileIDs.count(ElementIDs[i]) != 0,
+                             "ElementIDs  not found in partitions");
+
+                    loadPartitions.insert(FileIDs[ElementIDs[i]]);
+                }
+            }
+
+            set<int>::iterator iter;
+            for (iter = loadPartitions.begin(); iter != loadPartitions.end();
+                 ++iter)
+            {
+                const BinaryPartition &part = partitions[*iter];
+                if (part.m_defsLength == 0)
+                {
+                    continue;
+                }
+
+                std::string defs(part.m_defsLength, '\0');
+                file.ReadAt(part.m_defsOffset, &defs[0], part.m_defsLength);
+
+                TiXmlDocument doc;
+                doc.Parse(defs.c_str());
+                ASSERTL0(!doc.Error(), "Unable to parse field definitions "
+                         "of binary field file: " + infilename);
+
+                unsigned int first = fielddefs.size();
+                ImportFieldDefs(doc, fielddefs, false);
+
+                if (fielddata != NullVectorNekDoubleVector)
+                {
+                    std::vector<NekDouble> data(part.m_numData);
+                    if (part.m_numData > 0)
+                    {
+                        file.ReadAt(part.m_dataOffset, &data[0],
+                                    part.m_numData*sizeof(NekDouble));
+                    }
+
+                    std::vector<NekDouble>::size_type offset = 0;
+                    for (i = first; i < fielddefs.size(); ++i)
+                    {
+                        int datasize = CheckFieldDefinition(fielddefs[i]) *
+                                       fielddefs[i]->m_fields.size();
+                        ASSERTL0(offset + datasize <= data.size(),
+                                 "Input data is not the same length as "
+                                 "header information");
+
+                        fielddata.push_back(std::vector<NekDouble>(
+                            data.begin() + offset,
+                            data.begin() + offset + datasize));
+                        offset += datasize;
+                    }
+
+                    ASSERTL0(offset == data.size(),
+                             "Input data is not the same length as header "
+                             "information");
+                }
+            }
+        }
+
+
+        /**
+         * Checks for the identifier written at the start of binary field
+         * files. Directories (the parallel XML format) are never binary.
+         */
+        bool FieldIO::IsBinaryFile(const std::string &filename)
+        {
+            fs::path pfilename(filename);
+            if (!fs::exists(pfilename) || fs::is_directory(pfilename))
+            {
+                return false;
+            }
+
+            std::ifstream file(filename.c_str(), std::ios::binary);
+            char magic[8];
+            file.read(magic, 8);
+
+            return file.gcount() == 8 && memcmp(magic, kBinaryMagic, 8) == 0;
+        }
+
+
         /**
          *
          */
@@ -604,6 +1142,23 @@ namespace Nektar
         void FieldIO::ImportFieldMetaData(std::string filename,
                                  FieldMetaDataMap &fieldmetadatamap)
         {
+            if (IsBinaryFile(filename))
+            {
+                // Only the header is read, so this need not be collective.
+                BinaryFieldFile file(CommSharedPtr(), filename, false);
+                std::vector<BinaryPartition> partitions;
+                std::string metadata;
+                ReadBinaryHeader(file, partitions, metadata);
+
+                TiXmlDocument doc;
+                doc.Parse(metadata.c_str());
+                ASSERTL0(!doc.Error(), "Unable to parse metadata of binary "
+                         "field file: " + filename);
+
+                ImportFieldMetaData(doc,fieldmetadatamap);
+                return;
+            }
+
             TiXmlDocument doc(filename);
             bool loadOkay = doc.LoadFile();
             
@@ -130,6 +130,13 @@ namespace Nektar
         
         typedef boost::shared_ptr<FieldDefinitions> FieldDefinitionsSharedPtr;
 
+        /// Storage formats of field files.
+        enum FieldIOFormat
+        {
+            eFieldIOXml,        ///< XML file per process with Info.xml.
+            eFieldIOBinary      ///< Single binary file written collectively.
+        };
+
 
         /// Write a field file in serial only
         LIB_UTILITIES_EXPORT void Write(
@@ -153,7 +160,22 @@ namespace Nektar
             public:
                 /// Constructor
                 LIB_UTILITIES_EXPORT FieldIO(
-                        LibUtilities::CommSharedPtr pComm);
+                        LibUtilities::CommSharedPtr pComm,
+                        FieldIOFormat pFormat = eFieldIOXml);
+
+                /// Constructor using the IOFormat solver info of a session.
+                LIB_UTILITIES_EXPORT FieldIO(
+                        const LibUtilities::SessionReaderSharedPtr &pSession);
+
+                /// Sets the format used by Write.
+                inline void SetFormat(FieldIOFormat pFormat);
+
+                /// Returns the format used by Write.
+                inline FieldIOFormat GetFormat() const;
+
+                /// Determines if a file is in the binary field format.
+                LIB_UTILITIES_EXPORT static bool IsBinaryFile(
+                        const std::string &filename);
 
                 /// Write data in FLD format
                 LIB_UTILITIES_EXPORT void Write(
@@ -196,6 +218,26 @@ namespace Nektar
                 /// Communicator to use when writing parallel format
                 LibUtilities::CommSharedPtr    m_comm;
 
+                /// Format used when writing files
+                FieldIOFormat                  m_format;
+
+                LIB_UTILITIES_EXPORT TiXmlElement *WriteFieldDefinition(
+                        TiXmlElement * root,
+                        const FieldDefinitionsSharedPtr &fielddef);
+
+                LIB_UTILITIES_EXPORT void WriteBinary(
+                        const std::string &outFile,
+                        std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                        std::vector<std::vector<NekDouble> >   &fielddata,
+                        const FieldMetaDataMap &fieldinfomap);
+
+                LIB_UTILITIES_EXPORT void ImportBinary(
+                        const std::string& infilename,
+                        std::vector<FieldDefinitionsSharedPtr> &fielddefs,
+                        std::vector<std::vector<NekDouble> > &fielddata,
+                        FieldMetaDataMap &fieldinfomap,
+                        const Array<OneD, int> ElementIDs);
+
                 LIB_UTILITIES_EXPORT void AddInfoTag(
                         TiXmlElement * root,
                         const FieldMetaDataMap &fieldmetadatamap);
@@ -233,6 +275,16 @@ namespace Nektar
         };
 
         typedef boost::shared_ptr<FieldIO> FieldIOSharedPtr;
+
+        inline void FieldIO::SetFormat(FieldIOFormat pFormat)
+        {
+            m_format = pFormat;
+        }
+
+        inline FieldIOFormat FieldIO::GetFormat() const
+        {
+            return m_format;
+        }
     }
 }
 #endif
@@ -0,0 +1,133 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File MeshEntities.hpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Records of mesh entities as stored in the compressed
+// sections of the GEOMETRY tag.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_MESHENTITIES_HPP
+#define NEKTAR_LIB_UTILITIES_BASIC_UTILS_MESHENTITIES_HPP
+
+#include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        /**
+         * The records below define the binary layout of the compressed
+         * VERTEX, EDGE, FACE, ELEMENT and CURVED sections of a mesh. Each
+         * section (or each shape tag within it) holds an array of records
+         * which is written and read in a single block, so the layout of
+         * these structures must not change.
+         */
+
+        /// Vertex of the mesh. The explicit padding field keeps the
+        /// coordinates aligned and is always written as zero, so that no
+        /// uninitialised bytes end up in the compressed data.
+        struct MeshVertex
+        {
+            int       id;
+            int       pad;
+            NekDouble x;
+            NekDouble y;
+            NekDouble z;
+        };
+
+        /// Edge given by its two vertices; also used for 1D segments.
+        struct MeshEdge
+        {
+            int id;
+            int v0;
+            int v1;
+        };
+
+        /// Triangle given by its three edges.
+        struct MeshTri
+        {
+            int id;
+            int e[3];
+        };
+
+        /// Quadrilateral given by its four edges.
+        struct MeshQuad
+        {
+            int id;
+            int e[4];
+        };
+
+        /// Tetrahedron given by its four faces.
+        struct MeshTet
+        {
+            int id;
+            int f[4];
+        };
+
+        /// Pyramid given by its five faces.
+        struct MeshPyr
+        {
+            int id;
+            int f[5];
+        };
+
+        /// Prism given by its five faces.
+        struct MeshPrism
+        {
+            int id;
+            int f[5];
+        };
+
+        /// Hexahedron given by its six faces.
+        struct MeshHex
+        {
+            int id;
+            int f[6];
+        };
+
+        /**
+         * Curvature of an edge or face. The @a npoints points of the curve
+         * are stored as (x,y,z) triples in the POINTS tag of the CURVED
+         * section, starting at point @a ptoffset. The points distribution
+         * @a ptype is a LibUtilities::PointsType.
+         */
+        struct MeshCurvedInfo
+        {
+            int id;
+            int entityid;
+            int npoints;
+            int ptoffset;
+            int ptype;
+        };
+    }
+}
+
+#endif
@@ -52,6 +52,8 @@
 #include <LibUtilities/BasicUtils/SessionReader.h>
 #include <LibUtilities/BasicUtils/ShapeType.hpp>
 #include <LibUtilities/BasicUtils/FileSystem.h>
+#include <LibUtilities/BasicUtils/CompressData.h>
+#include <LibUtilities/Foundations/Foundations.hpp>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/graph/adjacency_list.hpp>
@@ -155,6 +157,33 @@ namespace Nektar
             }
         }
 
+        /**
+         * Generates the session document of a single partition as a string,
+         * so that it may be sent to another process rather than written to
+         * disk.
+         */
+        void MeshPartition::GetPartitionXml(
+                LibUtilities::SessionReaderSharedPtr& pSession,
+                int                                   pPart,
+                std::string&                          pXml)
+        {
+            TiXmlDocument vNew;
+            TiXmlDeclaration * decl = new TiXmlDeclaration("1.0", "utf-8", "");
+            vNew.LinkEndChild(decl);
+
+            TiXmlElement* vElmtNektar;
+            vElmtNektar = new TiXmlElement("NEKTAR");
+
+            OutputPartition(pSession, m_localPartition[pPart], vElmtNektar);
+
+            vNew.LinkEndChild(vElmtNektar);
+
+            TiXmlPrinter printer;
+            printer.SetIndent("");
+            vNew.Accept(&printer);
+            pXml = printer.CStr();
+        }
+
         void MeshPartition::GetCompositeOrdering(CompositeOrdering &composites)
         {
             std::map<int, MeshEntity>::iterator it;
@@ -298,135 +327,308 @@ namespace Nektar
                 }
             }
 
-            x = vSubElement->FirstChildElement();
-            i = 0;
-            while(x)
+            if (CompressData::IsCompressed(vSubElement))
             {
-                TiXmlAttribute* y = x->FirstAttribute();
-                ASSERTL0(y, "Failed to get attribute.");
-                MeshVertex v;
-                v.id = y->IntValue();
-                ASSERTL0(v.id == i++, "Vertex IDs not sequential.");
-                std::vector<std::string> vCoords;
-                std::string vCoordStr = x->FirstChild()->ToText()->Value();
-                boost::split(vCoords, vCoordStr, boost::is_any_of("\t "));
-                v.x = atof(vCoords[0].c_str());
-                v.y = atof(vCoords[1].c_str());
-                v.z = atof(vCoords[2].c_str());
-                m_meshVertices[v.id] = v;
-                x = x->NextSiblingElement();
+                std::vector<MeshVertex> vertData;
+                CompressData::ReadCompressedData(vSubElement, vertData);
+                for (i = 0; i < vertData.size(); ++i)
+                {
+                    ASSERTL0(vertData[i].id == i, "Vertex IDs not sequential.");
+                    m_meshVertices[i] = vertData[i];
+                }
             }
-
-            // Read mesh edges
-            if (m_dim >= 2)
+            else
             {
-                vSubElement = pSession->GetElement("Nektar/Geometry/Edge");
-                ASSERTL0(vSubElement, "Cannot read edges");
                 x = vSubElement->FirstChildElement();
                 i = 0;
                 while(x)
                 {
                     TiXmlAttribute* y = x->FirstAttribute();
                     ASSERTL0(y, "Failed to get attribute.");
-                    MeshEntity e;
-                    e.id = y->IntValue();
-                    e.type = 'E';
-                    ASSERTL0(e.id == i++, "Edge IDs not sequential.");
-                    std::vector<std::string> vVertices;
-                    std::string vVerticesString = x->FirstChild()->ToText()->Value();
-                    boost::split(vVertices, vVerticesString, boost::is_any_of("\t "));
-                    e.list.push_back(atoi(vVertices[0].c_str()));
-                    e.list.push_back(atoi(vVertices[1].c_str()));
-                    m_meshEdges[e.id] = e;
+                    MeshVertex v;
+                    v.id  = y->IntValue();
+                    v.pad = 0;
+                    ASSERTL0(v.id == i++, "Vertex IDs not sequential.");
+                    std::vector<std::string> vCoords;
+                    std::string vCoordStr = x->FirstChild()->ToText()->Value();
+                    boost::split(vCoords, vCoordStr, boost::is_any_of("\t "));
+                    v.x = atof(vCoords[0].c_str());
+                    v.y = atof(vCoords[1].c_str());
+                    v.z = atof(vCoords[2].c_str());
+                    m_meshVertices[v.id] = v;
                     x = x->NextSiblingElement();
                 }
             }
 
+            // Read mesh edges
+            if (m_dim >= 2)
+            {
+                vSubElement = pSession->GetElement("Nektar/Geometry/Edge");
+                ASSERTL0(vSubElement, "Cannot read edges");
+                if (CompressData::IsCompressed(vSubElement))
+                {
+                    std::vector<MeshEdge> edgeData;
+                    CompressData::ReadCompressedData(vSubElement, edgeData);
+                    for (i = 0; i < edgeData.size(); ++i)
+                    {
+                        ASSERTL0(edgeData[i].id == i, "Edge IDs not sequential.");
+                        MeshEntity e;
+                        e.id = i;
+                        e.type = 'E';
+                        e.list.push_back(edgeData[i].v0);
+                        e.list.push_back(edgeData[i].v1);
+                        m_meshEdges[e.id] = e;
+                    }
+                }
+                else
+                {
+                    x = vSubElement->FirstChildElement();
+                    i = 0;
+                    while(x)
+                    {
+                        TiXmlAttribute* y = x->FirstAttribute();
+                        ASSERTL0(y, "Failed to get attribute.");
+                        MeshEntity e;
+                        e.id = y->IntValue();
+                        e.type = 'E';
+                        ASSERTL0(e.id == i++, "Edge IDs not sequential.");
+                        std::vector<std::string> vVertices;
+                        std::string vVerticesString = x->FirstChild()->ToText()->Value();
+                        boost::split(vVertices, vVerticesString, boost::is_any_of("\t "));
+                        e.list.push_back(atoi(vVertices[0].c_str()));
+                        e.list.push_back(atoi(vVertices[1].c_str()));
+                        m_meshEdges[e.id] = e;
+                        x = x->NextSiblingElement();
+                    }
+                }
+            }
+
             // Read mesh faces
             if (m_dim == 3)
             {
                 vSubElement = pSession->GetElement("Nektar/Geometry/Face");
                 ASSERTL0(vSubElement, "Cannot read faces.");
-                x = vSubElement->FirstChildElement();
-                i = 0;
-                while(x)
+                if (CompressData::IsCompressed(vSubElement))
                 {
-                    TiXmlAttribute* y = x->FirstAttribute();
-                    ASSERTL0(y, "Failed to get attribute.");
-                    MeshEntity f;
-                    f.id = y->IntValue();
-                    f.type = x->Value()[0];
-                    ASSERTL0(f.id == i++, "Face IDs not sequential.");
-                    std::vector<std::string> vEdges;
-                    std::string vEdgeStr = x->FirstChild()->ToText()->Value();
-                    boost::split(vEdges, vEdgeStr, boost::is_any_of("\t "));
-                    for (int i = 0; i < vEdges.size(); ++i)
+                    x = vSubElement->FirstChildElement();
+                    while(x)
+                    {
+                        std::string vType = x->ValueStr();
+                        if (vType == "T")
+                        {
+                            std::vector<MeshTri> triData;
+                            CompressData::ReadCompressedData(x, triData);
+                            ReadCompressedEntities(triData, &MeshTri::e, 'T', m_meshFaces);
+                        }
+                        else if (vType == "Q")
+                        {
+                            std::vector<MeshQuad> quadData;
+                            CompressData::ReadCompressedData(x, quadData);
+                            ReadCompressedEntities(quadData, &MeshQuad::e, 'Q', m_meshFaces);
+                        }
+                        else
+                        {
+                            ASSERTL0(false, "Unknown face type: " + vType);
+                        }
+                        x = x->NextSiblingElement();
+                    }
+                    CheckSequential(m_meshFaces, "Face");
+                }
+                else
+                {
+                    x = vSubElement->FirstChildElement();
+                    i = 0;
+                    while(x)
                     {
-                        f.list.push_back(atoi(vEdges[i].c_str()));
+                        TiXmlAttribute* y = x->FirstAttribute();
+                        ASSERTL0(y, "Failed to get attribute.");
+                        MeshEntity f;
+                        f.id = y->IntValue();
+                        f.type = x->Value()[0];
+                        ASSERTL0(f.id == i++, "Face IDs not sequential.");
+                        std::vector<std::string> vEdges;
+                        std::string vEdgeStr = x->FirstChild()->ToText()->Value();
+                        boost::split(vEdges, vEdgeStr, boost::is_any_of("\t "));
+                        for (int i = 0; i < vEdges.size(); ++i)
+                        {
+                            f.list.push_back(atoi(vEdges[i].c_str()));
+                        }
+                        m_meshFaces[f.id] = f;
+                        x = x->NextSiblingElement();
                     }
-                    m_meshFaces[f.id] = f;
-                    x = x->NextSiblingElement();
                 }
             }
 
             // Read mesh elements
             vSubElement = pSession->GetElement("Nektar/Geometry/Element");
             ASSERTL0(vSubElement, "Cannot read elements.");
-            x = vSubElement->FirstChildElement();
-            i = 0;
-            while(x)
+            if (CompressData::IsCompressed(vSubElement))
             {
-                TiXmlAttribute* y = x->FirstAttribute();
-                ASSERTL0(y, "Failed to get attribute.");
-                MeshEntity e;
-                e.id = y->IntValue();
-                ASSERTL0(e.id == i++, "Element IDs not sequential.");
-                std::vector<std::string> vItems;
-                std::string vItemStr = x->FirstChild()->ToText()->Value();
-                boost::split(vItems, vItemStr, boost::is_any_of("\t "));
-                for (int i = 0; i < vItems.size(); ++i)
+                x = vSubElement->FirstChildElement();
+                while(x)
                 {
-                    e.list.push_back(atoi(vItems[i].c_str()));
+                    std::string vType = x->ValueStr();
+                    if (vType == "S")
+                    {
+                        std::vector<MeshEdge> segData;
+                        CompressData::ReadCompressedData(x, segData);
+                        for (i = 0; i < segData.size(); ++i)
+                        {
+                            MeshEntity e;
+                            e.id = segData[i].id;
+                            e.type = 'S';
+                            e.list.push_back(segData[i].v0);
+                            e.list.push_back(segData[i].v1);
+                            m_meshElements[e.id] = e;
+                        }
+                    }
+                    else if (vType == "T")
+                    {
+                        std::vector<MeshTri> triData;
+                        CompressData::ReadCompressedData(x, triData);
+                        ReadCompressedEntities(triData, &MeshTri::e, 'T', m_meshElements);
+                    }
+                    else if (vType == "Q")
+                    {
+                        std::vector<MeshQuad> quadData;
+                        CompressData::ReadCompressedData(x, quadData);
+                        ReadCompressedEntities(quadData, &MeshQuad::e, 'Q', m_meshElements);
+                    }
+                    else if (vType == "A")
+                    {
+                        std::vector<MeshTet> tetData;
+                        CompressData::ReadCompressedData(x, tetData);
+                        ReadCompressedEntities(tetData, &MeshTet::f, 'A', m_meshElements);
+                    }
+                    else if (vType == "P")
+                    {
+                        std::vector<MeshPyr> pyrData;
+                        CompressData::ReadCompressedData(x, pyrData);
+                        ReadCompressedEntities(pyrData, &MeshPyr::f, 'P', m_meshElements);
+                    }
+                    else if (vType == "R")
+                    {
+                        std::vector<MeshPrism> prismData;
+                        CompressData::ReadCompressedData(x, prismData);
+                        ReadCompressedEntities(prismData, &MeshPrism::f, 'R', m_meshElements);
+                    }
+                    else if (vType == "H")
+                    {
+                        std::vector<MeshHex> hexData;
+                        CompressData::ReadCompressedData(x, hexData);
+                        ReadCompressedEntities(hexData, &MeshHex::f, 'H', m_meshElements);
+                    }
+                    else
+                    {
+                        ASSERTL0(false, "Unknown element type: " + vType);
+                    }
+                    x = x->NextSiblingElement();
                 }
-                e.type = x->Value()[0];
-                m_meshElements[e.id] = e;
-                x = x->NextSiblingElement();
+                CheckSequential(m_meshElements, "Element");
             }
-
-            // Read mesh curves
-            if (pSession->DefinesElement("Nektar/Geometry/Curved"))
+            else
             {
-                vSubElement = pSession->GetElement("Nektar/Geometry/Curved");
                 x = vSubElement->FirstChildElement();
                 i = 0;
                 while(x)
                 {
-                    MeshCurved c;
-                    ASSERTL0(x->Attribute("ID", &c.id),
-                             "Failed to get attribute ID");
-                    c.type = std::string(x->Attribute("TYPE"));
-                    ASSERTL0(!c.type.empty(),
-                             "Failed to get attribute TYPE");
-                    ASSERTL0(x->Attribute("NUMPOINTS", &c.npoints),
-                             "Failed to get attribute NUMPOINTS");
-                    c.data = x->FirstChild()->ToText()->Value();
-                    c.entitytype = x->Value()[0];
-                    if (c.entitytype == "E")
+                    TiXmlAttribute* y = x->FirstAttribute();
+                    ASSERTL0(y, "Failed to get attribute.");
+                    MeshEntity e;
+                    e.id = y->IntValue();
+                    ASSERTL0(e.id == i++, "Element IDs not sequential.");
+                    std::vector<std::string> vItems;
+                    std::string vItemStr = x->FirstChild()->ToText()->Value();
+                    boost::split(vItems, vItemStr, boost::is_any_of("\t "));
+                    for (int i = 0; i < vItems.size(); ++i)
                     {
-                        ASSERTL0(x->Attribute("EDGEID", &c.entityid),
-                             "Failed to get attribute EDGEID");
+                        e.list.push_back(atoi(vItems[i].c_str()));
                     }
-                    else if (c.entitytype == "F")
+                    e.type = x->Value()[0];
+                    m_meshElements[e.id] = e;
+                    x = x->NextSiblingElement();
+                }
+            }
+
+            // Read mesh curves
+            if (pSession->DefinesElement("Nektar/Geometry/Curved"))
+            {
+                vSubElement = pSession->GetElement("Nektar/Geometry/Curved");
+                if (CompressData::IsCompressed(vSubElement))
+                {
+                    std::vector<MeshCurvedInfo> edgeInfo;
+                    std::vector<MeshCurvedInfo> faceInfo;
+                    std::vector<NekDouble>      points;
+
+                    x = vSubElement->FirstChildElement();
+                    while(x)
                     {
-                        ASSERTL0(x->Attribute("FACEID", &c.entityid),
-                             "Failed to get attribute FACEID");
+                        std::string vType = x->ValueStr();
+                        if (vType == "E")
+                        {
+                            CompressData::ReadCompressedData(x, edgeInfo);
+                        }
+                        else if (vType == "F")
+                        {
+                            CompressData::ReadCompressedData(x, faceInfo);
+                        }
+                        else if (vType == "POINTS")
+                        {
+                            CompressData::ReadCompressedData(x, points);
+                        }
+                        else
+                        {
+                            ASSERTL0(false, "Unknown curve type.");
+                        }
+                        x = x->NextSiblingElement();
                     }
-                    else
+
+                    ReadCompressedCurves(edgeInfo, "E", points);
+                    ReadCompressedCurves(faceInfo, "F", points);
+                }
+                else
+                {
+                    x = vSubElement->FirstChildElement();
+                    while(x)
                     {
-                        ASSERTL0(false, "Unknown curve type.");
+                        MeshCurved c;
+                        int npoints;
+                        ASSERTL0(x->Attribute("ID", &c.id),
+                                 "Failed to get attribute ID");
+                        c.type = std::string(x->Attribute("TYPE"));
+                        ASSERTL0(!c.type.empty(),
+                                 "Failed to get attribute TYPE");
+                        ASSERTL0(x->Attribute("NUMPOINTS", &npoints),
+                                 "Failed to get attribute NUMPOINTS");
+                        c.entitytype = x->Value()[0];
+                        if (c.entitytype == "E")
+                        {
+                            ASSERTL0(x->Attribute("EDGEID", &c.entityid),
+                                 "Failed to get attribute EDGEID");
+                        }
+                        else if (c.entitytype == "F")
+                        {
+                            ASSERTL0(x->Attribute("FACEID", &c.entityid),
+                                 "Failed to get attribute FACEID");
+                        }
+                        else
+                        {
+                            ASSERTL0(false, "Unknown curve type.");
+                        }
+
+                        std::istringstream vPointsStrm(
+                            x->FirstChild()->ToText()->Value());
+                        NekDouble vCoord;
+                        while (vPointsStrm >> vCoord)
+                        {
+                            c.points.push_back(vCoord);
+                        }
+                        ASSERTL0(c.points.size() % 3 == 0,
+                                 "Curve points must have three coordinates.");
+
+                        m_meshCurved[std::make_pair(c.entitytype, c.id)] = c;
+                        x = x->NextSiblingElement();
                     }
-                    m_meshCurved[std::make_pair(c.entitytype, c.id)] = c;
-                    x = x->NextSiblingElement();
                 }
             }
 
@@ -469,6 +671,120 @@ namespace Nektar
         }
 
 
+        /**
+         * Converts the records of one shape in a compressed FACE or ELEMENT
+         * section into mesh entities of type @a pType, given by the list
+         * @a pList of each record.
+         */
+        template<class T, int N>
+        void MeshPartition::ReadCompressedEntities(
+                const std::vector<T>      &pData,
+                int                       (T::*pList)[N],
+                char                       pType,
+                std::map<int, MeshEntity> &pEntities)
+        {
+            for (int i = 0; i < pData.size(); ++i)
+            {
+                MeshEntity e;
+                e.id   = pData[i].id;
+                e.type = pType;
+                e.list.assign(pData[i].*pList, pData[i].*pList + N);
+                ASSERTL0(pEntities.insert(std::make_pair(e.id, e)).second,
+                         "Duplicate ID " +
+                         boost::lexical_cast<std::string>(e.id) +
+                         " in compressed data.");
+            }
+        }
+
+        /**
+         * Writes the entities of type @a pType as a compressed child of
+         * @a pParent, if there are any, and returns their number.
+         */
+        template<class T, int N>
+        int MeshPartition::WriteCompressedEntities(
+                const std::map<int, MeshEntity> &pEntities,
+                int                             (T::*pList)[N],
+                char                             pType,
+                TiXmlElement                    *pParent)
+        {
+            std::vector<T> vData;
+            std::map<int, MeshEntity>::const_iterator vIt;
+            for (vIt = pEntities.begin(); vIt != pEntities.end(); ++vIt)
+            {
+                if (vIt->second.type != pType)
+                {
+                    continue;
+                }
+
+                ASSERTL0(vIt->second.list.size() == N,
+                         "Entity " + boost::lexical_cast<std::string>(
+                             vIt->first) + " has the wrong number of items.");
+
+                T vRecord;
+                vRecord.id = vIt->first;
+                std::copy(vIt->second.list.begin(), vIt->second.list.end(),
+                          vRecord.*pList);
+                vData.push_back(vRecord);
+            }
+
+            if (vData.size() > 0)
+            {
+                TiXmlElement *x = new TiXmlElement(std::string(1, pType));
+                CompressData::WriteCompressedData(x, vData);
+                pParent->LinkEndChild(x);
+            }
+
+            return vData.size();
+        }
+
+        /**
+         * Compressed sections are split by shape, so the IDs of the entities
+         * can only be checked once all shapes are read.
+         */
+        void MeshPartition::CheckSequential(
+                const std::map<int, MeshEntity> &pEntities,
+                const std::string               &pName)
+        {
+            int i = 0;
+            std::map<int, MeshEntity>::const_iterator vIt;
+            for (vIt = pEntities.begin(); vIt != pEntities.end(); ++vIt)
+            {
+                ASSERTL0(vIt->first == i++, pName + " IDs not sequential.");
+            }
+        }
+
+        /**
+         * Stores the curves described by @a pInfo, whose points lie in
+         * @a pPoints.
+         */
+        void MeshPartition::ReadCompressedCurves(
+                const std::vector<MeshCurvedInfo> &pInfo,
+                const std::string                 &pEntityType,
+                const std::vector<NekDouble>      &pPoints)
+        {
+            for (int i = 0; i < pInfo.size(); ++i)
+            {
+                ASSERTL0(pInfo[i].ptype >= 0 &&
+                         pInfo[i].ptype < SIZE_PointsType,
+                         "Invalid points type.");
+                ASSERTL0(3 * ((size_t)pInfo[i].ptoffset + pInfo[i].npoints)
+                             <= pPoints.size(),
+                         "Curve points lie outside the POINTS data.");
+
+                MeshCurved c;
+                c.id         = pInfo[i].id;
+                c.entitytype = pEntityType;
+                c.entityid   = pInfo[i].entityid;
+                c.type       = kPointsTypeStr[pInfo[i].ptype];
+                c.points.assign(
+                    pPoints.begin() + 3 * (size_t)pInfo[i].ptoffset,
+                    pPoints.begin() + 3 * ((size_t)pInfo[i].ptoffset
+                                           + pInfo[i].npoints));
+                m_meshCurved[std::make_pair(c.entitytype, c.id)] = c;
+            }
+        }
+
+
         void MeshPartition::ReadConditions(const SessionReaderSharedPtr& pSession)
         {
             if (!pSession->DefinesElement("Nektar/Conditions/SolverInfo"))
@@ -884,20 +1200,15 @@ namespace Nektar
                 }
             }
 
-            // Generate XML data for these mesh entities
+            // Generate XML data for these mesh entities. Partitions are only
+            // read by the solvers, so the entities are always compressed.
+            std::vector<MeshVertex> vVertexData;
             for (vVertIt = vVertices.begin(); vVertIt != vVertices.end(); vVertIt++)
             {
-                x = new TiXmlElement("V");
-                x->SetAttribute("ID", vVertIt->first);
-                std::stringstream vCoords;
-                vCoords.precision(12);
-                vCoords << std::setw(15) << vVertIt->second.x
-                        << std::setw(15) << vVertIt->second.y
-                        << std::setw(15) << vVertIt->second.z << " ";
-                y = new TiXmlText(vCoords.str());
-                x->LinkEndChild(y);
-                vVertex->LinkEndChild(x);
+                vVertexData.push_back(vVertIt->second);
+                vVertexData.back().pad = 0;
             }
+            CompressData::WriteCompressedData(vVertex, vVertexData);
 
             // Apply transformation attributes to VERTEX section
             for (vAttrIt  = m_vertexAttributes.begin();
@@ -909,84 +1220,120 @@ namespace Nektar
 
             if (m_dim >= 2)
             {
+                std::vector<MeshEdge> vEdgeData;
                 for (vIt = vEdges.begin(); vIt != vEdges.end(); vIt++)
                 {
-                    x = new TiXmlElement("E");
-                    x->SetAttribute("ID", vIt->first);
-                    std::stringstream vVertices;
-                    vVertices << std::setw(10) << vIt->second.list[0]
-                            << std::setw(10) << vIt->second.list[1] << " ";
-                    y = new TiXmlText(vVertices.str());
-                    x->LinkEndChild(y);
-                    vEdge->LinkEndChild(x);
+                    MeshEdge e;
+                    e.id = vIt->first;
+                    e.v0 = vIt->second.list[0];
+                    e.v1 = vIt->second.list[1];
+                    vEdgeData.push_back(e);
                 }
+                CompressData::WriteCompressedData(vEdge, vEdgeData);
             }
 
             if (m_dim >= 3)
             {
-                for (vIt = vFaces.begin(); vIt != vFaces.end(); vIt++)
-                {
-                    std::string vType("F");
-                    vType[0] = vIt->second.type;
-                    x = new TiXmlElement(vType);
-                    x->SetAttribute("ID", vIt->first);
-                    std::stringstream vListStr;
-                    for (unsigned int i = 0; i < vIt->second.list.size(); ++i)
-                    {
-                        vListStr << std::setw(10) << vIt->second.list[i];
-                    }
-                    vListStr << " ";
-                    y = new TiXmlText(vListStr.str());
-                    x->LinkEndChild(y);
-                    vFace->LinkEndChild(x);
-                }
+                vFace->SetAttribute("COMPRESSED",
+                                    CompressData::GetCompressString());
+                int nFaces =
+                    WriteCompressedEntities(vFaces, &MeshTri::e,  'T', vFace) +
+                    WriteCompressedEntities(vFaces, &MeshQuad::e, 'Q', vFace);
+                ASSERTL0(nFaces == vFaces.size(), "Unknown face type.");
             }
 
-            for (vIt = vElements.begin(); vIt != vElements.end(); vIt++)
+            vElement->SetAttribute("COMPRESSED",
+                                   CompressData::GetCompressString());
+            int nElements = 0;
+            switch (m_dim)
             {
-                std::string vType("T");
-                vType[0] = vIt->second.type;
-                x = new TiXmlElement(vType.c_str());
-                x->SetAttribute("ID", vIt->first);
-                std::stringstream vEdges;
-                for (unsigned i = 0; i < vIt->second.list.size(); ++i)
+                case 1:
                 {
-                    vEdges << std::setw(10) << vIt->second.list[i];
+                    std::vector<MeshEdge> vSegData;
+                    for (vIt = vElements.begin(); vIt != vElements.end(); vIt++)
+                    {
+                        MeshEdge e;
+                        e.id = vIt->first;
+                        e.v0 = vIt->second.list[0];
+                        e.v1 = vIt->second.list[1];
+                        vSegData.push_back(e);
+                    }
+                    x = new TiXmlElement("S");
+                    CompressData::WriteCompressedData(x, vSegData);
+                    vElement->LinkEndChild(x);
+                    nElements = vSegData.size();
+                    break;
                 }
-                vEdges << " ";
-                y = new TiXmlText(vEdges.str());
-                x->LinkEndChild(y);
-                vElement->LinkEndChild(x);
+                case 2:
+                    nElements =
+                        WriteCompressedEntities(vElements, &MeshTri::e,  'T', vElement) +
+                        WriteCompressedEntities(vElements, &MeshQuad::e, 'Q', vElement);
+                    break;
+                case 3:
+                    nElements =
+                        WriteCompressedEntities(vElements, &MeshTet::f,   'A', vElement) +
+                        WriteCompressedEntities(vElements, &MeshPyr::f,   'P', vElement) +
+                        WriteCompressedEntities(vElements, &MeshPrism::f, 'R', vElement) +
+                        WriteCompressedEntities(vElements, &MeshHex::f,   'H', vElement);
+                    break;
             }
+            ASSERTL0(nElements == vElements.size(), "Unknown element type.");
 
             if (m_dim >= 2)
             {
+                std::vector<MeshCurvedInfo> vEdgeInfo;
+                std::vector<MeshCurvedInfo> vFaceInfo;
+                std::vector<NekDouble>      vPoints;
+
                 std::map<MeshCurvedKey, MeshCurved>::const_iterator vItCurve;
                 for (vItCurve  = m_meshCurved.begin(); 
                      vItCurve != m_meshCurved.end(); 
                      ++vItCurve)
                 {
-                    MeshCurved c = vItCurve->second;
-                    
-                    if (vEdges.find(c.entityid) != vEdges.end() || 
-                        vFaces.find(c.entityid) != vFaces.end())
+                    const MeshCurved &c = vItCurve->second;
+                    bool isEdge = c.entitytype == "E";
+
+                    if (( isEdge && vEdges.find(c.entityid) == vEdges.end()) ||
+                        (!isEdge && vFaces.find(c.entityid) == vFaces.end()))
                     {
-                        x = new TiXmlElement(c.entitytype);
-                        x->SetAttribute("ID", c.id);
-                        if (c.entitytype == "E")
-                        {
-                            x->SetAttribute("EDGEID", c.entityid);
-                        }
-                        else
-                        {
-                            x->SetAttribute("FACEID", c.entityid);
-                        }
-                        x->SetAttribute("TYPE", c.type);
-                        x->SetAttribute("NUMPOINTS", c.npoints);
-                        y = new TiXmlText(c.data);
-                        x->LinkEndChild(y);
-                        vCurved->LinkEndChild(x);
+                        continue;
                     }
+
+                    const std::string *begStr = kPointsTypeStr;
+                    const std::string *endStr = kPointsTypeStr + SIZE_PointsType;
+                    const std::string *ptsStr = std::find(begStr, endStr, c.type);
+                    ASSERTL0(ptsStr != endStr, "Invalid points type.");
+
+                    MeshCurvedInfo cinfo;
+                    cinfo.id       = c.id;
+                    cinfo.entityid = c.entityid;
+                    cinfo.npoints  = c.points.size() / 3;
+                    cinfo.ptoffset = vPoints.size() / 3;
+                    cinfo.ptype    = ptsStr - begStr;
+                    vPoints.insert(vPoints.end(), c.points.begin(), c.points.end());
+
+                    (isEdge ? vEdgeInfo : vFaceInfo).push_back(cinfo);
+                }
+
+                vCurved->SetAttribute("COMPRESSED",
+                                      CompressData::GetCompressString());
+                if (vEdgeInfo.size() > 0)
+                {
+                    x = new TiXmlElement("E");
+                    CompressData::WriteCompressedData(x, vEdgeInfo);
+                    vCurved->LinkEndChild(x);
+                }
+                if (vFaceInfo.size() > 0)
+                {
+                    x = new TiXmlElement("F");
+                    CompressData::WriteCompressedData(x, vFaceInfo);
+                    vCurved->LinkEndChild(x);
+                }
+                if (vPoints.size() > 0)
+                {
+                    x = new TiXmlElement("POINTS");
+                    CompressData::WriteCompressedData(x, vPoints);
+                    vCurved->LinkEndChild(x);
                 }
             }
 
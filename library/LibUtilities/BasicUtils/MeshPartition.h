@@ -39,6 +39,7 @@
 #include <boost/graph/subgraph.hpp>
 #include <boost/graph/adjacency_list.hpp>
 #include <LibUtilities/Communication/Comm.h>
+#include <LibUtilities/BasicUtils/MeshEntities.hpp>
 
 class TiXmlElement;
 
@@ -63,6 +64,10 @@ namespace Nektar
                     SessionReaderSharedPtr& pSession);
             LIB_UTILITIES_EXPORT void WriteAllPartitions(
                     SessionReaderSharedPtr& pSession);
+            LIB_UTILITIES_EXPORT void GetPartitionXml(
+                    SessionReaderSharedPtr& pSession,
+                    int                     pPart,
+                    std::string&            pXml);
 
             LIB_UTILITIES_EXPORT void GetCompositeOrdering(
                     CompositeOrdering &composites);
@@ -77,21 +82,6 @@ namespace Nektar
                 std::vector<unsigned int> list;
             };
 
-            struct MeshVertex
-            {
-                int id;
-                NekDouble x;
-                NekDouble y;
-                NekDouble z;
-            };
-
-            struct MeshEdge
-            {
-                int id;
-                int v0;
-                int v1;
-            };
-
             struct MeshFace
             {
                 int id;
@@ -111,8 +101,7 @@ namespace Nektar
                 std::string entitytype;
                 int entityid;
                 std::string type;
-                int npoints;
-                std::string data;
+                std::vector<NekDouble> points;
             };
             typedef std::pair<std::string, int> MeshCurvedKey;
             
@@ -208,6 +197,10 @@ namespace Nektar
 
             void ReadExpansions(const SessionReaderSharedPtr& pSession);
             void ReadGeometry(const SessionReaderSharedPtr& pSession);
+            void ReadCompressedCurves(
+                    const std::vector<MeshCurvedInfo> &pInfo,
+                    const std::string                 &pEntityType,
+                    const std::vector<NekDouble>      &pPoints);
             void ReadConditions(const SessionReaderSharedPtr& pSession);
             void WeightElements();
             void CreateGraph(BoostSubGraph& pGraph);
@@ -215,6 +208,22 @@ namespace Nektar
                                 std::vector<BoostSubGraph>& pLocalPartition);
             void OutputPartition(SessionReaderSharedPtr& pSession, BoostSubGraph& pGraph, TiXmlElement* pGeometry);
             void CheckPartitions(Array<OneD, int> &pPart);
+
+            template<class T, int N>
+            static void ReadCompressedEntities(
+                    const std::vector<T>      &pData,
+                    int                       (T::*pList)[N],
+                    char                       pType,
+                    std::map<int, MeshEntity> &pEntities);
+            template<class T, int N>
+            static int  WriteCompressedEntities(
+                    const std::map<int, MeshEntity> &pEntities,
+                    int                             (T::*pList)[N],
+                    char                             pType,
+                    TiXmlElement                    *pParent);
+            static void CheckSequential(
+                    const std::map<int, MeshEntity> &pEntities,
+                    const std::string               &pName);
         };
 
         typedef boost::shared_ptr<MeshPartition> MeshPartitionSharedPtr;
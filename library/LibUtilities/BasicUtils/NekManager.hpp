@@ -43,6 +43,7 @@
 #include <boost/concept_check.hpp>
 
 #include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
 #include <LibUtilities/BasicUtils/ErrorUtil.hpp>
 
 using namespace std;
@@ -71,39 +72,24 @@ namespace Nektar
                 typedef std::map<KeyType, ValueType> ValueContainer;
                 typedef boost::shared_ptr<ValueContainer> ValueContainerShPtr;
                 typedef std::map<KeyType, CreateFuncType, opLessCreator> CreateFuncContainer;
-                typedef std::map<std::string, boost::shared_ptr<ValueContainer> > ValueContainerPool;
                 typedef boost::shared_ptr<bool> BoolSharedPtr;
-                typedef std::map<std::string, BoolSharedPtr> FlagContainerPool;
+                typedef boost::shared_ptr<boost::mutex> MutexSharedPtr;
+
+                /// Storage shared by all managers using the same named pool.
+                struct Pool
+                {
+                    ValueContainerShPtr m_values;
+                    BoolSharedPtr       m_managementEnabled;
+                    MutexSharedPtr      m_mutex;
+                };
+                typedef std::map<std::string, Pool> ValueContainerPool;
 
                 NekManager(std::string whichPool="") :
                     m_values(), 
                     m_globalCreateFunc(),
                     m_keySpecificCreateFuncs()
                 {
-                    if (!whichPool.empty())
-                    {
-                        typename ValueContainerPool::iterator iter = m_ValueContainerPool.find(whichPool);
-                        if (iter != m_ValueContainerPool.end())
-                        {
-                            m_values = iter->second;
-                            m_managementEnabled = m_managementEnabledContainerPool[whichPool];
-                        }
-                        else
-                        {
-                            m_values = ValueContainerShPtr(new ValueContainer);
-                            m_ValueContainerPool[whichPool] = m_values;
-                            if (m_managementEnabledContainerPool.find(whichPool) == m_managementEnabledContainerPool.end())
-                            {
-                                m_managementEnabledContainerPool[whichPool] = BoolSharedPtr(new bool(true));
-                            }
-                            m_managementEnabled = m_managementEnabledContainerPool[whichPool];
-                        }
-                    }
-                    else
-                    {
-                        m_values = ValueContainerShPtr(new ValueContainer);
-                        m_managementEnabled = BoolSharedPtr(new bool(true));
-                    }
+                    AttachPool(whichPool);
                 };
 
 
@@ -112,31 +98,7 @@ namespace Nektar
                     m_globalCreateFunc(f),
                     m_keySpecificCreateFuncs()
                 {
-                    if (!whichPool.empty())
-                    {
-                        typename ValueContainerPool::iterator iter = m_ValueContainerPool.find(whichPool);
-                        if (iter != m_ValueContainerPool.end())
-                        {
-                            m_values = iter->second;
-                            m_managementEnabled = m_managementEnabledContainerPool[whichPool];
-                        }
-                        else
-                        {
-                            m_values = ValueContainerShPtr(new ValueContainer);
-                            m_ValueContainerPool[whichPool] = m_values;
-                            if (m_managementEnabledContainerPool.find(whichPool) == m_managementEnabledContainerPool.end())
-                            {
-                                m_managementEnabledContainerPool[whichPool] = BoolSharedPtr(new bool(true));
-                            }
-                            m_managementEnabled = m_managementEnabledContainerPool[whichPool];
-                        }
-
-                    }
-                    else
-                    {
-                        m_values = ValueContainerShPtr(new ValueContainer);
-                        m_managementEnabled = BoolSharedPtr(new bool(true));
-                    }
+                    AttachPool(whichPool);
                 }
                 
                 ~NekManager()
@@ -148,6 +110,7 @@ namespace Nektar
                 bool RegisterCreator(typename boost::call_traits<KeyType>::const_reference key, 
                                      const CreateFuncType& createFunc)
                 {
+                    boost::mutex::scoped_lock lock(*m_mutex);
                     m_keySpecificCreateFuncs[key] = createFunc;
 
                     return true;
@@ -157,6 +120,7 @@ namespace Nektar
                 /// The return value is just to facilitate calling statically.
                 bool RegisterGlobalCreator(const CreateFuncType& createFunc)
                 {
+                    boost::mutex::scoped_lock lock(*m_mutex);
                     m_globalCreateFunc = createFunc;
 
                     return true;
@@ -164,6 +128,7 @@ namespace Nektar
 
                 bool AlreadyCreated(typename boost::call_traits<KeyType>::const_reference key)
                 {
+                    boost::mutex::scoped_lock lock(*m_mutex);
                     bool value = false;
                     typename ValueContainer::iterator found = m_values->find(key);
                     if( found != m_values->end() )
@@ -176,44 +141,55 @@ namespace Nektar
 
                 ValueType operator[](typename boost::call_traits<KeyType>::const_reference key)
                 {
-                    typename ValueContainer::iterator found = m_values->find(key);
+                    CreateFuncType f;
 
-                    if( found != m_values->end() )
-                    {
-                        return (*found).second;
-                    }
-                    else
                     {
-                        // No object, create a new one.
-                        CreateFuncType f = m_globalCreateFunc;
+                        boost::mutex::scoped_lock lock(*m_mutex);
+                        typename ValueContainer::iterator found = m_values->find(key);
+
+                        if( found != m_values->end() )
+                        {
+                            return (*found).second;
+                        }
+
+                        f = m_globalCreateFunc;
                         typename CreateFuncContainer::iterator keyFound = m_keySpecificCreateFuncs.find(key);
                         if( keyFound != m_keySpecificCreateFuncs.end() )
                         {
                             f = (*keyFound).second;
                         }
+                    }
 
-                        if( f )
-                        {
-                            ValueType v = f(key);
-                            if (*m_managementEnabled)
-                            {
-                                (*m_values)[key] = v;
-                            }
-                            return v;
-                        }
-                        else
+                    // No object, create a new one. The lock is not held
+                    // while creating, since creators may request other
+                    // objects from this manager.
+                    if( f )
+                    {
+                        ValueType v = f(key);
+
+                        boost::mutex::scoped_lock lock(*m_mutex);
+                        if (*m_managementEnabled)
                         {
-                            std::string keyAsString = boost::lexical_cast<std::string>(key);
-                            std::string message = std::string("No create func found for key ") + keyAsString;
-                            NEKERROR(ErrorUtil::efatal, message.c_str());
-                            static ValueType result;
-                            return result;
+                            // If another thread created the object in the
+                            // meantime, its copy is retained.
+                            return (*m_values->insert(
+                                typename ValueContainer::value_type(key, v)).first).second;
                         }
+                        return v;
+                    }
+                    else
+                    {
+                        std::string keyAsString = boost::lexical_cast<std::string>(key);
+                        std::string message = std::string("No create func found for key ") + keyAsString;
+                        NEKERROR(ErrorUtil::efatal, message.c_str());
+                        static ValueType result;
+                        return result;
                     }
                 }
 
                 void DeleteObject(typename boost::call_traits<KeyType>::const_reference key)
                 {
+                    boost::mutex::scoped_lock lock(*m_mutex);
                     typename ValueContainer::iterator found = m_values->find(key);
 
                     if( found != m_values->end() )
@@ -224,55 +200,35 @@ namespace Nektar
 
                 static void ClearManager(std::string whichPool = "")
                 {
+                    boost::mutex::scoped_lock lock(GetPoolMutex());
+                    ValueContainerPool &pools = GetPools();
                     typename ValueContainerPool::iterator x;
                     if (!whichPool.empty())
                     {
-                        x = m_ValueContainerPool.find(whichPool);
-                        ASSERTL1(x != m_ValueContainerPool.end(),
+                        x = pools.find(whichPool);
+                        ASSERTL1(x != pools.end(),
                                 "Could not find pool " + whichPool);
-                        x->second->clear();
+                        boost::mutex::scoped_lock poolLock(*x->second.m_mutex);
+                        x->second.m_values->clear();
                     }
                     else
                     {
-                        for (x = m_ValueContainerPool.begin(); x != m_ValueContainerPool.end(); ++x)
+                        for (x = pools.begin(); x != pools.end(); ++x)
                         {
-                            x->second->clear();
+                            boost::mutex::scoped_lock poolLock(*x->second.m_mutex);
+                            x->second.m_values->clear();
                         }
                     }
                 }
 
                 static void EnableManagement(std::string whichPool = "")
                 {
-                    typename FlagContainerPool::iterator x;
-                    if (!whichPool.empty())
-                    {
-                        x = m_managementEnabledContainerPool.find(whichPool);
-                        if (x != m_managementEnabledContainerPool.end())
-                        {
-                            (*x->second) = true;
-                        }
-                        else
-                        {
-                            m_managementEnabledContainerPool[whichPool] = BoolSharedPtr(new bool(true));
-                        }
-                    }
+                    SetManagement(whichPool, true);
                 }
 
                 static void DisableManagement(std::string whichPool = "")
                 {
-                    typename FlagContainerPool::iterator x;
-                    if (!whichPool.empty())
-                    {
-                        x = m_managementEnabledContainerPool.find(whichPool);
-                        if (x != m_managementEnabledContainerPool.end())
-                        {
-                            (*x->second) = false;
-                        }
-                        else
-                        {
-                            m_managementEnabledContainerPool[whichPool] = BoolSharedPtr(new bool(false));
-                        }
-                    }
+                    SetManagement(whichPool, false);
                 }
 
             private:
@@ -281,13 +237,73 @@ namespace Nektar
 
                 ValueContainerShPtr m_values;
                 BoolSharedPtr m_managementEnabled;
-                static ValueContainerPool m_ValueContainerPool;
-                static FlagContainerPool m_managementEnabledContainerPool;
+                MutexSharedPtr m_mutex;
                 CreateFuncType m_globalCreateFunc;
                 CreateFuncContainer m_keySpecificCreateFuncs;
+
+                /// Named pools. These are constructed on first use so that
+                /// managers may be created during static initialisation.
+                static ValueContainerPool &GetPools()
+                {
+                    static ValueContainerPool pools;
+                    return pools;
+                }
+
+                /// Mutex guarding the set of named pools.
+                static boost::mutex &GetPoolMutex()
+                {
+                    static boost::mutex mutex;
+                    return mutex;
+                }
+
+                /// Returns the named pool, creating it if necessary. The
+                /// pool mutex must be held by the caller.
+                static Pool &FindPool(const std::string &whichPool)
+                {
+                    ValueContainerPool &pools = GetPools();
+                    typename ValueContainerPool::iterator iter = pools.find(whichPool);
+                    if (iter == pools.end())
+                    {
+                        Pool pool;
+                        pool.m_values = ValueContainerShPtr(new ValueContainer);
+                        pool.m_managementEnabled = BoolSharedPtr(new bool(true));
+                        pool.m_mutex = MutexSharedPtr(new boost::mutex);
+                        iter = pools.insert(
+                            typename ValueContainerPool::value_type(whichPool, pool)).first;
+                    }
+                    return iter->second;
+                }
+
+                void AttachPool(const std::string &whichPool)
+                {
+                    if (!whichPool.empty())
+                    {
+                        boost::mutex::scoped_lock lock(GetPoolMutex());
+                        Pool &pool = FindPool(whichPool);
+                        m_values            = pool.m_values;
+                        m_managementEnabled = pool.m_managementEnabled;
+                        m_mutex             = pool.m_mutex;
+                    }
+                    else
+                    {
+                        m_values = ValueContainerShPtr(new ValueContainer);
+                        m_managementEnabled = BoolSharedPtr(new bool(true));
+                        m_mutex = MutexSharedPtr(new boost::mutex);
+                    }
+                }
+
+                static void SetManagement(const std::string &whichPool,
+                                          const bool value)
+                {
+                    if (!whichPool.empty())
+                    {
+                        boost::mutex::scoped_lock lock(GetPoolMutex());
+                        Pool &pool = FindPool(whichPool);
+                        boost::mutex::scoped_lock poolLock(*pool.m_mutex);
+                        *pool.m_managementEnabled = value;
+                    }
+                }
         };
-        template <typename KeyType, typename ValueT, typename opLessCreator> typename NekManager<KeyType, ValueT, opLessCreator>::ValueContainerPool NekManager<KeyType, ValueT, opLessCreator>::m_ValueContainerPool;
-        template <typename KeyType, typename ValueT, typename opLessCreator> typename NekManager<KeyType, ValueT, opLessCreator>::FlagContainerPool NekManager<KeyType, ValueT, opLessCreator>::m_managementEnabledContainerPool;
     }
 }
 
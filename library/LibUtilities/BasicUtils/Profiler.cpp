@@ -0,0 +1,482 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Profiler.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Scoped hierarchical region profiler
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/BasicUtils/Profiler.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
+#include <LibUtilities/Communication/Comm.h>
+
+#include <loki/Singleton.h>
+#include <boost/algorithm/string.hpp>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <sys/time.h>
+#else
+#include <time.h>
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <sstream>
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        Profiler &GetProfiler()
+        {
+            typedef Loki::SingletonHolder<Profiler,
+                                          Loki::CreateUsingNew,
+                                          Loki::DefaultLifetime> Type;
+            return Type::Instance();
+        }
+
+        namespace
+        {
+            /// Separator of the region names in a path. It sorts before
+            /// any printable character, so that sorting the paths lists
+            /// each region directly before its children.
+            const char kPathSep = '\x01';
+
+            /// Quantities recorded per region.
+            enum ProfileQuantity
+            {
+                eCalls,
+                eTime,
+                eCommCalls,
+                eCommBytes,
+                SIZE_ProfileQuantity
+            };
+
+            const char *const kQuantityNames[] =
+            {
+                "calls",
+                "time",
+                "comm_calls",
+                "comm_bytes"
+            };
+
+            std::string DisplayPath(const std::string &path)
+            {
+                std::string out = path;
+                std::replace(out.begin(), out.end(), kPathSep, '/');
+                return out;
+            }
+
+            std::string JsonEscape(const std::string &in)
+            {
+                std::string out;
+                for (size_t i = 0; i < in.size(); ++i)
+                {
+                    if (in[i] == '"' || in[i] == '\\')
+                    {
+                        out += '\\';
+                    }
+                    out += in[i];
+                }
+                return out;
+            }
+
+            void SendString(
+                const CommSharedPtr &comm, const int proc, std::string str)
+            {
+                Array<OneD, int> len(1, (int) str.size());
+                comm->Send(proc, len);
+                if (len[0] > 0)
+                {
+                    comm->Send(proc, str);
+                }
+            }
+
+            std::string RecvString(const CommSharedPtr &comm, const int proc)
+            {
+                Array<OneD, int> len(1);
+                comm->Recv(proc, len);
+                std::string str(len[0], ' ');
+                if (len[0] > 0)
+                {
+                    comm->Recv(proc, str);
+                }
+                return str;
+            }
+        }
+
+        /**
+         * @class Profiler
+         *
+         * Regions are identified by the address of their name, so that
+         * entering a region only requires a lookup among the children of
+         * the current region. Regions with the same path are merged when
+         * the report is generated.
+         */
+        Profiler::Profiler()
+            : m_enabled(false),
+              m_current(0)
+        {
+            Node root;
+            root.m_name      = "Total";
+            root.m_parent    = -1;
+            root.m_calls     = 0;
+            root.m_time      = 0.0;
+            root.m_start     = 0.0;
+            root.m_commCalls = 0;
+            root.m_commBytes = 0;
+            m_nodes.push_back(root);
+        }
+
+        Profiler::~Profiler()
+        {
+        }
+
+        void Profiler::Enable()
+        {
+            if (m_enabled)
+            {
+                return;
+            }
+
+            m_enabled  = true;
+            m_threadId = boost::this_thread::get_id();
+            m_current  = 0;
+            m_nodes[0].m_calls++;
+            m_nodes[0].m_start = GetTime();
+        }
+
+        void Profiler::Disable()
+        {
+            if (!m_enabled)
+            {
+                return;
+            }
+
+            NekDouble now = GetTime();
+
+            // Close any regions which are still open.
+            for (int n = m_current; n >= 0; n = m_nodes[n].m_parent)
+            {
+                m_nodes[n].m_time += now - m_nodes[n].m_start;
+            }
+
+            m_enabled = false;
+            m_current = 0;
+        }
+
+        void Profiler::Start(const char *name)
+        {
+            if (!m_enabled || boost::this_thread::get_id() != m_threadId)
+            {
+                return;
+            }
+
+            Node &current = m_nodes[m_current];
+            std::map<std::string, int>::iterator x =
+                current.m_children.find(name);
+            int child;
+
+            if (x == current.m_children.end())
+            {
+                Node node;
+                node.m_name      = name;
+                node.m_parent    = m_current;
+                node.m_calls     = 0;
+                node.m_time      = 0.0;
+                node.m_start     = 0.0;
+                node.m_commCalls = 0;
+                node.m_commBytes = 0;
+
+                child = m_nodes.size();
+                current.m_children[name] = child;
+                m_nodes.push_back(node);
+            }
+            else
+            {
+                child = x->second;
+            }
+
+            m_current = child;
+            m_nodes[child].m_calls++;
+            m_nodes[child].m_start = GetTime();
+        }
+
+        void Profiler::Stop()
+        {
+            if (!m_enabled || boost::this_thread::get_id() != m_threadId ||
+                m_current == 0)
+            {
+                return;
+            }
+
+            Node &node = m_nodes[m_current];
+            node.m_time += GetTime() - node.m_start;
+            m_current    = node.m_parent;
+        }
+
+        /**
+         * Communication is attributed to the current region and all of its
+         * parents, so that the statistics of each region are inclusive.
+         */
+        void Profiler::AddCommToCurrent(const size_t bytes)
+        {
+            if (boost::this_thread::get_id() != m_threadId)
+            {
+                return;
+            }
+
+            for (int n = m_current; n >= 0; n = m_nodes[n].m_parent)
+            {
+                m_nodes[n].m_commCalls++;
+                m_nodes[n].m_commBytes += bytes;
+            }
+        }
+
+        /**
+         * Regions are matched across ranks by their path. The union of the
+         * paths is formed on rank 0 and sent back to all ranks, so that
+         * regions entered on a subset of ranks are reported with zero
+         * values on the others.
+         */
+        void Profiler::Report(
+            const CommSharedPtr &comm,
+            const std::string   &basename)
+        {
+            Disable();
+
+            // Merge the regions of this rank by path.
+            std::map<std::string, std::vector<NekDouble> > local;
+            std::vector<std::string> paths(m_nodes.size());
+            for (unsigned int n = 0; n < m_nodes.size(); ++n)
+            {
+                const Node &node = m_nodes[n];
+                paths[n] = node.m_parent < 0 ? node.m_name
+                         : paths[node.m_parent] + kPathSep + node.m_name;
+
+                std::vector<NekDouble> &val = local[paths[n]];
+                val.resize(SIZE_ProfileQuantity, 0.0);
+                val[eCalls]     += node.m_calls;
+                val[eTime]      += node.m_time;
+                val[eCommCalls] += node.m_commCalls;
+                val[eCommBytes] += node.m_commBytes;
+            }
+
+            // Form the union of the paths over all ranks.
+            const int nProc = comm->GetSize();
+            const int rank  = comm->GetRank();
+            std::set<std::string> allPaths;
+            std::map<std::string, std::vector<NekDouble> >::iterator x;
+
+            for (x = local.begin(); x != local.end(); ++x)
+            {
+                allPaths.insert(x->first);
+            }
+
+            if (nProc > 1)
+            {
+                std::string joined;
+                if (rank == 0)
+                {
+                    for (int p = 1; p < nProc; ++p)
+                    {
+                        std::vector<std::string> remote;
+                        std::string str = RecvString(comm, p);
+                        boost::split(remote, str, boost::is_any_of("\n"));
+                        allPaths.insert(remote.begin(), remote.end());
+                    }
+                    allPaths.erase("");
+
+                    joined = boost::algorithm::join(allPaths, "\n");
+                    for (int p = 1; p < nProc; ++p)
+                    {
+                        SendString(comm, p, joined);
+                    }
+                }
+                else
+                {
+                    std::vector<std::string> merged;
+                    joined = boost::algorithm::join(allPaths, "\n");
+                    SendString(comm, 0, joined);
+
+                    joined = RecvString(comm, 0);
+                    boost::split(merged, joined, boost::is_any_of("\n"));
+                    allPaths.clear();
+                    allPaths.insert(merged.begin(), merged.end());
+                }
+            }
+
+            // Reduce each quantity over the ranks.
+            const int nPaths = allPaths.size();
+            const int nVal   = nPaths * SIZE_ProfileQuantity;
+            Array<OneD, NekDouble> vMin(nVal, 0.0);
+            std::set<std::string>::iterator it;
+            int i, j;
+
+            for (i = 0, it = allPaths.begin(); it != allPaths.end(); ++it, ++i)
+            {
+                if ((x = local.find(*it)) != local.end())
+                {
+                    for (j = 0; j < SIZE_ProfileQuantity; ++j)
+                    {
+                        vMin[i*SIZE_ProfileQuantity + j] = x->second[j];
+                    }
+                }
+            }
+
+            Array<OneD, NekDouble> vMax(nVal), vSum(nVal);
+            Vmath::Vcopy(nVal, vMin, 1, vMax, 1);
+            Vmath::Vcopy(nVal, vMin, 1, vSum, 1);
+            comm->AllReduce(vMin, ReduceMin);
+            comm->AllReduce(vMax, ReduceMax);
+            comm->AllReduce(vSum, ReduceSum);
+
+            if (rank != 0)
+            {
+                return;
+            }
+
+            const std::string csvName  = basename + ".prof.csv";
+            const std::string jsonName = basename + ".prof.json";
+            std::ofstream csv (csvName.c_str());
+            std::ofstream json(jsonName.c_str());
+            NekDouble total = nPaths > 0 ? vSum[eTime] / nProc : 0.0;
+
+            csv << "path,depth";
+            for (j = 0; j < SIZE_ProfileQuantity; ++j)
+            {
+                csv << "," << kQuantityNames[j] << "_min,"
+                    << kQuantityNames[j] << "_avg,"
+                    << kQuantityNames[j] << "_max";
+            }
+            csv << std::endl;
+
+            json << "{" << std::endl
+                 << "  \"ranks\": " << nProc << "," << std::endl
+                 << "  \"regions\": [" << std::endl;
+
+            std::cout << std::endl << "Profile over " << nProc << " rank(s)"
+                      << " (time in s, min/avg/max over ranks):"
+                      << std::endl
+                      << std::left << std::setw(40) << "Region"
+                      << std::right
+                      << std::setw(10) << "Calls"
+                      << std::setw(11) << "Min"
+                      << std::setw(11) << "Avg"
+                      << std::setw(11) << "Max"
+                      << std::setw(8)  << "%Total"
+                      << std::setw(11) << "Comm"
+                      << std::setw(11) << "Comm MB"
+                      << std::endl;
+
+            for (i = 0, it = allPaths.begin(); it != allPaths.end(); ++it, ++i)
+            {
+                const int off   = i*SIZE_ProfileQuantity;
+                const int depth = std::count(it->begin(), it->end(), kPathSep);
+                const std::string name = it->substr(it->rfind(kPathSep) + 1);
+                const std::string path = DisplayPath(*it);
+
+                csv << "\"" << path << "\"," << depth;
+                json << "    {\"path\": \"" << JsonEscape(path) << "\", "
+                     << "\"name\": \"" << JsonEscape(name) << "\", "
+                     << "\"depth\": " << depth;
+
+                for (j = 0; j < SIZE_ProfileQuantity; ++j)
+                {
+                    csv << "," << vMin[off+j] << "," << vSum[off+j]/nProc
+                        << "," << vMax[off+j];
+                    json << ", \"" << kQuantityNames[j] << "\": {"
+                         << "\"min\": " << vMin[off+j] << ", "
+                         << "\"avg\": " << vSum[off+j]/nProc << ", "
+                         << "\"max\": " << vMax[off+j] << "}";
+                }
+
+                csv << std::endl;
+                json << "}" << (i < nPaths - 1 ? "," : "") << std::endl;
+
+                std::string label = std::string(2*depth, ' ') + name;
+                if (label.size() > 39)
+                {
+                    label = label.substr(0, 36) + "...";
+                }
+
+                std::cout << std::left << std::setw(40) << label
+                          << std::right << std::fixed
+                          << std::setprecision(0)
+                          << std::setw(10) << vSum[off+eCalls]/nProc
+                          << std::setprecision(4)
+                          << std::setw(11) << vMin[off+eTime]
+                          << std::setw(11) << vSum[off+eTime]/nProc
+                          << std::setw(11) << vMax[off+eTime]
+                          << std::setprecision(1)
+                          << std::setw(8)
+                          << (total > 0.0 ?
+                              100.0*vSum[off+eTime]/nProc/total : 0.0)
+                          << std::setprecision(0)
+                          << std::setw(11) << vSum[off+eCommCalls]/nProc
+                          << std::setprecision(2)
+                          << std::setw(11)
+                          << vSum[off+eCommBytes]/nProc/1048576.0
+                          << std::endl;
+            }
+
+            json << "  ]" << std::endl << "}" << std::endl;
+
+            std::cout.unsetf(std::ios::floatfield);
+            std::cout << std::setprecision(6)
+                      << "Profile written to " << jsonName << " and "
+                      << csvName << std::endl;
+        }
+
+        NekDouble Profiler::GetTime()
+        {
+#ifdef _WIN32
+            LARGE_INTEGER count, frequency;
+            QueryPerformanceCounter(&count);
+            QueryPerformanceFrequency(&frequency);
+            return count.QuadPart / (NekDouble) frequency.QuadPart;
+#elif defined(__APPLE__)
+            timeval t;
+            gettimeofday(&t, 0);
+            return t.tv_sec + 1.0e-6 * t.tv_usec;
+#else
+            timespec t;
+            clock_gettime(CLOCK_MONOTONIC, &t);
+            return t.tv_sec + 1.0e-9 * t.tv_nsec;
+#endif
+        }
+    }
+}
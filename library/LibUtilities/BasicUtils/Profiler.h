@@ -0,0 +1,184 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Profiler.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Scoped hierarchical region profiler
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_PROFILER_H
+#define NEKTAR_LIB_UTILITIES_BASIC_UTILS_PROFILER_H
+
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/thread.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        class Comm;
+        typedef boost::shared_ptr<Comm> CommSharedPtr;
+
+        /**
+         * @brief Hierarchical profiler of named code regions.
+         *
+         * Regions are entered and left with the RAII ProfileRegion marker,
+         * and nest into a tree by call path. For each node the number of
+         * calls, the inclusive time, and the number of calls and bytes
+         * passed through Comm while the region was active are recorded.
+         * Only the thread which enabled the profiler is recorded.
+         *
+         * The profiler is enabled with the --profile command-line option.
+         * When it is disabled a marker costs a single test. Report()
+         * reduces the statistics over all ranks and writes the min/avg/max
+         * per region to the screen and to JSON and CSV files.
+         */
+        class Profiler
+        {
+            public:
+                LIB_UTILITIES_EXPORT Profiler();
+                LIB_UTILITIES_EXPORT ~Profiler();
+
+                /// Starts recording, with the time from now on attributed
+                /// to the root region.
+                LIB_UTILITIES_EXPORT void Enable();
+
+                /// Stops recording; statistics collected so far are kept.
+                LIB_UTILITIES_EXPORT void Disable();
+
+                inline bool IsEnabled() const;
+
+                /// Enters the child region @a name of the current region.
+                LIB_UTILITIES_EXPORT void Start(const char *name);
+
+                /// Leaves the current region.
+                LIB_UTILITIES_EXPORT void Stop();
+
+                /// Adds a communication call of @a bytes to the current
+                /// region.
+                inline void AddComm(const size_t bytes);
+
+                /// Reduces the statistics over @a comm and writes the report
+                /// on rank 0 to the screen and to @a basename.prof.json and
+                /// @a basename.prof.csv. Disables the profiler.
+                LIB_UTILITIES_EXPORT void Report(
+                    const CommSharedPtr &comm,
+                    const std::string   &basename);
+
+                /// Wall-clock time in seconds.
+                LIB_UTILITIES_EXPORT static NekDouble GetTime();
+
+            private:
+                struct Node
+                {
+                    std::string m_name;
+                    int         m_parent;
+                    /// Child regions, keyed by their name.
+                    std::map<std::string, int> m_children;
+                    size_t      m_calls;
+                    NekDouble   m_time;
+                    NekDouble   m_start;
+                    size_t      m_commCalls;
+                    size_t      m_commBytes;
+                };
+
+                Profiler(const Profiler &rhs);
+                Profiler &operator=(const Profiler &rhs);
+
+                LIB_UTILITIES_EXPORT void AddCommToCurrent(const size_t bytes);
+
+                bool              m_enabled;
+                boost::thread::id m_threadId;
+                std::vector<Node> m_nodes;
+                /// Index of the current region in #m_nodes.
+                int               m_current;
+        };
+
+        /// Returns the profiler of this process.
+        LIB_UTILITIES_EXPORT Profiler &GetProfiler();
+
+        /**
+         * @brief Marks the enclosing scope as a region of the profiler.
+         */
+        class ProfileRegion
+        {
+            public:
+                inline explicit ProfileRegion(const char *name);
+                inline ~ProfileRegion();
+
+            private:
+                ProfileRegion(const ProfileRegion &rhs);
+                ProfileRegion &operator=(const ProfileRegion &rhs);
+
+                bool m_active;
+        };
+
+        inline bool Profiler::IsEnabled() const
+        {
+            return m_enabled;
+        }
+
+        inline void Profiler::AddComm(const size_t bytes)
+        {
+            if (m_enabled)
+            {
+                AddCommToCurrent(bytes);
+            }
+        }
+
+        inline ProfileRegion::ProfileRegion(const char *name)
+            : m_active(false)
+        {
+            Profiler &profiler = GetProfiler();
+            if (profiler.IsEnabled())
+            {
+                profiler.Start(name);
+                m_active = true;
+            }
+        }
+
+        inline ProfileRegion::~ProfileRegion()
+        {
+            if (m_active)
+            {
+                GetProfiler().Stop();
+            }
+        }
+    }
+}
+
+#endif //NEKTAR_LIB_UTILITIES_BASIC_UTILS_PROFILER_H
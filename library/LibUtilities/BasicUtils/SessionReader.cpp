@@ -55,6 +55,9 @@ using namespace std;
 #include <LibUtilities/BasicUtils/MeshPartition.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
 #include <LibUtilities/BasicUtils/FileSystem.h>
+#include <LibUtilities/BasicUtils/Thread.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
+#include <LibUtilities/Memory/ScratchArena.hpp>
 
 #include <boost/program_options.hpp>
 #include <boost/format.hpp>
@@ -66,6 +69,42 @@ namespace Nektar
 {
     namespace LibUtilities
     {
+        namespace
+        {
+            /// Appends an ordering to a flat list as the number of entries
+            /// followed by the id, length and values of each entry.
+            void PackOrdering(const CompositeOrdering   &pOrdering,
+                              std::vector<unsigned int> &pData)
+            {
+                CompositeOrdering::const_iterator it;
+                pData.push_back(pOrdering.size());
+                for (it = pOrdering.begin(); it != pOrdering.end(); ++it)
+                {
+                    pData.push_back(it->first);
+                    pData.push_back(it->second.size());
+                    pData.insert(pData.end(), it->second.begin(),
+                                              it->second.end());
+                }
+            }
+
+            /// Extracts an ordering written by PackOrdering, starting at
+            /// position @a pPos which is advanced past it.
+            void UnpackOrdering(const std::vector<unsigned int> &pData,
+                                unsigned int                    &pPos,
+                                CompositeOrdering               &pOrdering)
+            {
+                unsigned int nEntries = pData[pPos++];
+                for (unsigned int i = 0; i < nEntries; ++i)
+                {
+                    int          id = pData[pPos++];
+                    unsigned int n  = pData[pPos++];
+                    pOrdering[id] = std::vector<unsigned int>(
+                        pData.begin() + pPos, pData.begin() + pPos + n);
+                    pPos += n;
+                }
+            }
+        }
+
         /**
          * @class SessionReader
          *
@@ -246,8 +285,8 @@ namespace Nektar
         /**
          * Performs the main initialisation of the object. The XML file provided
          * on the command-line is loaded and any mesh partitioning is done. The
-         * resulting process-specific XML file (containing the process's
-         * geometry partition) is then reloaded and parsed.
+         * resulting process-specific XML document (containing the process's
+         * geometry partition) is then parsed.
          */
         void SessionReader::InitSession()
         {
@@ -263,6 +302,13 @@ namespace Nektar
             // Override SOLVERINFO and parameters with any specified on the
             // command line.
             CmdLineOverride();
+
+            // Start the threads used for the elemental loops.
+            if (m_cmdLineOptions.count("nthreads"))
+            {
+                GetThreadPool().SetNumThreads(
+                    m_cmdLineOptions["nthreads"].as<int>());
+            }
         }
 
 
@@ -278,6 +324,7 @@ namespace Nektar
             desc.add_options()
                 ("verbose,v",    "be verbose")
                 ("help,h",       "print this help message")
+                ("profile",      "time solver regions and report on exit")
                 ("solverinfo,I", po::value<vector<std::string> >(), 
                                  "override a SOLVERINFO property")
                 ("parameter,P",  po::value<vector<std::string> >(),
@@ -289,6 +336,8 @@ namespace Nektar
                                  "number of procs in Y-dir")
                 ("npz",          po::value<int>(),
                                  "number of procs in Z-dir")
+                ("nthreads",     po::value<int>(),
+                                 "number of threads per process")
 
             ;
             
@@ -359,6 +408,13 @@ namespace Nektar
             {
                 m_verbose = false;
             }
+
+            // Start the region profiler
+            if (m_cmdLineOptions.count("profile"))
+            {
+                GetProfiler().Enable();
+                ScratchArena::EnableStatistics();
+            }
             
             // Print a warning for unknown options
             std::vector< po::basic_option<char> >::iterator x;
@@ -510,6 +566,16 @@ namespace Nektar
          */
         void SessionReader::Finalise()
         {
+            if (GetProfiler().IsEnabled())
+            {
+                GetProfiler().Report(m_comm, m_sessionName);
+
+                // Workspace taken from the scratch arenas of this process.
+                if (m_comm->GetRank() == 0)
+                {
+                    ScratchArena::PrintStatistics(std::cout);
+                }
+            }
             m_comm->Finalise();
         }
 
@@ -1368,45 +1434,34 @@ namespace Nektar
                         vPartitioner->GetCompositeOrdering(m_compOrder);
                         vPartitioner->GetBndRegionOrdering(m_bndRegOrder);
                     }
-                }
-                else
-                {
-                    m_xmlDoc = MergeDoc(m_filenames);
-
-                    // Partitioner now operates in parallel
-                    // Each process receives partitioning over interconnect
-                    // and writes its own session file to the working directory.
-                    SessionReaderSharedPtr vSession     = GetSharedThisPtr();
-                    MeshPartitionSharedPtr vPartitioner = MemoryManager<
-                        MeshPartition>::AllocateSharedPtr(vSession);
-                    vPartitioner->PartitionMesh(false);
-                    vPartitioner->WriteLocalPartition(vSession);
-                    vPartitioner->GetCompositeOrdering(m_compOrder);
-                    vPartitioner->GetBndRegionOrdering(m_bndRegOrder);
-                }
-                m_comm->Block();
+                    m_comm->Block();
 
-                std::string  dirname = GetSessionName() + "_xml";
-                fs::path    pdirname(dirname);
-                boost::format pad("P%1$07d.xml");
-                pad % m_comm->GetRank();
-                fs::path    pFilename(pad.str());
-                fs::path fullpath = pdirname / pFilename;
+                    std::string  dirname = GetSessionName() + "_xml";
+                    fs::path    pdirname(dirname);
+                    boost::format pad("P%1$07d.xml");
+                    pad % m_comm->GetRank();
+                    fs::path    pFilename(pad.str());
+                    fs::path fullpath = pdirname / pFilename;
 
-                m_filename = PortablePath(fullpath);
+                    m_filename = PortablePath(fullpath);
 
-                if (m_xmlDoc)
-                {
-                    delete m_xmlDoc;
-                }
-                m_xmlDoc = new TiXmlDocument(m_filename);
+                    if (m_xmlDoc)
+                    {
+                        delete m_xmlDoc;
+                    }
+                    m_xmlDoc = new TiXmlDocument(m_filename);
 
-                ASSERTL0(m_xmlDoc, "Failed to create XML document object.");
+                    ASSERTL0(m_xmlDoc, "Failed to create XML document object.");
 
-                bool loadOkay = m_xmlDoc->LoadFile(m_filename);
-                ASSERTL0(loadOkay, "Unable to load file: " + m_filename      + 
-                         ". Check XML standards compliance. Error on line: " +
-                         boost::lexical_cast<std::string>(m_xmlDoc->Row()));
+                    bool loadOkay = m_xmlDoc->LoadFile(m_filename);
+                    ASSERTL0(loadOkay, "Unable to load file: " + m_filename      + 
+                             ". Check XML standards compliance. Error on line: " +
+                             boost::lexical_cast<std::string>(m_xmlDoc->Row()));
+                }
+                else
+                {
+                    DistributePartitions();
+                }
             }
             else
             {
@@ -1419,6 +1474,80 @@ namespace Nektar
         }
 
 
+        /**
+         * Only the root process reads the session files and partitions the
+         * mesh. The session document of each partition is then sent to the
+         * process it belongs to, together with the composite and boundary
+         * region orderings, so that no partition files are written to disk.
+         * The partition of each process is given by its rank in the row
+         * communicator.
+         */
+        void SessionReader::DistributePartitions()
+        {
+            int vRank = m_comm->GetRank();
+            int vSize = m_comm->GetSize();
+
+            Array<OneD, int> vPartId(vSize, 0);
+            vPartId[vRank] = m_comm->GetRowComm()->GetRank();
+            m_comm->AllReduce(vPartId, LibUtilities::ReduceSum);
+
+            std::string               vXml;
+            std::vector<unsigned int> vOrdering;
+            Array<OneD, int>          vLengths(2);
+
+            if (vRank == 0)
+            {
+                m_xmlDoc = MergeDoc(m_filenames);
+
+                SessionReaderSharedPtr vSession     = GetSharedThisPtr();
+                MeshPartitionSharedPtr vPartitioner = MemoryManager<
+                    MeshPartition>::AllocateSharedPtr(vSession);
+                vPartitioner->PartitionMesh(true);
+                vPartitioner->GetCompositeOrdering(m_compOrder);
+                vPartitioner->GetBndRegionOrdering(m_bndRegOrder);
+
+                PackOrdering(m_compOrder,   vOrdering);
+                PackOrdering(m_bndRegOrder, vOrdering);
+
+                for (int i = 1; i < vSize; ++i)
+                {
+                    vPartitioner->GetPartitionXml(vSession, vPartId[i], vXml);
+
+                    vLengths[0] = vXml.size();
+                    vLengths[1] = vOrdering.size();
+                    m_comm->Send(i, vLengths);
+                    m_comm->Send(i, vXml);
+                    m_comm->Send(i, vOrdering);
+                }
+
+                vPartitioner->GetPartitionXml(vSession, vPartId[0], vXml);
+            }
+            else
+            {
+                m_comm->Recv(0, vLengths);
+
+                vXml.resize(vLengths[0]);
+                vOrdering.resize(vLengths[1]);
+                m_comm->Recv(0, vXml);
+                m_comm->Recv(0, vOrdering);
+
+                unsigned int vPos = 0;
+                UnpackOrdering(vOrdering, vPos, m_compOrder);
+                UnpackOrdering(vOrdering, vPos, m_bndRegOrder);
+            }
+
+            if (m_xmlDoc)
+            {
+                delete m_xmlDoc;
+            }
+            m_xmlDoc = new TiXmlDocument();
+            m_xmlDoc->Parse(vXml.c_str());
+
+            ASSERTL0(!m_xmlDoc->Error(), "Unable to parse mesh partition: " +
+                     std::string(m_xmlDoc->ErrorDesc()));
+        }
+
+
         /**
          * Splits the processes into a cartesian grid and creates communicators
          * for each row and column of the grid. The grid is defined by the
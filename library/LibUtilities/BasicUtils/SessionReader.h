@@ -472,6 +472,9 @@ namespace Nektar
                 char*              argv[]);
             /// Partitions the mesh when running in parallel.
             LIB_UTILITIES_EXPORT void PartitionMesh();
+            /// Partitions the mesh on the root process and sends each
+            /// process its partition.
+            LIB_UTILITIES_EXPORT void DistributePartitions();
             /// Partitions the comm object based on session parameters.
             LIB_UTILITIES_EXPORT void PartitionComm();
 
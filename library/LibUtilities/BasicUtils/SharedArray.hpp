@@ -46,14 +46,131 @@
 #include <boost/multi_array.hpp>
 #include <boost/shared_ptr.hpp>
 
+#if defined(NEKTAR_USING_THREADS) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace Nektar
 {
     class LinearSystem;
 
+    namespace detail
+    {
+        /// \brief Increments a reference count, atomically if threads
+        /// are enabled.
+        inline void IncrementCount(unsigned int* count)
+        {
+#if !defined(NEKTAR_USING_THREADS)
+            ++(*count);
+#elif defined(_MSC_VER)
+            _InterlockedIncrement(reinterpret_cast<volatile long*>(count));
+#else
+            __sync_fetch_and_add(count, 1u);
+#endif
+        }
+
+        /// \brief Decrements a reference count, atomically if threads
+        /// are enabled, and returns the new value.
+        inline unsigned int DecrementCount(unsigned int* count)
+        {
+#if !defined(NEKTAR_USING_THREADS)
+            return --(*count);
+#elif defined(_MSC_VER)
+            return static_cast<unsigned int>(
+                _InterlockedDecrement(reinterpret_cast<volatile long*>(count)));
+#else
+            return __sync_sub_and_fetch(count, 1u);
+#endif
+        }
+
+        /// \brief Alignment in bytes of the storage of 1D arrays occupying
+        /// at least this many bytes.
+#ifdef NEKTAR_ALIGNED_ARRAYS
+        const size_t ArrayAlignment = 64;
+#else
+        const size_t ArrayAlignment = 8;
+#endif
+
+        /// \brief Bookkeeping stored immediately before the elements of a
+        /// 1D array.
+        struct ArrayStorageHeader
+        {
+            /// Reference count.
+            unsigned int m_count;
+            /// Distance in bytes from the start of the allocation to the
+            /// first element.
+            unsigned int m_offset;
+        };
+
+        /// \brief Bytes between the start of an allocation and the
+        /// elements when the storage is not aligned, keeping the
+        /// alignment of the allocation.
+        const size_t ArrayHeaderBytes = 16;
+
+        /// \brief Returns true if storage of the given size is aligned to
+        /// ArrayAlignment and padded to a multiple of it.
+        inline bool UseAlignedArrayStorage(size_t bytes)
+        {
+            return ArrayAlignment > ArrayHeaderBytes && bytes >= ArrayAlignment;
+        }
+
+        /// \brief Size of the allocation holding storage of the given size.
+        inline size_t ArrayAllocationBytes(size_t bytes)
+        {
+            if (UseAlignedArrayStorage(bytes))
+            {
+                // Padding to the alignment, and room for the header and
+                // for aligning the allocation, which is at least 8-byte
+                // aligned.
+                return (bytes + ArrayAlignment - 1) / ArrayAlignment * ArrayAlignment
+                    + ArrayAlignment;
+            }
+            return bytes + ArrayHeaderBytes;
+        }
+
+        /// \brief Allocates storage of the given size with its reference
+        /// count, which is set to one, in the same allocation.
+        inline void* AllocateArrayStorage(size_t bytes, unsigned int*& count)
+        {
+            char* raw  = MemoryManager<char>::RawAllocate(ArrayAllocationBytes(bytes));
+            char* data = raw + ArrayHeaderBytes;
+
+            if (UseAlignedArrayStorage(bytes))
+            {
+                size_t misalign = reinterpret_cast<size_t>(raw + sizeof(ArrayStorageHeader))
+                    % ArrayAlignment;
+                data = raw + sizeof(ArrayStorageHeader)
+                    + (misalign ? ArrayAlignment - misalign : 0);
+            }
+
+            ArrayStorageHeader* header = reinterpret_cast<ArrayStorageHeader*>(data) - 1;
+            header->m_count  = 1;
+            header->m_offset = static_cast<unsigned int>(data - raw);
+            count = &header->m_count;
+            return data;
+        }
+
+        /// \brief Releases storage created by AllocateArrayStorage.
+        inline void DeallocateArrayStorage(void* data, size_t bytes)
+        {
+            ArrayStorageHeader* header = static_cast<ArrayStorageHeader*>(data) - 1;
+            MemoryManager<char>::RawDeallocate(
+                static_cast<char*>(data) - header->m_offset,
+                ArrayAllocationBytes(bytes));
+        }
+    }
+
     // Forward declaration for a ConstArray constructor.
     template<typename Dim, typename DataType>
     class Array;
 
+    /// \brief Selects the constructor of an array referencing storage
+    /// which it does not own.
+    enum ArrayStorageWrapper
+    {
+        eUnownedStorage
+    };
+
     /// \brief 1D Array of constant elements with garbage collection and bounds checking.
     template<typename DataType>
     class Array<OneD, const DataType>
@@ -95,7 +212,7 @@ namespace Nektar
                 m_offset(0)
             {
                 CreateStorage(m_capacity);
-                ArrayInitializationPolicy<DataType>::Initialize(m_data + 1, m_capacity);
+                ArrayInitializationPolicy<DataType>::Initialize(m_data, m_capacity);
             }
 
              /// \brief Creates a 1D array with each element
@@ -115,7 +232,7 @@ namespace Nektar
                 m_offset(0)
             {
                 CreateStorage(m_capacity);
-                ArrayInitializationPolicy<DataType>::Initialize(m_data + 1, m_capacity, initValue);
+                ArrayInitializationPolicy<DataType>::Initialize(m_data, m_capacity, initValue);
             }
 
             /// \brief Creates a 1D array a copies data into it.
@@ -133,7 +250,21 @@ namespace Nektar
                 m_offset(0)
             {
                 CreateStorage(m_capacity);
-                ArrayInitializationPolicy<DataType>::Initialize(m_data + 1, m_capacity, data);
+                ArrayInitializationPolicy<DataType>::Initialize(m_data, m_capacity, data);
+            }
+
+            /// \brief Creates a 1D array referencing dim1Size elements at
+            /// data.
+            ///
+            /// The storage is neither reference counted nor released by
+            /// the array, and must outlive the array and all its copies.
+            Array(unsigned int dim1Size, const DataType* data, ArrayStorageWrapper) :
+                m_size(dim1Size),
+                m_capacity(dim1Size),
+                m_data(const_cast<DataType*>(data)),
+                m_count(0),
+                m_offset(0)
+            {
             }
 
             /// \brief Creates a 1D array that references rhs.
@@ -152,7 +283,10 @@ namespace Nektar
                 m_count(rhs.m_count),
                 m_offset(rhs.m_offset)
             {
-                *m_count += 1;
+                if( m_count != 0 )
+                {
+                    detail::IncrementCount(m_count);
+                }
                 ASSERTL0(m_size <= rhs.num_elements(), "Requested size is larger than input array size.");
             }
 
@@ -164,7 +298,10 @@ namespace Nektar
                 m_count(rhs.m_count),
                 m_offset(rhs.m_offset)
             {
-                *m_count += 1;
+                if( m_count != 0 )
+                {
+                    detail::IncrementCount(m_count);
+                }
             }
 
             ~Array()
@@ -174,49 +311,52 @@ namespace Nektar
                     return;
                 }
 
-                *m_count -= 1;
-                if( *m_count == 0 )
+                if( detail::DecrementCount(m_count) == 0 )
                 {
-                    ArrayDestructionPolicy<DataType>::Destroy(m_data+1, m_capacity);
-                    MemoryManager<DataType>::RawDeallocate(m_data, m_capacity+1);
+                    ArrayDestructionPolicy<DataType>::Destroy(m_data, m_capacity);
+                    detail::DeallocateArrayStorage(m_data, m_capacity*sizeof(DataType));
                 }
             }
 
             /// \brief Creates a reference to rhs.
             Array<OneD, const DataType>& operator=(const Array<OneD, const DataType>& rhs)
             {
-                *m_count -= 1;
-                if( *m_count == 0 )
+                // Take the new reference first so that self-assignment
+                // does not release the storage.
+                if( rhs.m_count != 0 )
+                {
+                    detail::IncrementCount(rhs.m_count);
+                }
+                if( m_count != 0 && detail::DecrementCount(m_count) == 0 )
                 {
-                    ArrayDestructionPolicy<DataType>::Destroy(m_data+1, m_capacity);
-                    MemoryManager<DataType>::RawDeallocate(m_data, m_capacity+1);
+                    ArrayDestructionPolicy<DataType>::Destroy(m_data, m_capacity);
+                    detail::DeallocateArrayStorage(m_data, m_capacity*sizeof(DataType));
                 }
 
                 m_data = rhs.m_data;
                 m_capacity = rhs.m_capacity;
                 m_count = rhs.m_count;
-                *m_count += 1;
                 m_offset = rhs.m_offset;
                 m_size = rhs.m_size;
                 return *this;
             }
 
-            const_iterator begin() const { return m_data + m_offset + 1; }
-            const_iterator end() const { return m_data + m_offset + m_size + 1; }
+            const_iterator begin() const { return m_data + m_offset; }
+            const_iterator end() const { return m_data + m_offset + m_size; }
 
             const_reference operator[](unsigned int i) const
             {
                 ASSERTL1(static_cast<size_type>(i) < m_size, (std::string("Element ") +
                     boost::lexical_cast<std::string>(i) + std::string(" requested in an array of size ") +
                     boost::lexical_cast<std::string>(m_size)));
-                return *(m_data + i + m_offset + 1);
+                return *(m_data + i + m_offset);
             }
 
             /// \brief Returns a c-style pointer to the underlying array.
-            const element* get() const { return m_data+m_offset+1; }
+            const element* get() const { return m_data+m_offset; }
 
             /// \brief Returns a c-style pointer to the underlying array.
-            const element* data() const { return m_data+m_offset+1; }
+            const element* data() const { return m_data+m_offset; }
 
             /// \brief Returns 1.
             size_type num_dimensions() const { return 1; }
@@ -229,6 +369,30 @@ namespace Nektar
             /// \brief Returns the array's offset.
             unsigned int GetOffset() const { return m_offset; }
 
+            /// \brief Returns the largest power of two, up to 64, dividing
+            /// the address of the first element.
+            ///
+            /// Storage of at least detail::ArrayAlignment bytes is aligned
+            /// to detail::ArrayAlignment and padded to a multiple of it;
+            /// arrays created with an offset are aligned accordingly.
+            unsigned int GetAlignment() const
+            {
+                size_t address = reinterpret_cast<size_t>(get());
+                unsigned int alignment = 1;
+                while (alignment < 64 && address % (2*alignment) == 0)
+                {
+                    alignment *= 2;
+                }
+                return alignment;
+            }
+
+            /// \brief Returns true if the first element is aligned to
+            /// bytes, which must be a power of two.
+            bool IsAligned(unsigned int bytes = detail::ArrayAlignment) const
+            {
+                return reinterpret_cast<size_t>(get()) % bytes == 0;
+            }
+
             /// \brief Returns true is this array and rhs overlap.
             bool Overlaps(const Array<OneD, const DataType>& rhs) const
             {
@@ -292,10 +456,8 @@ namespace Nektar
         void
             CreateStorage(unsigned int size)
             {
-                DataType* storage = MemoryManager<DataType>::RawAllocate(size+1);
-                m_data = storage;
-                m_count = (unsigned int*)storage;
-                *m_count = 1;
+                m_data = static_cast<DataType*>(
+                    detail::AllocateArrayStorage(size*sizeof(DataType), m_count));
                 //return NekPtr<DataType>(storage, size);
                 //return boost::shared_ptr<DataType>(storage,
                         //boost::bind(DeleteStorage<DataType>, storage, size) );
@@ -504,6 +666,11 @@ namespace Nektar
             {
             }
 
+            Array(unsigned int dim1Size, DataType* data, ArrayStorageWrapper w) :
+                BaseType(dim1Size, data, w)
+            {
+            }
+
             Array(unsigned int dim1Size, const Array<OneD, DataType>& rhs) :
                 BaseType(dim1Size, rhs)
             {
@@ -539,10 +706,10 @@ namespace Nektar
             }
 
             using BaseType::begin;
-            iterator begin() { return this->m_data + 1 +this->m_offset; }
+            iterator begin() { return this->m_data + this->m_offset; }
 
             using BaseType::end;
-            iterator end() { return this->m_data + 1 + this->m_offset + this->m_size; }
+            iterator end() { return this->m_data + this->m_offset + this->m_size; }
 
             using BaseType::operator[];
             reference operator[](unsigned int i)
@@ -555,10 +722,10 @@ namespace Nektar
 
 
             using BaseType::get;
-            element* get() { return this->m_data + 1 +this->m_offset; }
+            element* get() { return this->m_data + this->m_offset; }
 
             using BaseType::data;
-            element* data() { return this->m_data + 1 +this->m_offset; }
+            element* data() { return this->m_data + this->m_offset; }
 
             template<typename T1>
             friend class NekVector;
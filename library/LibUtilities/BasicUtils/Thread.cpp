@@ -0,0 +1,271 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Thread.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Thread pool for shared-memory parallel loops
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#include <LibUtilities/BasicUtils/Thread.h>
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+
+#include <loki/Singleton.h>
+#include <boost/bind.hpp>
+
+#include <algorithm>
+#include <exception>
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        ThreadPool &GetThreadPool()
+        {
+            typedef Loki::SingletonHolder<ThreadPool,
+                                          Loki::CreateUsingNew,
+                                          Loki::DefaultLifetime> Type;
+            return Type::Instance();
+        }
+
+        /**
+         * @class ThreadPool
+         *
+         * The pool evaluates the elemental loops of the library on several
+         * threads of a single process. By default it holds only the calling
+         * thread and loops are evaluated serially. Loops are partitioned
+         * statically into contiguous chunks, the first of which is evaluated
+         * by the calling thread. Parallel loops requested from a worker, or
+         * from within another parallel loop, are evaluated serially.
+         */
+        ThreadPool::ThreadPool() :
+            m_workers(),
+            m_tasks(),
+            m_mutex(),
+            m_numThreads(1),
+            m_pending(0),
+            m_shutdown(false),
+            m_inParallel(false),
+            m_masterId(boost::this_thread::get_id()),
+            m_error()
+        {
+        }
+
+        ThreadPool::~ThreadPool()
+        {
+            StopWorkers();
+        }
+
+        /**
+         * @param   n           Number of threads, including the calling
+         *                      thread. A value of one disables threading.
+         *                      Builds without NEKTAR_USE_THREADS always
+         *                      use one thread, since their array reference
+         *                      counts are not updated atomically.
+         */
+        void ThreadPool::SetNumThreads(unsigned int n)
+        {
+            ASSERTL0(n > 0, "Number of threads must be positive.");
+            ASSERTL0(!m_inParallel,
+                     "Cannot change number of threads in a parallel loop.");
+
+#ifndef NEKTAR_USING_THREADS
+            if (n > 1)
+            {
+                NEKERROR(ErrorUtil::ewarning,
+                         "Nektar++ was built without NEKTAR_USE_THREADS; "
+                         "using one thread.");
+                n = 1;
+            }
+#endif
+
+            StopWorkers();
+
+            m_masterId   = boost::this_thread::get_id();
+            m_numThreads = n;
+            m_shutdown   = false;
+
+            for (unsigned int i = 1; i < n; ++i)
+            {
+                m_workers.push_back(boost::shared_ptr<boost::thread>(
+                    new boost::thread(
+                        boost::bind(&ThreadPool::WorkerLoop, this))));
+            }
+        }
+
+        /**
+         * @param   n           Number of loop iterations.
+         * @param   func        Function evaluating the iterations in the
+         *                      range [start, end).
+         */
+        void ThreadPool::ParallelFor(const int n, const ThreadRangeFunc &func)
+        {
+            if (n <= 0)
+            {
+                return;
+            }
+
+            int nchunk = std::min((int) m_numThreads, n);
+
+            if (nchunk <= 1 || m_inParallel ||
+                boost::this_thread::get_id() != m_masterId)
+            {
+                func(0, n);
+                return;
+            }
+
+            m_inParallel = true;
+
+            int chunk = n / nchunk;
+            int rem   = n % nchunk;
+            int start = chunk + (rem > 0 ? 1 : 0);
+
+            for (int c = 1; c < nchunk; ++c)
+            {
+                int end = start + chunk + (c < rem ? 1 : 0);
+                QueueTask(boost::bind(func, start, end));
+                start = end;
+            }
+
+            try
+            {
+                func(0, chunk + (rem > 0 ? 1 : 0));
+            }
+            catch (...)
+            {
+                Wait();
+                m_inParallel = false;
+                throw;
+            }
+
+            m_inParallel = false;
+            Wait();
+        }
+
+        void ThreadPool::QueueTask(const ThreadTaskFunc &task)
+        {
+            if (m_numThreads <= 1)
+            {
+                task();
+                return;
+            }
+
+            boost::mutex::scoped_lock lock(m_mutex);
+            m_tasks.push_back(task);
+            ++m_pending;
+            m_taskCond.notify_one();
+        }
+
+        /**
+         * If a task raised an error, it is reported once all tasks have
+         * completed.
+         */
+        void ThreadPool::Wait()
+        {
+            std::string error;
+
+            {
+                boost::mutex::scoped_lock lock(m_mutex);
+                while (m_pending > 0)
+                {
+                    m_doneCond.wait(lock);
+                }
+                error.swap(m_error);
+            }
+
+            ASSERTL0(error.empty(), error.c_str());
+        }
+
+        void ThreadPool::WorkerLoop()
+        {
+            for (;;)
+            {
+                ThreadTaskFunc task;
+
+                {
+                    boost::mutex::scoped_lock lock(m_mutex);
+                    while (m_tasks.empty() && !m_shutdown)
+                    {
+                        m_taskCond.wait(lock);
+                    }
+
+                    if (m_tasks.empty())
+                    {
+                        return;
+                    }
+
+                    task = m_tasks.front();
+                    m_tasks.pop_front();
+                }
+
+                std::string error;
+                try
+                {
+                    task();
+                }
+                catch (std::exception &e)
+                {
+                    error = e.what();
+                }
+                catch (...)
+                {
+                    error = "Unknown error in thread pool task.";
+                }
+
+                boost::mutex::scoped_lock lock(m_mutex);
+                if (!error.empty() && m_error.empty())
+                {
+                    m_error = error;
+                }
+                if (--m_pending == 0)
+                {
+                    m_doneCond.notify_all();
+                }
+            }
+        }
+
+        void ThreadPool::StopWorkers()
+        {
+            {
+                boost::mutex::scoped_lock lock(m_mutex);
+                m_shutdown = true;
+                m_taskCond.notify_all();
+            }
+
+            for (unsigned int i = 0; i < m_workers.size(); ++i)
+            {
+                m_workers[i]->join();
+            }
+            m_workers.clear();
+
+            m_numThreads = 1;
+        }
+    }
+}
@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: Thread.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Thread pool for shared-memory parallel loops
+//
+///////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef NEKTAR_LIB_UTILITIES_BASIC_UTILS_THREAD_H
+#define NEKTAR_LIB_UTILITIES_BASIC_UTILS_THREAD_H
+
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+
+#include <boost/function.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/condition_variable.hpp>
+
+#include <boost/shared_ptr.hpp>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace Nektar
+{
+    namespace LibUtilities
+    {
+        /// Function evaluated over the half-open loop range [start, end).
+        typedef boost::function<void (const int, const int)> ThreadRangeFunc;
+
+        /// Function executed as a single task.
+        typedef boost::function<void ()> ThreadTaskFunc;
+
+        /// Pool of worker threads for shared-memory parallel loops.
+        class ThreadPool
+        {
+            public:
+                LIB_UTILITIES_EXPORT ThreadPool();
+                LIB_UTILITIES_EXPORT ~ThreadPool();
+
+                /// Sets the number of threads, including the calling thread.
+                LIB_UTILITIES_EXPORT void SetNumThreads(unsigned int n);
+
+                /// Number of threads, including the calling thread.
+                inline unsigned int GetNumThreads() const;
+
+                /// Evaluates a loop split into contiguous chunks.
+                LIB_UTILITIES_EXPORT void ParallelFor(
+                    const int              n,
+                    const ThreadRangeFunc &func);
+
+                /// Adds a task to the queue.
+                LIB_UTILITIES_EXPORT void QueueTask(const ThreadTaskFunc &task);
+
+                /// Blocks until all queued tasks have completed.
+                LIB_UTILITIES_EXPORT void Wait();
+
+            private:
+                ThreadPool(const ThreadPool &rhs);
+                ThreadPool &operator=(const ThreadPool &rhs);
+
+                void WorkerLoop();
+                void StopWorkers();
+
+                /// Worker threads.
+                std::vector<boost::shared_ptr<boost::thread> > m_workers;
+
+                /// Tasks waiting for a worker.
+                std::deque<ThreadTaskFunc> m_tasks;
+
+                /// Guards the task queue and counters.
+                boost::mutex m_mutex;
+
+                /// Signalled when tasks are queued or the workers stop.
+                boost::condition_variable m_taskCond;
+
+                /// Signalled when all tasks have completed.
+                boost::condition_variable m_doneCond;
+
+                /// Number of threads, including the calling thread.
+                unsigned int m_numThreads;
+
+                /// Number of queued or running tasks.
+                unsigned int m_pending;
+
+                /// Set when the workers should exit.
+                bool m_shutdown;
+
+                /// Set while a parallel loop is being evaluated.
+                bool m_inParallel;
+
+                /// Thread which owns the pool.
+                boost::thread::id m_masterId;
+
+                /// First error raised by a task.
+                std::string m_error;
+        };
+
+        inline unsigned int ThreadPool::GetNumThreads() const
+        {
+            return m_numThreads;
+        }
+
+        /// Returns the thread pool of this process.
+        LIB_UTILITIES_EXPORT ThreadPool &GetThreadPool();
+    }
+}
+
+#endif //NEKTAR_LIB_UTILITIES_BASIC_UTILS_THREAD_H
@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <LibUtilities/BasicUtils/VmathSIMD.h>
 #include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
 #include <LibUtilities/LibUtilitiesDeclspec.h>
 
@@ -169,13 +170,7 @@ namespace Vmath
         ++n;
         if (incx == 1 && incy == 1 && incz == 1)
         {
-            while( --n )
-            {
-                *z = (*x) * (*y);
-                ++x;
-                ++y;
-                ++z;
-            }
+            SIMD::GetKernels().Vmul(n-1, x, y, z);
         }
         else
         {
@@ -199,12 +194,7 @@ namespace Vmath
         ++n;
         if (incx == 1 && incy == 1)
         {
-            while( --n )
-            {
-                *y = alpha * (*x);
-                ++x;
-                ++y;
-            }
+            SIMD::GetKernels().Smul(n-1, alpha, x, y);
         }
         else
         {
@@ -225,15 +215,9 @@ namespace Vmath
                   const int incy,  T*z, const int incz)
     {
         ++n;
-        if (incx == 1 && incy == 1)
+        if (incx == 1 && incy == 1 && incz == 1)
         {
-            while( --n )
-            {
-                *z = (*x) / (*y);
-                ++x;
-                ++y;
-                ++z;
-            }
+            SIMD::GetKernels().Vdiv(n-1, x, y, z);
         }
         else
         {
@@ -282,6 +266,12 @@ namespace Vmath
     template<class T>  void Vadd( int n, const T *x, const int incx, const T *y,
                                   const int incy,  T *z, const int incz)
     {
+        if (incx == 1 && incy == 1 && incz == 1)
+        {
+            SIMD::GetKernels().Vadd(n, x, y, z);
+            return;
+        }
+
         while( n-- )
         {
             *z = (*x) + (*y);
@@ -301,12 +291,7 @@ namespace Vmath
         ++n;
         if (incx == 1 && incy == 1)
         {
-            while( --n )
-            {
-                *y = alpha + (*x);
-                ++x;
-                ++y;
-            }
+            SIMD::GetKernels().Sadd(n-1, alpha, x, y);
         }
         else
         {
@@ -329,13 +314,7 @@ namespace Vmath
         ++n;
         if (incx == 1 && incy == 1 && incz == 1)
         {
-            while( --n )
-            {
-                *z = (*x) - (*y);
-                ++x;
-                ++y;
-                ++z;
-            }
+            SIMD::GetKernels().Vsub(n-1, x, y, z);
         }
         else
         {
@@ -428,6 +407,12 @@ namespace Vmath
                                  const T *y, const int incy,
                                        T *z, const int incz)
     {
+        if (incw == 1 && incx == 1 && incy == 1 && incz == 1)
+        {
+            SIMD::GetKernels().Vvtvp(n, w, x, y, z);
+            return;
+        }
+
         while( n-- )
         {
             *z = (*w) * (*x) + (*y);
@@ -449,6 +434,12 @@ namespace Vmath
                  const int incx, const T *y, const int incy,
                  T *z, const int incz)
     {
+        if (incw == 1 && incx == 1 && incy == 1 && incz == 1)
+        {
+            SIMD::GetKernels().Vvtvm(n, w, x, y, z);
+            return;
+        }
+
         while( n-- )
         {
             *z = (*w) * (*x) - (*y);
@@ -472,13 +463,7 @@ namespace Vmath
         ++n;
         if (incx == 1 && incy == 1 && incz == 1)
         {
-            while( --n )
-            {
-                *z = alpha * (*x) + (*y);
-                ++x;
-                ++y;
-                ++z;
-            }
+            SIMD::GetKernels().Svtvp(n-1, alpha, x, y, z);
         }
         else
         {
@@ -524,6 +509,13 @@ namespace Vmath
                                     const T* y, int incy,
                                           T* z, int incz)
     {
+        if (incv == 1 && incw == 1 && incx == 1 && incy == 1 &&
+            incz == 1)
+        {
+            SIMD::GetKernels().Vvtvvtp(n, v, w, x, y, z);
+            return;
+        }
+
         while( n-- )
         {
             *z = (*v) * (*w) + (*x) * (*y);
@@ -551,6 +543,13 @@ namespace Vmath
                                     const T* y, int incy,
                                           T* z, int incz)
     {
+        if (incv == 1 && incw == 1 && incx == 1 && incy == 1 &&
+            incz == 1)
+        {
+            SIMD::GetKernels().Vvtvvtm(n, v, w, x, y, z);
+            return;
+        }
+
         while( n-- )
         {
             *z = (*v) * (*w) - (*x) * (*y);
@@ -578,6 +577,12 @@ namespace Vmath
                                     const T* y, int incy,
                                           T* z, int incz)
     {
+        if (incx == 1 && incy == 1 && incz == 1)
+        {
+            SIMD::GetKernels().Svtsvtp(n, alpha, x, beta, y, z);
+            return;
+        }
+
         while( n-- )
         {
             *z = alpha * (*x) + beta * (*y);
@@ -594,6 +599,66 @@ namespace Vmath
                                 const Nektar::NekDouble* y, int incy,
                                       Nektar::NekDouble* z, int incz);
 
+    /// \brief  svvt (scalar times vector times vector): z = alpha*(x*y)
+    template<class T> void Svvt (int n,
+                                 const T alpha,
+                                 const T* x, int incx,
+                                 const T* y, int incy,
+                                       T* z, int incz)
+    {
+        if (incx == 1 && incy == 1 && incz == 1)
+        {
+            SIMD::GetKernels().Svvt(n, alpha, x, y, z);
+            return;
+        }
+
+        while( n-- )
+        {
+            *z = alpha * ((*x) * (*y));
+            x += incx;
+            y += incy;
+            z += incz;
+        }
+    }
+
+    template LIB_UTILITIES_EXPORT void Svvt (int n,
+                                const Nektar::NekDouble alpha,
+                                const Nektar::NekDouble* x, int incx,
+                                const Nektar::NekDouble* y, int incy,
+                                      Nektar::NekDouble* z, int incz);
+
+    /// \brief  svvtvp (scalar times vector times vector plus vector):
+    // z = alpha*(w*x) + y
+    template<class T> void Svvtvp (int n,
+                                   const T alpha,
+                                   const T* w, int incw,
+                                   const T* x, int incx,
+                                   const T* y, int incy,
+                                         T* z, int incz)
+    {
+        if (incw == 1 && incx == 1 && incy == 1 && incz == 1)
+        {
+            SIMD::GetKernels().Svvtvp(n, alpha, w, x, y, z);
+            return;
+        }
+
+        while( n-- )
+        {
+            *z = alpha * ((*w) * (*x)) + (*y);
+            w += incw;
+            x += incx;
+            y += incy;
+            z += incz;
+        }
+    }
+
+    template LIB_UTILITIES_EXPORT void Svvtvp (int n,
+                                const Nektar::NekDouble alpha,
+                                const Nektar::NekDouble* w, int incw,
+                                const Nektar::NekDouble* x, int incx,
+                                const Nektar::NekDouble* y, int incy,
+                                      Nektar::NekDouble* z, int incz);
+
 
     /// \brief  Vstvpp (scalar times vector plus vector plus vector):
     // z = v*w + x*y
@@ -184,6 +184,22 @@ namespace Vmath
                                     const T* y, int incy,
                                           T* z, int incz);
 
+    /// \brief  Svvt (scalar times vector times vector): z = alpha*(x*y)
+    template<class T> LIB_UTILITIES_EXPORT void Svvt (int n,
+                                    const T alpha,
+                                    const T* x, int incx,
+                                    const T* y, int incy,
+                                          T* z, int incz);
+
+    /// \brief  Svvtvp (scalar times vector times vector plus vector):
+    // z = alpha*(w*x) + y
+    template<class T> LIB_UTILITIES_EXPORT void Svvtvp (int n,
+                                    const T alpha,
+                                    const T* w, int incw,
+                                    const T* x, int incx,
+                                    const T* y, int incy,
+                                          T* z, int incz);
+
     /// \brief  Vstvpp (scalar times vector plus vector plus vector): 
     // z = v*w + x*y
     template<class T> LIB_UTILITIES_EXPORT void Vstvpp(int n,
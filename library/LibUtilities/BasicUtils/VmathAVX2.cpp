@@ -0,0 +1,67 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: VmathAVX2.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Vmath kernels using AVX2 intrinsics
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <immintrin.h>
+
+#include <LibUtilities/BasicUtils/VmathSIMDKernels.hpp>
+
+namespace Vmath
+{
+    namespace SIMD
+    {
+        namespace
+        {
+            struct AVX2Vec
+            {
+                typedef __m256d vec;
+                static const int width = 4;
+
+                static vec  load (const NekDouble *p)  { return _mm256_loadu_pd(p); }
+                static void store(NekDouble *p, vec a) { _mm256_storeu_pd(p, a); }
+                static vec  set1 (NekDouble a)         { return _mm256_set1_pd(a); }
+                static vec  add  (vec a, vec b)        { return _mm256_add_pd(a, b); }
+                static vec  sub  (vec a, vec b)        { return _mm256_sub_pd(a, b); }
+                static vec  mul  (vec a, vec b)        { return _mm256_mul_pd(a, b); }
+                static vec  div  (vec a, vec b)        { return _mm256_div_pd(a, b); }
+            };
+        }
+
+        const Kernels &GetAVX2Kernels()
+        {
+            static const Kernels kernels = KernelImpl<AVX2Vec>::Create();
+            return kernels;
+        }
+    }
+}
@@ -287,6 +287,27 @@
             Svtsvtp(n,alpha,&x[0],incx,beta,&y[0],incy,&z[0],incz);
         }
 
+        /// \brief  Svvt (scalar times vector times vector): z = alpha*(x*y)
+        template<class T> void Svvt(int n, const T alpha, const Array<OneD,const T> &x, const int incx, const Array<OneD,const T> &y, const int incy,  Array<OneD,T> &z, const int incz)
+        {
+            ASSERTL1(n*incx <= x.num_elements()+x.GetOffset(),"Array out of bounds");
+            ASSERTL1(n*incy <= y.num_elements()+y.GetOffset(),"Array out of bounds");
+            ASSERTL1(n*incz <= z.num_elements()+z.GetOffset(),"Array out of bounds");
+
+            Svvt(n,alpha,&x[0],incx,&y[0],incy,&z[0],incz);
+        }
+
+        /// \brief  Svvtvp (scalar times vector times vector plus vector): z = alpha*(w*x) + y
+        template<class T> void Svvtvp(int n, const T alpha, const Array<OneD,const T> &w, const int incw, const Array<OneD,const T> &x, const int incx, const Array<OneD,const T> &y, const int incy,  Array<OneD,T> &z, const int incz)
+        {
+            ASSERTL1(n*incw <= w.num_elements()+w.GetOffset(),"Array out of bounds");
+            ASSERTL1(n*incx <= x.num_elements()+x.GetOffset(),"Array out of bounds");
+            ASSERTL1(n*incy <= y.num_elements()+y.GetOffset(),"Array out of bounds");
+            ASSERTL1(n*incz <= z.num_elements()+z.GetOffset(),"Array out of bounds");
+
+            Svvtvp(n,alpha,&w[0],incw,&x[0],incx,&y[0],incy,&z[0],incz);
+        }
+
 
 
 
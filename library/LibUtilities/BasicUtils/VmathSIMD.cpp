@@ -0,0 +1,190 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: VmathSIMD.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Runtime selection of vectorised unit-stride Vmath kernels
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <LibUtilities/BasicUtils/VmathSIMDKernels.hpp>
+
+namespace Vmath
+{
+    namespace SIMD
+    {
+        namespace
+        {
+            /// Scalar "vector" type: reproduces the original Vmath loops.
+            struct ScalarVec
+            {
+                typedef NekDouble vec;
+                static const int width = 1;
+
+                static vec  load (const NekDouble *p)    { return *p; }
+                static void store(NekDouble *p, vec a)   { *p = a; }
+                static vec  set1 (NekDouble a)           { return a; }
+                static vec  add  (vec a, vec b)          { return a + b; }
+                static vec  sub  (vec a, vec b)          { return a - b; }
+                static vec  mul  (vec a, vec b)          { return a * b; }
+                static vec  div  (vec a, vec b)          { return a / b; }
+            };
+
+            bool IsSupported(InstructionSet isa)
+            {
+                switch (isa)
+                {
+                    case eScalar:
+                        return true;
+#if defined(NEKTAR_VMATH_SSE2)
+                    case eSSE2:
+                        return __builtin_cpu_supports("sse2");
+#endif
+#if defined(NEKTAR_VMATH_AVX2)
+                    case eAVX2:
+                        return __builtin_cpu_supports("avx2");
+#endif
+#if defined(NEKTAR_VMATH_AVX512)
+                    case eAVX512:
+                        return __builtin_cpu_supports("avx512f");
+#endif
+                    default:
+                        return false;
+                }
+            }
+
+            /**
+             * Picks the widest instruction set supported by both the build
+             * and the processor. The NEKTAR_VMATH_ISA environment variable
+             * may be set to one of InstructionSetMap to override this, e.g.
+             * to obtain the scalar reference behaviour.
+             */
+            InstructionSet DefaultInstructionSet()
+            {
+#if defined(NEKTAR_VMATH_SSE2) || defined(NEKTAR_VMATH_AVX2) || \
+    defined(NEKTAR_VMATH_AVX512)
+                __builtin_cpu_init();
+#endif
+                const char *env = std::getenv("NEKTAR_VMATH_ISA");
+                if (env)
+                {
+                    for (int i = 0; i < SIZE_InstructionSet; ++i)
+                    {
+                        if (boost::iequals(env, InstructionSetMap[i]) &&
+                            IsSupported((InstructionSet)i))
+                        {
+                            return (InstructionSet)i;
+                        }
+                    }
+                }
+
+                for (int i = SIZE_InstructionSet-1; i > eScalar; --i)
+                {
+                    if (IsSupported((InstructionSet)i))
+                    {
+                        return (InstructionSet)i;
+                    }
+                }
+                return eScalar;
+            }
+
+            InstructionSet &ActiveInstructionSet()
+            {
+                static InstructionSet isa = DefaultInstructionSet();
+                return isa;
+            }
+
+            const Kernels *&ActiveKernels()
+            {
+                static const Kernels *kernels =
+                    GetKernels(ActiveInstructionSet());
+                return kernels;
+            }
+        }
+
+        const Kernels &GetScalarKernels()
+        {
+            static const Kernels kernels = KernelImpl<ScalarVec>::Create();
+            return kernels;
+        }
+
+        const Kernels &GetKernels()
+        {
+            return *ActiveKernels();
+        }
+
+        const Kernels *GetKernels(InstructionSet isa)
+        {
+            if (!IsSupported(isa))
+            {
+                return NULL;
+            }
+
+            switch (isa)
+            {
+#if defined(NEKTAR_VMATH_SSE2)
+                case eSSE2:
+                    return &GetSSE2Kernels();
+#endif
+#if defined(NEKTAR_VMATH_AVX2)
+                case eAVX2:
+                    return &GetAVX2Kernels();
+#endif
+#if defined(NEKTAR_VMATH_AVX512)
+                case eAVX512:
+                    return &GetAVX512Kernels();
+#endif
+                default:
+                    return &GetScalarKernels();
+            }
+        }
+
+        InstructionSet GetInstructionSet()
+        {
+            return ActiveInstructionSet();
+        }
+
+        bool SetInstructionSet(InstructionSet isa)
+        {
+            const Kernels *kernels = GetKernels(isa);
+            if (!kernels)
+            {
+                return false;
+            }
+
+            ActiveInstructionSet() = isa;
+            ActiveKernels()        = kernels;
+            return true;
+        }
+    }
+}
@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: VmathSIMD.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Runtime selection of vectorised unit-stride Vmath kernels
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_LIBUTILITIES_BASICUTILS_VMATHSIMD_H
+#define NEKTAR_LIB_LIBUTILITIES_BASICUTILS_VMATHSIMD_H
+
+#include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+
+namespace Vmath
+{
+    namespace SIMD
+    {
+        using Nektar::NekDouble;
+
+        /// Instruction sets for which Vmath kernels may be available.
+        enum InstructionSet
+        {
+            eScalar,
+            eSSE2,
+            eAVX2,
+            eAVX512,
+            SIZE_InstructionSet
+        };
+
+        const char* const InstructionSetMap[] =
+        {
+            "Scalar",
+            "SSE2",
+            "AVX2",
+            "AVX512"
+        };
+
+        /**
+         * @brief Unit-stride double precision kernels for one instruction
+         * set.
+         *
+         * The operation order of every kernel matches the scalar loops in
+         * Vmath.cpp (no fused multiply-add is used), so all instruction sets
+         * give bitwise identical results.
+         */
+        struct Kernels
+        {
+            /// z = x*y
+            void (*Vmul)   (int n, const NekDouble *x, const NekDouble *y,
+                            NekDouble *z);
+            /// z = x+y
+            void (*Vadd)   (int n, const NekDouble *x, const NekDouble *y,
+                            NekDouble *z);
+            /// z = x-y
+            void (*Vsub)   (int n, const NekDouble *x, const NekDouble *y,
+                            NekDouble *z);
+            /// z = x/y
+            void (*Vdiv)   (int n, const NekDouble *x, const NekDouble *y,
+                            NekDouble *z);
+            /// y = alpha*x
+            void (*Smul)   (int n, const NekDouble alpha, const NekDouble *x,
+                            NekDouble *y);
+            /// y = alpha+x
+            void (*Sadd)   (int n, const NekDouble alpha, const NekDouble *x,
+                            NekDouble *y);
+            /// z = alpha*x + y
+            void (*Svtvp)  (int n, const NekDouble alpha, const NekDouble *x,
+                            const NekDouble *y, NekDouble *z);
+            /// z = w*x + y
+            void (*Vvtvp)  (int n, const NekDouble *w, const NekDouble *x,
+                            const NekDouble *y, NekDouble *z);
+            /// z = w*x - y
+            void (*Vvtvm)  (int n, const NekDouble *w, const NekDouble *x,
+                            const NekDouble *y, NekDouble *z);
+            /// z = v*w + x*y
+            void (*Vvtvvtp)(int n, const NekDouble *v, const NekDouble *w,
+                            const NekDouble *x, const NekDouble *y,
+                            NekDouble *z);
+            /// z = v*w - x*y
+            void (*Vvtvvtm)(int n, const NekDouble *v, const NekDouble *w,
+                            const NekDouble *x, const NekDouble *y,
+                            NekDouble *z);
+            /// z = alpha*x + beta*y
+            void (*Svtsvtp)(int n, const NekDouble alpha, const NekDouble *x,
+                            const NekDouble beta, const NekDouble *y,
+                            NekDouble *z);
+            /// z = alpha*(x*y)
+            void (*Svvt)   (int n, const NekDouble alpha, const NekDouble *x,
+                            const NekDouble *y, NekDouble *z);
+            /// z = alpha*(w*x) + y
+            void (*Svvtvp) (int n, const NekDouble alpha, const NekDouble *w,
+                            const NekDouble *x, const NekDouble *y,
+                            NekDouble *z);
+        };
+
+        /// Kernels for the active instruction set.
+        LIB_UTILITIES_EXPORT const Kernels &GetKernels();
+
+        /// Kernels for a given instruction set, or NULL if the library was
+        /// built without it or the processor does not support it.
+        LIB_UTILITIES_EXPORT const Kernels *GetKernels(InstructionSet isa);
+
+        /// Returns the active instruction set.
+        LIB_UTILITIES_EXPORT InstructionSet GetInstructionSet();
+
+        /// Selects the instruction set used by Vmath; returns false (and
+        /// leaves the selection unchanged) if it is not available.
+        LIB_UTILITIES_EXPORT bool SetInstructionSet(InstructionSet isa);
+    }
+}
+
+#endif
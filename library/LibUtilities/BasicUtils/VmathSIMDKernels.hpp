@@ -0,0 +1,312 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: VmathSIMDKernels.hpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Unit-stride Vmath kernels templated on a vector type
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_LIBUTILITIES_BASICUTILS_VMATHSIMDKERNELS_HPP
+#define NEKTAR_LIB_LIBUTILITIES_BASICUTILS_VMATHSIMDKERNELS_HPP
+
+#include <LibUtilities/BasicUtils/VmathSIMD.h>
+
+namespace Vmath
+{
+    namespace SIMD
+    {
+        /**
+         * @brief Unit-stride kernels written in terms of a vector type @a V.
+         *
+         * @a V provides the register type @c vec, its @c width in doubles and
+         * static @c load, @c store, @c set1, @c add, @c sub, @c mul and
+         * @c div functions. Each instruction set is compiled in its own
+         * translation unit with the matching compiler flags, so this header
+         * must only contain templates on @a V. Loads and stores are
+         * unaligned; the remainder of each loop is handled by scalar code.
+         */
+        template<class V>
+        struct KernelImpl
+        {
+            typedef typename V::vec vec;
+
+            static void Vmul(int n, const NekDouble *x, const NekDouble *y,
+                             NekDouble *z)
+            {
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::mul(V::load(x+i), V::load(y+i)));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = x[i] * y[i];
+                }
+            }
+
+            static void Vadd(int n, const NekDouble *x, const NekDouble *y,
+                             NekDouble *z)
+            {
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::add(V::load(x+i), V::load(y+i)));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = x[i] + y[i];
+                }
+            }
+
+            static void Vsub(int n, const NekDouble *x, const NekDouble *y,
+                             NekDouble *z)
+            {
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::sub(V::load(x+i), V::load(y+i)));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = x[i] - y[i];
+                }
+            }
+
+            static void Vdiv(int n, const NekDouble *x, const NekDouble *y,
+                             NekDouble *z)
+            {
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::div(V::load(x+i), V::load(y+i)));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = x[i] / y[i];
+                }
+            }
+
+            static void Smul(int n, const NekDouble alpha, const NekDouble *x,
+                             NekDouble *y)
+            {
+                const vec a = V::set1(alpha);
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(y+i, V::mul(a, V::load(x+i)));
+                }
+                for (; i < n; ++i)
+                {
+                    y[i] = alpha * x[i];
+                }
+            }
+
+            static void Sadd(int n, const NekDouble alpha, const NekDouble *x,
+                             NekDouble *y)
+            {
+                const vec a = V::set1(alpha);
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(y+i, V::add(a, V::load(x+i)));
+                }
+                for (; i < n; ++i)
+                {
+                    y[i] = alpha + x[i];
+                }
+            }
+
+            static void Svtvp(int n, const NekDouble alpha,
+                              const NekDouble *x, const NekDouble *y,
+                              NekDouble *z)
+            {
+                const vec a = V::set1(alpha);
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::add(V::mul(a, V::load(x+i)),
+                                         V::load(y+i)));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = alpha * x[i] + y[i];
+                }
+            }
+
+            static void Vvtvp(int n, const NekDouble *w, const NekDouble *x,
+                              const NekDouble *y, NekDouble *z)
+            {
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::add(V::mul(V::load(w+i), V::load(x+i)),
+                                         V::load(y+i)));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = w[i] * x[i] + y[i];
+                }
+            }
+
+            static void Vvtvm(int n, const NekDouble *w, const NekDouble *x,
+                              const NekDouble *y, NekDouble *z)
+            {
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::sub(V::mul(V::load(w+i), V::load(x+i)),
+                                         V::load(y+i)));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = w[i] * x[i] - y[i];
+                }
+            }
+
+            static void Vvtvvtp(int n, const NekDouble *v, const NekDouble *w,
+                                const NekDouble *x, const NekDouble *y,
+                                NekDouble *z)
+            {
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::add(V::mul(V::load(v+i), V::load(w+i)),
+                                         V::mul(V::load(x+i), V::load(y+i))));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = v[i] * w[i] + x[i] * y[i];
+                }
+            }
+
+            static void Vvtvvtm(int n, const NekDouble *v, const NekDouble *w,
+                                const NekDouble *x, const NekDouble *y,
+                                NekDouble *z)
+            {
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::sub(V::mul(V::load(v+i), V::load(w+i)),
+                                         V::mul(V::load(x+i), V::load(y+i))));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = v[i] * w[i] - x[i] * y[i];
+                }
+            }
+
+            static void Svtsvtp(int n, const NekDouble alpha,
+                                const NekDouble *x, const NekDouble beta,
+                                const NekDouble *y, NekDouble *z)
+            {
+                const vec a = V::set1(alpha);
+                const vec b = V::set1(beta);
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::add(V::mul(a, V::load(x+i)),
+                                         V::mul(b, V::load(y+i))));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = alpha * x[i] + beta * y[i];
+                }
+            }
+
+            static void Svvt(int n, const NekDouble alpha, const NekDouble *x,
+                             const NekDouble *y, NekDouble *z)
+            {
+                const vec a = V::set1(alpha);
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::mul(a, V::mul(V::load(x+i),
+                                                   V::load(y+i))));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = alpha * (x[i] * y[i]);
+                }
+            }
+
+            static void Svvtvp(int n, const NekDouble alpha,
+                               const NekDouble *w, const NekDouble *x,
+                               const NekDouble *y, NekDouble *z)
+            {
+                const vec a = V::set1(alpha);
+                int i = 0;
+                for (; i + V::width <= n; i += V::width)
+                {
+                    V::store(z+i, V::add(V::mul(a, V::mul(V::load(w+i),
+                                                          V::load(x+i))),
+                                         V::load(y+i)));
+                }
+                for (; i < n; ++i)
+                {
+                    z[i] = alpha * (w[i] * x[i]) + y[i];
+                }
+            }
+
+            static Kernels Create()
+            {
+                Kernels k;
+                k.Vmul    = &Vmul;
+                k.Vadd    = &Vadd;
+                k.Vsub    = &Vsub;
+                k.Vdiv    = &Vdiv;
+                k.Smul    = &Smul;
+                k.Sadd    = &Sadd;
+                k.Svtvp   = &Svtvp;
+                k.Vvtvp   = &Vvtvp;
+                k.Vvtvm   = &Vvtvm;
+                k.Vvtvvtp = &Vvtvvtp;
+                k.Vvtvvtm = &Vvtvvtm;
+                k.Svtsvtp = &Svtsvtp;
+                k.Svvt    = &Svvt;
+                k.Svvtvp  = &Svvtvp;
+                return k;
+            }
+        };
+
+        /// Kernel tables defined in the per-instruction-set sources.
+        const Kernels &GetScalarKernels();
+#ifdef NEKTAR_VMATH_SSE2
+        const Kernels &GetSSE2Kernels();
+#endif
+#ifdef NEKTAR_VMATH_AVX2
+        const Kernels &GetAVX2Kernels();
+#endif
+#ifdef NEKTAR_VMATH_AVX512
+        const Kernels &GetAVX512Kernels();
+#endif
+    }
+}
+
+#endif
@@ -40,9 +40,10 @@
 #include <boost/enable_shared_from_this.hpp>
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
 #include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 #include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
-namespace Nektar { template <typename Dim, typename DataType> class Array; }
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
 
 
 namespace Nektar
@@ -69,6 +70,28 @@ namespace Nektar
             ReduceMin
         };
 
+        /**
+         * @brief Handle to one or more outstanding non-blocking operations.
+         *
+         * A request is obtained from Comm::CreateRequest and holds a fixed
+         * number of slots. Each non-blocking call uses one slot, identified
+         * by its index, and Comm::WaitAll completes every slot.
+         */
+        class CommRequest
+        {
+            public:
+                CommRequest()
+                {
+                }
+
+                virtual ~CommRequest()
+                {
+                }
+        };
+
+        /// Pointer to a request object.
+        typedef boost::shared_ptr<CommRequest> CommRequestSharedPtr;
+
         /// Base communications class
         class Comm: public boost::enable_shared_from_this<Comm>
         {
@@ -91,6 +114,8 @@ namespace Nektar
                 LIB_UTILITIES_EXPORT inline void Recv(int pProc, Array<OneD, NekDouble>& pData);
                 LIB_UTILITIES_EXPORT inline void Recv(int pProc, Array<OneD, int>& pData);
                 LIB_UTILITIES_EXPORT inline void Recv(int pProc, std::vector<unsigned int>& pData);
+                LIB_UTILITIES_EXPORT inline void Send(int pProc, std::string& pData);
+                LIB_UTILITIES_EXPORT inline void Recv(int pProc, std::string& pData);
                 LIB_UTILITIES_EXPORT inline void SendRecv(int pSendProc,
                                      Array<OneD, NekDouble>& pSendData,
                                      int pRecvProc,
@@ -130,6 +155,66 @@ namespace Nektar
 													      Array<OneD, int>& pRecvDataSizeMap,
 													      Array<OneD, int>& pRecvDataOffsetMap);
 
+                LIB_UTILITIES_EXPORT inline CommRequestSharedPtr CreateRequest(
+                                         int pNumRequest);
+                LIB_UTILITIES_EXPORT inline void Isend(int pProc,
+                                         Array<OneD, NekDouble>& pData,
+                                         int pCount,
+                                         CommRequestSharedPtr pRequest,
+                                         int pLoc);
+                LIB_UTILITIES_EXPORT inline void Isend(int pProc,
+                                         Array<OneD, int>& pData,
+                                         int pCount,
+                                         CommRequestSharedPtr pRequest,
+                                         int pLoc);
+                LIB_UTILITIES_EXPORT inline void Irecv(int pProc,
+                                         Array<OneD, NekDouble>& pData,
+                                         int pCount,
+                                         CommRequestSharedPtr pRequest,
+                                         int pLoc);
+                LIB_UTILITIES_EXPORT inline void Irecv(int pProc,
+                                         Array<OneD, int>& pData,
+                                         int pCount,
+                                         CommRequestSharedPtr pRequest,
+                                         int pLoc);
+                LIB_UTILITIES_EXPORT inline void SendInit(int pProc,
+                                         Array<OneD, NekDouble>& pData,
+                                         int pCount,
+                                         CommRequestSharedPtr pRequest,
+                                         int pLoc);
+                LIB_UTILITIES_EXPORT inline void RecvInit(int pProc,
+                                         Array<OneD, NekDouble>& pData,
+                                         int pCount,
+                                         CommRequestSharedPtr pRequest,
+                                         int pLoc);
+                LIB_UTILITIES_EXPORT inline void StartAll(
+                                         CommRequestSharedPtr pRequest);
+                LIB_UTILITIES_EXPORT inline void IAllReduce(
+                                         Array<OneD, NekDouble>& pData,
+                                         enum ReduceOperator pOp,
+                                         CommRequestSharedPtr pRequest,
+                                         int pLoc);
+                LIB_UTILITIES_EXPORT inline void IAlltoAllv(
+                                         Array<OneD, NekDouble>& pSendData,
+                                         Array<OneD, int>& pSendDataSizeMap,
+                                         Array<OneD, int>& pSendDataOffsetMap,
+                                         Array<OneD, NekDouble>& pRecvData,
+                                         Array<OneD, int>& pRecvDataSizeMap,
+                                         Array<OneD, int>& pRecvDataOffsetMap,
+                                         CommRequestSharedPtr pRequest,
+                                         int pLoc);
+                LIB_UTILITIES_EXPORT inline void IAlltoAllv(
+                                         Array<OneD, int>& pSendData,
+                                         Array<OneD, int>& pSendDataSizeMap,
+                                         Array<OneD, int>& pSendDataOffsetMap,
+                                         Array<OneD, int>& pRecvData,
+                                         Array<OneD, int>& pRecvDataSizeMap,
+                                         Array<OneD, int>& pRecvDataOffsetMap,
+                                         CommRequestSharedPtr pRequest,
+                                         int pLoc);
+                LIB_UTILITIES_EXPORT inline void WaitAll(
+                                         CommRequestSharedPtr pRequest);
+
                 LIB_UTILITIES_EXPORT inline void SplitComm(int pRows, int pColumns);
                 LIB_UTILITIES_EXPORT inline CommSharedPtr GetRowComm();
                 LIB_UTILITIES_EXPORT inline CommSharedPtr GetColumnComm();
@@ -151,6 +236,8 @@ namespace Nektar
                 virtual void v_Recv(int pProc, Array<OneD, NekDouble>& pData) = 0;
                 virtual void v_Recv(int pProc, Array<OneD, int>& pData) = 0;
                 virtual void v_Recv(int pProc, std::vector<unsigned int>& pData) = 0;
+                virtual void v_Send(int pProc, std::string& pData) = 0;
+                virtual void v_Recv(int pProc, std::string& pData) = 0;
                 virtual void v_SendRecv(int pSendProc,
                                         Array<OneD, NekDouble>& pSendData,
                                         int pRecvProc,
@@ -191,6 +278,59 @@ namespace Nektar
 										Array<OneD, int>& pRecvData,
 										Array<OneD, int>& pRecvDataSizeMap,
 										Array<OneD, int>& pRecvDataOffsetMap) = 0;
+                virtual CommRequestSharedPtr v_CreateRequest(int pNumRequest) = 0;
+                virtual void v_Isend(int pProc,
+                                     Array<OneD, NekDouble>& pData,
+                                     int pCount,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc) = 0;
+                virtual void v_Isend(int pProc,
+                                     Array<OneD, int>& pData,
+                                     int pCount,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc) = 0;
+                virtual void v_Irecv(int pProc,
+                                     Array<OneD, NekDouble>& pData,
+                                     int pCount,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc) = 0;
+                virtual void v_Irecv(int pProc,
+                                     Array<OneD, int>& pData,
+                                     int pCount,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc) = 0;
+                virtual void v_SendInit(int pProc,
+                                        Array<OneD, NekDouble>& pData,
+                                        int pCount,
+                                        CommRequestSharedPtr pRequest,
+                                        int pLoc) = 0;
+                virtual void v_RecvInit(int pProc,
+                                        Array<OneD, NekDouble>& pData,
+                                        int pCount,
+                                        CommRequestSharedPtr pRequest,
+                                        int pLoc) = 0;
+                virtual void v_StartAll(CommRequestSharedPtr pRequest) = 0;
+                virtual void v_IAllReduce(Array<OneD, NekDouble>& pData,
+                                          enum ReduceOperator pOp,
+                                          CommRequestSharedPtr pRequest,
+                                          int pLoc) = 0;
+                virtual void v_IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                          Array<OneD, int>& pSendDataSizeMap,
+                                          Array<OneD, int>& pSendDataOffsetMap,
+                                          Array<OneD, NekDouble>& pRecvData,
+                                          Array<OneD, int>& pRecvDataSizeMap,
+                                          Array<OneD, int>& pRecvDataOffsetMap,
+                                          CommRequestSharedPtr pRequest,
+                                          int pLoc) = 0;
+                virtual void v_IAlltoAllv(Array<OneD, int>& pSendData,
+                                          Array<OneD, int>& pSendDataSizeMap,
+                                          Array<OneD, int>& pSendDataOffsetMap,
+                                          Array<OneD, int>& pRecvData,
+                                          Array<OneD, int>& pRecvDataSizeMap,
+                                          Array<OneD, int>& pRecvDataOffsetMap,
+                                          CommRequestSharedPtr pRequest,
+                                          int pLoc) = 0;
+                virtual void v_WaitAll(CommRequestSharedPtr pRequest) = 0;
                 virtual void v_SplitComm(int pRows, int pColumns) = 0;
         };
 
@@ -240,6 +380,7 @@ namespace Nektar
          */
         inline void Comm::Send(int pProc, Array<OneD, NekDouble>& pData)
         {
+            GetProfiler().AddComm(pData.num_elements()*sizeof(NekDouble));
             v_Send(pProc, pData);
         }
 
@@ -248,6 +389,7 @@ namespace Nektar
          */
         inline void Comm::Recv(int pProc, Array<OneD, NekDouble>& pData)
         {
+            GetProfiler().AddComm(pData.num_elements()*sizeof(NekDouble));
             v_Recv(pProc, pData);
         }
 
@@ -257,6 +399,7 @@ namespace Nektar
          */
         inline void Comm::Send(int pProc, Array<OneD, int>& pData)
         {
+            GetProfiler().AddComm(pData.num_elements()*sizeof(int));
             v_Send(pProc, pData);
         }
 
@@ -265,6 +408,7 @@ namespace Nektar
          */
         inline void Comm::Recv(int pProc, Array<OneD, int>& pData)
         {
+            GetProfiler().AddComm(pData.num_elements()*sizeof(int));
             v_Recv(pProc, pData);
         }
 
@@ -273,6 +417,7 @@ namespace Nektar
          */
         inline void Comm::Send(int pProc, std::vector<unsigned int>& pData)
         {
+            GetProfiler().AddComm(pData.size()*sizeof(unsigned int));
             v_Send(pProc, pData);
         }
 
@@ -281,6 +426,26 @@ namespace Nektar
          */
         inline void Comm::Recv(int pProc, std::vector<unsigned int>& pData)
         {
+            GetProfiler().AddComm(pData.size()*sizeof(unsigned int));
+            v_Recv(pProc, pData);
+        }
+
+        /**
+         *
+         */
+        inline void Comm::Send(int pProc, std::string& pData)
+        {
+            GetProfiler().AddComm(pData.size());
+            v_Send(pProc, pData);
+        }
+
+        /**
+         * The string must be resized to the length of the message before
+         * receiving.
+         */
+        inline void Comm::Recv(int pProc, std::string& pData)
+        {
+            GetProfiler().AddComm(pData.size());
             v_Recv(pProc, pData);
         }
 
@@ -292,6 +457,9 @@ namespace Nektar
                              int pRecvProc,
                              Array<OneD, NekDouble>& pRecvData)
         {
+            GetProfiler().AddComm(
+                (pSendData.num_elements() + pRecvData.num_elements())
+                * sizeof(NekDouble));
             v_SendRecv(pSendProc, pSendData, pRecvProc, pRecvData);
         }
 
@@ -304,6 +472,9 @@ namespace Nektar
                              int pRecvProc,
                              Array<OneD, int>& pRecvData)
         {
+            GetProfiler().AddComm(
+                (pSendData.num_elements() + pRecvData.num_elements())
+                * sizeof(int));
             v_SendRecv(pSendProc, pSendData, pRecvProc, pRecvData);
         }
 		
@@ -314,6 +485,7 @@ namespace Nektar
 										 int pRecvProc,
 								         Array<OneD, NekDouble>& pSendData)
         {
+            GetProfiler().AddComm(2*pSendData.num_elements()*sizeof(NekDouble));
             v_SendRecvReplace(pSendProc,pRecvProc,pSendData);
         }
 		
@@ -325,6 +497,7 @@ namespace Nektar
 										 int pRecvProc,
 								         Array<OneD, int>& pSendData)
         {
+            GetProfiler().AddComm(2*pSendData.num_elements()*sizeof(int));
             v_SendRecvReplace(pSendProc,pRecvProc,pSendData);
         }
 
@@ -334,6 +507,7 @@ namespace Nektar
          */
         inline void Comm::AllReduce(NekDouble& pData, enum ReduceOperator pOp)
         {
+            GetProfiler().AddComm(sizeof(NekDouble));
             v_AllReduce(pData, pOp);
         }
 
@@ -343,6 +517,7 @@ namespace Nektar
          */
         inline void Comm::AllReduce(int& pData, enum ReduceOperator pOp)
         {
+            GetProfiler().AddComm(sizeof(int));
             v_AllReduce(pData, pOp);
         }
 
@@ -352,6 +527,7 @@ namespace Nektar
          */
         inline void Comm::AllReduce(Array<OneD, NekDouble>& pData, enum ReduceOperator pOp)
         {
+            GetProfiler().AddComm(pData.num_elements()*sizeof(NekDouble));
             v_AllReduce(pData, pOp);
         }
 
@@ -361,6 +537,7 @@ namespace Nektar
          */
         inline void Comm::AllReduce(Array<OneD, int>& pData, enum ReduceOperator pOp)
         {
+            GetProfiler().AddComm(pData.num_elements()*sizeof(int));
             v_AllReduce(pData, pOp);
         }
 		
@@ -370,6 +547,7 @@ namespace Nektar
          */
         inline void Comm::AllReduce(std::vector<unsigned int>& pData, enum ReduceOperator pOp)
         {
+            GetProfiler().AddComm(pData.size()*sizeof(unsigned int));
             v_AllReduce(pData, pOp);
         }
 
@@ -379,6 +557,9 @@ namespace Nektar
          */
 		inline void Comm::AlltoAll(Array<OneD, NekDouble>& pSendData,Array<OneD, NekDouble>& pRecvData)
 		{
+			GetProfiler().AddComm(
+			    (pSendData.num_elements() + pRecvData.num_elements())
+			    * sizeof(NekDouble));
 			v_AlltoAll(pSendData,pRecvData);
 		}
 		
@@ -388,6 +569,9 @@ namespace Nektar
          */
 		inline void Comm::AlltoAll(Array<OneD, int>& pSendData,Array<OneD, int>& pRecvData)
 		{
+			GetProfiler().AddComm(
+			    (pSendData.num_elements() + pRecvData.num_elements())
+			    * sizeof(int));
 			v_AlltoAll(pSendData,pRecvData);
 		}
 		
@@ -402,6 +586,9 @@ namespace Nektar
 								 Array<OneD, int>& pRecvDataSizeMap,
 								 Array<OneD, int>& pRecvDataOffsetMap)
 		{
+			GetProfiler().AddComm(
+			    (pSendData.num_elements() + pRecvData.num_elements())
+			    * sizeof(NekDouble));
 			v_AlltoAllv(pSendData,pSendDataSizeMap,pSendDataOffsetMap,pRecvData,pRecvDataSizeMap,pRecvDataOffsetMap);
 		}
 		
@@ -415,10 +602,196 @@ namespace Nektar
 								 Array<OneD, int>& pRecvDataSizeMap,
 								 Array<OneD, int>& pRecvDataOffsetMap)
 		{
+			GetProfiler().AddComm(
+			    (pSendData.num_elements() + pRecvData.num_elements())
+			    * sizeof(int));
 			v_AlltoAllv(pSendData,pSendDataSizeMap,pSendDataOffsetMap,pRecvData,pRecvDataSizeMap,pRecvDataOffsetMap);
 		}
 
 
+        /**
+         * @brief Creates a request object with @a pNumRequest slots for
+         * non-blocking operations.
+         */
+        inline CommRequestSharedPtr Comm::CreateRequest(int pNumRequest)
+        {
+            return v_CreateRequest(pNumRequest);
+        }
+
+
+        /**
+         * @brief Starts a non-blocking send of the first @a pCount values of
+         * @a pData to process @a pProc, using slot @a pLoc of @a pRequest.
+         */
+        inline void Comm::Isend(int pProc,
+                                Array<OneD, NekDouble>& pData,
+                                int pCount,
+                                CommRequestSharedPtr pRequest,
+                                int pLoc)
+        {
+            GetProfiler().AddComm(pCount*sizeof(NekDouble));
+            v_Isend(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         *
+         */
+        inline void Comm::Isend(int pProc,
+                                Array<OneD, int>& pData,
+                                int pCount,
+                                CommRequestSharedPtr pRequest,
+                                int pLoc)
+        {
+            GetProfiler().AddComm(pCount*sizeof(int));
+            v_Isend(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Starts a non-blocking receive of @a pCount values from
+         * process @a pProc into @a pData, using slot @a pLoc of @a pRequest.
+         */
+        inline void Comm::Irecv(int pProc,
+                                Array<OneD, NekDouble>& pData,
+                                int pCount,
+                                CommRequestSharedPtr pRequest,
+                                int pLoc)
+        {
+            GetProfiler().AddComm(pCount*sizeof(NekDouble));
+            v_Irecv(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         *
+         */
+        inline void Comm::Irecv(int pProc,
+                                Array<OneD, int>& pData,
+                                int pCount,
+                                CommRequestSharedPtr pRequest,
+                                int pLoc)
+        {
+            GetProfiler().AddComm(pCount*sizeof(int));
+            v_Irecv(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Sets up a persistent send of the first @a pCount values of
+         * @a pData to process @a pProc in slot @a pLoc of @a pRequest.
+         *
+         * The send is not started until StartAll is called; it may be
+         * started again once WaitAll has returned. @a pData must stay
+         * allocated for the lifetime of the request.
+         */
+        inline void Comm::SendInit(int pProc,
+                                   Array<OneD, NekDouble>& pData,
+                                   int pCount,
+                                   CommRequestSharedPtr pRequest,
+                                   int pLoc)
+        {
+            GetProfiler().AddComm(pCount*sizeof(NekDouble));
+            v_SendInit(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Sets up a persistent receive of @a pCount values from
+         * process @a pProc into @a pData in slot @a pLoc of @a pRequest.
+         */
+        inline void Comm::RecvInit(int pProc,
+                                   Array<OneD, NekDouble>& pData,
+                                   int pCount,
+                                   CommRequestSharedPtr pRequest,
+                                   int pLoc)
+        {
+            GetProfiler().AddComm(pCount*sizeof(NekDouble));
+            v_RecvInit(pProc, pData, pCount, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Starts all persistent operations held in @a pRequest.
+         */
+        inline void Comm::StartAll(CommRequestSharedPtr pRequest)
+        {
+            GetProfiler().AddComm(0);
+            v_StartAll(pRequest);
+        }
+
+
+        /**
+         * @brief Starts an in-place reduction of @a pData across all
+         * processes, using slot @a pLoc of @a pRequest.
+         *
+         * The contents of @a pData must not be accessed until WaitAll has
+         * been called on the request.
+         */
+        inline void Comm::IAllReduce(Array<OneD, NekDouble>& pData,
+                                     enum ReduceOperator pOp,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc)
+        {
+            GetProfiler().AddComm(pData.num_elements()*sizeof(NekDouble));
+            v_IAllReduce(pData, pOp, pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Non-blocking version of AlltoAllv, using slot @a pLoc of
+         * @a pRequest.
+         */
+        inline void Comm::IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                     Array<OneD, int>& pSendDataSizeMap,
+                                     Array<OneD, int>& pSendDataOffsetMap,
+                                     Array<OneD, NekDouble>& pRecvData,
+                                     Array<OneD, int>& pRecvDataSizeMap,
+                                     Array<OneD, int>& pRecvDataOffsetMap,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc)
+        {
+            GetProfiler().AddComm(
+                (pSendData.num_elements() + pRecvData.num_elements())
+                * sizeof(NekDouble));
+            v_IAlltoAllv(pSendData, pSendDataSizeMap, pSendDataOffsetMap,
+                         pRecvData, pRecvDataSizeMap, pRecvDataOffsetMap,
+                         pRequest, pLoc);
+        }
+
+
+        /**
+         *
+         */
+        inline void Comm::IAlltoAllv(Array<OneD, int>& pSendData,
+                                     Array<OneD, int>& pSendDataSizeMap,
+                                     Array<OneD, int>& pSendDataOffsetMap,
+                                     Array<OneD, int>& pRecvData,
+                                     Array<OneD, int>& pRecvDataSizeMap,
+                                     Array<OneD, int>& pRecvDataOffsetMap,
+                                     CommRequestSharedPtr pRequest,
+                                     int pLoc)
+        {
+            GetProfiler().AddComm(
+                (pSendData.num_elements() + pRecvData.num_elements())
+                * sizeof(int));
+            v_IAlltoAllv(pSendData, pSendDataSizeMap, pSendDataOffsetMap,
+                         pRecvData, pRecvDataSizeMap, pRecvDataOffsetMap,
+                         pRequest, pLoc);
+        }
+
+
+        /**
+         * @brief Blocks until all operations started on @a pRequest have
+         * completed.
+         */
+        inline void Comm::WaitAll(CommRequestSharedPtr pRequest)
+        {
+            GetProfiler().AddComm(0);
+            v_WaitAll(pRequest);
+        }
+
+
         /**
          * @brief Splits this communicator into a grid of size pRows*pColumns
          * and creates row and column communicators. By default the communicator
@@ -264,6 +264,48 @@ namespace Nektar
         }
 
 
+        /**
+         *
+         */
+        void CommMpi::v_Send(int pProc, std::string& pData)
+        {
+            if (MPISYNC)
+            {
+                MPI_Ssend( &pData[0],
+                          (int) pData.size(),
+                          MPI_CHAR,
+                          pProc,
+                          0,
+                          m_comm);
+            }
+            else
+            {
+                MPI_Send( &pData[0],
+                          (int) pData.size(),
+                          MPI_CHAR,
+                          pProc,
+                          0,
+                          m_comm);
+            }
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_Recv(int pProc, std::string& pData)
+        {
+            MPI_Status status;
+            MPI_Recv( &pData[0],
+                      (int) pData.size(),
+                      MPI_CHAR,
+                      pProc,
+                      0,
+                      m_comm,
+                      &status);
+        }
+
+
         /**
          *
          */
@@ -599,6 +641,280 @@ namespace Nektar
 		}
 
 
+        /**
+         *
+         */
+        CommRequestSharedPtr CommMpi::v_CreateRequest(int pNumRequest)
+        {
+            return MemoryManager<CommRequestMpi>::AllocateSharedPtr(
+                                                                pNumRequest);
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_Isend(int pProc,
+                              Array<OneD, NekDouble>& pData,
+                              int pCount,
+                              CommRequestSharedPtr pRequest,
+                              int pLoc)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+            int retval = MPI_Isend(pData.get(), pCount, MPI_DOUBLE, pProc, 0,
+                                   m_comm, req->GetRequest(pLoc));
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking send.");
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_Isend(int pProc,
+                              Array<OneD, int>& pData,
+                              int pCount,
+                              CommRequestSharedPtr pRequest,
+                              int pLoc)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+            int retval = MPI_Isend(pData.get(), pCount, MPI_INT, pProc, 0,
+                                   m_comm, req->GetRequest(pLoc));
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking send.");
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_Irecv(int pProc,
+                              Array<OneD, NekDouble>& pData,
+                              int pCount,
+                              CommRequestSharedPtr pRequest,
+                              int pLoc)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+            int retval = MPI_Irecv(pData.get(), pCount, MPI_DOUBLE, pProc, 0,
+                                   m_comm, req->GetRequest(pLoc));
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking receive.");
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_Irecv(int pProc,
+                              Array<OneD, int>& pData,
+                              int pCount,
+                              CommRequestSharedPtr pRequest,
+                              int pLoc)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+            int retval = MPI_Irecv(pData.get(), pCount, MPI_INT, pProc, 0,
+                                   m_comm, req->GetRequest(pLoc));
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking receive.");
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_SendInit(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+            int retval = MPI_Send_init(pData.get(), pCount, MPI_DOUBLE, pProc,
+                                       0, m_comm, req->GetRequest(pLoc));
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error setting up persistent send.");
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_RecvInit(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+            int retval = MPI_Recv_init(pData.get(), pCount, MPI_DOUBLE, pProc,
+                                       0, m_comm, req->GetRequest(pLoc));
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error setting up persistent receive.");
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_StartAll(CommRequestSharedPtr pRequest)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+
+            if (req->GetNumRequest() == 0)
+            {
+                return;
+            }
+
+            int retval = MPI_Startall(req->GetNumRequest(),
+                                      req->GetRequest(0));
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error starting persistent requests.");
+        }
+
+
+        /**
+         * Uses MPI_Iallreduce if the MPI library implements MPI-3 and falls
+         * back to a blocking reduction otherwise, in which case the request
+         * slot is left empty.
+         */
+        void CommMpi::v_IAllReduce(Array<OneD, NekDouble>& pData,
+                                   enum ReduceOperator pOp,
+                                   CommRequestSharedPtr pRequest,
+                                   int pLoc)
+        {
+            if (GetSize() == 1)
+            {
+                return;
+            }
+
+#if MPI_VERSION >= 3
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+
+            MPI_Op vOp;
+            switch (pOp)
+            {
+            case ReduceMax: vOp = MPI_MAX; break;
+            case ReduceMin: vOp = MPI_MIN; break;
+            case ReduceSum:
+            default:        vOp = MPI_SUM; break;
+            }
+            int retval = MPI_Iallreduce(MPI_IN_PLACE,
+                                        pData.get(),
+                                        (int) pData.num_elements(),
+                                        MPI_DOUBLE,
+                                        vOp,
+                                        m_comm,
+                                        req->GetRequest(pLoc));
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking All-reduce.");
+#else
+            v_AllReduce(pData, pOp);
+#endif
+        }
+
+
+        /**
+         * As for IAllReduce, a blocking exchange is used if MPI-3 is not
+         * available.
+         */
+        void CommMpi::v_IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                   Array<OneD, int>& pSendDataSizeMap,
+                                   Array<OneD, int>& pSendDataOffsetMap,
+                                   Array<OneD, NekDouble>& pRecvData,
+                                   Array<OneD, int>& pRecvDataSizeMap,
+                                   Array<OneD, int>& pRecvDataOffsetMap,
+                                   CommRequestSharedPtr pRequest,
+                                   int pLoc)
+        {
+#if MPI_VERSION >= 3
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+            int retval = MPI_Ialltoallv(pSendData.get(),
+                                        pSendDataSizeMap.get(),
+                                        pSendDataOffsetMap.get(),
+                                        MPI_DOUBLE,
+                                        pRecvData.get(),
+                                        pRecvDataSizeMap.get(),
+                                        pRecvDataOffsetMap.get(),
+                                        MPI_DOUBLE,
+                                        m_comm,
+                                        req->GetRequest(pLoc));
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking All-to-All-v.");
+#else
+            v_AlltoAllv(pSendData, pSendDataSizeMap, pSendDataOffsetMap,
+                        pRecvData, pRecvDataSizeMap, pRecvDataOffsetMap);
+#endif
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_IAlltoAllv(Array<OneD, int>& pSendData,
+                                   Array<OneD, int>& pSendDataSizeMap,
+                                   Array<OneD, int>& pSendDataOffsetMap,
+                                   Array<OneD, int>& pRecvData,
+                                   Array<OneD, int>& pRecvDataSizeMap,
+                                   Array<OneD, int>& pRecvDataOffsetMap,
+                                   CommRequestSharedPtr pRequest,
+                                   int pLoc)
+        {
+#if MPI_VERSION >= 3
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+            int retval = MPI_Ialltoallv(pSendData.get(),
+                                        pSendDataSizeMap.get(),
+                                        pSendDataOffsetMap.get(),
+                                        MPI_INT,
+                                        pRecvData.get(),
+                                        pRecvDataSizeMap.get(),
+                                        pRecvDataOffsetMap.get(),
+                                        MPI_INT,
+                                        m_comm,
+                                        req->GetRequest(pLoc));
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error performing non-blocking All-to-All-v.");
+#else
+            v_AlltoAllv(pSendData, pSendDataSizeMap, pSendDataOffsetMap,
+                        pRecvData, pRecvDataSizeMap, pRecvDataOffsetMap);
+#endif
+        }
+
+
+        /**
+         *
+         */
+        void CommMpi::v_WaitAll(CommRequestSharedPtr pRequest)
+        {
+            CommRequestMpiSharedPtr req =
+                boost::static_pointer_cast<CommRequestMpi>(pRequest);
+
+            if (req->GetNumRequest() == 0)
+            {
+                return;
+            }
+
+            int retval = MPI_Waitall(req->GetNumRequest(),
+                                     req->GetRequest(0),
+                                     MPI_STATUSES_IGNORE);
+
+            ASSERTL0(retval == MPI_SUCCESS,
+                     "MPI error waiting for requests to complete.");
+        }
+
+
         /**
          * Processes are considered as a grid of size pRows*pColumns. Comm
          * objects are created corresponding to the rows and columns of this
@@ -57,6 +57,56 @@ namespace Nektar
         /// Pointer to a Communicator object.
         typedef boost::shared_ptr<CommMpi> CommMpiSharedPtr;
 
+        /// Request object holding the MPI requests of non-blocking
+        /// operations.
+        class CommRequestMpi : public CommRequest
+        {
+        public:
+            CommRequestMpi(int pNumRequest)
+                : m_request(pNumRequest, MPI_REQUEST_NULL)
+            {
+            }
+
+            /// Releases any persistent requests. Completed non-persistent
+            /// requests are already MPI_REQUEST_NULL.
+            virtual ~CommRequestMpi()
+            {
+                int finalized;
+                MPI_Finalized(&finalized);
+                if (finalized)
+                {
+                    return;
+                }
+
+                for (int i = 0; i < m_request.size(); ++i)
+                {
+                    if (m_request[i] != MPI_REQUEST_NULL)
+                    {
+                        MPI_Request_free(&m_request[i]);
+                    }
+                }
+            }
+
+            /// Returns the number of request slots.
+            int GetNumRequest()
+            {
+                return m_request.size();
+            }
+
+            /// Returns the MPI request in slot @a pLoc.
+            MPI_Request *GetRequest(int pLoc)
+            {
+                ASSERTL1(pLoc >= 0 && pLoc < m_request.size(),
+                         "Request index out of range.");
+                return &m_request[pLoc];
+            }
+
+        private:
+            std::vector<MPI_Request> m_request;
+        };
+
+        typedef boost::shared_ptr<CommRequestMpi> CommRequestMpiSharedPtr;
+
         /// A global linear system.
         class CommMpi : public Comm
         {
@@ -85,6 +135,8 @@ namespace Nektar
             virtual void v_Recv(int pProc, Array<OneD, NekDouble>& pData);
             virtual void v_Recv(int pProc, Array<OneD, int>& pData);
             virtual void v_Recv(int pProc, std::vector<unsigned int>& pData);
+            virtual void v_Send(int pProc, std::string& pData);
+            virtual void v_Recv(int pProc, std::string& pData);
             virtual void v_SendRecv(int pSendProc,
                                     Array<OneD, NekDouble>& pSendData,
                                     int pRecvProc,
@@ -125,6 +177,59 @@ namespace Nektar
 									Array<OneD, int>& pRecvData,
 									Array<OneD, int>& pRecvDataSizeMap,
 									Array<OneD, int>& pRecvDataOffsetMap);
+            virtual CommRequestSharedPtr v_CreateRequest(int pNumRequest);
+            virtual void v_Isend(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc);
+            virtual void v_Isend(int pProc,
+                                 Array<OneD, int>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc);
+            virtual void v_Irecv(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc);
+            virtual void v_Irecv(int pProc,
+                                 Array<OneD, int>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc);
+            virtual void v_SendInit(int pProc,
+                                    Array<OneD, NekDouble>& pData,
+                                    int pCount,
+                                    CommRequestSharedPtr pRequest,
+                                    int pLoc);
+            virtual void v_RecvInit(int pProc,
+                                    Array<OneD, NekDouble>& pData,
+                                    int pCount,
+                                    CommRequestSharedPtr pRequest,
+                                    int pLoc);
+            virtual void v_StartAll(CommRequestSharedPtr pRequest);
+            virtual void v_IAllReduce(Array<OneD, NekDouble>& pData,
+                                      enum ReduceOperator pOp,
+                                      CommRequestSharedPtr pRequest,
+                                      int pLoc);
+            virtual void v_IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                      Array<OneD, int>& pSendDataSizeMap,
+                                      Array<OneD, int>& pSendDataOffsetMap,
+                                      Array<OneD, NekDouble>& pRecvData,
+                                      Array<OneD, int>& pRecvDataSizeMap,
+                                      Array<OneD, int>& pRecvDataOffsetMap,
+                                      CommRequestSharedPtr pRequest,
+                                      int pLoc);
+            virtual void v_IAlltoAllv(Array<OneD, int>& pSendData,
+                                      Array<OneD, int>& pSendDataSizeMap,
+                                      Array<OneD, int>& pSendDataOffsetMap,
+                                      Array<OneD, int>& pRecvData,
+                                      Array<OneD, int>& pRecvDataSizeMap,
+                                      Array<OneD, int>& pRecvDataOffsetMap,
+                                      CommRequestSharedPtr pRequest,
+                                      int pLoc);
+            virtual void v_WaitAll(CommRequestSharedPtr pRequest);
             virtual void v_SplitComm(int pRows, int pColumns);
 
         private:
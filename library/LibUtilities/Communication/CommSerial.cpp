@@ -129,6 +129,22 @@ namespace Nektar
         }
 
 
+        /**
+         *
+         */
+        void CommSerial::v_Send(int pProc, std::string& pData)
+        {
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_Recv(int pProc, std::string& pData)
+        {
+        }
+
+
         /**
          *
          */
@@ -262,6 +278,156 @@ namespace Nektar
         }
 
 
+        /**
+         *
+         */
+        CommRequestSharedPtr CommSerial::v_CreateRequest(int pNumRequest)
+        {
+            return MemoryManager<CommRequestSerial>::AllocateSharedPtr(
+                                                                pNumRequest);
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_Isend(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_Isend(int pProc,
+                                 Array<OneD, int>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_Irecv(int pProc,
+                                 Array<OneD, NekDouble>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_Irecv(int pProc,
+                                 Array<OneD, int>& pData,
+                                 int pCount,
+                                 CommRequestSharedPtr pRequest,
+                                 int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_SendInit(int pProc,
+                                    Array<OneD, NekDouble>& pData,
+                                    int pCount,
+                                    CommRequestSharedPtr pRequest,
+                                    int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_RecvInit(int pProc,
+                                    Array<OneD, NekDouble>& pData,
+                                    int pCount,
+                                    CommRequestSharedPtr pRequest,
+                                    int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_StartAll(CommRequestSharedPtr pRequest)
+        {
+
+        }
+
+
+        /**
+         * With a single process the data is already reduced.
+         */
+        void CommSerial::v_IAllReduce(Array<OneD, NekDouble>& pData,
+                                      enum ReduceOperator pOp,
+                                      CommRequestSharedPtr pRequest,
+                                      int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                      Array<OneD, int>& pSendDataSizeMap,
+                                      Array<OneD, int>& pSendDataOffsetMap,
+                                      Array<OneD, NekDouble>& pRecvData,
+                                      Array<OneD, int>& pRecvDataSizeMap,
+                                      Array<OneD, int>& pRecvDataOffsetMap,
+                                      CommRequestSharedPtr pRequest,
+                                      int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_IAlltoAllv(Array<OneD, int>& pSendData,
+                                      Array<OneD, int>& pSendDataSizeMap,
+                                      Array<OneD, int>& pSendDataOffsetMap,
+                                      Array<OneD, int>& pRecvData,
+                                      Array<OneD, int>& pRecvDataSizeMap,
+                                      Array<OneD, int>& pRecvDataOffsetMap,
+                                      CommRequestSharedPtr pRequest,
+                                      int pLoc)
+        {
+
+        }
+
+
+        /**
+         *
+         */
+        void CommSerial::v_WaitAll(CommRequestSharedPtr pRequest)
+        {
+
+        }
+
+
         /**
          *
          */
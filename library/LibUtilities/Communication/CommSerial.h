@@ -51,6 +51,20 @@ namespace Nektar
         /// Pointer to a Communicator object.
         typedef boost::shared_ptr<CommSerial> CommSerialSharedPtr;
 
+        /// Request object for serial communication; all operations complete
+        /// immediately so no state is needed.
+        class CommRequestSerial : public CommRequest
+        {
+        public:
+            CommRequestSerial(int pNumRequest)
+            {
+            }
+
+            virtual ~CommRequestSerial()
+            {
+            }
+        };
+
         /// A global linear system.
         class CommSerial : public Comm
         {
@@ -77,6 +91,8 @@ namespace Nektar
             LIB_UTILITIES_EXPORT virtual void v_Recv(int pProc, Array<OneD, NekDouble>& pData);
             LIB_UTILITIES_EXPORT virtual void v_Recv(int pProc, Array<OneD, int>& pData);
             LIB_UTILITIES_EXPORT virtual void v_Recv(int pProc, std::vector<unsigned int>& pData);
+            LIB_UTILITIES_EXPORT virtual void v_Send(int pProc, std::string& pData);
+            LIB_UTILITIES_EXPORT virtual void v_Recv(int pProc, std::string& pData);
             LIB_UTILITIES_EXPORT virtual void v_SendRecv(int pSendProc,
                                     Array<OneD, NekDouble>& pSendData,
                                     int pRecvProc,
@@ -117,6 +133,59 @@ namespace Nektar
 													     Array<OneD, int>& pRecvData,
 													     Array<OneD, int>& pRecvDataSizeMap,
 													     Array<OneD, int>& pRecvDataOffsetMap);
+            LIB_UTILITIES_EXPORT virtual CommRequestSharedPtr v_CreateRequest(int pNumRequest);
+            LIB_UTILITIES_EXPORT virtual void v_Isend(int pProc,
+                                                      Array<OneD, NekDouble>& pData,
+                                                      int pCount,
+                                                      CommRequestSharedPtr pRequest,
+                                                      int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_Isend(int pProc,
+                                                      Array<OneD, int>& pData,
+                                                      int pCount,
+                                                      CommRequestSharedPtr pRequest,
+                                                      int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_Irecv(int pProc,
+                                                      Array<OneD, NekDouble>& pData,
+                                                      int pCount,
+                                                      CommRequestSharedPtr pRequest,
+                                                      int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_Irecv(int pProc,
+                                                      Array<OneD, int>& pData,
+                                                      int pCount,
+                                                      CommRequestSharedPtr pRequest,
+                                                      int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_SendInit(int pProc,
+                                                         Array<OneD, NekDouble>& pData,
+                                                         int pCount,
+                                                         CommRequestSharedPtr pRequest,
+                                                         int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_RecvInit(int pProc,
+                                                         Array<OneD, NekDouble>& pData,
+                                                         int pCount,
+                                                         CommRequestSharedPtr pRequest,
+                                                         int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_StartAll(CommRequestSharedPtr pRequest);
+            LIB_UTILITIES_EXPORT virtual void v_IAllReduce(Array<OneD, NekDouble>& pData,
+                                                           enum ReduceOperator pOp,
+                                                           CommRequestSharedPtr pRequest,
+                                                           int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_IAlltoAllv(Array<OneD, NekDouble>& pSendData,
+                                                           Array<OneD, int>& pSendDataSizeMap,
+                                                           Array<OneD, int>& pSendDataOffsetMap,
+                                                           Array<OneD, NekDouble>& pRecvData,
+                                                           Array<OneD, int>& pRecvDataSizeMap,
+                                                           Array<OneD, int>& pRecvDataOffsetMap,
+                                                           CommRequestSharedPtr pRequest,
+                                                           int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_IAlltoAllv(Array<OneD, int>& pSendData,
+                                                           Array<OneD, int>& pSendDataSizeMap,
+                                                           Array<OneD, int>& pSendDataOffsetMap,
+                                                           Array<OneD, int>& pRecvData,
+                                                           Array<OneD, int>& pRecvDataSizeMap,
+                                                           Array<OneD, int>& pRecvDataOffsetMap,
+                                                           CommRequestSharedPtr pRequest,
+                                                           int pLoc);
+            LIB_UTILITIES_EXPORT virtual void v_WaitAll(CommRequestSharedPtr pRequest);
             LIB_UTILITIES_EXPORT virtual void v_SplitComm(int pRows, int pColumns);
 			
         };
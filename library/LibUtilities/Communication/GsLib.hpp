@@ -37,6 +37,7 @@
 #define NEKTAR_LIB_UTILITIES_COMMUNICATION_GSLIB_HPP
 
 #include <iostream>
+#include <vector>
 using namespace std;
 
 #include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
@@ -127,6 +128,8 @@ namespace Gs
     {
         void nektar_gs(void *u, gs_dom dom, gs_op op, unsigned transpose,
                 gs_data *gsh, buffer *buf);
+        void nektar_gs_many(void *const *u, unsigned vn, gs_dom dom,
+                gs_op op, unsigned transpose, gs_data *gsh, buffer *buf);
         gs_data *nektar_gs_setup(const long *id, unsigned int n, const struct comm *comm,
                                 int unique, gs_method method, int verbose);
         void nektar_gs_free(gs_data *gsh);
@@ -238,6 +241,47 @@ namespace Gs
 #endif
     }
 
+
+    /**
+     * @brief Performs a gather-scatter operation on several vectors at once.
+     *
+     * The @a pVn vectors are stored one after the other in @a pU, each of
+     * length @a pStride. The values of all vectors at a shared degree of
+     * freedom are exchanged in the same message, so the number of messages
+     * is that of a single Gather call.
+     */
+    static inline void GatherMany(Nektar::Array<OneD, NekDouble> pU,
+                       const unsigned int pVn, const unsigned int pStride,
+                       gs_op pOp, gs_data *pGsh,
+                       Nektar::Array<OneD, NekDouble> pBuffer
+                                                        = NullNekDouble1DArray)
+    {
+#ifdef NEKTAR_USE_MPI
+        if (!pGsh)
+        {
+            return;
+        }
+        std::vector<NekDouble*> vPtr(pVn);
+        for (unsigned int i = 0; i < pVn; ++i)
+        {
+            vPtr[i] = pU.get() + i*pStride;
+        }
+        if (pBuffer.num_elements() == 0)
+        {
+            nektar_gs_many((void *const *) &vPtr[0], pVn, gs_double, pOp,
+                           false, pGsh, 0);
+        }
+        else
+        {
+            array buf;
+            buf.ptr = &pBuffer[0];
+            buf.n = pBuffer.num_elements();
+            nektar_gs_many((void *const *) &vPtr[0], pVn, gs_double, pOp,
+                           false, pGsh, &buf);
+        }
+#endif
+    }
+
 }
 
 #endif
@@ -37,6 +37,8 @@
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
 #include <LibUtilities/BasicUtils/SharedArray.hpp>
 
+#include <cstdio>
+
 namespace Nektar
 {
     namespace LibUtilities
@@ -45,38 +47,99 @@ namespace Nektar
             = GetNektarFFTFactory().RegisterCreatorFunction("NekFFTW",
                                                             NekFFTW::create);
 
+        bool NekFFTW::s_wisdomRead = false;
+
         NekFFTW::NekFFTW(int N)
                 : NektarFFT(N)
         {
-            m_wsp = Array<OneD, NekDouble>(m_N);
-            phys = Array<OneD,NekDouble>(m_N);
-            coef = Array<OneD,NekDouble>(m_N);
+            ASSERTL0(m_N % 2 == 0,
+                     "Number of Fourier points must be even.");
+
+            if (!s_wisdomRead && s_wisdomFile != "")
+            {
+                // Missing or stale wisdom only means planning from scratch.
+                FILE *f = fopen(s_wisdomFile.c_str(), "r");
+                if (f)
+                {
+                    fftw_import_wisdom_from_file(f);
+                    fclose(f);
+                }
+                s_wisdomRead = true;
+            }
+        }
+
+        // Distructor
+        NekFFTW::~NekFFTW()
+        {
+            std::map<int, Plan>::iterator it;
+            for (it = m_plans.begin(); it != m_plans.end(); ++it)
+            {
+                fftw_destroy_plan(it->second.forward);
+                fftw_destroy_plan(it->second.backward);
+                fftw_free(it->second.phys);
+                fftw_free(it->second.coef);
+            }
+        }
+
+        /**
+         * Plans are made once per batch size with the planner effort set
+         * through NektarFFT::Configure. With an effort other than Estimate,
+         * newly accumulated wisdom is written back to the wisdom file.
+         */
+        NekFFTW::Plan &NekFFTW::GetPlan(int howmany)
+        {
+            std::map<int, Plan>::iterator it = m_plans.find(howmany);
+            if (it != m_plans.end())
+            {
+                return it->second;
+            }
+
+            unsigned int flags = FFTW_ESTIMATE;
+            switch (s_plannerEffort)
+            {
+                case eFFTMeasure: flags = FFTW_MEASURE; break;
+                case eFFTPatient: flags = FFTW_PATIENT; break;
+                default: break;
+            }
 
-            plan_forward  = fftw_plan_r2r_1d(m_N, &phys[0], &coef[0],
-                                             FFTW_R2HC, FFTW_ESTIMATE);
-            plan_backward = fftw_plan_r2r_1d(m_N, &coef[0], &phys[0],
-                                             FFTW_HC2R, FFTW_ESTIMATE);
+            int  n[1]  = {m_N};
+            int  nc    = m_N/2 + 1;
+            Plan &plan = m_plans[howmany];
 
-            m_FFTW_w = Array<OneD,NekDouble>(m_N);
-            m_FFTW_w_inv = Array<OneD,NekDouble>(m_N);
+            plan.phys = (double *) fftw_malloc(sizeof(double)*m_N*howmany);
+            plan.coef = (double *) fftw_malloc(sizeof(double)*2*nc*howmany);
 
-            m_FFTW_w[0] = 1.0/(NekDouble)m_N;
-            m_FFTW_w[1] = 0.0;
+            plan.forward  = fftw_plan_many_dft_r2c(
+                1, n, howmany, plan.phys, NULL, 1, m_N,
+                (fftw_complex *) plan.coef, NULL, 1, nc, flags);
+            plan.backward = fftw_plan_many_dft_c2r(
+                1, n, howmany, (fftw_complex *) plan.coef, NULL, 1, nc,
+                plan.phys, NULL, 1, m_N, flags);
 
-            m_FFTW_w_inv[0] = m_N;
-            m_FFTW_w_inv[1] = 0.0;
+            ASSERTL0(plan.forward && plan.backward,
+                     "Unable to create FFTW plans.");
 
-            for(int i=2;i<m_N;i++)
+            if (flags != FFTW_ESTIMATE && s_wisdomWrite)
             {
-                m_FFTW_w[i]     = m_FFTW_w[0];
-                m_FFTW_w_inv[i] = m_FFTW_w_inv[0];
+                FILE *f = fopen(s_wisdomFile.c_str(), "w");
+                if (f)
+                {
+                    fftw_export_wisdom_to_file(f);
+                    fclose(f);
+                }
             }
+
+            return plan;
         }
 
-        // Distructor
-        NekFFTW::~NekFFTW()
+        /**
+         * Arrays aligned to 64 bytes have the same alignment as those from
+         * fftw_malloc for any SIMD extension FFTW uses, so the plans may be
+         * executed on them directly.
+         */
+        bool NekFFTW::IsAligned(const NekDouble *p)
         {
-
+            return reinterpret_cast<size_t>(p) % 64 == 0;
         }
 
         // Forward transformation
@@ -84,13 +147,7 @@ namespace Nektar
                 Array<OneD,NekDouble> &inarray,
                 Array<OneD,NekDouble> &outarray)
         {
-            Vmath::Vcopy(m_N, inarray, 1, phys, 1);
-
-            fftw_execute(plan_forward);
-
-            Reshuffle_FFTW2Nek(coef);
-
-            Vmath::Vcopy(m_N, coef, 1, outarray, 1);
+            v_FFTFwdTrans(1, inarray, outarray);
         }
 
         // Backward transformation
@@ -98,53 +155,76 @@ namespace Nektar
                 Array<OneD,NekDouble> &inarray,
                 Array<OneD,NekDouble> &outarray)
         {
-            Vmath::Vcopy(m_N, inarray, 1, coef, 1);
-
-            Reshuffle_Nek2FFTW(coef);
-
-            fftw_execute(plan_backward);
-
-            Vmath::Vcopy(m_N, phys, 1, outarray, 1);
+            v_FFTBwdTrans(1, inarray, outarray);
         }
 
-        // Reshuffle FFTW2Nek
-        void NekFFTW::Reshuffle_FFTW2Nek(Array<OneD,NekDouble> &coef)
+        /**
+         * The complex output of FFTW for each vector is (r_0, 0, r_1, i_1,
+         * ..., r_{N/2}, 0). The Nektar++ ordering holds the Nyquist mode in
+         * place of the zero imaginary part of the mean and discards it, so
+         * the coefficients are the first m_N values of each vector scaled by
+         * 1/m_N.
+         */
+        void NekFFTW::v_FFTFwdTrans(
+                int howmany,
+                Array<OneD,NekDouble> &inarray,
+                Array<OneD,NekDouble> &outarray)
         {
-            int halfN = m_N/2;
+            Plan     &plan = GetPlan(howmany);
+            int       nc2  = m_N + 2;
+            double   *in   = &inarray[0];
 
-            m_wsp[1] = coef[halfN];
-
-            Vmath::Vcopy(halfN, coef, 1, m_wsp, 2);
-
-            for(int i = 0; i < (halfN - 1); i++)
+            if (!IsAligned(in))
             {
-                m_wsp[(m_N-1)-2*i] = coef[halfN+1+i];
+                Vmath::Vcopy(m_N*howmany, in, 1, plan.phys, 1);
+                in = plan.phys;
             }
 
-            Vmath::Vmul(m_N, m_wsp, 1, m_FFTW_w, 1, coef, 1);
+            fftw_execute_dft_r2c(plan.forward, in,
+                                 (fftw_complex *) plan.coef);
 
-            return;
+            for (int i = 0; i < howmany; ++i)
+            {
+                Vmath::Smul(m_N, 1.0/m_N, plan.coef + i*nc2, 1,
+                            &outarray[i*m_N], 1);
+                outarray[i*m_N+1] = 0.0;
+            }
         }
 
-        // Reshuffle Nek2FFTW
-        void NekFFTW::Reshuffle_Nek2FFTW(Array<OneD,NekDouble> &coef)
+        /**
+         * Reverses the layout of the forward transform, with the Nyquist
+         * mode set to zero. The transform is unnormalised so that it is the
+         * inverse of the forward transform.
+         */
+        void NekFFTW::v_FFTBwdTrans(
+                int howmany,
+                Array<OneD,NekDouble> &inarray,
+                Array<OneD,NekDouble> &outarray)
         {
-            int halfN = m_N/2;
-
-            Vmath::Vmul(m_N, coef, 1, m_FFTW_w_inv, 1, coef, 1);
-
-            m_wsp[halfN] = coef[1];
+            Plan     &plan = GetPlan(howmany);
+            int       nc2  = m_N + 2;
+            double   *out  = &outarray[0];
 
-            Vmath::Vcopy(halfN, coef, 2, m_wsp, 1);
-
-            for(int i = 0; i < (halfN-1); i++)
+            for (int i = 0; i < howmany; ++i)
             {
-                m_wsp[halfN+1+i] = coef[(m_N-1)-2*i];
+                double *c = plan.coef + i*nc2;
+                Vmath::Vcopy(m_N, &inarray[i*m_N], 1, c, 1);
+                c[1]     = 0.0;
+                c[m_N]   = 0.0;
+                c[m_N+1] = 0.0;
             }
 
-            Vmath::Smul(m_N, 1.0/m_N, m_wsp, 1, coef, 1);
-
-            return;
+            if (IsAligned(out))
+            {
+                fftw_execute_dft_c2r(plan.backward,
+                                     (fftw_complex *) plan.coef, out);
+            }
+            else
+            {
+                fftw_execute_dft_c2r(plan.backward,
+                                     (fftw_complex *) plan.coef, plan.phys);
+                Vmath::Vcopy(m_N*howmany, plan.phys, 1, out, 1);
+            }
         }
     }
 }
@@ -46,6 +46,8 @@
 
 #include <fftw3.h>
 
+#include <map>
+
 namespace Nektar
 {
     template <typename Dim, typename DataType>
@@ -71,7 +73,7 @@ namespace Nektar
 			/// Name of class
 			static std::string className;
 			            
-			// constructor (initialisation of the FFTW planes and fill up the m_FFTW_w vector)
+			// constructor
 			NekFFTW(int N);
 			
 			// Distructor
@@ -83,32 +85,41 @@ namespace Nektar
 			
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
 			
+			virtual void v_FFTFwdTrans(int howmany, Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
+			
+			virtual void v_FFTBwdTrans(int howmany, Array<OneD,NekDouble> &inarray, Array<OneD,NekDouble> &outarray);
+			
 			
 			
 		protected:
 			
-			Array<OneD,NekDouble> m_FFTW_w;  // weights to convert arrays form Nektar++ to FFTW format
-			Array<OneD,NekDouble> m_FFTW_w_inv; // weights to convert arrays from FFTW to Nektar++ format
-
-			Array<OneD,NekDouble> phys;
-			Array<OneD,NekDouble> coef;
-
-			Array<OneD,NekDouble> m_wsp;     // Workspace area for transforms
-
-			fftw_plan plan_backward;         // plan to execute a backward FFT in FFTW
-			fftw_plan plan_forward;          // plan to execute a forward FFT in FFTW
 			/**
-			 * Reshuffling routines to put the coefficients in Nektar++/FFTW format.
-			 * The routines take as an input the number of points N, the vector of coeffcients
-			 * and the vector containing the weights of the numerical integration.
-			 * The routines modify directly the coef vector.
+			 * Plans for transforming a given number of vectors at once. The
+			 * transforms are real-to-complex, whose interleaved output is
+			 * the Nektar++ coefficient ordering padded with the Nyquist mode,
+			 * so that no reshuffling is required.
 			 */
-			void Reshuffle_FFTW2Nek(Array<OneD,NekDouble> &coef);
+			struct Plan
+			{
+				fftw_plan  forward;  // plan to execute a forward FFT in FFTW
+				fftw_plan  backward; // plan to execute a backward FFT in FFTW
+				double    *phys;     // aligned physical space storage
+				double    *coef;     // aligned complex storage, m_N+2 per vector
+			};
 			
-			void Reshuffle_Nek2FFTW(Array<OneD,NekDouble> &coef);
+			/// Plans indexed by the number of vectors transformed.
+			std::map<int, Plan> m_plans;
 			
+			/// Returns the plans for @a howmany vectors, creating them on
+			/// first use.
+			Plan &GetPlan(int howmany);
+			
+			/// Whether @a p has the alignment of arrays passed to the planner.
+			static bool IsAligned(const NekDouble *p);
+			
+			/// Whether the wisdom file has been read by this process.
+			static bool s_wisdomRead;
 			
-
 		private:
 		};
 
@@ -34,6 +34,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LibUtilities/FFT/NektarFFT.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/Communication/Comm.h>
 #include <loki/Singleton.h>             // for CreateUsingNew, NoDestroy, etc
 
 namespace Nektar
@@ -56,6 +58,22 @@ namespace Nektar
 		 * This constructor is protected as the objects of this class are never
 		 * instantiated directly.
 		 */
+		std::string NektarFFT::s_plannerEffortLookupIds[] = {
+			LibUtilities::SessionReader::RegisterEnumValue(
+				"FFTPlannerEffort", "Estimate", eFFTEstimate),
+			LibUtilities::SessionReader::RegisterEnumValue(
+				"FFTPlannerEffort", "Measure",  eFFTMeasure),
+			LibUtilities::SessionReader::RegisterEnumValue(
+				"FFTPlannerEffort", "Patient",  eFFTPatient)
+		};
+		std::string NektarFFT::s_plannerEffortDef =
+			LibUtilities::SessionReader::RegisterDefaultSolverInfo(
+				"FFTPlannerEffort", "Measure");
+		
+		FFTPlannerEffort NektarFFT::s_plannerEffort = eFFTMeasure;
+		std::string      NektarFFT::s_wisdomFile    = "";
+		bool             NektarFFT::s_wisdomWrite   = false;
+		
 		NektarFFT::NektarFFT(int N)
 		{
 			m_N = N;
@@ -91,6 +109,32 @@ namespace Nektar
 			v_FFTBwdTrans(coef,phys);
 		}
 		
+		void NektarFFT::FFTFwdTrans(int howmany, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
+		{
+			v_FFTFwdTrans(howmany,phys,coef);
+		}
+		
+		void NektarFFT::FFTBwdTrans(int howmany, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys)
+		{
+			v_FFTBwdTrans(howmany,coef,phys);
+		}
+		
+		/**
+		 * Only the root process of the session communicator writes the
+		 * wisdom file, all processes read it.
+		 */
+		void NektarFFT::Configure(const SessionReaderSharedPtr &pSession)
+		{
+			s_plannerEffort = pSession->GetSolverInfoAsEnum<FFTPlannerEffort>(
+				"FFTPlannerEffort");
+			
+			if (pSession->DefinesSolverInfo("FFTWisdom"))
+			{
+				s_wisdomFile  = pSession->GetSolverInfo("FFTWisdom");
+				s_wisdomWrite = pSession->GetComm()->GetRank() == 0;
+			}
+		}
+		
 		void NektarFFT::v_FFTFwdTrans(Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
 		{
 			
@@ -101,5 +145,27 @@ namespace Nektar
 			
 		}
 		
+		/**
+		 * Transforms each vector in turn, for implementations without a
+		 * batched transform.
+		 */
+		void NektarFFT::v_FFTFwdTrans(int howmany, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef)
+		{
+			Array<OneD,NekDouble> tmp1, tmp2;
+			for (int i = 0; i < howmany; ++i)
+			{
+				v_FFTFwdTrans(tmp1 = phys + i*m_N, tmp2 = coef + i*m_N);
+			}
+		}
+		
+		void NektarFFT::v_FFTBwdTrans(int howmany, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys)
+		{
+			Array<OneD,NekDouble> tmp1, tmp2;
+			for (int i = 0; i < howmany; ++i)
+			{
+				v_FFTBwdTrans(tmp1 = coef + i*m_N, tmp2 = phys + i*m_N);
+			}
+		}
+		
 	}//end namespace LibUtilities
 }//end of namespace Nektar
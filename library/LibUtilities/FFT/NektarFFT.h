@@ -39,6 +39,9 @@
 #include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
 #include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+
+#include <string>
 
 namespace Nektar
 {
@@ -64,6 +67,22 @@ namespace Nektar
 		
 		LIB_UTILITIES_EXPORT NektarFFTFactory& GetNektarFFTFactory();
 
+		/// Effort spent by the FFT library in choosing the fastest algorithm.
+		enum FFTPlannerEffort
+		{
+			eFFTEstimate,
+			eFFTMeasure,
+			eFFTPatient,
+			SIZE_FFTPlannerEffort
+		};
+
+		const char* const FFTPlannerEffortMap[] =
+		{
+			"Estimate",
+			"Measure",
+			"Patient"
+		};
+
 		class NektarFFT
 		{
 		public:
@@ -72,7 +91,7 @@ namespace Nektar
 			LIB_UTILITIES_EXPORT NektarFFT(int N);
 			
 			// Distructor
-			LIB_UTILITIES_EXPORT  ~NektarFFT();
+			LIB_UTILITIES_EXPORT virtual ~NektarFFT();
 			
 			/**
 			 * m_N is the dimension of the Fourier transform.
@@ -103,13 +122,46 @@ namespace Nektar
 			 */
 			LIB_UTILITIES_EXPORT void FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
 			
+			/**
+			 * Forward transformation of @a howmany contiguous vectors of
+			 * length m_N, stored one after the other in @a phys and @a coef.
+			 */
+			LIB_UTILITIES_EXPORT void FFTFwdTrans(int howmany, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
+			
+			/**
+			 * Backward transformation of @a howmany contiguous vectors of
+			 * length m_N, stored one after the other in @a coef and @a phys.
+			 */
+			LIB_UTILITIES_EXPORT void FFTBwdTrans(int howmany, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
+			
+			/**
+			 * Reads the planner effort (SOLVERINFO FFTPlannerEffort) and the
+			 * file in which planning information is kept between runs
+			 * (SOLVERINFO FFTWisdom) from the session. Applies to transforms
+			 * created afterwards.
+			 */
+			LIB_UTILITIES_EXPORT static void Configure(const SessionReaderSharedPtr &pSession);
+			
 		protected:
 			
+			static std::string     s_plannerEffortLookupIds[];
+			static std::string     s_plannerEffortDef;
+			
+			/// Planner effort used by implementations which support it.
+			static FFTPlannerEffort s_plannerEffort;
+			/// File holding planning information; empty if not used.
+			static std::string      s_wisdomFile;
+			/// Whether this process writes #s_wisdomFile.
+			static bool             s_wisdomWrite;
 			
 			virtual void v_FFTFwdTrans(Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
 						
 			virtual void v_FFTBwdTrans(Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
 			
+			virtual void v_FFTFwdTrans(int howmany, Array<OneD,NekDouble> &phys, Array<OneD,NekDouble> &coef);
+			
+			virtual void v_FFTBwdTrans(int howmany, Array<OneD,NekDouble> &coef, Array<OneD,NekDouble> &phys);
+			
 		private:
 			
 		};
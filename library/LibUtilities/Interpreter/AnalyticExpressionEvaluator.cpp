@@ -674,6 +674,265 @@ namespace Nektar
 
 
 
+        int AnalyticExpressionEvaluator::GetSpatialCacheSize(const int expression_id)
+        {
+            SplitExecutionStack(expression_id);
+            return m_spaceTimeSplit[expression_id].m_numCache;
+        }
+
+
+        void AnalyticExpressionEvaluator::EvaluateSpatial(
+                    const int expression_id,
+                    const Array<OneD, const NekDouble>& x,
+                    const Array<OneD, const NekDouble>& y,
+                    const Array<OneD, const NekDouble>& z,
+                    Array<OneD, NekDouble>& cache)
+        {
+            SplitExecutionStack(expression_id);
+
+            m_timer.Start();
+
+            const int num_points = x.num_elements();
+            ExecutionStack &stack = m_executionStack[expression_id];
+            SpaceTimeSplit &split = m_spaceTimeSplit[expression_id];
+
+            const int chunk_size = (std::min)(1024, num_points);
+            if (m_state.size() < chunk_size * m_state_sizes[expression_id] )
+            {
+                m_state.resize( m_state_sizes[expression_id] * chunk_size, 0.0 );
+            }
+            if (m_variable.size() < 4 * chunk_size )
+            {
+                m_variable.resize( 4 * chunk_size, 0.0);
+            }
+            if (cache.num_elements() < split.m_numCache * num_points)
+            {
+                cache = Array<OneD, NekDouble>(split.m_numCache * num_points);
+            }
+
+            int offset = 0;
+            int work_left = num_points;
+            while(work_left > 0)
+            {
+                const int this_chunk_size = (std::min)(work_left, 1024);
+                for (int i = 0; i < this_chunk_size; i++)
+                {
+                    m_variable[i+this_chunk_size*0] = x[offset + i];
+                    m_variable[i+this_chunk_size*1] = y[offset + i];
+                    m_variable[i+this_chunk_size*2] = z[offset + i];
+                    m_variable[i+this_chunk_size*3] = 0.0;
+                }
+                for (int j = 0; j < stack.size(); j++)
+                {
+                    if (!split.m_static[j])
+                    {
+                        continue;
+                    }
+
+                    (*stack[j]).run_many(this_chunk_size);
+
+                    const int c = split.m_cacheIdx[j];
+                    if (c >= 0)
+                    {
+                        const int store = stack[j]->storeIdx;
+                        for (int i = 0; i < this_chunk_size; i++)
+                        {
+                            cache[c*num_points + offset + i] =
+                                m_state[store*this_chunk_size + i];
+                        }
+                    }
+                }
+                work_left -= this_chunk_size;
+                offset    += this_chunk_size;
+            }
+            m_timer.Stop();
+            m_total_eval_time += m_timer.TimePerTest(1);
+        }
+
+
+        void AnalyticExpressionEvaluator::EvaluateCached(
+                    const int expression_id,
+                    const int num_points,
+                    const Array<OneD, const NekDouble>& cache,
+                    const NekDouble t,
+                    Array<OneD, NekDouble>& result)
+        {
+            SplitExecutionStack(expression_id);
+
+            m_timer.Start();
+
+            ExecutionStack &stack = m_executionStack[expression_id];
+            SpaceTimeSplit &split = m_spaceTimeSplit[expression_id];
+
+            ASSERTL1(cache.num_elements() >= split.m_numCache * num_points,
+                     "cache has not been filled for this number of points");
+
+            const int chunk_size = (std::min)(1024, num_points);
+            if (m_state.size() < chunk_size * m_state_sizes[expression_id] )
+            {
+                m_state.resize( m_state_sizes[expression_id] * chunk_size, 0.0 );
+            }
+            if (m_variable.size() < 4 * chunk_size )
+            {
+                m_variable.resize( 4 * chunk_size, 0.0);
+            }
+            if (result.num_elements() < num_points)
+            {
+                result = Array<OneD, NekDouble>(num_points, 0.0);
+            }
+
+            int offset = 0;
+            int work_left = num_points;
+            while(work_left > 0)
+            {
+                const int this_chunk_size = (std::min)(work_left, 1024);
+                for (int i = 0; i < this_chunk_size; i++)
+                {
+                    m_variable[i+this_chunk_size*3] = t;
+                }
+                for (int j = 0; j < stack.size(); j++)
+                {
+                    if (!split.m_static[j])
+                    {
+                        (*stack[j]).run_many(this_chunk_size);
+                        continue;
+                    }
+
+                    // Time-independent values are loaded where they were
+                    // computed; the remaining static steps are skipped.
+                    const int c = split.m_cacheIdx[j];
+                    if (c >= 0)
+                    {
+                        const int store = stack[j]->storeIdx;
+                        for (int i = 0; i < this_chunk_size; i++)
+                        {
+                            m_state[store*this_chunk_size + i] =
+                                cache[c*num_points + offset + i];
+                        }
+                    }
+                }
+                for (int i = 0; i < this_chunk_size; i++)
+                {
+                    result[offset + i] = m_state[i];
+                }
+                work_left -= this_chunk_size;
+                offset    += this_chunk_size;
+            }
+            m_timer.Stop();
+            m_total_eval_time += m_timer.TimePerTest(1);
+        }
+
+
+        /**
+         * Steps are evaluated in the order of the stack and each writes to the
+         * state slot storeIdx. A step is time-dependent if it stores t or a
+         * parameter, generates noise, or reads a slot last written by a
+         * time-dependent step. Running only the time-independent steps in
+         * order reproduces the values they write, since they read only slots
+         * last written by time-independent steps. A time-independent step is
+         * cached if the next step using its slot is time-dependent, or if it
+         * writes the final result.
+         */
+        void AnalyticExpressionEvaluator::SplitExecutionStack(const int expression_id)
+        {
+            ASSERTL1(m_executionStack.size() > expression_id, "unknown analytic expression, it must first be defined with DefineFunction(...)");
+
+            if (m_spaceTimeSplit.size() <= expression_id)
+            {
+                m_spaceTimeSplit.resize(m_executionStack.size());
+            }
+
+            SpaceTimeSplit &split = m_spaceTimeSplit[expression_id];
+            if (split.m_isSet)
+            {
+                return;
+            }
+
+            // Index of t in the (x,y,z,t) ordering of the vectorized evaluators.
+            const int timeIdx = 3;
+
+            ExecutionStack &stack = m_executionStack[expression_id];
+            const int nSteps = stack.size();
+
+            std::vector<bool> slotDynamic(m_state_sizes[expression_id], false);
+            std::vector<int>  read1(nSteps, -1);
+            std::vector<int>  read2(nSteps, -1);
+
+            split.m_static.resize(nSteps);
+            split.m_cacheIdx.resize(nSteps, -1);
+
+            for (int j = 0; j < nSteps; j++)
+            {
+                EvaluationStep *step = stack[j];
+                bool dynamic;
+
+                if (dynamic_cast<StoreConst*>(step))
+                {
+                    dynamic = false;
+                }
+                else if (dynamic_cast<StoreVar*>(step))
+                {
+                    dynamic = step->argIdx1 == timeIdx;
+                }
+                else if (dynamic_cast<StorePrm*>(step))
+                {
+                    dynamic = true;
+                }
+                else if (dynamic_cast<EvalAWGN*>(step))
+                {
+                    read1[j] = step->storeIdx;
+                    dynamic  = true;
+                }
+                else
+                {
+                    // Functions and negation act in place on argIdx1. Binary
+                    // operators also read argIdx2, which is never slot 0.
+                    read1[j] = step->argIdx1;
+                    dynamic  = slotDynamic[step->argIdx1];
+                    if (step->argIdx2 > 0)
+                    {
+                        read2[j] = step->argIdx2;
+                        dynamic  = dynamic || slotDynamic[step->argIdx2];
+                    }
+                }
+
+                slotDynamic[step->storeIdx] = dynamic;
+                split.m_static[j] = !dynamic;
+            }
+
+            for (int j = 0; j < nSteps; j++)
+            {
+                if (!split.m_static[j])
+                {
+                    continue;
+                }
+
+                const int store = stack[j]->storeIdx;
+                bool cached = store == 0;
+                for (int k = j+1; k < nSteps; k++)
+                {
+                    if (read1[k] == store || read2[k] == store)
+                    {
+                        cached = !split.m_static[k];
+                        break;
+                    }
+                    if (stack[k]->storeIdx == store)
+                    {
+                        cached = false;
+                        break;
+                    }
+                }
+
+                if (cached)
+                {
+                    split.m_cacheIdx[j] = split.m_numCache++;
+                }
+            }
+
+            split.m_isSet = true;
+        }
+
+
         AnalyticExpressionEvaluator::PrecomputedValue AnalyticExpressionEvaluator::PrepareExecutionAsYouParse(
                     const ParsedTreeIterator& location,
                     ExecutionStack& stack,
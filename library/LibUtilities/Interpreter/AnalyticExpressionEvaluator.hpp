@@ -240,6 +240,30 @@ namespace Nektar
                     const std::vector<Array<OneD, const NekDouble> > points,
                     Array<OneD, NekDouble>& result);
 
+            ///  Number of values per point stored by #EvaluateSpatial for an
+            ///  expression depending on the 4 variables (x,y,z,t).
+            LIB_UTILITIES_EXPORT int GetSpatialCacheSize(const int expression_id);
+
+            ///  Evaluates the sub-expressions which depend neither on t nor on
+            ///  parameters at a set of points, and stores those needed by
+            ///  #EvaluateCached in @a cache (point index fastest).
+            LIB_UTILITIES_EXPORT void EvaluateSpatial(
+                        const int expression_id,
+                        const Array<OneD, const NekDouble>& x,
+                        const Array<OneD, const NekDouble>& y,
+                        const Array<OneD, const NekDouble>& z,
+                        Array<OneD, NekDouble>& cache);
+
+            ///  Vectorized evaluation at time @a t at the @a num_points points
+            ///  of a cache filled by #EvaluateSpatial. Only the steps which
+            ///  depend on t or on parameters are run.
+            LIB_UTILITIES_EXPORT void EvaluateCached(
+                        const int expression_id,
+                        const int num_points,
+                        const Array<OneD, const NekDouble>& cache,
+                        const NekDouble t,
+                        Array<OneD, NekDouble>& result);
+
         private:
 
             // ======================================================
@@ -281,6 +305,11 @@ namespace Nektar
                         VariableMap &varMap,
                         int stateIndex);
 
+            ///  Classifies the steps of an execution stack as time-independent
+            ///  or not and finds the time-independent values read by
+            ///  time-dependent steps, which are cached by #EvaluateSpatial.
+            LIB_UTILITIES_EXPORT void SplitExecutionStack(const int expression_id);
+
 
             // ======================================================
             //  Boost::spirit related data structures
@@ -382,6 +411,22 @@ namespace Nektar
 
             std::vector<VariableMap>     m_stackVariableMap;
 
+            ///  Split of an execution stack by #SplitExecutionStack.
+            ///  m_static flags the steps depending neither on t nor on
+            ///  parameters, and m_cacheIdx gives the position in the cache of
+            ///  the value written by a step (-1 if it is not cached).
+            struct SpaceTimeSplit
+            {
+                SpaceTimeSplit() : m_isSet(false), m_numCache(0) {}
+
+                bool               m_isSet;
+                int                m_numCache;
+                std::vector<bool>  m_static;
+                std::vector<int>   m_cacheIdx;
+            };
+
+            std::vector<SpaceTimeSplit>  m_spaceTimeSplit;
+
             // ======================================================
             //  Execution state and data
             // ======================================================
@@ -79,6 +79,10 @@ namespace Blas
         void F77NAME(dtpmv) (const char& uplo, const char& trans, const char& diag,
                  const int& n, const double* ap, double* x, const int& incx);
 
+        void F77NAME(dtrsv) (const char& uplo, const char& trans, const char& diag,
+                 const int& n, const double* a, const int& lda,
+                 double* x, const int& incx);
+
         void F77NAME(dspmv) (const char& trans, const int& n,    const double& alpha,
                  const double* a,   const double* x, const int& incx,
                  const double& beta,      double* y, const int& incy);
@@ -96,6 +100,15 @@ namespace Blas
                  const double* a,     const int& lda,
                  const double* b,     const int& ldb,
                  const double& beta,  double* c, const int& ldc);
+        void F77NAME(dtrsm) (const char& side,    const char& uplo,
+                 const char& transa,  const char& diag,
+                 const int& m,        const int& n,
+                 const double& alpha, const double* a, const int& lda,
+                 double* b,           const int& ldb);
+        void F77NAME(dsyrk) (const char& uplo,    const char& trans,
+                 const int& n,        const int& k,
+                 const double& alpha, const double* a, const int& lda,
+                 const double& beta,  double* c, const int& ldc);
     }
 
 #ifdef NEKTAR_USING_BLAS
@@ -190,6 +203,15 @@ namespace Blas
         F77NAME(dtpmv) (uplo, trans, diag, n, ap, x, incx);
     }
 
+    /// \brief BLAS level 2: Solve A \e x = b in place where A is
+    /// triangular
+    static inline void Dtrsv(const char& uplo, const char& trans, const char& diag,
+                 const int& n, const double* a, const int& lda,
+                 double* x, const int& incx)
+    {
+        F77NAME(dtrsv) (uplo, trans, diag, n, a, lda, x, incx);
+    }
+
     /// \brief BLAS level 2: Matrix vector multiply y = A \e x where A
     /// is symmetric packed
     static inline void Dspmv (const char& trans,  const int& n,    const double& alpha,
@@ -219,6 +241,26 @@ namespace Blas
         F77NAME(dgemm) (transa,transb,m,n,k,alpha,a,lda,b,ldb,beta,c,ldc);
     }
 
+    /// \brief BLAS level 3: Solve op(A) X = alpha B or X op(A) = alpha B
+    ///   in place where A is triangular
+    static inline void Dtrsm (const char& side,    const char& uplo,
+          const char& transa,  const char& diag,   const int& m,
+          const int& n,        const double& alpha, const double* a,
+          const int& lda,            double* b,     const int& ldb)
+    {
+        F77NAME(dtrsm) (side,uplo,transa,diag,m,n,alpha,a,lda,b,ldb);
+    }
+
+    /// \brief BLAS level 3: Symmetric rank-k update C = alpha A A^T + beta C
+    ///   where C[n x n] is symmetric
+    static inline void Dsyrk (const char& uplo,    const char& trans,
+          const int& n,        const int& k,       const double& alpha,
+          const double* a,     const int& lda,     const double& beta,
+                double* c,     const int& ldc)
+    {
+        F77NAME(dsyrk) (uplo,trans,n,k,alpha,a,lda,beta,c,ldc);
+    }
+
     // \brief Wrapper to mutliply two (row major) matrices together C =
     // a*A*B + b*C
     static inline void Cdgemm(const int M, const int N, const int K, const double a,
@@ -60,6 +60,10 @@ namespace Nektar
     typedef boost::shared_ptr<COOMatType>       COOMatTypeSharedPtr;
     typedef Array<OneD, COOMatType>             COOMatVector;
 
+    // Elemental COO as a list of entries, e.g. for assembly
+    typedef std::pair<CoordType, NekDouble>     COOTriplet;
+    typedef std::vector<COOTriplet>             COOTripletVector;
+
     // Block COO (BCO): each entry is a dense submatrix (of same size)
     typedef Array<OneD, NekDouble>              BCOEntryType;
     typedef std::map<CoordType, BCOEntryType >  BCOMatType;
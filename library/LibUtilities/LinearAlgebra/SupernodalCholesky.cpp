@@ -0,0 +1,458 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SupernodalCholesky.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Sparse supernodal Cholesky factorisation
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <LibUtilities/LinearAlgebra/SupernodalCholesky.hpp>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+#include <LibUtilities/LinearAlgebra/Lapack.hpp>
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
+
+namespace Nektar
+{
+    /**
+     * The lower triangle of @a entries is converted to compressed column
+     * storage, from which the supernodal structure of the factor is
+     * determined before the numerical factorisation.
+     */
+    SupernodalCholesky::SupernodalCholesky(
+        const unsigned int      nRows,
+        const COOTripletVector &entries)
+        : m_nRows(nRows)
+    {
+        Factorise(entries);
+    }
+
+    SupernodalCholesky::SupernodalCholesky(
+        const unsigned int  nRows,
+        const COOMatType   &cooMat)
+        : m_nRows(nRows)
+    {
+        Factorise(COOTripletVector(cooMat.begin(), cooMat.end()));
+    }
+
+    SupernodalCholesky::~SupernodalCholesky()
+    {
+    }
+
+    void SupernodalCholesky::Factorise(const COOTripletVector &entries)
+    {
+        const unsigned int nRows = m_nRows;
+
+        Timer t;
+        t.Start();
+
+        // Entries of a column are visited in increasing row order.
+        std::vector<int>       colPtr(nRows+1, 0);
+        std::vector<int>       rowIdx;
+        std::vector<NekDouble> val;
+        COOTripletVector::const_iterator entry;
+
+        for (entry = entries.begin(); entry != entries.end(); ++entry)
+        {
+            if (entry->first.first >= entry->first.second)
+            {
+                ++colPtr[entry->first.second+1];
+            }
+        }
+
+        for (unsigned int i = 0; i < nRows; ++i)
+        {
+            colPtr[i+1] += colPtr[i];
+        }
+
+        std::vector<int> pos(colPtr.begin(), colPtr.end()-1);
+        rowIdx.resize(colPtr[nRows]);
+        val   .resize(colPtr[nRows]);
+
+        for (entry = entries.begin(); entry != entries.end(); ++entry)
+        {
+            if (entry->first.first >= entry->first.second)
+            {
+                int p     = pos[entry->first.second]++;
+                rowIdx[p] = entry->first.first;
+                val[p]    = entry->second;
+            }
+        }
+
+        Symbolic(colPtr, rowIdx);
+        Numeric (colPtr, rowIdx, val);
+
+        t.Stop();
+        m_factorTime = t.TimePerTest(1);
+    }
+
+    size_t SupernodalCholesky::GetFactorMemory() const
+    {
+        return m_val.size()    * sizeof(NekDouble)
+             + m_rowIdx.size() * sizeof(int)
+             + (m_rowPtr.size() + m_valPtr.size()) * sizeof(size_t)
+             + m_snodeStart.size() * sizeof(int);
+    }
+
+    /**
+     * Computes the elimination tree and the sparsity pattern of each column
+     * of L, which is the pattern of the matrix column merged with those of
+     * its children in the tree. Consecutive columns j and j+1 form part of
+     * the same supernode when j+1 is the parent of j and the pattern of j is
+     * that of j+1 together with j+1 itself. Only the patterns of the last
+     * column of each supernode are retained.
+     */
+    void SupernodalCholesky::Symbolic(
+        const std::vector<int> &colPtr,
+        const std::vector<int> &rowIdx)
+    {
+        int i, j, k, p, c;
+        int n = m_nRows;
+
+        // Strictly lower triangle stored by rows.
+        std::vector<int> rowPtr(n+1, 0);
+        for (k = 0; k < n; ++k)
+        {
+            for (p = colPtr[k]; p < colPtr[k+1]; ++p)
+            {
+                if (rowIdx[p] > k)
+                {
+                    ++rowPtr[rowIdx[p]+1];
+                }
+            }
+        }
+        for (k = 0; k < n; ++k)
+        {
+            rowPtr[k+1] += rowPtr[k];
+        }
+
+        std::vector<int> colIdx(rowPtr[n]);
+        std::vector<int> pos(rowPtr.begin(), rowPtr.end()-1);
+        for (k = 0; k < n; ++k)
+        {
+            for (p = colPtr[k]; p < colPtr[k+1]; ++p)
+            {
+                if (rowIdx[p] > k)
+                {
+                    colIdx[pos[rowIdx[p]]++] = k;
+                }
+            }
+        }
+
+        // Elimination tree with path compression.
+        std::vector<int> parent  (n, -1);
+        std::vector<int> ancestor(n, -1);
+        for (k = 0; k < n; ++k)
+        {
+            for (p = rowPtr[k]; p < rowPtr[k+1]; ++p)
+            {
+                for (i = colIdx[p]; i != -1 && i < k; i = j)
+                {
+                    j = ancestor[i];
+                    ancestor[i] = k;
+                    if (j == -1)
+                    {
+                        parent[i] = k;
+                    }
+                }
+            }
+        }
+
+        // Children of each column, in increasing order.
+        std::vector<int> head(n, -1);
+        std::vector<int> next(n, -1);
+        for (k = n-1; k >= 0; --k)
+        {
+            if (parent[k] != -1)
+            {
+                next[k] = head[parent[k]];
+                head[parent[k]] = k;
+            }
+        }
+
+        std::vector<std::vector<int> > pattern(n);
+        std::vector<int>               mark(n, -1);
+
+        m_snodeStart.clear();
+        for (k = 0; k < n; ++k)
+        {
+            std::vector<int> &pk = pattern[k];
+            mark[k] = k;
+
+            for (p = colPtr[k]; p < colPtr[k+1]; ++p)
+            {
+                i = rowIdx[p];
+                if (mark[i] != k)
+                {
+                    mark[i] = k;
+                    pk.push_back(i);
+                }
+            }
+
+            for (c = head[k]; c != -1; c = next[c])
+            {
+                for (unsigned int q = 0; q < pattern[c].size(); ++q)
+                {
+                    i = pattern[c][q];
+                    if (mark[i] != k)
+                    {
+                        mark[i] = k;
+                        pk.push_back(i);
+                    }
+                }
+            }
+            std::sort(pk.begin(), pk.end());
+
+            if (k > 0 && parent[k-1] == k &&
+                pattern[k-1].size() == pk.size() + 1)
+            {
+                std::vector<int>().swap(pattern[k-1]);
+            }
+            else
+            {
+                m_snodeStart.push_back(k);
+            }
+        }
+        m_snodeStart.push_back(n);
+
+        int nSnode = m_snodeStart.size() - 1;
+        m_rowPtr.resize(nSnode+1);
+        m_valPtr.resize(nSnode+1);
+        m_rowPtr[0] = 0;
+        m_valPtr[0] = 0;
+
+        for (k = 0; k < nSnode; ++k)
+        {
+            int first = m_snodeStart[k];
+            int last  = m_snodeStart[k+1] - 1;
+            int ns    = last - first + 1;
+            int nrows = ns + pattern[last].size();
+
+            m_rowPtr[k+1] = m_rowPtr[k] + nrows;
+            m_valPtr[k+1] = m_valPtr[k] + (size_t) nrows * ns;
+        }
+
+        m_rowIdx.resize(m_rowPtr[nSnode]);
+        for (k = 0; k < nSnode; ++k)
+        {
+            int last = m_snodeStart[k+1] - 1;
+            int *r   = &m_rowIdx[0] + m_rowPtr[k];
+
+            for (j = m_snodeStart[k]; j <= last; ++j)
+            {
+                *r++ = j;
+            }
+            std::copy(pattern[last].begin(), pattern[last].end(), r);
+            std::vector<int>().swap(pattern[last]);
+        }
+    }
+
+    /**
+     * Multifrontal factorisation. For each supernode the panel of L is
+     * assembled from the matrix and the update matrices of its children,
+     * the diagonal block is factorised and the off-diagonal block solved
+     * for, and the update matrix passed to the parent is formed by a
+     * symmetric rank-k update.
+     */
+    void SupernodalCholesky::Numeric(
+        const std::vector<int>       &colPtr,
+        const std::vector<int>       &rowIdx,
+        const std::vector<NekDouble> &val)
+    {
+        int i, j, p, s, c, info;
+        int n      = m_nRows;
+        int nSnode = m_snodeStart.size() - 1;
+
+        m_val.assign(m_valPtr[nSnode], 0.0);
+
+        std::vector<int> snodeOf(n);
+        for (s = 0; s < nSnode; ++s)
+        {
+            for (j = m_snodeStart[s]; j < m_snodeStart[s+1]; ++j)
+            {
+                snodeOf[j] = s;
+            }
+        }
+
+        // Children of each supernode.
+        std::vector<int> head(nSnode, -1);
+        std::vector<int> next(nSnode, -1);
+        for (s = nSnode-1; s >= 0; --s)
+        {
+            int ns    = m_snodeStart[s+1] - m_snodeStart[s];
+            int nrows = m_rowPtr[s+1] - m_rowPtr[s];
+            if (nrows > ns)
+            {
+                int par = snodeOf[m_rowIdx[m_rowPtr[s] + ns]];
+                next[s]   = head[par];
+                head[par] = s;
+            }
+        }
+
+        std::vector<std::vector<NekDouble> > update(nSnode);
+        std::vector<int>                     relPos(n);
+
+        for (s = 0; s < nSnode; ++s)
+        {
+            int        first = m_snodeStart[s];
+            int        ns    = m_snodeStart[s+1] - first;
+            int        m     = m_rowPtr[s+1] - m_rowPtr[s];
+            int        nr    = m - ns;
+            const int *rows  = &m_rowIdx[0] + m_rowPtr[s];
+            NekDouble *panel = &m_val[0] + m_valPtr[s];
+
+            for (i = 0; i < m; ++i)
+            {
+                relPos[rows[i]] = i;
+            }
+
+            std::vector<NekDouble> &U = update[s];
+            U.assign((size_t) nr * nr, 0.0);
+
+            for (j = 0; j < ns; ++j)
+            {
+                for (p = colPtr[first+j]; p < colPtr[first+j+1]; ++p)
+                {
+                    panel[relPos[rowIdx[p]] + (size_t) j*m] += val[p];
+                }
+            }
+
+            // Extend-add the lower triangle of the children's updates.
+            for (c = head[s]; c != -1; c = next[c])
+            {
+                int        nsc   = m_snodeStart[c+1] - m_snodeStart[c];
+                int        k     = m_rowPtr[c+1] - m_rowPtr[c] - nsc;
+                const int *crows = &m_rowIdx[0] + m_rowPtr[c] + nsc;
+                const NekDouble *Uc = &update[c][0];
+
+                for (j = 0; j < k; ++j)
+                {
+                    int pj = relPos[crows[j]];
+                    for (i = j; i < k; ++i)
+                    {
+                        int       pi = relPos[crows[i]];
+                        NekDouble v  = Uc[i + (size_t) j*k];
+
+                        if (pj < ns)
+                        {
+                            panel[pi + (size_t) pj*m] += v;
+                        }
+                        else
+                        {
+                            U[(pi-ns) + (size_t) (pj-ns)*nr] += v;
+                        }
+                    }
+                }
+
+                std::vector<NekDouble>().swap(update[c]);
+            }
+
+            Lapack::Dpotrf('L', ns, panel, m, info);
+            ASSERTL0(info == 0, "Matrix is not positive definite.");
+
+            if (nr > 0)
+            {
+                Blas::Dtrsm('R', 'L', 'T', 'N', nr, ns, 1.0, panel, m,
+                            panel + ns, m);
+                Blas::Dsyrk('L', 'N', nr, ns, -1.0, panel + ns, m,
+                            1.0, &U[0], nr);
+            }
+        }
+    }
+
+    /**
+     * Forward substitution with L followed by backward substitution with
+     * L^T, supernode by supernode. The columns of a supernode are contiguous
+     * so that the diagonal blocks are solved in place.
+     */
+    void SupernodalCholesky::Solve(
+        const Array<OneD, const NekDouble> &pInput,
+              Array<OneD,       NekDouble> &pOutput) const
+    {
+        int i, s;
+        int nSnode = m_snodeStart.size() - 1;
+
+        if (m_nRows == 0)
+        {
+            return;
+        }
+
+        std::vector<NekDouble> x(pInput.get(), pInput.get() + m_nRows);
+        std::vector<NekDouble> tmp(m_nRows);
+
+        for (s = 0; s < nSnode; ++s)
+        {
+            int              first = m_snodeStart[s];
+            int              ns    = m_snodeStart[s+1] - first;
+            int              m     = m_rowPtr[s+1] - m_rowPtr[s];
+            int              nr    = m - ns;
+            const int       *below = &m_rowIdx[0] + m_rowPtr[s] + ns;
+            const NekDouble *panel = &m_val[0] + m_valPtr[s];
+
+            Blas::Dtrsv('L', 'N', 'N', ns, panel, m, &x[first], 1);
+
+            if (nr > 0)
+            {
+                Blas::Dgemv('N', nr, ns, 1.0, panel + ns, m, &x[first], 1,
+                            0.0, &tmp[0], 1);
+                for (i = 0; i < nr; ++i)
+                {
+                    x[below[i]] -= tmp[i];
+                }
+            }
+        }
+
+        for (s = nSnode-1; s >= 0; --s)
+        {
+            int              first = m_snodeStart[s];
+            int              ns    = m_snodeStart[s+1] - first;
+            int              m     = m_rowPtr[s+1] - m_rowPtr[s];
+            int              nr    = m - ns;
+            const int       *below = &m_rowIdx[0] + m_rowPtr[s] + ns;
+            const NekDouble *panel = &m_val[0] + m_valPtr[s];
+
+            if (nr > 0)
+            {
+                for (i = 0; i < nr; ++i)
+                {
+                    tmp[i] = x[below[i]];
+                }
+                Blas::Dgemv('T', nr, ns, -1.0, panel + ns, m, &tmp[0], 1,
+                            1.0, &x[first], 1);
+            }
+
+            Blas::Dtrsv('L', 'T', 'N', ns, panel, m, &x[first], 1);
+        }
+
+        std::copy(x.begin(), x.end(), pOutput.get());
+    }
+}
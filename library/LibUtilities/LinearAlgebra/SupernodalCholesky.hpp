@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: SupernodalCholesky.hpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Sparse supernodal Cholesky factorisation
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_SUPERNODAL_CHOLESKY_HPP
+#define NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_SUPERNODAL_CHOLESKY_HPP
+
+#include <vector>
+
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
+
+namespace Nektar
+{
+    class SupernodalCholesky;
+    typedef boost::shared_ptr<SupernodalCholesky> SupernodalCholeskySharedPtr;
+
+    /**
+     * @brief Sparse Cholesky factorisation \f$ A = LL^T \f$ of a symmetric
+     * positive-definite matrix.
+     *
+     * Columns of \f$ L \f$ sharing the same sparsity pattern are grouped into
+     * supernodes, each stored as a dense column-major panel, and the
+     * factorisation is carried out by the multifrontal method with BLAS 3
+     * kernels per supernode. The matrix is factorised in the given ordering,
+     * which should therefore already be fill-reducing (e.g. nested
+     * dissection).
+     */
+    class SupernodalCholesky
+    {
+    public:
+        /// Factorises the matrix of dimension @a nRows given by the lower
+        /// triangle (row >= column) of @a entries, which must be sorted by
+        /// row and then column and hold each position once.
+        LIB_UTILITIES_EXPORT SupernodalCholesky(
+            const unsigned int      nRows,
+            const COOTripletVector &entries);
+
+        /// Factorises the matrix of dimension @a nRows given by the lower
+        /// triangle (row >= column) of @a cooMat.
+        LIB_UTILITIES_EXPORT SupernodalCholesky(
+            const unsigned int  nRows,
+            const COOMatType   &cooMat);
+
+        LIB_UTILITIES_EXPORT ~SupernodalCholesky();
+
+        /// Solves \f$ A x = b \f$, where @a pOutput may alias @a pInput.
+        LIB_UTILITIES_EXPORT void Solve(
+            const Array<OneD, const NekDouble> &pInput,
+                  Array<OneD,       NekDouble> &pOutput) const;
+
+        unsigned int GetRows() const
+        {
+            return m_nRows;
+        }
+
+        unsigned int GetNumSupernodes() const
+        {
+            return m_snodeStart.size() - 1;
+        }
+
+        /// Number of entries stored for the factor.
+        size_t GetFactorNonZeros() const
+        {
+            return m_val.size();
+        }
+
+        /// Storage used by the factor, in bytes.
+        LIB_UTILITIES_EXPORT size_t GetFactorMemory() const;
+
+        /// Time taken by the symbolic and numeric factorisation, in seconds.
+        NekDouble GetFactorTime() const
+        {
+            return m_factorTime;
+        }
+
+    private:
+        unsigned int        m_nRows;
+        /// First column of each supernode, with the number of columns as
+        /// the last entry.
+        std::vector<int>    m_snodeStart;
+        /// Offset of the row indices of each supernode in #m_rowIdx.
+        std::vector<size_t> m_rowPtr;
+        /// Row indices of each supernode, starting with its own columns.
+        std::vector<int>    m_rowIdx;
+        /// Offset of the panel of each supernode in #m_val.
+        std::vector<size_t> m_valPtr;
+        /// Column-major panels of L.
+        std::vector<NekDouble> m_val;
+        NekDouble           m_factorTime;
+
+        void Factorise(const COOTripletVector &entries);
+
+        void Symbolic(
+            const std::vector<int> &colPtr,
+            const std::vector<int> &rowIdx);
+
+        void Numeric(
+            const std::vector<int>       &colPtr,
+            const std::vector<int>       &rowIdx,
+            const std::vector<NekDouble> &val);
+    };
+}
+
+#endif //NEKTAR_LIB_UTILITIES_LINEAR_ALGEBRA_SUPERNODAL_CHOLESKY_HPP
@@ -0,0 +1,310 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: ScratchArena.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Per-thread stack allocator for operator workspace.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/Memory/ScratchArena.hpp>
+
+#include <loki/Singleton.h>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <iomanip>
+
+namespace Nektar
+{
+    namespace
+    {
+        /// Size of the first block of each arena in bytes.
+        const size_t kInitialBlockSize = 256*1024;
+
+        /// Arenas of all threads, for the collection of statistics.
+        struct ArenaRegistry
+        {
+            ArenaRegistry() : m_statsEnabled(false)
+            {
+            }
+
+            boost::thread_specific_ptr<ScratchArena> m_threadArena;
+            boost::mutex                             m_mutex;
+            std::vector<ScratchArena *>              m_arenas;
+            /// Statistics of the arenas of threads which have ended.
+            ScratchArena::StatisticsMap              m_retired;
+            bool                                     m_statsEnabled;
+        };
+
+        ArenaRegistry &GetArenaRegistry()
+        {
+            typedef Loki::SingletonHolder<ArenaRegistry,
+                                          Loki::CreateUsingNew,
+                                          Loki::NoDestroy > Type;
+            return Type::Instance();
+        }
+    }
+
+    ScratchArena::ScratchArena()
+        : m_blocks(),
+          m_block(0),
+          m_ptr(0),
+          m_end(0),
+          m_depth(0),
+          m_statsEnabled(false),
+          m_current(0),
+          m_stats()
+    {
+        AddBlock(kInitialBlockSize);
+        m_ptr = m_blocks[0].m_base;
+        m_end = m_ptr + m_blocks[0].m_size;
+
+        ArenaRegistry &registry = GetArenaRegistry();
+        boost::mutex::scoped_lock l(registry.m_mutex);
+        registry.m_arenas.push_back(this);
+        m_statsEnabled = registry.m_statsEnabled;
+    }
+
+    ScratchArena::~ScratchArena()
+    {
+        ASSERTL1(m_depth == 0, "Scratch arena destroyed with open scopes.");
+
+        {
+            ArenaRegistry &registry = GetArenaRegistry();
+            boost::mutex::scoped_lock l(registry.m_mutex);
+            registry.m_arenas.erase(std::find(registry.m_arenas.begin(),
+                                              registry.m_arenas.end(),
+                                              this));
+            MergeStatistics(registry.m_retired);
+        }
+
+        for (size_t i = 0; i < m_blocks.size(); ++i)
+        {
+            ::operator delete(m_blocks[i].m_raw);
+        }
+    }
+
+    ScratchArena &ScratchArena::GetThreadArena()
+    {
+        boost::thread_specific_ptr<ScratchArena> &arena =
+            GetArenaRegistry().m_threadArena;
+
+        if (!arena.get())
+        {
+            arena.reset(new ScratchArena());
+        }
+        return *arena;
+    }
+
+    void ScratchArena::EnableStatistics(const bool enable)
+    {
+        ArenaRegistry &registry = GetArenaRegistry();
+        boost::mutex::scoped_lock l(registry.m_mutex);
+
+        registry.m_statsEnabled = enable;
+        for (size_t i = 0; i < registry.m_arenas.size(); ++i)
+        {
+            registry.m_arenas[i]->m_statsEnabled = enable;
+        }
+    }
+
+    /**
+     * The statistics of other threads are read while they may be running,
+     * so they should be collected when the threads are idle.
+     */
+    void ScratchArena::GetStatistics(StatisticsMap &stats)
+    {
+        ArenaRegistry &registry = GetArenaRegistry();
+        boost::mutex::scoped_lock l(registry.m_mutex);
+
+        stats = registry.m_retired;
+        for (size_t i = 0; i < registry.m_arenas.size(); ++i)
+        {
+            registry.m_arenas[i]->MergeStatistics(stats);
+        }
+    }
+
+    void ScratchArena::ResetStatistics()
+    {
+        ArenaRegistry &registry = GetArenaRegistry();
+        boost::mutex::scoped_lock l(registry.m_mutex);
+
+        registry.m_retired.clear();
+        for (size_t i = 0; i < registry.m_arenas.size(); ++i)
+        {
+            std::map<const char *, Statistics>::iterator it;
+            for (it  = registry.m_arenas[i]->m_stats.begin();
+                 it != registry.m_arenas[i]->m_stats.end(); ++it)
+            {
+                it->second = Statistics();
+            }
+        }
+    }
+
+    void ScratchArena::PrintStatistics(std::ostream &out)
+    {
+        StatisticsMap stats;
+        GetStatistics(stats);
+
+        out << std::left  << std::setw(40) << "Scratch scope"
+            << std::right << std::setw(12) << "Entered"
+            << std::setw(12) << "Allocs"
+            << std::setw(12) << "MB"
+            << std::setw(10) << "Peak MB"
+            << std::setw(8)  << "Heap" << std::endl;
+
+        StatisticsMap::const_iterator it;
+        for (it = stats.begin(); it != stats.end(); ++it)
+        {
+            std::string label = it->first;
+            if (label.size() > 39)
+            {
+                label = label.substr(0, 36) + "...";
+            }
+
+            out << std::left  << std::setw(40) << label
+                << std::right << std::setw(12) << it->second.m_scopes
+                << std::setw(12) << it->second.m_allocs
+                << std::fixed << std::setprecision(2)
+                << std::setw(12) << it->second.m_bytes/1048576.0
+                << std::setw(10) << it->second.m_peak/1048576.0
+                << std::setw(8)  << it->second.m_heapAllocs << std::endl;
+        }
+        out.unsetf(std::ios::floatfield);
+    }
+
+    size_t ScratchArena::GetCapacity() const
+    {
+        size_t capacity = 0;
+        for (size_t i = 0; i < m_blocks.size(); ++i)
+        {
+            capacity += m_blocks[i].m_size;
+        }
+        return capacity;
+    }
+
+    /**
+     * Called when the current block is exhausted or statistics are being
+     * recorded. Blocks left behind by a scope which has ended are reused
+     * before a new block is taken from the heap.
+     */
+    void *ScratchArena::AllocateSlow(size_t bytes)
+    {
+        if (bytes > static_cast<size_t>(m_end - m_ptr))
+        {
+            size_t inUse = GetBytesInUse();
+            size_t next  = m_block + 1;
+
+            while (next < m_blocks.size() && m_blocks[next].m_size < bytes)
+            {
+                ++next;
+            }
+
+            if (next == m_blocks.size())
+            {
+                AddBlock((std::max)(bytes, 2*m_blocks.back().m_size));
+                if (m_current)
+                {
+                    ++m_current->m_heapAllocs;
+                }
+            }
+
+            m_block = next;
+            m_blocks[next].m_start = inUse;
+            m_ptr = m_blocks[next].m_base;
+            m_end = m_ptr + m_blocks[next].m_size;
+        }
+
+        void *result = m_ptr;
+        m_ptr += bytes;
+
+        if (m_current)
+        {
+            ++m_current->m_allocs;
+            m_current->m_bytes += bytes;
+            m_current->m_peak   = (std::max)(m_current->m_peak,
+                                             GetBytesInUse());
+        }
+
+        return result;
+    }
+
+    ScratchArena::Statistics *ScratchArena::EnterNamedScope(const char *name)
+    {
+        Statistics *stats = &m_stats[name];
+        ++stats->m_scopes;
+        return stats;
+    }
+
+    /**
+     * Replaces the blocks by a single one of their total size once no
+     * scope is open, so that later passes fit in one block.
+     */
+    void ScratchArena::Consolidate()
+    {
+        size_t capacity = GetCapacity();
+
+        for (size_t i = 0; i < m_blocks.size(); ++i)
+        {
+            ::operator delete(m_blocks[i].m_raw);
+        }
+        m_blocks.clear();
+
+        AddBlock(capacity);
+        m_block = 0;
+        m_ptr   = m_blocks[0].m_base;
+        m_end   = m_ptr + m_blocks[0].m_size;
+    }
+
+    void ScratchArena::AddBlock(size_t bytes)
+    {
+        Block block;
+        block.m_raw   = static_cast<char *>(::operator new(bytes + Alignment));
+        block.m_base  = block.m_raw + (Alignment -
+            reinterpret_cast<size_t>(block.m_raw) % Alignment) % Alignment;
+        block.m_size  = bytes;
+        block.m_start = 0;
+        m_blocks.push_back(block);
+    }
+
+    void ScratchArena::MergeStatistics(StatisticsMap &stats) const
+    {
+        std::map<const char *, Statistics>::const_iterator it;
+        for (it = m_stats.begin(); it != m_stats.end(); ++it)
+        {
+            Statistics &s = stats[it->first];
+            s.m_scopes     += it->second.m_scopes;
+            s.m_allocs     += it->second.m_allocs;
+            s.m_bytes      += it->second.m_bytes;
+            s.m_peak        = (std::max)(s.m_peak, it->second.m_peak);
+            s.m_heapAllocs += it->second.m_heapAllocs;
+        }
+    }
+}
@@ -0,0 +1,286 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: ScratchArena.hpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Scientific Computing and Imaging Institute,
+// University of Utah (USA) and Department of Aeronautics, Imperial
+// College London (UK).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Per-thread stack allocator for operator workspace.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_UTILITIES_MEMORY_SCRATCH_ARENA_HPP
+#define NEKTAR_LIB_UTILITIES_MEMORY_SCRATCH_ARENA_HPP
+
+#include <LibUtilities/LibUtilitiesDeclspec.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Nektar
+{
+    /**
+     * @brief Per-thread stack allocator for the temporary storage of
+     * element and field operators.
+     *
+     * Memory is handed out by advancing a pointer through large blocks and
+     * is returned in one step when the enclosing ScratchScope ends, so an
+     * allocation involves neither the memory pool nor a reference count.
+     * Every allocation is aligned to #Alignment bytes. When a block is
+     * exhausted a larger one is added; once no scope is open the blocks
+     * are merged into one, so an operator called repeatedly with the same
+     * sizes stops allocating from the heap after its first call. The arena
+     * keeps its largest size until the thread ends.
+     *
+     * Statistics of the allocations made in each named scope are recorded
+     * once enabled with EnableStatistics().
+     */
+    class ScratchArena
+    {
+        public:
+            /// Alignment of every allocation in bytes.
+            static const size_t Alignment = 64;
+
+            /// Allocations made in the scopes with a given name.
+            struct Statistics
+            {
+                Statistics() :
+                    m_scopes(0), m_allocs(0), m_bytes(0), m_peak(0),
+                    m_heapAllocs(0)
+                {
+                }
+
+                /// Number of times the scope was entered.
+                size_t m_scopes;
+                /// Number and total size of the allocations.
+                size_t m_allocs;
+                size_t m_bytes;
+                /// Largest size of the arena in use within the scope.
+                size_t m_peak;
+                /// Number of blocks the arena took from the heap.
+                size_t m_heapAllocs;
+            };
+            typedef std::map<std::string, Statistics> StatisticsMap;
+
+            LIB_UTILITIES_EXPORT ScratchArena();
+            LIB_UTILITIES_EXPORT ~ScratchArena();
+
+            /// Returns the arena of the calling thread.
+            LIB_UTILITIES_EXPORT static ScratchArena &GetThreadArena();
+
+            /// Enables or disables the statistics of all arenas.
+            LIB_UTILITIES_EXPORT static void EnableStatistics(
+                const bool enable = true);
+
+            /// Sums the statistics of all arenas by scope name.
+            LIB_UTILITIES_EXPORT static void GetStatistics(
+                StatisticsMap &stats);
+
+            /// Clears the statistics of all arenas.
+            LIB_UTILITIES_EXPORT static void ResetStatistics();
+
+            /// Prints the statistics of all arenas, one line per scope.
+            LIB_UTILITIES_EXPORT static void PrintStatistics(
+                std::ostream &out);
+
+            /// Returns @a bytes of uninitialised storage, valid until the
+            /// innermost open ScratchScope ends.
+            inline void *Allocate(size_t bytes);
+
+            /// Number of bytes currently handed out.
+            size_t GetBytesInUse() const
+            {
+                return m_blocks.size() == 0 ? 0 :
+                    m_blocks[m_block].m_start +
+                    (m_ptr - m_blocks[m_block].m_base);
+            }
+
+            /// Total size of the blocks held by the arena.
+            LIB_UTILITIES_EXPORT size_t GetCapacity() const;
+
+            /// Number of blocks held by the arena.
+            size_t GetNumBlocks() const
+            {
+                return m_blocks.size();
+            }
+
+        private:
+            friend class ScratchScope;
+
+            struct Block
+            {
+                /// Storage as returned by operator new.
+                char   *m_raw;
+                /// First aligned byte of the block.
+                char   *m_base;
+                size_t  m_size;
+                /// Bytes handed out before this block in a pass through
+                /// the blocks, used for the statistics.
+                size_t  m_start;
+            };
+
+            ScratchArena(const ScratchArena &rhs);
+            ScratchArena &operator=(const ScratchArena &rhs);
+
+            std::vector<Block> m_blocks;
+            /// Index of the current block in #m_blocks.
+            size_t             m_block;
+            /// Next free byte and end of the current block.
+            char              *m_ptr;
+            char              *m_end;
+            /// Number of open scopes.
+            int                m_depth;
+
+            bool               m_statsEnabled;
+            /// Statistics of the innermost named scope, or null.
+            Statistics        *m_current;
+            /// Statistics keyed by the address of the scope name.
+            std::map<const char *, Statistics> m_stats;
+
+            LIB_UTILITIES_EXPORT void *AllocateSlow(size_t bytes);
+            LIB_UTILITIES_EXPORT Statistics *EnterNamedScope(const char *name);
+            LIB_UTILITIES_EXPORT void Consolidate();
+            void AddBlock(size_t bytes);
+            void MergeStatistics(StatisticsMap &stats) const;
+    };
+
+    /**
+     * @brief Marks the lifetime of workspace taken from the arena of the
+     * calling thread.
+     *
+     * All storage allocated through a scope is released when it ends.
+     * Scopes nest and must end in the reverse order to which they were
+     * created, which is guaranteed when they are local variables. Arrays
+     * returned by Allocate() do not own their storage, so neither they nor
+     * any copy of them may outlive the scope.
+     *
+     * \code
+     * ScratchScope scratch("HexExp::PhysDeriv");
+     * Array<OneD, NekDouble> tmp = scratch.Allocate(nq);
+     * \endcode
+     */
+    class ScratchScope
+    {
+        public:
+            /// Opens a scope whose allocations are recorded under @a name,
+            /// which must remain valid while the statistics are in use,
+            /// e.g. a string literal. Unnamed scopes are recorded under the
+            /// enclosing named scope.
+            inline explicit ScratchScope(const char *name = 0);
+            inline ~ScratchScope();
+
+            /// Returns an uninitialised array of @a n elements of a type
+            /// without constructor or destructor.
+            template<typename T>
+            Array<OneD, T> Allocate(const unsigned int n)
+            {
+                return Array<OneD, T>(
+                    n, static_cast<T*>(m_arena.Allocate(n*sizeof(T))),
+                    eUnownedStorage);
+            }
+
+            /// Returns an uninitialised array of @a n doubles.
+            Array<OneD, NekDouble> Allocate(const unsigned int n)
+            {
+                return Allocate<NekDouble>(n);
+            }
+
+            /// Returns an array of @a n doubles set to @a initValue.
+            Array<OneD, NekDouble> Allocate(const unsigned int n,
+                                            const NekDouble    initValue)
+            {
+                Array<OneD, NekDouble> result = Allocate<NekDouble>(n);
+                std::fill(result.get(), result.get() + n, initValue);
+                return result;
+            }
+
+        private:
+            ScratchScope(const ScratchScope &rhs);
+            ScratchScope &operator=(const ScratchScope &rhs);
+
+            ScratchArena             &m_arena;
+            size_t                    m_block;
+            char                     *m_ptr;
+            ScratchArena::Statistics *m_parent;
+    };
+
+    inline void *ScratchArena::Allocate(size_t bytes)
+    {
+        bytes = (bytes + Alignment - 1) & ~(Alignment - 1);
+
+        ASSERTL1(m_depth > 0, "Scratch storage requires an open scope.");
+
+        if (m_current || bytes > static_cast<size_t>(m_end - m_ptr))
+        {
+            return AllocateSlow(bytes);
+        }
+
+        void *result = m_ptr;
+        m_ptr += bytes;
+        return result;
+    }
+
+    inline ScratchScope::ScratchScope(const char *name)
+        : m_arena(ScratchArena::GetThreadArena()),
+          m_block(m_arena.m_block),
+          m_ptr  (m_arena.m_ptr),
+          m_parent(m_arena.m_current)
+    {
+        ++m_arena.m_depth;
+
+        if (m_arena.m_statsEnabled && name)
+        {
+            m_arena.m_current = m_arena.EnterNamedScope(name);
+        }
+    }
+
+    inline ScratchScope::~ScratchScope()
+    {
+        m_arena.m_current = m_parent;
+
+        if (m_block != m_arena.m_block)
+        {
+            m_arena.m_block = m_block;
+            m_arena.m_end   = m_arena.m_blocks[m_block].m_base +
+                              m_arena.m_blocks[m_block].m_size;
+        }
+        m_arena.m_ptr = m_ptr;
+
+        if (--m_arena.m_depth == 0 && m_arena.m_blocks.size() > 1)
+        {
+            m_arena.Consolidate();
+        }
+    }
+}
+
+#endif //NEKTAR_LIB_UTILITIES_MEMORY_SCRATCH_ARENA_HPP
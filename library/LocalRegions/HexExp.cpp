@@ -35,8 +35,10 @@
 
 
 #include <LocalRegions/HexExp.h>
+#include <LocalRegions/MatrixCache.h>
 #include <LibUtilities/Foundations/Interp.h>
 #include <SpatialDomains/HexGeom.h>
+#include <LibUtilities/Memory/ScratchArena.hpp>
 
 namespace Nektar
 {
@@ -65,10 +67,12 @@ namespace Nektar
             Expansion     (geom),
             Expansion3D   (geom),
             m_matrixManager(
-                    boost::bind(&HexExp::CreateMatrix, this, _1),
+                    MatrixCache::SharedMatrixCreator(
+                        boost::bind(&HexExp::CreateMatrix, this, _1)),
                     std::string("HexExpMatrix")),
             m_staticCondMatrixManager(
-                    boost::bind(&HexExp::CreateStaticCondMatrix, this, _1),
+                    MatrixCache::SharedStaticCondMatrixCreator(
+                        boost::bind(&HexExp::CreateStaticCondMatrix, this, _1)),
                     std::string("HexExpStaticCondMatrix"))
         {
         }
@@ -168,9 +172,10 @@ namespace Nektar
 
             Array<TwoD, const NekDouble> df =
                                 m_metricinfo->GetDerivFactors(GetPointsKeys());
-            Array<OneD,NekDouble> Diff0 = Array<OneD,NekDouble>(ntot);
-            Array<OneD,NekDouble> Diff1 = Array<OneD,NekDouble>(ntot);
-            Array<OneD,NekDouble> Diff2 = Array<OneD,NekDouble>(ntot);
+            ScratchScope scratch("HexExp::PhysDeriv");
+            Array<OneD,NekDouble> Diff0 = scratch.Allocate(ntot);
+            Array<OneD,NekDouble> Diff1 = scratch.Allocate(ntot);
+            Array<OneD,NekDouble> Diff2 = scratch.Allocate(ntot);
 
             StdHexExp::v_PhysDeriv(inarray, Diff0, Diff1, Diff2);
 
@@ -0,0 +1,377 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File MatrixCache.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Cache of elemental matrices shared between elements with
+// equivalent geometry
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <map>
+#include <vector>
+
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/weak_ptr.hpp>
+
+#include <LocalRegions/MatrixCache.h>
+
+namespace Nektar
+{
+    namespace LocalRegions
+    {
+        namespace
+        {
+            /// Standard matrix key and quantised, size-normalised metric
+            /// terms of an element.
+            typedef std::pair<StdRegions::StdMatrixKey,
+                              std::vector<boost::int64_t> > Signature;
+
+            /// Matrix stored in the cache, with its scaling and the size of
+            /// the element it was built for. Only weak references are held
+            /// so that the cache does not extend the lifetime of matrices
+            /// which are released by the elements.
+            struct MatrixEntry
+            {
+                boost::weak_ptr<const DNekMat> m_mat;
+                NekDouble                m_scale;
+                NekDouble                m_h;
+            };
+
+            typedef std::map<Signature, MatrixEntry> MatrixMap;
+            typedef std::map<Signature, boost::weak_ptr<DNekScalBlkMat> >
+                                                     BlkMatrixMap;
+
+            /// Relative tolerance to which metric terms are matched.
+            const NekDouble kTolerance = 1e-12;
+
+            bool         s_enabled = false;
+            MatrixMap    s_matrices;
+            BlkMatrixMap s_blkMatrices;
+            unsigned int s_hits    = 0;
+            unsigned int s_misses  = 0;
+            size_t       s_saved   = 0;
+            boost::mutex s_mutex;
+
+            boost::int64_t Quantise(const NekDouble v)
+            {
+                return (boost::int64_t) floor(v / kTolerance + 0.5);
+            }
+
+            /**
+             * Determines the metric terms @a geom entering the signature of
+             * the matrix given by @a mkey. Returns false if the matrix is not
+             * cacheable. Otherwise @a h
+             * is set to the size of the element and @a p to the power of
+             * @a h by which the matrix scales between elements sharing the
+             * signature.
+             */
+            bool GetSignature(
+                const MatrixKey                   &mkey,
+                const bool                         staticCond,
+                      std::vector<boost::int64_t> &geom,
+                      NekDouble                   &h,
+                      int                         &p)
+            {
+                SpatialDomains::GeomFactorsSharedPtr metric =
+                    mkey.GetMetricInfo();
+
+                if (!metric ||
+                    metric->GetGtype() != SpatialDomains::eRegular ||
+                    !metric->IsValid() ||
+                    mkey.GetNVarCoeff() > 0)
+                {
+                    return false;
+                }
+
+                const int dim = mkey.GetBase().num_elements();
+                bool useGmat  = false;
+                bool useTerms = true;
+
+                switch (mkey.GetMatrixType())
+                {
+                    case StdRegions::eMass:
+                        useTerms = false;
+                        p        = dim;
+                        break;
+                    case StdRegions::eInvMass:
+                        useTerms = false;
+                        p        = -dim;
+                        break;
+                    case StdRegions::eLaplacian:
+                    case StdRegions::eHelmholtz:
+                        useGmat = true;
+                        p       = dim - 2;
+                        break;
+                    case StdRegions::eWeakDeriv0:
+                    case StdRegions::eWeakDeriv1:
+                    case StdRegions::eWeakDeriv2:
+                        if (staticCond)
+                        {
+                            return false;
+                        }
+                        p = dim - 1;
+                        break;
+                    default:
+                        return false;
+                }
+
+                LibUtilities::PointsKeyVector ptsKeys;
+                for (int i = 0; i < dim; ++i)
+                {
+                    ptsKeys.push_back(mkey.GetBasis(i)->GetPointsKey());
+                }
+
+                const NekDouble jac = metric->GetJac(ptsKeys)[0];
+                h = pow(fabs(jac), 1.0/dim);
+
+                if (useTerms)
+                {
+                    Array<TwoD, const NekDouble> terms = useGmat
+                        ? metric->GetGmat(ptsKeys)
+                        : metric->GetDerivFactors(ptsKeys);
+                    const NekDouble norm = useGmat ? h*h : h;
+
+                    for (unsigned int i = 0; i < terms.GetRows(); ++i)
+                    {
+                        geom.push_back(Quantise(terms[i][0]*norm));
+                    }
+                }
+                else
+                {
+                    // The (inverse) mass matrix of a regular element is the
+                    // standard one scaled by the Jacobian (or its inverse),
+                    // so only its sign distinguishes elements.
+                    geom.push_back(jac < 0.0 ? -1 : 1);
+                }
+
+                // Operators with constants (e.g. the Helmholtz constant) are
+                // not homogeneous in h, so only equally sized elements match.
+                // The same holds for static condensation, since the Schur
+                // complement blocks are assembled without their scaling.
+                if (mkey.GetNConstFactors() > 0 || staticCond)
+                {
+                    geom.push_back(Quantise(log(h)));
+                    p = 0;
+                }
+
+                return true;
+            }
+        }
+
+        MatrixCreateFuncType MatrixCache::SharedMatrixCreator(
+            const MatrixCreateFuncType &create)
+        {
+            return boost::bind(&MatrixCache::GetMatrix, _1, create);
+        }
+
+        StaticCondMatrixCreateFuncType
+            MatrixCache::SharedStaticCondMatrixCreator(
+                const StaticCondMatrixCreateFuncType &create)
+        {
+            return boost::bind(&MatrixCache::GetStaticCondMatrix, _1, create);
+        }
+
+        DNekScalMatSharedPtr MatrixCache::GetMatrix(
+            const MatrixKey            &mkey,
+            const MatrixCreateFuncType &create)
+        {
+            std::vector<boost::int64_t> geom;
+            NekDouble h;
+            int       p;
+
+            if (!s_enabled || !GetSignature(mkey, false, geom, h, p))
+            {
+                return create(mkey);
+            }
+
+            Signature sig(StdRegions::StdMatrixKey(mkey), geom);
+
+            {
+                boost::mutex::scoped_lock lock(s_mutex);
+                MatrixMap::iterator x = s_matrices.find(sig);
+                boost::shared_ptr<const DNekMat> mat;
+                if (x != s_matrices.end() && (mat = x->second.m_mat.lock()))
+                {
+                    NekDouble scale = x->second.m_scale
+                                    * pow(h/x->second.m_h, p);
+
+                    ++s_hits;
+                    s_saved += sizeof(NekDouble)*mat->GetRows()
+                                                *mat->GetColumns();
+
+                    return MemoryManager<DNekScalMat>::AllocateSharedPtr(
+                        scale, mat);
+                }
+            }
+
+            // The lock is not held while creating, since the creator may
+            // request further matrices.
+            DNekScalMatSharedPtr returnval = create(mkey);
+
+            MatrixEntry entry;
+            entry.m_mat   = returnval->GetOwnedMatrix();
+            entry.m_scale = returnval->Scale();
+            entry.m_h     = h;
+
+            boost::mutex::scoped_lock lock(s_mutex);
+            s_matrices[sig] = entry;
+            ++s_misses;
+
+            return returnval;
+        }
+
+        DNekScalBlkMatSharedPtr MatrixCache::GetStaticCondMatrix(
+            const MatrixKey                      &mkey,
+            const StaticCondMatrixCreateFuncType &create)
+        {
+            std::vector<boost::int64_t> geom;
+            NekDouble h;
+            int       p;
+
+            if (!s_enabled || !GetSignature(mkey, true, geom, h, p))
+            {
+                return create(mkey);
+            }
+
+            Signature sig(StdRegions::StdMatrixKey(mkey), geom);
+
+            {
+                boost::mutex::scoped_lock lock(s_mutex);
+                BlkMatrixMap::iterator x = s_blkMatrices.find(sig);
+                DNekScalBlkMatSharedPtr mat;
+                if (x != s_blkMatrices.end() && (mat = x->second.lock()))
+                {
+                    const unsigned int nblks = mat->GetNumberOfBlockRows();
+
+                    Array<OneD, unsigned int> size(nblks);
+                    for (unsigned int i = 0; i < nblks; ++i)
+                    {
+                        size[i] = mat->GetNumberOfRowsInBlockRow(i);
+                    }
+
+                    DNekScalBlkMatSharedPtr returnval =
+                        MemoryManager<DNekScalBlkMat>::AllocateSharedPtr(
+                            size, size);
+
+                    for (unsigned int i = 0; i < nblks; ++i)
+                    {
+                        for (unsigned int j = 0; j < nblks; ++j)
+                        {
+                            DNekScalMatSharedPtr blk = mat->GetBlock(i, j);
+                            if (!blk)
+                            {
+                                continue;
+                            }
+
+                            DNekScalMatSharedPtr Atmp =
+                                MemoryManager<DNekScalMat>::AllocateSharedPtr(
+                                    blk->Scale(),
+                                    blk->GetOwnedMatrix());
+                            returnval->SetBlock(i, j, Atmp);
+                            s_saved += sizeof(NekDouble)*blk->GetRows()
+                                                        *blk->GetColumns();
+                        }
+                    }
+
+                    ++s_hits;
+                    return returnval;
+                }
+            }
+
+            DNekScalBlkMatSharedPtr returnval = create(mkey);
+
+            boost::mutex::scoped_lock lock(s_mutex);
+            s_blkMatrices[sig] = returnval;
+            ++s_misses;
+
+            return returnval;
+        }
+
+        void MatrixCache::EnableCache()
+        {
+            boost::mutex::scoped_lock lock(s_mutex);
+            s_enabled = true;
+        }
+
+        void MatrixCache::DisableCache()
+        {
+            boost::mutex::scoped_lock lock(s_mutex);
+            s_enabled = false;
+        }
+
+        bool MatrixCache::IsEnabled()
+        {
+            return s_enabled;
+        }
+
+        void MatrixCache::Clear()
+        {
+            boost::mutex::scoped_lock lock(s_mutex);
+            s_matrices.clear();
+            s_blkMatrices.clear();
+            s_hits   = 0;
+            s_misses = 0;
+            s_saved  = 0;
+        }
+
+        unsigned int MatrixCache::GetNumHits()
+        {
+            return s_hits;
+        }
+
+        unsigned int MatrixCache::GetNumMisses()
+        {
+            return s_misses;
+        }
+
+        size_t MatrixCache::GetSavedMemory()
+        {
+            return s_saved;
+        }
+
+        void MatrixCache::PrintStatistics(std::ostream &out)
+        {
+            boost::mutex::scoped_lock lock(s_mutex);
+            unsigned int total = s_hits + s_misses;
+
+            out << "Elemental matrix cache: " << s_hits << " hits, "
+                << s_misses << " misses";
+            if (total > 0)
+            {
+                out << " (" << 100.0*s_hits/total << "% hit rate)";
+            }
+            out << ", " << s_saved/1024 << " kB of storage shared"
+                << std::endl;
+        }
+    }
+}
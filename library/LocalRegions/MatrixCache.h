@@ -0,0 +1,127 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File MatrixCache.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Cache of elemental matrices shared between elements with
+// equivalent geometry
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_LOCALREGIONS_MATRIXCACHE_H
+#define NEKTAR_LIB_LOCALREGIONS_MATRIXCACHE_H
+
+#include <iostream>
+
+#include <boost/function.hpp>
+
+#include <LocalRegions/LocalRegionsDeclspec.h>
+#include <LocalRegions/MatrixKey.h>
+
+namespace Nektar
+{
+    namespace LocalRegions
+    {
+        typedef boost::function<DNekScalMatSharedPtr (const MatrixKey&)>
+            MatrixCreateFuncType;
+        typedef boost::function<DNekScalBlkMatSharedPtr (const MatrixKey&)>
+            StaticCondMatrixCreateFuncType;
+
+        /**
+         * @brief Cache of elemental matrices shared between elements with
+         * equivalent regular geometry.
+         *
+         * Elements with constant geometric factors which are translates of
+         * each other have identical elemental matrices, and scaled copies
+         * have matrices which differ only by a scalar for operators which
+         * are homogeneous in the element size. Matrices are stored under a
+         * signature made up of the StdRegions::StdMatrixKey (matrix type,
+         * bases, constants and variable coefficients) and the metric terms
+         * used by the operator, normalised by the element size \f$ h =
+         * |J|^{1/d} \f$. A matching element reuses the stored matrix with
+         * its own scaling.
+         *
+         * Only the operators assembled per element for regular geometries
+         * (mass and inverse mass, which scale as \f$ h^{\pm d} \f$,
+         * Laplacian, Helmholtz and weak derivatives, and the static
+         * condensation of mass, Laplacian and Helmholtz) are cached; all other
+         * matrices are passed straight to the element. Only weak
+         * references are held, so a cached matrix is released once no
+         * element uses it.
+         */
+        class MatrixCache
+        {
+        public:
+            /// Returns a create function for NekManager which looks up
+            /// the matrix in the cache before calling @a create.
+            LOCAL_REGIONS_EXPORT static MatrixCreateFuncType
+                SharedMatrixCreator(const MatrixCreateFuncType &create);
+
+            /// Returns a create function for NekManager which looks up
+            /// the static condensation matrix in the cache before calling
+            /// @a create.
+            LOCAL_REGIONS_EXPORT static StaticCondMatrixCreateFuncType
+                SharedStaticCondMatrixCreator(
+                    const StaticCondMatrixCreateFuncType &create);
+
+            LOCAL_REGIONS_EXPORT static DNekScalMatSharedPtr GetMatrix(
+                const MatrixKey            &mkey,
+                const MatrixCreateFuncType &create);
+
+            LOCAL_REGIONS_EXPORT static DNekScalBlkMatSharedPtr
+                GetStaticCondMatrix(
+                    const MatrixKey                      &mkey,
+                    const StaticCondMatrixCreateFuncType &create);
+
+            LOCAL_REGIONS_EXPORT static void EnableCache();
+            LOCAL_REGIONS_EXPORT static void DisableCache();
+            LOCAL_REGIONS_EXPORT static bool IsEnabled();
+
+            /// Releases all cached matrices and resets the statistics.
+            LOCAL_REGIONS_EXPORT static void Clear();
+
+            /// Number of requests served from the cache.
+            LOCAL_REGIONS_EXPORT static unsigned int GetNumHits();
+
+            /// Number of cacheable requests which built a new matrix.
+            LOCAL_REGIONS_EXPORT static unsigned int GetNumMisses();
+
+            /// Storage of the matrices reused from the cache, in bytes.
+            LOCAL_REGIONS_EXPORT static size_t GetSavedMemory();
+
+            LOCAL_REGIONS_EXPORT static void PrintStatistics(
+                std::ostream &out);
+
+        private:
+            MatrixCache();
+        };
+    }
+}
+
+#endif
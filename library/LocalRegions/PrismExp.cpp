@@ -35,6 +35,7 @@
 
 
 #include <LocalRegions/PrismExp.h>
+#include <LocalRegions/MatrixCache.h>
 #include <SpatialDomains/SegGeom.h>
 #include <LibUtilities/Foundations/Interp.h>
 
@@ -57,10 +58,12 @@ namespace Nektar
             Expansion     (geom),
             Expansion3D   (geom),
             m_matrixManager(
-                    boost::bind(&PrismExp::CreateMatrix, this, _1),
+                    MatrixCache::SharedMatrixCreator(
+                        boost::bind(&PrismExp::CreateMatrix, this, _1)),
                     std::string("PrismExpMatrix")),
             m_staticCondMatrixManager(
-                    boost::bind(&PrismExp::CreateStaticCondMatrix, this, _1),
+                    MatrixCache::SharedStaticCondMatrixCreator(
+                        boost::bind(&PrismExp::CreateStaticCondMatrix, this, _1)),
                     std::string("PrismExpStaticCondMatrix"))
         {
         }
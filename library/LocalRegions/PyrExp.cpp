@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LocalRegions/PyrExp.h>
+#include <LocalRegions/MatrixCache.h>
 #include <LibUtilities/Foundations/Interp.h>
 
 namespace Nektar 
@@ -59,10 +60,12 @@ namespace Nektar
             Expansion     (geom),
             Expansion3D   (geom),
             m_matrixManager(
-                    boost::bind(&PyrExp::CreateMatrix, this, _1),
+                    MatrixCache::SharedMatrixCreator(
+                        boost::bind(&PyrExp::CreateMatrix, this, _1)),
                     std::string("PyrExpMatrix")),
             m_staticCondMatrixManager(
-                    boost::bind(&PyrExp::CreateStaticCondMatrix, this, _1),
+                    MatrixCache::SharedStaticCondMatrixCreator(
+                        boost::bind(&PyrExp::CreateStaticCondMatrix, this, _1)),
                     std::string("PyrExpStaticCondMatrix"))
         {
         }
@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LocalRegions/QuadExp.h>
+#include <LocalRegions/MatrixCache.h>
 #include <LocalRegions/Expansion3D.h>
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
 #include <LibUtilities/BasicUtils/Vmath.hpp>
@@ -54,10 +55,12 @@ namespace Nektar
              Expansion     (geom),
              Expansion2D   (geom),
              m_matrixManager(
-                    boost::bind(&QuadExp::CreateMatrix, this, _1),
+                    MatrixCache::SharedMatrixCreator(
+                        boost::bind(&QuadExp::CreateMatrix, this, _1)),
                     std::string("QuadExpMatrix")),
              m_staticCondMatrixManager(
-                    boost::bind(&QuadExp::CreateStaticCondMatrix, this, _1),
+                    MatrixCache::SharedStaticCondMatrixCreator(
+                        boost::bind(&QuadExp::CreateStaticCondMatrix, this, _1)),
                     std::string("QuadExpStaticCondMatrix"))
         {
         }
@@ -35,6 +35,7 @@
 
 #include <LocalRegions/Expansion2D.h>
 #include <LocalRegions/SegExp.h>
+#include <LocalRegions/MatrixCache.h>
 #include <LibUtilities/Foundations/Interp.h>
 
 
@@ -62,10 +63,12 @@ namespace Nektar
             Expansion(geom),
             Expansion1D(geom),
             m_matrixManager(
-                    boost::bind(&SegExp::CreateMatrix, this, _1),
+                    MatrixCache::SharedMatrixCreator(
+                        boost::bind(&SegExp::CreateMatrix, this, _1)),
                     std::string("SegExpMatrix")),
             m_staticCondMatrixManager(
-                    boost::bind(&SegExp::CreateStaticCondMatrix, this, _1),
+                    MatrixCache::SharedStaticCondMatrixCreator(
+                        boost::bind(&SegExp::CreateStaticCondMatrix, this, _1)),
                     std::string("SegExpStaticCondMatrix"))
         {
         }
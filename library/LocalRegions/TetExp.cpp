@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LocalRegions/TetExp.h>
+#include <LocalRegions/MatrixCache.h>
 #include <SpatialDomains/SegGeom.h>
 
 #include <LibUtilities/Foundations/Interp.h>
@@ -66,10 +67,12 @@ namespace Nektar
             Expansion     (geom),
             Expansion3D   (geom),
             m_matrixManager(
-                    boost::bind(&TetExp::CreateMatrix, this, _1),
+                    MatrixCache::SharedMatrixCreator(
+                        boost::bind(&TetExp::CreateMatrix, this, _1)),
                     std::string("TetExpMatrix")),
             m_staticCondMatrixManager(
-                    boost::bind(&TetExp::CreateStaticCondMatrix, this, _1),
+                    MatrixCache::SharedStaticCondMatrixCreator(
+                        boost::bind(&TetExp::CreateStaticCondMatrix, this, _1)),
                     std::string("TetExpStaticCondMatrix"))
         {
         }
@@ -33,6 +33,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LocalRegions/TriExp.h>
+#include <LocalRegions/MatrixCache.h>
 #include <LocalRegions/SegExp.h>
 #include <LocalRegions/Expansion3D.h>
 #include <StdRegions/StdNodalTriExp.h>
@@ -52,10 +53,12 @@ namespace Nektar
             Expansion     (geom),
             Expansion2D   (geom),
             m_matrixManager(
-                    boost::bind(&TriExp::CreateMatrix, this, _1),
+                    MatrixCache::SharedMatrixCreator(
+                        boost::bind(&TriExp::CreateMatrix, this, _1)),
                     std::string("TriExpMatrix")),
             m_staticCondMatrixManager(
-                    boost::bind(&TriExp::CreateStaticCondMatrix, this, _1),
+                    MatrixCache::SharedStaticCondMatrixCreator(
+                        boost::bind(&TriExp::CreateStaticCondMatrix, this, _1)),
                     std::string("TriExpStaticCondMatrix"))
         {
         }
@@ -85,6 +85,7 @@ namespace Nektar
             m_solnType(eNoSolnType),
             m_bndSystemBandWidth(0),
             m_successiveRHS(0),
+            m_iterativeMethod(eConjugateGradient),
             m_gsh(0),
             m_bndGsh(0)
         {
@@ -110,6 +111,8 @@ namespace Nektar
                                                             "GlobalSysSoln");
             m_preconType = pSession->GetSolverInfoAsEnum<PreconditionerType>(
                                                             "Preconditioner");
+            m_iterativeMethod = pSession->GetSolverInfoAsEnum<IterativeMethod>(
+                                                            "IterativeMethod");
 
             // Override values with data from GlobalSysSolnInfo section 
             if(pSession->DefinesGlobalSysSolnInfo(variable, "GlobalSysSoln"))
@@ -128,6 +131,14 @@ namespace Nektar
                                                     "Preconditioner", precon);
             }
 
+            if(pSession->DefinesGlobalSysSolnInfo(variable, "IterativeMethod"))
+            {
+                std::string method = pSession->GetGlobalSysSolnInfo(variable,
+                                                            "IterativeMethod");
+                m_iterativeMethod = pSession->GetValueAsEnum<IterativeMethod>(
+                                                    "IterativeMethod", method);
+            }
+
             if(pSession->DefinesGlobalSysSolnInfo(variable,
                                                   "IterativeSolverTolerance"))
             {
@@ -173,6 +184,7 @@ namespace Nektar
             m_preconType(oldLevelMap->m_preconType),
             m_iterativeTolerance(oldLevelMap->m_iterativeTolerance),
             m_successiveRHS(oldLevelMap->m_successiveRHS),
+            m_iterativeMethod(oldLevelMap->m_iterativeMethod),
             m_gsh(oldLevelMap->m_gsh),
             m_bndGsh(oldLevelMap->m_bndGsh),
             m_lowestStaticCondLevel(oldLevelMap->m_lowestStaticCondLevel)
@@ -1126,6 +1138,90 @@ namespace Nektar
             if (offset > 0)  Vmath::Vcopy(offset, tmp, 1, pGlobal, 1);
         }
 
+        void AssemblyMap::MultiGlobalToLocalBnd(
+                    const Array<OneD, const NekDouble>& global,
+                          Array<OneD,       NekDouble>& loc,
+                    const int                           nVec) const
+        {
+            ASSERTL1(loc.num_elements() >= nVec*m_numLocalBndCoeffs,
+                     "Local vector is not of correct dimension");
+            ASSERTL1(global.num_elements() >= nVec*m_numGlobalBndCoeffs,
+                     "Global vector is not of correct dimension");
+
+            for (int i = 0; i < nVec; ++i)
+            {
+                const NekDouble *g = global.get() + i*m_numGlobalBndCoeffs;
+                NekDouble       *l = loc.get()    + i*m_numLocalBndCoeffs;
+
+                if(m_signChange)
+                {
+                    Vmath::Gathr(m_numLocalBndCoeffs,
+                                 m_localToGlobalBndSign.get(), g,
+                                 m_localToGlobalBndMap.get(), l);
+                }
+                else
+                {
+                    Vmath::Gathr(m_numLocalBndCoeffs, g,
+                                 m_localToGlobalBndMap.get(), l);
+                }
+            }
+        }
+
+        void AssemblyMap::MultiAssembleBnd(
+                    const Array<OneD, const NekDouble>& loc,
+                          Array<OneD,       NekDouble>& global,
+                    const int                           nVec) const
+        {
+            ASSERTL1(loc.num_elements() >= nVec*m_numLocalBndCoeffs,
+                     "Local vector is not of correct dimension");
+            ASSERTL1(global.num_elements() >= nVec*m_numGlobalBndCoeffs,
+                     "Global vector is not of correct dimension");
+
+            Vmath::Zero(nVec*m_numGlobalBndCoeffs, global.get(), 1);
+
+            for (int i = 0; i < nVec; ++i)
+            {
+                const NekDouble *l = loc.get()    + i*m_numLocalBndCoeffs;
+                NekDouble       *g = global.get() + i*m_numGlobalBndCoeffs;
+
+                if(m_signChange)
+                {
+                    Vmath::Assmb(m_numLocalBndCoeffs,
+                                 m_localToGlobalBndSign.get(), l,
+                                 m_localToGlobalBndMap.get(), g);
+                }
+                else
+                {
+                    Vmath::Assmb(m_numLocalBndCoeffs, l,
+                                 m_localToGlobalBndMap.get(), g);
+                }
+            }
+            MultiUniversalAssembleBnd(global, nVec);
+        }
+
+        void AssemblyMap::MultiUniversalAssembleBnd(
+                      Array<OneD,     NekDouble>& pGlobal,
+                const int                         nVec,
+                const int                         offset) const
+        {
+            ASSERTL1(pGlobal.num_elements() >= nVec*m_numGlobalBndCoeffs,
+                     "Wrong size.");
+
+            Array<OneD, NekDouble> tmp(nVec*offset);
+            for (int i = 0; i < nVec && offset > 0; ++i)
+            {
+                Vmath::Vcopy(offset, pGlobal.get() + i*m_numGlobalBndCoeffs, 1,
+                                     tmp.get()     + i*offset, 1);
+            }
+            Gs::GatherMany(pGlobal, nVec, m_numGlobalBndCoeffs,
+                           Gs::gs_add, m_bndGsh);
+            for (int i = 0; i < nVec && offset > 0; ++i)
+            {
+                Vmath::Vcopy(offset, tmp.get()     + i*offset, 1,
+                                     pGlobal.get() + i*m_numGlobalBndCoeffs, 1);
+            }
+        }
+
         int AssemblyMap::GetBndSystemBandWidth() const
         {
             return m_bndSystemBandWidth;
@@ -1193,6 +1289,11 @@ namespace Nektar
             return m_successiveRHS;
         }
 
+        IterativeMethod AssemblyMap::GetIterativeMethod() const
+        {
+            return m_iterativeMethod;
+        }
+
         void AssemblyMap::GlobalToLocalBndWithoutSign(
                     const Array<OneD, const NekDouble>& global,
                     Array<OneD,NekDouble>& loc)
@@ -236,6 +236,25 @@ namespace Nektar
                           Array<OneD,     NekDouble>& pGlobal,
                           int                         offset) const;
 
+            /// Gathers @a nVec global boundary vectors, stored one after the
+            /// other, into the corresponding local boundary vectors.
+            MULTI_REGIONS_EXPORT void MultiGlobalToLocalBnd(
+                    const Array<OneD, const NekDouble>& global,
+                          Array<OneD,       NekDouble>& loc,
+                    const int                           nVec) const;
+
+            /// Assembles @a nVec local boundary vectors, exchanging the
+            /// values of all of them in a single gather-scatter operation.
+            MULTI_REGIONS_EXPORT void MultiAssembleBnd(
+                    const Array<OneD, const NekDouble>& loc,
+                          Array<OneD,       NekDouble>& global,
+                    const int                           nVec) const;
+
+            MULTI_REGIONS_EXPORT void MultiUniversalAssembleBnd(
+                          Array<OneD,     NekDouble>& pGlobal,
+                    const int                         nVec,
+                    const int                         offset = 0) const;
+
             MULTI_REGIONS_EXPORT int GetFullSystemBandWidth() const;
 
             MULTI_REGIONS_EXPORT int GetNumNonDirVertexModes() const;
@@ -289,6 +308,7 @@ namespace Nektar
             MULTI_REGIONS_EXPORT PreconditionerType GetPreconType() const;
             MULTI_REGIONS_EXPORT NekDouble GetIterativeTolerance() const;
             MULTI_REGIONS_EXPORT int GetSuccessiveRHS() const;
+            MULTI_REGIONS_EXPORT IterativeMethod GetIterativeMethod() const;
 
             MULTI_REGIONS_EXPORT int GetLowestStaticCondLevel() const
             {
@@ -370,6 +390,9 @@ namespace Nektar
             /// sucessive RHS  for iterative solver
             int  m_successiveRHS;
 
+            /// Algorithm used by the iterative solver
+            IterativeMethod m_iterativeMethod;
+
             Gs::gs_data * m_gsh;
             Gs::gs_data * m_bndGsh;
 
@@ -1236,6 +1236,11 @@ namespace Nektar
                         CuthillMckeeReordering(boostGraphObj,perm,iperm);
                     }
                     break;
+                case eDirectSparseStaticCond:
+                    {
+                        NestedDissectionReordering(boostGraphObj,perm,iperm);
+                    }
+                    break;
                 case eDirectMultiLevelStaticCond:
                 case eIterativeMultiLevelStaticCond:
                 case eXxtMultiLevelStaticCond:
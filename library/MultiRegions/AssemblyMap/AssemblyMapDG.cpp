@@ -58,7 +58,8 @@ namespace Nektar
     namespace MultiRegions
     {
         AssemblyMapDG::AssemblyMapDG():
-            m_numDirichletBndPhys(0)
+            m_numDirichletBndPhys(0),
+            m_multiTraceWidth(0)
         {
         }
 
@@ -79,7 +80,8 @@ namespace Nektar
             const Array<OneD, const SpatialDomains::BoundaryConditionShPtr> &bndCond,
             const map<int,int> &periodicVertices,
             const std::string variable)
-            : AssemblyMap(pSession,variable)
+            : AssemblyMap(pSession,variable),
+              m_multiTraceWidth(0)
         {
             int i,j;
             int cnt, vid, gid;
@@ -194,7 +196,8 @@ namespace Nektar
                                                const Array<OneD, SpatialDomains::BoundaryConditionShPtr> &bndCond,
                                                const PeriodicMap &periodicEdges,
                                      const std::string variable) :
-            AssemblyMap(pSession,variable)
+            AssemblyMap(pSession,variable),
+            m_multiTraceWidth(0)
         {
 
             int i,j,k,cnt,eid, id, id1, order_e,gid;
@@ -438,6 +441,11 @@ namespace Nektar
                         CuthillMckeeReordering(boostGraphObj,perm,iperm);
                         break;
                     }
+                    case eDirectSparseStaticCond:
+                    {
+                        NestedDissectionReordering(boostGraphObj,perm,iperm);
+                        break;
+                    }
                     case eDirectMultiLevelStaticCond:
                     {
                         MultiLevelBisectionReordering(boostGraphObj,perm,iperm,bottomUpGraph);
@@ -634,7 +642,8 @@ namespace Nektar
             const Array<OneD, SpatialDomains::BoundaryConditionShPtr> &bndCond,
             const PeriodicMap                                         &periodicFaces,
             const std::string variable):
-            AssemblyMap(pSession,variable)
+            AssemblyMap(pSession,variable),
+            m_multiTraceWidth(0)
         {
             int i,j,k,cnt,eid, id, id1, order_e,gid;
             int ntrace_exp = trace->GetExpSize();
@@ -848,6 +857,11 @@ namespace Nektar
                         CuthillMckeeReordering(boostGraphObj,perm,iperm);
                         break;
                     }
+                    case eDirectSparseStaticCond:
+                    {
+                        NestedDissectionReordering(boostGraphObj,perm,iperm);
+                        break;
+                    }
                     case eDirectMultiLevelStaticCond:
                     {
                         MultiLevelBisectionReordering(boostGraphObj,perm,iperm,
@@ -1307,6 +1321,139 @@ namespace Nektar
             {
                 m_traceToUniversalMapUnique[i] = tmp2[i];
             }
+
+            if (m_comm->GetSize() > 1)
+            {
+                SetUpTraceExchange(trace);
+            }
+        }
+
+        /**
+         * Replaces the gslib exchange of the trace space with persistent
+         * point-to-point messages, so that the exchange can be started once
+         * the partition-boundary traces are filled and completed after the
+         * interior ones. Each shared trace point must be held by exactly one
+         * other process; otherwise (e.g. periodic traces joining two elements
+         * on the same process) every process keeps using gslib.
+         */
+        void AssemblyMapDG::SetUpTraceExchange(const ExpListSharedPtr trace)
+        {
+            int i, j;
+            int nTracePhys = trace->GetTotPoints();
+            int rank       = m_comm->GetRank();
+
+            // Count the copies of each trace point and identify the lowest
+            // and highest process holding it.
+            Array<OneD, NekDouble> count  (nTracePhys, 1.0);
+            Array<OneD, NekDouble> minRank(nTracePhys, (NekDouble) rank);
+            Array<OneD, NekDouble> maxRank(nTracePhys, (NekDouble) rank);
+            Gs::Gather(count,   Gs::gs_add, m_traceGsh);
+            Gs::Gather(minRank, Gs::gs_min, m_traceGsh);
+            Gs::Gather(maxRank, Gs::gs_max, m_traceGsh);
+
+            int valid = 1;
+            map<int, vector<pair<int, int> > > procPoints;
+            for (i = 0; i < nTracePhys; ++i)
+            {
+                int nCopies = (int) (count[i] + 0.5);
+                if (nCopies == 1)
+                {
+                    continue;
+                }
+
+                int other = (int) maxRank[i] == rank ? (int) minRank[i]
+                                                     : (int) maxRank[i];
+                if (nCopies > 2 || other == rank)
+                {
+                    valid = 0;
+                    break;
+                }
+
+                procPoints[other].push_back(
+                    make_pair(m_traceToUniversalMap[i], i));
+            }
+
+            m_comm->AllReduce(valid, LibUtilities::ReduceMin);
+            if (!valid)
+            {
+                return;
+            }
+
+            int nPoints = 0;
+            map<int, vector<pair<int, int> > >::iterator it;
+            for (it = procPoints.begin(); it != procPoints.end(); ++it)
+            {
+                nPoints += it->second.size();
+            }
+
+            m_traceExchangeIdx = Array<OneD, int>(nPoints);
+
+            int cnt = 0;
+            for (it = procPoints.begin(); it != procPoints.end(); ++it)
+            {
+                // Both processes order their points by universal ID.
+                sort(it->second.begin(), it->second.end());
+
+                int nProc = it->second.size();
+                m_traceExchangeProc  .push_back(it->first);
+                m_traceExchangeOffset.push_back(cnt);
+
+                for (j = 0; j < nProc; ++j)
+                {
+                    m_traceExchangeIdx[cnt+j] = it->second[j].second;
+                }
+                cnt += nProc;
+            }
+            m_traceExchangeOffset.push_back(cnt);
+
+            InitTraceRequest(2, m_traceRequest, m_traceSendBuf,
+                             m_traceRecvBuf);
+
+            m_sharedTrace.resize(trace->GetExpSize(), false);
+            for (i = 0; i < trace->GetExpSize(); ++i)
+            {
+                int offset = trace->GetPhys_Offset(i);
+                for (j = 0; j < trace->GetExp(i)->GetTotPoints(); ++j)
+                {
+                    if (count[offset+j] > 1.5)
+                    {
+                        m_sharedTrace[i] = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Creates persistent requests exchanging @a nVal interleaved values
+         * for each point of #m_traceExchangeIdx, together with their send and
+         * receive buffers.
+         */
+        void AssemblyMapDG::InitTraceRequest(
+            const int                           nVal,
+            LibUtilities::CommRequestSharedPtr &request,
+            Array<OneD, NekDouble>             &sendBuf,
+            Array<OneD, NekDouble>             &recvBuf)
+        {
+            int nProcs = m_traceExchangeProc.size();
+            int nPoints = m_traceExchangeIdx.num_elements();
+
+            sendBuf = Array<OneD, NekDouble>(nVal*nPoints);
+            recvBuf = Array<OneD, NekDouble>(nVal*nPoints);
+            request = m_comm->CreateRequest(2*nProcs);
+
+            Array<OneD, NekDouble> tmp;
+            for (int i = 0; i < nProcs; ++i)
+            {
+                int offset = nVal*m_traceExchangeOffset[i];
+                int nProc  = nVal*(m_traceExchangeOffset[i+1] -
+                                   m_traceExchangeOffset[i]);
+
+                m_comm->SendInit(m_traceExchangeProc[i], tmp = sendBuf + offset,
+                                 nProc, request, 2*i);
+                m_comm->RecvInit(m_traceExchangeProc[i], tmp = recvBuf + offset,
+                                 nProc, request, 2*i+1);
+            }
         }
 
         void AssemblyMapDG::RealignTraceElement(
@@ -1395,6 +1542,148 @@ namespace Nektar
             Gs::Gather(pGlobal, Gs::gs_add, m_traceGsh);
         }
 
+        /**
+         * Starts the exchange of the shared points of the forwards and
+         * backwards trace spaces. Only these points need to be filled before
+         * calling this method; the remainder may be filled before the
+         * matching call to #UniversalTraceAssembleFinish.
+         */
+        void AssemblyMapDG::UniversalTraceAssembleStart(
+            const Array<OneD, const NekDouble> &pFwd,
+            const Array<OneD, const NekDouble> &pBwd)
+        {
+            if (!m_traceRequest)
+            {
+                return;
+            }
+
+            for (int i = 0; i < m_traceExchangeIdx.num_elements(); ++i)
+            {
+                m_traceSendBuf[2*i]   = pFwd[m_traceExchangeIdx[i]];
+                m_traceSendBuf[2*i+1] = pBwd[m_traceExchangeIdx[i]];
+            }
+            m_comm->StartAll(m_traceRequest);
+        }
+
+        /**
+         * Completes the exchange started by #UniversalTraceAssembleStart,
+         * summing the values received into @a pFwd and @a pBwd. Equivalent to
+         * calling #UniversalTraceAssemble on both if no point-to-point
+         * exchange has been set up.
+         */
+        void AssemblyMapDG::UniversalTraceAssembleFinish(
+            Array<OneD, NekDouble> &pFwd,
+            Array<OneD, NekDouble> &pBwd)
+        {
+            if (!m_traceRequest)
+            {
+                UniversalTraceAssemble(pFwd);
+                UniversalTraceAssemble(pBwd);
+                return;
+            }
+
+            m_comm->WaitAll(m_traceRequest);
+
+            for (int i = 0; i < m_traceExchangeIdx.num_elements(); ++i)
+            {
+                pFwd[m_traceExchangeIdx[i]] += m_traceRecvBuf[2*i];
+                pBwd[m_traceExchangeIdx[i]] += m_traceRecvBuf[2*i+1];
+            }
+        }
+
+        /**
+         * Starts the exchange of the forwards and backwards trace spaces of
+         * several variables in a single set of messages, with the same
+         * requirements on @a pFwd and @a pBwd as the single variable version.
+         */
+        void AssemblyMapDG::UniversalTraceAssembleStart(
+            const Array<OneD, const Array<OneD, NekDouble> > &pFwd,
+            const Array<OneD, const Array<OneD, NekDouble> > &pBwd)
+        {
+            if (!m_traceRequest)
+            {
+                return;
+            }
+
+            int nVar = pFwd.num_elements();
+            int nVal = 2*nVar;
+
+            // Requests are kept for the last number of variables used.
+            if (nVal != m_multiTraceWidth)
+            {
+                InitTraceRequest(nVal, m_multiTraceRequest,
+                                 m_multiTraceSendBuf, m_multiTraceRecvBuf);
+                m_multiTraceWidth = nVal;
+            }
+
+            for (int i = 0; i < m_traceExchangeIdx.num_elements(); ++i)
+            {
+                int idx = m_traceExchangeIdx[i];
+                for (int j = 0; j < nVar; ++j)
+                {
+                    m_multiTraceSendBuf[nVal*i+2*j]   = pFwd[j][idx];
+                    m_multiTraceSendBuf[nVal*i+2*j+1] = pBwd[j][idx];
+                }
+            }
+            m_comm->StartAll(m_multiTraceRequest);
+        }
+
+        /**
+         * Completes the exchange started by the multiple variable
+         * #UniversalTraceAssembleStart. Without a point-to-point exchange the
+         * trace spaces are summed through a single gslib call.
+         */
+        void AssemblyMapDG::UniversalTraceAssembleFinish(
+            Array<OneD, Array<OneD, NekDouble> > &pFwd,
+            Array<OneD, Array<OneD, NekDouble> > &pBwd)
+        {
+            int nVar = pFwd.num_elements();
+
+            if (!m_traceRequest)
+            {
+                if (m_comm->GetSize() == 1)
+                {
+                    return;
+                }
+
+                int nTracePhys = m_traceToUniversalMap.num_elements();
+                Array<OneD, NekDouble> tmp(2*nVar*nTracePhys), tmp2;
+                for (int j = 0; j < nVar; ++j)
+                {
+                    Vmath::Vcopy(nTracePhys, pFwd[j], 1,
+                                 tmp2 = tmp + 2*j*nTracePhys, 1);
+                    Vmath::Vcopy(nTracePhys, pBwd[j], 1,
+                                 tmp2 = tmp + (2*j+1)*nTracePhys, 1);
+                }
+                Gs::GatherMany(tmp, 2*nVar, nTracePhys, Gs::gs_add,
+                               m_traceGsh);
+                for (int j = 0; j < nVar; ++j)
+                {
+                    Vmath::Vcopy(nTracePhys, tmp + 2*j*nTracePhys, 1,
+                                 pFwd[j], 1);
+                    Vmath::Vcopy(nTracePhys, tmp + (2*j+1)*nTracePhys, 1,
+                                 pBwd[j], 1);
+                }
+                return;
+            }
+
+            int nVal = 2*nVar;
+            ASSERTL1(nVal == m_multiTraceWidth,
+                     "Number of variables differs from exchange started.");
+
+            m_comm->WaitAll(m_multiTraceRequest);
+
+            for (int i = 0; i < m_traceExchangeIdx.num_elements(); ++i)
+            {
+                int idx = m_traceExchangeIdx[i];
+                for (int j = 0; j < nVar; ++j)
+                {
+                    pFwd[j][idx] += m_multiTraceRecvBuf[nVal*i+2*j];
+                    pBwd[j][idx] += m_multiTraceRecvBuf[nVal*i+2*j+1];
+                }
+            }
+        }
+
         int AssemblyMapDG::v_GetLocalToGlobalMap(const int i) const
         {
             return m_localToGlobalBndMap[i];
@@ -116,6 +116,29 @@ namespace Nektar
             MULTI_REGIONS_EXPORT void UniversalTraceAssemble(
                 Array<OneD, NekDouble> &pGlobal) const;
 
+            MULTI_REGIONS_EXPORT void UniversalTraceAssembleStart(
+                const Array<OneD, const NekDouble> &pFwd,
+                const Array<OneD, const NekDouble> &pBwd);
+
+            MULTI_REGIONS_EXPORT void UniversalTraceAssembleFinish(
+                Array<OneD, NekDouble> &pFwd,
+                Array<OneD, NekDouble> &pBwd);
+
+            MULTI_REGIONS_EXPORT void UniversalTraceAssembleStart(
+                const Array<OneD, const Array<OneD, NekDouble> > &pFwd,
+                const Array<OneD, const Array<OneD, NekDouble> > &pBwd);
+
+            MULTI_REGIONS_EXPORT void UniversalTraceAssembleFinish(
+                Array<OneD, Array<OneD, NekDouble> > &pFwd,
+                Array<OneD, Array<OneD, NekDouble> > &pBwd);
+
+            /// Flags for each trace element whose points are exchanged with
+            /// another process. Empty if the exchange is done through gslib.
+            MULTI_REGIONS_EXPORT const std::vector<bool> &GetSharedTrace() const
+            {
+                return m_sharedTrace;
+            }
+
         protected:
             Gs::gs_data * m_traceGsh;
             
@@ -131,6 +154,27 @@ namespace Nektar
             /// universal space (signed).
             Array<OneD,int> m_traceToUniversalMapUnique;
 
+            /// Persistent requests for the point-to-point trace exchange.
+            LibUtilities::CommRequestSharedPtr m_traceRequest;
+            /// Processes with which trace points are exchanged.
+            std::vector<int> m_traceExchangeProc;
+            /// Offset of each process' points in #m_traceExchangeIdx.
+            std::vector<int> m_traceExchangeOffset;
+            /// Trace points exchanged, grouped by process and sorted by
+            /// universal ID.
+            Array<OneD, int> m_traceExchangeIdx;
+            /// Interleaved forwards/backwards send and receive buffers.
+            Array<OneD, NekDouble> m_traceSendBuf;
+            Array<OneD, NekDouble> m_traceRecvBuf;
+            /// Trace elements which have points in the exchange.
+            std::vector<bool> m_sharedTrace;
+            /// Requests and buffers for exchanging several variables, with
+            /// #m_multiTraceWidth values per point.
+            LibUtilities::CommRequestSharedPtr m_multiTraceRequest;
+            int                    m_multiTraceWidth;
+            Array<OneD, NekDouble> m_multiTraceSendBuf;
+            Array<OneD, NekDouble> m_multiTraceRecvBuf;
+
             void SetUpUniversalDGMap(const ExpList &locExp);
 
             void SetUpUniversalTraceMap(
@@ -138,6 +182,14 @@ namespace Nektar
                 const ExpListSharedPtr trace,
                 const PeriodicMap     &perMap = NullPeriodicMap);
 
+            void SetUpTraceExchange(const ExpListSharedPtr trace);
+
+            void InitTraceRequest(
+                const int                           nVal,
+                LibUtilities::CommRequestSharedPtr &request,
+                Array<OneD, NekDouble>             &sendBuf,
+                Array<OneD, NekDouble>             &recvBuf);
+
             virtual int v_GetLocalToGlobalMap(const int i) const;
 
             virtual int v_GetGlobalToUniversalMap(const int i) const;
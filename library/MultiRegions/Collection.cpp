@@ -0,0 +1,552 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File Collection.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Multi-element collection of expansions
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <MultiRegions/Collection.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * @class Collection
+         *
+         * A collection is a run of consecutive elements of an ExpList which
+         * share the same standard expansion (shape and basis keys) and the
+         * same geometry type (regular or deformed). Since the coefficient and
+         * physical data of these elements are stored contiguously, the
+         * tensor-product sum-factorisation operators can be applied to all
+         * elements of the collection at once. Each tensor direction is then
+         * evaluated by a single large matrix-matrix multiplication rather
+         * than one small multiplication per element.
+         *
+         * Batched kernels are available for segments, quadrilaterals and
+         * hexahedra. For other shapes the collection falls back to calling
+         * the elemental operators.
+         */
+
+        /**
+         * @param   pExp        Elements of the collection in storage order.
+         * @param   coeffOffset Offset of the first element into the
+         *                      coefficient array of the expansion list.
+         * @param   physOffset  Offset of the first element into the
+         *                      physical array of the expansion list.
+         */
+        Collection::Collection(
+                const LocalRegions::ExpansionVector &pExp,
+                const int                            coeffOffset,
+                const int                            physOffset):
+            m_exp        (pExp),
+            m_numElmt    (pExp.size()),
+            m_coeffOffset(coeffOffset),
+            m_physOffset (physOffset)
+        {
+            ASSERTL0(m_numElmt > 0, "Collection requires at least one element");
+
+            int i, j, e;
+            const LocalRegions::ExpansionSharedPtr &exp0 = m_exp[0];
+
+            m_ncoeffs  = exp0->GetNcoeffs();
+            m_nqtot    = exp0->GetTotPoints();
+            m_dim      = exp0->GetNumBases();
+            m_coordim  = exp0->GetCoordim();
+            m_deformed = exp0->GetMetricInfo()->GetGtype()
+                                        == SpatialDomains::eDeformed;
+
+            switch (exp0->DetShapeType())
+            {
+                case LibUtilities::eSegment:
+                case LibUtilities::eQuadrilateral:
+                case LibUtilities::eHexahedron:
+                    m_batched = true;
+                    break;
+                default:
+                    m_batched = false;
+                    break;
+            }
+
+            if (!m_batched)
+            {
+                return;
+            }
+
+            m_nmodes = Array<OneD, int>(m_dim);
+            m_nquad  = Array<OneD, int>(m_dim);
+            m_base   = Array<OneD, Array<OneD, const NekDouble> >(m_dim);
+            m_deriv  = Array<OneD, Array<OneD, const NekDouble> >(m_dim);
+
+            for (i = 0; i < m_dim; ++i)
+            {
+                m_nmodes[i] = exp0->GetBasisNumModes(i);
+                m_nquad [i] = exp0->GetNumPoints(i);
+                m_base  [i] = exp0->GetBasis(i)->GetBdata();
+                m_deriv [i] = exp0->GetBasis(i)->GetD()->GetPtr();
+            }
+
+            // Concatenate the quadrature metric of all elements so that it
+            // can be applied in a single pass.
+            Array<OneD, NekDouble> ones(m_nqtot, 1.0), tmp;
+            m_quadMetric = Array<OneD, NekDouble>(m_nqtot*m_numElmt);
+            for (e = 0; e < m_numElmt; ++e)
+            {
+                m_exp[e]->MultiplyByQuadratureMetric(
+                    ones, tmp = m_quadMetric + e*m_nqtot);
+            }
+
+            // Gather the derivative factors of all elements. These are
+            // stored as one value per element for regular geometry and one
+            // value per quadrature point for deformed geometry.
+            LibUtilities::PointsKeyVector ptsKeys = exp0->GetPointsKeys();
+            int nfac   = exp0->GetMetricInfo()->GetDerivFactors(ptsKeys)
+                                                                .GetRows();
+            int facLen = m_deformed ? m_nqtot : 1;
+
+            m_derivFac = Array<OneD, Array<OneD, NekDouble> >(nfac);
+            for (j = 0; j < nfac; ++j)
+            {
+                m_derivFac[j] = Array<OneD, NekDouble>(facLen*m_numElmt);
+            }
+
+            for (e = 0; e < m_numElmt; ++e)
+            {
+                const Array<TwoD, const NekDouble> df =
+                    m_exp[e]->GetMetricInfo()->GetDerivFactors(ptsKeys);
+
+                for (j = 0; j < nfac; ++j)
+                {
+                    Vmath::Vcopy(facLen, &df[j][0],                1,
+                                         &m_derivFac[j][e*facLen], 1);
+                }
+            }
+        }
+
+
+        /**
+         * Two elements are compatible if they have the same shape, the same
+         * basis keys in each direction, the same coordinate dimension and
+         * the same geometry type.
+         */
+        bool Collection::IsCompatible(
+                const LocalRegions::ExpansionSharedPtr &pExp1,
+                const LocalRegions::ExpansionSharedPtr &pExp2)
+        {
+            if (pExp1->DetShapeType() != pExp2->DetShapeType() ||
+                pExp1->GetNumBases()  != pExp2->GetNumBases()  ||
+                pExp1->GetCoordim()   != pExp2->GetCoordim())
+            {
+                return false;
+            }
+
+            for (int i = 0; i < pExp1->GetNumBases(); ++i)
+            {
+                if (pExp1->GetBasis(i)->GetBasisKey() !=
+                    pExp2->GetBasis(i)->GetBasisKey())
+                {
+                    return false;
+                }
+            }
+
+            bool deformed1 = pExp1->GetMetricInfo()->GetGtype()
+                                        == SpatialDomains::eDeformed;
+            bool deformed2 = pExp2->GetMetricInfo()->GetGtype()
+                                        == SpatialDomains::eDeformed;
+
+            return deformed1 == deformed2;
+        }
+
+
+        /**
+         * @param   inarray     Coefficients of all elements of the
+         *                      collection.
+         * @param   outarray    Physical values of all elements of the
+         *                      collection.
+         */
+        void Collection::BwdTrans(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray)
+        {
+            if (m_batched)
+            {
+                BwdTrans_SumFac(inarray, outarray);
+                return;
+            }
+
+            Array<OneD, NekDouble> tmp;
+            for (int e = 0; e < m_numElmt; ++e)
+            {
+                m_exp[e]->BwdTrans(inarray + e*m_ncoeffs,
+                                   tmp = outarray + e*m_nqtot);
+            }
+        }
+
+
+        /**
+         * @param   inarray     Physical values of all elements of the
+         *                      collection.
+         * @param   outarray    Inner products of all elements of the
+         *                      collection.
+         */
+        void Collection::IProductWRTBase(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray)
+        {
+            if (m_batched)
+            {
+                IProductWRTBase_SumFac(inarray, outarray);
+                return;
+            }
+
+            Array<OneD, NekDouble> tmp;
+            for (int e = 0; e < m_numElmt; ++e)
+            {
+                m_exp[e]->IProductWRTBase(inarray + e*m_nqtot,
+                                          tmp = outarray + e*m_ncoeffs);
+            }
+        }
+
+
+        /**
+         * Directions for which the output array is empty are not computed.
+         */
+        void Collection::PhysDeriv(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &out_d0,
+                      Array<OneD,       NekDouble> &out_d1,
+                      Array<OneD,       NekDouble> &out_d2)
+        {
+            int i, j, e;
+
+            if (!m_batched)
+            {
+                Array<OneD, NekDouble> e_out_d0;
+                Array<OneD, NekDouble> e_out_d1;
+                Array<OneD, NekDouble> e_out_d2;
+
+                for (e = 0; e < m_numElmt; ++e)
+                {
+                    e_out_d0 = out_d0 + e*m_nqtot;
+                    if (out_d1.num_elements())
+                    {
+                        e_out_d1 = out_d1 + e*m_nqtot;
+                    }
+                    if (out_d2.num_elements())
+                    {
+                        e_out_d2 = out_d2 + e*m_nqtot;
+                    }
+                    m_exp[e]->PhysDeriv(inarray + e*m_nqtot,
+                                        e_out_d0, e_out_d1, e_out_d2);
+                }
+                return;
+            }
+
+            const int ntot = m_nqtot*m_numElmt;
+
+            Array<OneD, Array<OneD, NekDouble> > diff(m_dim);
+            for (i = 0; i < m_dim; ++i)
+            {
+                diff[i] = Array<OneD, NekDouble>(ntot);
+            }
+
+            PhysTensorDeriv(inarray, diff);
+
+            Array<OneD, NekDouble> out[3] = {out_d0, out_d1, out_d2};
+
+            for (i = 0; i < m_coordim; ++i)
+            {
+                if (out[i].num_elements() == 0)
+                {
+                    continue;
+                }
+
+                if (m_deformed)
+                {
+                    Vmath::Vmul(ntot, &m_derivFac[i*m_dim][0], 1,
+                                      &diff[0][0],             1,
+                                      &out[i][0],              1);
+                    for (j = 1; j < m_dim; ++j)
+                    {
+                        Vmath::Vvtvp(ntot, &m_derivFac[i*m_dim+j][0], 1,
+                                           &diff[j][0],               1,
+                                           &out[i][0],                1,
+                                           &out[i][0],                1);
+                    }
+                }
+                else
+                {
+                    for (e = 0; e < m_numElmt; ++e)
+                    {
+                        Vmath::Smul(m_nqtot, m_derivFac[i*m_dim][e],
+                                    &diff[0][e*m_nqtot], 1,
+                                    &out[i][e*m_nqtot],  1);
+                        for (j = 1; j < m_dim; ++j)
+                        {
+                            Blas::Daxpy(m_nqtot, m_derivFac[i*m_dim+j][e],
+                                        &diff[j][e*m_nqtot], 1,
+                                        &out[i][e*m_nqtot],  1);
+                        }
+                    }
+                }
+            }
+        }
+
+
+        /**
+         * The coefficients of all elements are viewed as a single matrix
+         * whose leading dimension is the number of modes in the first
+         * direction. Each direction is contracted by one matrix-matrix
+         * multiply which also rotates the indices, so that after the last
+         * direction the element index is the leading one. A final transpose
+         * restores the elemental storage order.
+         */
+        void Collection::BwdTrans_SumFac(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray)
+        {
+            const int nel = m_numElmt;
+
+            switch (m_dim)
+            {
+                case 1:
+                {
+                    Blas::Dgemm('N', 'N', m_nquad[0], nel, m_nmodes[0],
+                                1.0, m_base[0].get(), m_nquad[0],
+                                     inarray.get(),   m_nmodes[0],
+                                0.0, outarray.get(),  m_nquad[0]);
+                    break;
+                }
+                case 2:
+                {
+                    Array<OneD, NekDouble> wsp (m_nmodes[1]*nel*m_nquad[0]);
+                    Array<OneD, NekDouble> wsp2(nel*m_nqtot);
+
+                    Blas::Dgemm('T', 'T', m_nmodes[1]*nel, m_nquad[0],
+                                m_nmodes[0],
+                                1.0, inarray.get(),   m_nmodes[0],
+                                     m_base[0].get(), m_nquad[0],
+                                0.0, wsp.get(),       m_nmodes[1]*nel);
+                    Blas::Dgemm('T', 'T', nel*m_nquad[0], m_nquad[1],
+                                m_nmodes[1],
+                                1.0, wsp.get(),       m_nmodes[1],
+                                     m_base[1].get(), m_nquad[1],
+                                0.0, wsp2.get(),      nel*m_nquad[0]);
+
+                    Transpose(nel, m_nqtot, wsp2, outarray);
+                    break;
+                }
+                case 3:
+                {
+                    Array<OneD, NekDouble> wsp (
+                        std::max(m_nmodes[1]*m_nmodes[2]*m_nquad[0],
+                                 m_nqtot)*nel);
+                    Array<OneD, NekDouble> wsp2(
+                        m_nmodes[2]*m_nquad[0]*m_nquad[1]*nel);
+
+                    Blas::Dgemm('T', 'T', m_nmodes[1]*m_nmodes[2]*nel,
+                                m_nquad[0], m_nmodes[0],
+                                1.0, inarray.get(),   m_nmodes[0],
+                                     m_base[0].get(), m_nquad[0],
+                                0.0, wsp.get(),  m_nmodes[1]*m_nmodes[2]*nel);
+                    Blas::Dgemm('T', 'T', m_nmodes[2]*nel*m_nquad[0],
+                                m_nquad[1], m_nmodes[1],
+                                1.0, wsp.get(),       m_nmodes[1],
+                                     m_base[1].get(), m_nquad[1],
+                                0.0, wsp2.get(), m_nmodes[2]*nel*m_nquad[0]);
+                    Blas::Dgemm('T', 'T', nel*m_nquad[0]*m_nquad[1],
+                                m_nquad[2], m_nmodes[2],
+                                1.0, wsp2.get(),      m_nmodes[2],
+                                     m_base[2].get(), m_nquad[2],
+                                0.0, wsp.get(),  nel*m_nquad[0]*m_nquad[1]);
+
+                    Transpose(nel, m_nqtot, wsp, outarray);
+                    break;
+                }
+                default:
+                    ASSERTL0(false, "Unsupported dimension for collection");
+                    break;
+            }
+        }
+
+
+        /**
+         * The physical values are multiplied by the quadrature metric of
+         * the whole collection in a single pass, and the inner product is
+         * then evaluated in the same rotated fashion as the backward
+         * transform.
+         */
+        void Collection::IProductWRTBase_SumFac(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray)
+        {
+            const int nel = m_numElmt;
+
+            Array<OneD, NekDouble> tmp(nel*m_nqtot);
+            Vmath::Vmul(nel*m_nqtot, m_quadMetric, 1, inarray, 1, tmp, 1);
+
+            switch (m_dim)
+            {
+                case 1:
+                {
+                    Blas::Dgemm('T', 'N', m_nmodes[0], nel, m_nquad[0],
+                                1.0, m_base[0].get(), m_nquad[0],
+                                     tmp.get(),       m_nquad[0],
+                                0.0, outarray.get(),  m_nmodes[0]);
+                    break;
+                }
+                case 2:
+                {
+                    Array<OneD, NekDouble> wsp (m_nquad[1]*nel*m_nmodes[0]);
+                    Array<OneD, NekDouble> wsp2(nel*m_ncoeffs);
+
+                    Blas::Dgemm('T', 'N', m_nquad[1]*nel, m_nmodes[0],
+                                m_nquad[0],
+                                1.0, tmp.get(),       m_nquad[0],
+                                     m_base[0].get(), m_nquad[0],
+                                0.0, wsp.get(),       m_nquad[1]*nel);
+                    Blas::Dgemm('T', 'N', nel*m_nmodes[0], m_nmodes[1],
+                                m_nquad[1],
+                                1.0, wsp.get(),       m_nquad[1],
+                                     m_base[1].get(), m_nquad[1],
+                                0.0, wsp2.get(),      nel*m_nmodes[0]);
+
+                    Transpose(nel, m_ncoeffs, wsp2, outarray);
+                    break;
+                }
+                case 3:
+                {
+                    Array<OneD, NekDouble> wsp (
+                        std::max(m_nquad[1]*m_nquad[2]*m_nmodes[0],
+                                 m_ncoeffs)*nel);
+                    Array<OneD, NekDouble> wsp2(
+                        m_nquad[2]*m_nmodes[0]*m_nmodes[1]*nel);
+
+                    Blas::Dgemm('T', 'N', m_nquad[1]*m_nquad[2]*nel,
+                                m_nmodes[0], m_nquad[0],
+                                1.0, tmp.get(),       m_nquad[0],
+                                     m_base[0].get(), m_nquad[0],
+                                0.0, wsp.get(),  m_nquad[1]*m_nquad[2]*nel);
+                    Blas::Dgemm('T', 'N', m_nquad[2]*nel*m_nmodes[0],
+                                m_nmodes[1], m_nquad[1],
+                                1.0, wsp.get(),       m_nquad[1],
+                                     m_base[1].get(), m_nquad[1],
+                                0.0, wsp2.get(), m_nquad[2]*nel*m_nmodes[0]);
+                    Blas::Dgemm('T', 'N', nel*m_nmodes[0]*m_nmodes[1],
+                                m_nmodes[2], m_nquad[2],
+                                1.0, wsp2.get(),      m_nquad[2],
+                                     m_base[2].get(), m_nquad[2],
+                                0.0, wsp.get(),  nel*m_nmodes[0]*m_nmodes[1]);
+
+                    Transpose(nel, m_ncoeffs, wsp, outarray);
+                    break;
+                }
+                default:
+                    ASSERTL0(false, "Unsupported dimension for collection");
+                    break;
+            }
+        }
+
+
+        /**
+         * The derivative in the first direction is evaluated for all
+         * elements by one matrix-matrix multiply. The remaining directions
+         * are not the leading index of the elemental data and are therefore
+         * evaluated per element (and per plane in the second direction of
+         * a hexahedron).
+         */
+        void Collection::PhysTensorDeriv(
+                const Array<OneD, const NekDouble>         &inarray,
+                      Array<OneD, Array<OneD, NekDouble> > &diff)
+        {
+            int e, k;
+            const int nel = m_numElmt;
+
+            Blas::Dgemm('N', 'N', m_nquad[0], m_nqtot/m_nquad[0]*nel,
+                        m_nquad[0],
+                        1.0, m_deriv[0].get(), m_nquad[0],
+                             inarray.get(),    m_nquad[0],
+                        0.0, diff[0].get(),    m_nquad[0]);
+
+            if (m_dim == 2)
+            {
+                for (e = 0; e < nel; ++e)
+                {
+                    Blas::Dgemm('N', 'T', m_nquad[0], m_nquad[1], m_nquad[1],
+                                1.0, &inarray[e*m_nqtot],  m_nquad[0],
+                                     m_deriv[1].get(),     m_nquad[1],
+                                0.0, &diff[1][e*m_nqtot],  m_nquad[0]);
+                }
+            }
+            else if (m_dim == 3)
+            {
+                const int nplane = m_nquad[0]*m_nquad[1];
+
+                for (k = 0; k < m_nquad[2]*nel; ++k)
+                {
+                    Blas::Dgemm('N', 'T', m_nquad[0], m_nquad[1], m_nquad[1],
+                                1.0, &inarray[k*nplane],  m_nquad[0],
+                                     m_deriv[1].get(),    m_nquad[1],
+                                0.0, &diff[1][k*nplane],  m_nquad[0]);
+                }
+
+                for (e = 0; e < nel; ++e)
+                {
+                    Blas::Dgemm('N', 'T', nplane, m_nquad[2], m_nquad[2],
+                                1.0, &inarray[e*m_nqtot],  nplane,
+                                     m_deriv[2].get(),     m_nquad[2],
+                                0.0, &diff[2][e*m_nqtot],  nplane);
+                }
+            }
+        }
+
+
+        /**
+         * Converts data stored with the element index leading, i.e. as a
+         * matrix of size @a nrows by @a ncols entries per element, back to
+         * elemental storage order.
+         */
+        void Collection::Transpose(
+                const int                           nrows,
+                const int                           ncols,
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray)
+        {
+            for (int e = 0; e < nrows; ++e)
+            {
+                Vmath::Vcopy(ncols, &inarray[e], nrows,
+                                    &outarray[e*ncols], 1);
+            }
+        }
+    } //end of namespace
+} //end of namespace
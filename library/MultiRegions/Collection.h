@@ -0,0 +1,194 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File Collection.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Multi-element collection of expansions header
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_COLLECTION_H
+#define NEKTAR_LIB_MULTIREGIONS_COLLECTION_H
+
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <LocalRegions/Expansion.h>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /// Group of consecutive elements evaluated together.
+        class Collection
+        {
+        public:
+            /// Construct a collection from a run of compatible elements.
+            MULTI_REGIONS_EXPORT Collection(
+                const LocalRegions::ExpansionVector &pExp,
+                const int                            coeffOffset,
+                const int                            physOffset);
+
+            MULTI_REGIONS_EXPORT ~Collection() {}
+
+            /// Determines if two elements may share a collection.
+            MULTI_REGIONS_EXPORT static bool IsCompatible(
+                const LocalRegions::ExpansionSharedPtr &pExp1,
+                const LocalRegions::ExpansionSharedPtr &pExp2);
+
+            /// Backward transform of all elements of the collection.
+            MULTI_REGIONS_EXPORT void BwdTrans(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray);
+
+            /// Inner product with respect to the basis of all elements of
+            /// the collection.
+            MULTI_REGIONS_EXPORT void IProductWRTBase(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray);
+
+            /// Physical derivative of all elements of the collection.
+            MULTI_REGIONS_EXPORT void PhysDeriv(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &out_d0,
+                      Array<OneD,       NekDouble> &out_d1,
+                      Array<OneD,       NekDouble> &out_d2);
+
+            /// Number of elements in the collection.
+            inline int GetNumElmts() const;
+
+            /// Offset of the collection data into the coefficient array.
+            inline int GetCoeffOffset() const;
+
+            /// Offset of the collection data into the physical array.
+            inline int GetPhysOffset() const;
+
+            /// True if the collection is evaluated using the batched
+            /// sum-factorisation kernels.
+            inline bool IsBatched() const;
+
+        private:
+            /// Elements in the collection, in storage order.
+            LocalRegions::ExpansionVector m_exp;
+
+            /// Number of elements in the collection.
+            int m_numElmt;
+
+            /// Number of coefficients per element.
+            int m_ncoeffs;
+
+            /// Number of quadrature points per element.
+            int m_nqtot;
+
+            /// Shape dimension of the elements.
+            int m_dim;
+
+            /// Number of derivative directions in physical space.
+            int m_coordim;
+
+            /// Offset of the first element in the coefficient array.
+            int m_coeffOffset;
+
+            /// Offset of the first element in the physical array.
+            int m_physOffset;
+
+            /// Whether batched tensor-product kernels are used.
+            bool m_batched;
+
+            /// Whether the elements have deformed geometry.
+            bool m_deformed;
+
+            /// Number of modes in each direction.
+            Array<OneD, int> m_nmodes;
+
+            /// Number of quadrature points in each direction.
+            Array<OneD, int> m_nquad;
+
+            /// Basis matrices in each direction.
+            Array<OneD, Array<OneD, const NekDouble> > m_base;
+
+            /// Differentiation matrices in each direction.
+            Array<OneD, Array<OneD, const NekDouble> > m_deriv;
+
+            /// Quadrature metric (Jacobian times weights) of all elements.
+            Array<OneD, NekDouble> m_quadMetric;
+
+            /// Derivative factors of all elements, one value per element
+            /// for regular geometry and one per point for deformed.
+            Array<OneD, Array<OneD, NekDouble> > m_derivFac;
+
+            void BwdTrans_SumFac(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray);
+
+            void IProductWRTBase_SumFac(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray);
+
+            void PhysTensorDeriv(
+                const Array<OneD, const NekDouble>               &inarray,
+                      Array<OneD, Array<OneD, NekDouble> > &diff);
+
+            void Transpose(
+                const int                           nrows,
+                const int                           ncols,
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &outarray);
+        };
+
+        /// Shared pointer to a Collection object.
+        typedef boost::shared_ptr<Collection> CollectionSharedPtr;
+        /// Vector of collections.
+        typedef std::vector<CollectionSharedPtr> CollectionVector;
+        /// Shared pointer to a vector of collections.
+        typedef boost::shared_ptr<CollectionVector> CollectionVectorShPtr;
+
+        inline int Collection::GetNumElmts() const
+        {
+            return m_numElmt;
+        }
+
+        inline int Collection::GetCoeffOffset() const
+        {
+            return m_coeffOffset;
+        }
+
+        inline int Collection::GetPhysOffset() const
+        {
+            return m_physOffset;
+        }
+
+        inline bool Collection::IsBatched() const
+        {
+            return m_batched;
+        }
+    } //end of namespace
+} //end of namespace
+
+#endif
@@ -137,6 +137,11 @@ namespace Nektar
                                     CheckIfSingularSystem,
                                     variable);
 
+            if(m_globalOptParam->DoAutoTune())
+            {
+                AutoTuneGlobalOptParam(m_locToGloMap);
+                m_globalMat->clear();
+            }
         }
 
 
@@ -813,13 +818,122 @@ namespace Nektar
                 const StdRegions::ConstFactorMap &factors,
                 const StdRegions::VarCoeffMap &varcoeff,
                 const Array<OneD, const NekDouble> &dirForcing)
+        {
+            int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
+            Array<OneD,NekDouble> wsp(contNcoeffs);
+            SetUpHelmholtzForcing(inarray, wsp);
+
+            GlobalLinSysKey key(StdRegions::eHelmholtz,m_locToGloMap,factors,varcoeff);
+            
+            if(flags.isSet(eUseGlobal))
+            {
+                GlobalSolve(key,wsp,outarray,dirForcing);
+            }
+            else
+            {
+                Array<OneD,NekDouble> tmp(contNcoeffs);
+                LocalToGlobal(outarray,tmp);
+                GlobalSolve(key,wsp,tmp,dirForcing);
+                GlobalToLocal(tmp,outarray);
+            }
+        }
+
+
+        /**
+         * The fields are solved together, with a single global linear
+         * system, if all of them are two-dimensional continuous fields
+         * sharing the local to global map of this field on all processes;
+         * i.e. they differ only in the values of their boundary conditions.
+         * Otherwise they are solved one after the other.
+         *
+         * @param   fields      Fields providing the boundary conditions.
+         * @param   inarray     Forcing functions in physical space.
+         * @param   outarray    Initial guesses on entry, solutions on exit.
+         */
+        void ContField2D::v_MultiHelmSolve(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff)
+        {
+            int i;
+            int nVec = fields.num_elements();
+            int shared = 1;
+
+            std::vector<ContField2DSharedPtr> cont(nVec);
+            for(i = 0; i < nVec; ++i)
+            {
+                cont[i] = boost::dynamic_pointer_cast<ContField2D>(fields[i]);
+                if(!cont[i] || cont[i]->m_locToGloMap != m_locToGloMap)
+                {
+                    shared = 0;
+                }
+            }
+            m_comm->GetRowComm()->AllReduce(shared, LibUtilities::ReduceMin);
+
+            if(!shared)
+            {
+                ExpList::v_MultiHelmSolve(fields, inarray, outarray, flags,
+                                          factors, varcoeff);
+                return;
+            }
+
+            int NumDirBcs   = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+            int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
+            Array<OneD, Array<OneD, NekDouble> > rhs(nVec), sol(nVec);
+
+            for(i = 0; i < nVec; ++i)
+            {
+                rhs[i] = Array<OneD, NekDouble>(contNcoeffs);
+                cont[i]->SetUpHelmholtzForcing(inarray[i], rhs[i]);
+
+                if(flags.isSet(eUseGlobal))
+                {
+                    sol[i] = outarray[i];
+                }
+                else
+                {
+                    sol[i] = Array<OneD, NekDouble>(contNcoeffs);
+                    LocalToGlobal(outarray[i], sol[i]);
+                }
+
+                // Set the Dirichlet DOFs of each field
+                cont[i]->v_ImposeDirichletConditions(sol[i]);
+            }
+
+            if(contNcoeffs - NumDirBcs > 0)
+            {
+                GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap,
+                                    factors, varcoeff);
+                GetGlobalLinSys(key)->Solve(rhs, sol, m_locToGloMap);
+            }
+
+            if(!flags.isSet(eUseGlobal))
+            {
+                for(i = 0; i < nVec; ++i)
+                {
+                    GlobalToLocal(sol[i], outarray[i]);
+                }
+            }
+        }
+
+
+        /**
+         * Computes the inner product of the forcing function @a inarray,
+         * negated to be consistent with the matrix definition, and adds the
+         * weak (Neumann and Robin) boundary conditions.
+         */
+        void ContField2D::SetUpHelmholtzForcing(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &wsp)
         {
             //----------------------------------
             //  Setup RHS Inner product
             //----------------------------------
             // Inner product of forcing
             int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
-            Array<OneD,NekDouble> wsp(contNcoeffs);
             IProductWRTBase(inarray,wsp,eGlobal);
             // Note -1.0 term necessary to invert forcing function to
             // be consistent with matrix definition
@@ -851,20 +965,6 @@ namespace Nektar
 
             // Add weak boundary conditions to forcing
             Vmath::Vadd(contNcoeffs, wsp, 1, gamma, 1, wsp, 1);
-
-            GlobalLinSysKey key(StdRegions::eHelmholtz,m_locToGloMap,factors,varcoeff);
-            
-            if(flags.isSet(eUseGlobal))
-            {
-                GlobalSolve(key,wsp,outarray,dirForcing);
-            }
-            else
-            {
-                Array<OneD,NekDouble> tmp(contNcoeffs);
-                LocalToGlobal(outarray,tmp);
-                GlobalSolve(key,wsp,tmp,dirForcing);
-                GlobalToLocal(tmp,outarray);
-            }
         }
 
 
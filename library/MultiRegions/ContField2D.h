@@ -254,6 +254,22 @@ namespace Nektar
                     const StdRegions::VarCoeffMap &varcoeff,
                     const Array<OneD, const NekDouble> &dirForcing);
 
+            /// Solves the Helmholtz equation for several fields which share
+            /// the local to global map of this field.
+            MULTI_REGIONS_EXPORT virtual void v_MultiHelmSolve(
+                    const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                    const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                          Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                    const FlagList &flags,
+                    const StdRegions::ConstFactorMap &factors,
+                    const StdRegions::VarCoeffMap &varcoeff);
+
+            /// Sets up the global right-hand side of the Helmholtz equation,
+            /// including the weak boundary conditions.
+            void SetUpHelmholtzForcing(
+                    const Array<OneD, const NekDouble> &inarray,
+                          Array<OneD,       NekDouble> &wsp);
+
             /// Calculates the result of the multiplication of a global
             /// matrix of type specified by \a mkey with a vector given by \a
             /// inarray.
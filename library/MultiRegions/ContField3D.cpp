@@ -89,6 +89,12 @@ namespace Nektar
                 m_session,m_ncoeffs,*this,m_bndCondExpansions,m_bndConditions,
                 m_periodicVerts, m_periodicEdges, m_periodicFaces,
                 CheckIfSingularSystem, variable);
+
+            if(m_globalOptParam->DoAutoTune())
+            {
+                AutoTuneGlobalOptParam(m_locToGloMap);
+                m_globalMat->clear();
+            }
         }
 
 
@@ -509,9 +515,111 @@ namespace Nektar
                                     const StdRegions::VarCoeffMap &varcoeff,
                                     const Array<OneD, const NekDouble> &dirForcing)
       {
-          // Inner product of forcing
           int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
           Array<OneD,NekDouble> wsp(contNcoeffs);
+          SetUpHelmholtzForcing(inarray, wsp);
+
+          // Solve the system
+          GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap, factors,varcoeff);
+          
+          if(flags.isSet(eUseGlobal))
+          {
+              GlobalSolve(key,wsp,outarray,dirForcing);
+          }
+          else
+          {
+              Array<OneD,NekDouble> tmp(contNcoeffs);
+              LocalToGlobal(outarray,tmp);
+              GlobalSolve(key,wsp,tmp,dirForcing);
+              GlobalToLocal(tmp,outarray);
+          }
+      }
+
+      /**
+       * Solves the Helmholtz equation for all @a fields with a single global
+       * linear system if they are continuous fields sharing the local to
+       * global map of this field on all processes, and one after the other
+       * otherwise. See ContField2D::v_MultiHelmSolve.
+       */
+      void ContField3D::v_MultiHelmSolve(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff)
+      {
+          int i;
+          int nVec = fields.num_elements();
+          int shared = 1;
+
+          std::vector<ContField3DSharedPtr> cont(nVec);
+          for(i = 0; i < nVec; ++i)
+          {
+              cont[i] = boost::dynamic_pointer_cast<ContField3D>(fields[i]);
+              if(!cont[i] || cont[i]->m_locToGloMap != m_locToGloMap)
+              {
+                  shared = 0;
+              }
+          }
+          m_comm->GetRowComm()->AllReduce(shared, LibUtilities::ReduceMin);
+
+          if(!shared)
+          {
+              ExpList::v_MultiHelmSolve(fields, inarray, outarray, flags,
+                                        factors, varcoeff);
+              return;
+          }
+
+          int NumDirBcs   = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+          int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
+          Array<OneD, Array<OneD, NekDouble> > rhs(nVec), sol(nVec);
+
+          for(i = 0; i < nVec; ++i)
+          {
+              rhs[i] = Array<OneD, NekDouble>(contNcoeffs);
+              cont[i]->SetUpHelmholtzForcing(inarray[i], rhs[i]);
+
+              if(flags.isSet(eUseGlobal))
+              {
+                  sol[i] = outarray[i];
+              }
+              else
+              {
+                  sol[i] = Array<OneD, NekDouble>(contNcoeffs);
+                  LocalToGlobal(outarray[i], sol[i]);
+              }
+
+              // Set the Dirichlet DOFs of each field
+              cont[i]->v_ImposeDirichletConditions(sol[i]);
+          }
+
+          if(contNcoeffs - NumDirBcs > 0)
+          {
+              GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap,
+                                  factors, varcoeff);
+              GetGlobalLinSys(key)->Solve(rhs, sol, m_locToGloMap);
+          }
+
+          if(!flags.isSet(eUseGlobal))
+          {
+              for(i = 0; i < nVec; ++i)
+              {
+                  GlobalToLocal(sol[i], outarray[i]);
+              }
+          }
+      }
+
+      /**
+       * Computes the negated inner product of the forcing function and adds
+       * the weak boundary conditions.
+       */
+      void ContField3D::SetUpHelmholtzForcing(
+                const Array<OneD, const NekDouble> &inarray,
+                      Array<OneD,       NekDouble> &wsp)
+      {
+          // Inner product of forcing
+          int contNcoeffs = m_locToGloMap->GetNumGlobalCoeffs();
           IProductWRTBase(inarray,wsp,eGlobal);
 
           // Note -1.0 term necessary to invert forcing function to
@@ -543,21 +651,6 @@ namespace Nektar
           
           // Add weak boundary conditions to forcing
           Vmath::Vadd(contNcoeffs, wsp, 1, gamma, 1, wsp, 1);
-          
-          // Solve the system
-          GlobalLinSysKey key(StdRegions::eHelmholtz, m_locToGloMap, factors,varcoeff);
-          
-          if(flags.isSet(eUseGlobal))
-          {
-              GlobalSolve(key,wsp,outarray,dirForcing);
-          }
-          else
-          {
-              Array<OneD,NekDouble> tmp(contNcoeffs);
-              LocalToGlobal(outarray,tmp);
-              GlobalSolve(key,wsp,tmp,dirForcing);
-              GlobalToLocal(tmp,outarray);
-          }
       }
       
       void ContField3D::v_GeneralMatrixOp(
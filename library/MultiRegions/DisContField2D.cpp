@@ -1346,27 +1346,45 @@ namespace Nektar
             Vmath::Zero(Fwd.num_elements(), Fwd, 1);
             Vmath::Zero(Bwd.num_elements(), Bwd, 1);
 
-            for(cnt = n = 0; n < nexp; ++n)
+            // Traces shared with other processes are filled first so that
+            // their exchange overlaps with extracting the remaining traces.
+            const vector<bool> &shared = m_traceMap->GetSharedTrace();
+            bool overlap = shared.size() > 0;
+
+            for (int pass = overlap ? 0 : 1; pass < 2; ++pass)
             {
-                exp2d = LocalRegions::Expansion2D::FromStdExp((*m_exp)[n]);
-                phys_offset = GetPhys_Offset(n);
+                if (pass == 1)
+                {
+                    m_traceMap->UniversalTraceAssembleStart(Fwd, Bwd);
+                }
 
-                for(e = 0; e < exp2d->GetNedges(); ++e, ++cnt)
+                for(cnt = n = 0; n < nexp; ++n)
                 {
-                    int offset = m_trace->GetPhys_Offset(
-                        elmtToTrace[n][e]->GetElmtId());
+                    exp2d = LocalRegions::Expansion2D::FromStdExp((*m_exp)[n]);
+                    phys_offset = GetPhys_Offset(n);
 
-                    if (m_leftAdjacentEdges[cnt])
+                    for(e = 0; e < exp2d->GetNedges(); ++e, ++cnt)
                     {
-                        exp2d->GetEdgePhysVals(e, elmtToTrace[n][e],
-                                                     field + phys_offset,
-                                                     e_tmp = Fwd + offset);
-                    }
-                    else
-                    {
-                        exp2d->GetEdgePhysVals(e, elmtToTrace[n][e],
-                                                     field + phys_offset,
-                                                     e_tmp = Bwd + offset);
+                        int id = elmtToTrace[n][e]->GetElmtId();
+                        if (overlap && shared[id] != (pass == 0))
+                        {
+                            continue;
+                        }
+
+                        int offset = m_trace->GetPhys_Offset(id);
+
+                        if (m_leftAdjacentEdges[cnt])
+                        {
+                            exp2d->GetEdgePhysVals(e, elmtToTrace[n][e],
+                                                         field + phys_offset,
+                                                         e_tmp = Fwd + offset);
+                        }
+                        else
+                        {
+                            exp2d->GetEdgePhysVals(e, elmtToTrace[n][e],
+                                                         field + phys_offset,
+                                                         e_tmp = Bwd + offset);
+                        }
                     }
                 }
             }
@@ -1426,8 +1444,7 @@ namespace Nektar
             }
 
             // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
+            m_traceMap->UniversalTraceAssembleFinish(Fwd, Bwd);
         }
         
         void DisContField2D::v_FillBndCondFromField(void)
@@ -2121,7 +2138,6 @@ namespace Nektar
                                                           const NekDouble x3_in)
         {
             int i;
-            int npoints;
             int nbnd = m_bndCondExpansions.num_elements();
 
             MultiRegions::ExpListSharedPtr locExpList;
@@ -2133,21 +2149,6 @@ namespace Nektar
                     SpatialDomains::eTimeDependent)
                 {
                     locExpList = m_bndCondExpansions[i];
-                    npoints    = locExpList->GetNpoints();
-                    Array<OneD, NekDouble> x0(npoints, 0.0);
-                    Array<OneD, NekDouble> x1(npoints, 0.0);
-                    Array<OneD, NekDouble> x2(npoints, 0.0);
-
-                    // Homogeneous input case for x2.
-                    if (x2_in == NekConstants::kNekUnsetDouble)
-                    {
-                        locExpList->GetCoords(x0,x1,x2);
-                    }
-                    else
-                    {
-                        locExpList->GetCoords(x0, x1, x2);
-                        Vmath::Fill(npoints, x2_in, x2, 1);
-                    }
 
                     if (m_bndConditions[i]->GetBoundaryConditionType()
                         == SpatialDomains::eDirichlet)
@@ -2169,8 +2170,8 @@ namespace Nektar
                              std::vector<LibUtilities::
                                     FieldDefinitionsSharedPtr> FieldDef;
                              std::vector<std::vector<NekDouble> > FieldData;
-                             LibUtilities::FieldIO f(m_session->GetComm());
-                             f.Import(filebcs, FieldDef, FieldData);
+                             locExpList->ImportCached(
+                                 filebcs, FieldDef, FieldData);
 
                              // copy FieldData into locExpList
                              locExpList->ExtractDataToCoeffs(
@@ -2194,8 +2195,8 @@ namespace Nektar
                                         (m_bndConditions[i])->
                                             m_dirichletCondition;
                             
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
+                            locExpList->EvaluateEquation(
+                                condition, time, locExpList->UpdatePhys(), x2_in);
 
                             locExpList->FwdTrans_BndConstrained(
                                 locExpList->GetPhys(),
@@ -2222,8 +2223,8 @@ namespace Nektar
                              std::vector<LibUtilities::
                                 FieldDefinitionsSharedPtr> FieldDef;
                              std::vector<std::vector<NekDouble> > FieldData;
-                             LibUtilities::FieldIO f(m_session->GetComm());
-                             f.Import(filebcs, FieldDef, FieldData);
+                             locExpList->ImportCached(
+                                 filebcs, FieldDef, FieldData);
 
                              // copy FieldData into locExpList
                              locExpList->ExtractDataToCoeffs(
@@ -2257,8 +2258,8 @@ namespace Nektar
                                     SpatialDomains::NeumannBoundaryCondition>
                                         (m_bndConditions[i])->
                                             m_neumannCondition;
-                            condition.Evaluate(x0, x1, x2, time, 
-                                               locExpList->UpdatePhys());
+                            locExpList->EvaluateEquation(
+                                condition, time, locExpList->UpdatePhys(), x2_in);
 
                             locExpList->IProductWRTBase(
                                             locExpList->GetPhys(),
@@ -2283,8 +2284,8 @@ namespace Nektar
                             std::vector<LibUtilities::
                                 FieldDefinitionsSharedPtr> FieldDef;
                             std::vector<std::vector<NekDouble> > FieldData;
-                            LibUtilities::FieldIO f(m_session->GetComm());
-                            f.Import(filebcs, FieldDef, FieldData);
+                            locExpList->ImportCached(
+                                filebcs, FieldDef, FieldData);
 
                             // copy FieldData into locExpList
                             locExpList->ExtractDataToCoeffs(
@@ -2306,8 +2307,8 @@ namespace Nektar
                             // Array<OneD,NekDouble> timeArray(npoints, time);
                             // put primitive coefficient into the physical space
                             // storage
-                            coeff.Evaluate(x0,x1,x2,time, 
-                                           locExpList->UpdatePhys());
+                            locExpList->EvaluateEquation(
+                                coeff, time, locExpList->UpdatePhys(), x2_in);
                         }
                         else
                         {
@@ -2321,16 +2322,16 @@ namespace Nektar
                                     SpatialDomains::RobinBoundaryCondition>
                                         (m_bndConditions[i])->
                                             m_robinPrimitiveCoeff;
-                            condition.Evaluate(x0, x1, x2, time,
-                                               locExpList->UpdatePhys());
+                            locExpList->EvaluateEquation(
+                                condition, time, locExpList->UpdatePhys(), x2_in);
                             locExpList->IProductWRTBase(
                                 locExpList->GetPhys(),
                                 locExpList->UpdateCoeffs());
 
                             // put primitive coefficient into the physical space
                             // storage
-                            coeff.Evaluate(x0, x1, x2, time,
-                                           locExpList->UpdatePhys());
+                            locExpList->EvaluateEquation(
+                                coeff, time, locExpList->UpdatePhys(), x2_in);
                         }
                     }    
                     else
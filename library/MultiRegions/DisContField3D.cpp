@@ -187,15 +187,23 @@
              {
                  if(SetUpJustDG)
                  {
-                     m_globalBndMat = In.m_globalBndMat;
-                     m_trace        = In.m_trace;
-                     m_traceMap     = In.m_traceMap;
+                     m_globalBndMat      = In.m_globalBndMat;
+                     m_trace             = In.m_trace;
+                     m_traceMap          = In.m_traceMap;
+                     m_periodicFwdCopy   = In.m_periodicFwdCopy;
+                     m_periodicBwdCopy   = In.m_periodicBwdCopy;
+                     m_leftAdjacentFaces = In.m_leftAdjacentFaces;
+                     m_traceGather       = In.m_traceGather;
                  }
                  else 
                  {
-                     m_globalBndMat = In.m_globalBndMat;
-                     m_trace        = In.m_trace;
-                     m_traceMap     = In.m_traceMap;
+                     m_globalBndMat      = In.m_globalBndMat;
+                     m_trace             = In.m_trace;
+                     m_traceMap          = In.m_traceMap;
+                     m_periodicFwdCopy   = In.m_periodicFwdCopy;
+                     m_periodicBwdCopy   = In.m_periodicBwdCopy;
+                     m_leftAdjacentFaces = In.m_leftAdjacentFaces;
+                     m_traceGather       = In.m_traceGather;
 
                      int i,cnt,f;
                      Array<OneD, int> ElmtID,FaceID;
@@ -255,7 +263,11 @@
              m_bndConditions       (In.m_bndConditions),
              m_globalBndMat        (In.m_globalBndMat),
              m_trace               (In.m_trace),
-             m_traceMap            (In.m_traceMap)
+             m_traceMap            (In.m_traceMap),
+             m_leftAdjacentFaces   (In.m_leftAdjacentFaces),
+             m_periodicFwdCopy     (In.m_periodicFwdCopy),
+             m_periodicBwdCopy     (In.m_periodicBwdCopy),
+             m_traceGather         (In.m_traceGather)
          {
          }
 
@@ -633,6 +645,13 @@
                         ::AllocateSharedPtr(m_session, *(it->second),
                                             graph3D, variable);
 
+                    // Boundary regions are not auto-tuned themselves.
+                    if(m_globalOptParam->DoAutoTune())
+                    {
+                        locExpList->GetGlobalOptParam()->CopyCollectionOps(
+                            *m_globalOptParam);
+                    }
+
                     // Set up normals on non-Dirichlet boundary conditions
                     if(locBCond->GetBoundaryConditionType() != 
                            SpatialDomains::eDirichlet)
@@ -1703,53 +1722,262 @@
                   Array<OneD,       NekDouble> &Fwd,
                   Array<OneD,       NekDouble> &Bwd)
         {
-            // Loop over elements and collect forward and backward expansions.
-            int nexp = GetExpSize();
-            int cnt, n, e, npts, offset, phys_offset;
-            Array<OneD,NekDouble> e_tmp;
-            
-            Array<OneD, Array<OneD, StdRegions::StdExpansionSharedPtr> >
-                &elmtToTrace = m_traceMap->GetElmtToTrace();
-
-            set<int>::iterator    it;
-            PeriodicMap::iterator it2;
-            boost::unordered_map<int,pair<int,int> >::iterator it3;
+            SetUpTraceGather();
 
             // Zero vectors.
             Vmath::Zero(Fwd.num_elements(), Fwd, 1);
             Vmath::Zero(Bwd.num_elements(), Bwd, 1);
-             
-            LocalRegions::Expansion3DSharedPtr exp3d;
-            bool fwd;
 
-            for(cnt = n = 0; n < nexp; ++n)
+            // Traces shared with other processes are filled first so that
+            // their exchange overlaps with extracting the remaining traces.
+            GatherTracePhys(0, field, Fwd, Bwd);
+            m_traceMap->UniversalTraceAssembleStart(Fwd, Bwd);
+            GatherTracePhys(1, field, Fwd, Bwd);
+
+            FillBwdWithBoundConds(Fwd, Bwd);
+
+            // Do parallel exchange for forwards/backwards spaces.
+            m_traceMap->UniversalTraceAssembleFinish(Fwd, Bwd);
+        }
+
+        /**
+         * @brief Extract the forwards and backwards trace spaces of several
+         * fields at once.
+         *
+         * All fields are extracted with the gather of this expansion and the
+         * trace points shared with other processes are exchanged for all
+         * fields and both trace spaces in a single set of messages. Fields
+         * which are not 3D discontinuous fields with the same trace as this
+         * expansion are handled one by one.
+         */
+        void DisContField3D::v_MultiGetFwdBwdTracePhys(
+            const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &Bwd)
+        {
+            int i;
+            int nVar = fields.num_elements();
+            vector<DisContField3DSharedPtr> disFields(nVar);
+
+            for (i = 0; i < nVar; ++i)
+            {
+                disFields[i] = boost::dynamic_pointer_cast<DisContField3D>(
+                    fields[i]);
+                if (!disFields[i] ||
+                    disFields[i]->GetExpSize() != GetExpSize() ||
+                    disFields[i]->GetTrace()->GetTotPoints() !=
+                        m_trace->GetTotPoints())
+                {
+                    ExpList::v_MultiGetFwdBwdTracePhys(
+                        fields, inarray, Fwd, Bwd);
+                    return;
+                }
+            }
+
+            SetUpTraceGather();
+
+            for (i = 0; i < nVar; ++i)
+            {
+                Vmath::Zero(Fwd[i].num_elements(), Fwd[i], 1);
+                Vmath::Zero(Bwd[i].num_elements(), Bwd[i], 1);
+                GatherTracePhys(0, inarray[i], Fwd[i], Bwd[i]);
+            }
+
+            m_traceMap->UniversalTraceAssembleStart(Fwd, Bwd);
+
+            for (i = 0; i < nVar; ++i)
+            {
+                GatherTracePhys(1, inarray[i], Fwd[i], Bwd[i]);
+                disFields[i]->FillBwdWithBoundConds(Fwd[i], Bwd[i]);
+            }
+
+            m_traceMap->UniversalTraceAssembleFinish(Fwd, Bwd);
+        }
+
+        /**
+         * @brief Set up the gather from element to trace storage used to
+         * extract the trace spaces.
+         *
+         * Each face is extracted once with GetFacePhysVals from two probe
+         * fields holding \f$ j+1 \f$ and \f$ (j+1)^2 \f$ at the element
+         * point \f$ j \f$. If both are reproduced exactly at every face
+         * point, the face is a permutation of element points and its
+         * indices are recorded; otherwise the face is interpolated and is
+         * left to GetFacePhysVals.
+         */
+        void DisContField3D::SetUpTraceGather()
+        {
+            if (m_traceGather)
+            {
+                return;
+            }
+
+            int i, j, n, e, cnt;
+            int nexp       = GetExpSize();
+            int nTracePts  = m_trace->GetTotPoints();
+            int nTraceExp  = m_trace->GetExpSize();
+            Array<OneD, Array<OneD, StdRegions::StdExpansionSharedPtr> >
+                &elmtToTrace = m_traceMap->GetElmtToTrace();
+            const vector<bool> &shared = m_traceMap->GetSharedTrace();
+
+            m_traceGather = MemoryManager<TraceGather>::AllocateSharedPtr();
+            TraceGather &gather = *m_traceGather;
+
+            vector<int> fwdSrc[2], fwdDst[2], bwdSrc[2], bwdDst[2];
+            vector<int> extractSrc(nTracePts, -1);
+            vector<TraceGather::InterpFace> extractInterp(nTraceExp);
+            vector<bool> lastInterp(nTraceExp, false);
+
+            for (cnt = n = 0; n < nexp; ++n)
             {
-                exp3d = LocalRegions::Expansion3D::FromStdExp((*m_exp)[n]);
-                phys_offset = GetPhys_Offset(n);
-                for(e = 0; e < exp3d->GetNfaces(); ++e, ++cnt)
+                LocalRegions::Expansion3DSharedPtr exp3d =
+                    LocalRegions::Expansion3D::FromStdExp((*m_exp)[n]);
+                int nPts        = exp3d->GetTotPoints();
+                int phys_offset = GetPhys_Offset(n);
+
+                Array<OneD, NekDouble> probe1(nPts), probe2(nPts);
+                for (i = 0; i < nPts; ++i)
                 {
-                    offset = m_trace->GetPhys_Offset(
-                        elmtToTrace[n][e]->GetElmtId());
+                    probe1[i] = i + 1;
+                    probe2[i] = probe1[i]*probe1[i];
+                }
 
-                    fwd = m_leftAdjacentFaces[cnt];
-                    if (fwd)
+                for (e = 0; e < exp3d->GetNfaces(); ++e, ++cnt)
+                {
+                    int id        = elmtToTrace[n][e]->GetElmtId();
+                    int offset    = m_trace->GetPhys_Offset(id);
+                    int nFacePts  = elmtToTrace[n][e]->GetTotPoints();
+                    int pass      = shared.size() > 0 && shared[id] ? 0 : 1;
+                    bool fwd      = m_leftAdjacentFaces[cnt];
+
+                    Array<OneD, NekDouble> face1(nFacePts), face2(nFacePts);
+                    exp3d->GetFacePhysVals(e, elmtToTrace[n][e],
+                                           probe1, face1);
+                    exp3d->GetFacePhysVals(e, elmtToTrace[n][e],
+                                           probe2, face2);
+
+                    bool copy = true;
+                    for (i = 0; i < nFacePts && copy; ++i)
                     {
-                        exp3d->GetFacePhysVals(e, elmtToTrace[n][e],
-                                                     field + phys_offset,
-                                                     e_tmp = Fwd + offset);
+                        int k = (int) (face1[i] + 0.5);
+                        copy = k >= 1 && k <= nPts && face1[i] == k &&
+                               face2[i] == (NekDouble) k*k;
                     }
-                    else
+
+                    TraceGather::InterpFace face = { n, e, fwd };
+                    lastInterp[id]    = !copy;
+                    extractInterp[id] = face;
+
+                    if (!copy)
                     {
-                        exp3d->GetFacePhysVals(e, elmtToTrace[n][e],
-                                                     field + phys_offset,
-                                                     e_tmp = Bwd + offset);
+                        gather.m_interp[pass].push_back(face);
+                        continue;
+                    }
+
+                    for (i = 0; i < nFacePts; ++i)
+                    {
+                        int src = phys_offset + (int) (face1[i] + 0.5) - 1;
+                        extractSrc[offset + i] = src;
+                        if (fwd)
+                        {
+                            fwdSrc[pass].push_back(src);
+                            fwdDst[pass].push_back(offset + i);
+                        }
+                        else
+                        {
+                            bwdSrc[pass].push_back(src);
+                            bwdDst[pass].push_back(offset + i);
+                        }
                     }
                 }
             }
-            
-            // fill boundary conditions into missing elements
-            int id1,id2 = 0;
-            cnt = 0;
+
+            gather.m_fwdOffset[0] = gather.m_bwdOffset[0] = 0;
+            for (i = 0; i < 2; ++i)
+            {
+                gather.m_fwdSrc.insert(gather.m_fwdSrc.end(),
+                                       fwdSrc[i].begin(), fwdSrc[i].end());
+                gather.m_fwdDst.insert(gather.m_fwdDst.end(),
+                                       fwdDst[i].begin(), fwdDst[i].end());
+                gather.m_bwdSrc.insert(gather.m_bwdSrc.end(),
+                                       bwdSrc[i].begin(), bwdSrc[i].end());
+                gather.m_bwdDst.insert(gather.m_bwdDst.end(),
+                                       bwdDst[i].begin(), bwdDst[i].end());
+                gather.m_fwdOffset[i+1] = gather.m_fwdSrc.size();
+                gather.m_bwdOffset[i+1] = gather.m_bwdSrc.size();
+            }
+
+            for (i = 0; i < nTraceExp; ++i)
+            {
+                if (lastInterp[i])
+                {
+                    gather.m_extractInterp.push_back(extractInterp[i]);
+                    continue;
+                }
+
+                int offset = m_trace->GetPhys_Offset(i);
+                for (j = 0; j < m_trace->GetExp(i)->GetTotPoints(); ++j)
+                {
+                    gather.m_extractSrc.push_back(extractSrc[offset + j]);
+                    gather.m_extractDst.push_back(offset + j);
+                }
+            }
+        }
+
+        /**
+         * @brief Extract the traces of pass @a pass (0 for traces exchanged
+         * with other processes, 1 for the remainder) from @a field into the
+         * forwards and backwards trace spaces.
+         */
+        void DisContField3D::GatherTracePhys(
+            const int                           pass,
+            const Array<OneD, const NekDouble> &field,
+                  Array<OneD,       NekDouble> &Fwd,
+                  Array<OneD,       NekDouble> &Bwd)
+        {
+            int i;
+            const TraceGather &gather = *m_traceGather;
+            Array<OneD, NekDouble> e_tmp;
+            Array<OneD, Array<OneD, StdRegions::StdExpansionSharedPtr> >
+                &elmtToTrace = m_traceMap->GetElmtToTrace();
+
+            for (i = gather.m_fwdOffset[pass];
+                 i < gather.m_fwdOffset[pass+1]; ++i)
+            {
+                Fwd[gather.m_fwdDst[i]] = field[gather.m_fwdSrc[i]];
+            }
+
+            for (i = gather.m_bwdOffset[pass];
+                 i < gather.m_bwdOffset[pass+1]; ++i)
+            {
+                Bwd[gather.m_bwdDst[i]] = field[gather.m_bwdSrc[i]];
+            }
+
+            for (i = 0; i < gather.m_interp[pass].size(); ++i)
+            {
+                const TraceGather::InterpFace &face = gather.m_interp[pass][i];
+                const StdRegions::StdExpansionSharedPtr &trace =
+                    elmtToTrace[face.m_elmt][face.m_face];
+                int offset = m_trace->GetPhys_Offset(trace->GetElmtId());
+
+                (*m_exp)[face.m_elmt]->GetFacePhysVals(
+                    face.m_face, trace,
+                    field + GetPhys_Offset(face.m_elmt),
+                    e_tmp = (face.m_fwd ? Fwd : Bwd) + offset);
+            }
+        }
+
+        /**
+         * @brief Fill the backwards trace space on the boundaries from the
+         * boundary conditions and copy periodic traces.
+         */
+        void DisContField3D::FillBwdWithBoundConds(
+            const Array<OneD, const NekDouble> &Fwd,
+                  Array<OneD,       NekDouble> &Bwd)
+        {
+            int n, e, npts, id1, id2;
+            int cnt = 0;
             
             for(n = 0; n < m_bndCondExpansions.num_elements(); ++n)
             {
@@ -1802,10 +2030,6 @@
             {
                 Bwd[m_periodicBwdCopy[n]] = Fwd[m_periodicFwdCopy[n]];
             }
-            
-            // Do parallel exchange for forwards/backwards spaces.
-            m_traceMap->UniversalTraceAssemble(Fwd);
-            m_traceMap->UniversalTraceAssemble(Bwd);
         }
 
         void DisContField3D::v_ExtractTracePhys(
@@ -1821,28 +2045,35 @@
             const Array<OneD, const NekDouble> &inarray,
                   Array<OneD,       NekDouble> &outarray)
         {
-            // Loop over elemente and collect forward expansion
-            int nexp = GetExpSize();
-            int n,e,offset,phys_offset;
-            Array<OneD,NekDouble> e_tmp;
+            ASSERTL1(outarray.num_elements() >= m_trace->GetNpoints(),
+                     "input array is of insufficient length");
+
+            SetUpTraceGather();
+
+            int i;
+            const TraceGather &gather = *m_traceGather;
+            Array<OneD, NekDouble> e_tmp;
             Array<OneD, Array<OneD, StdRegions::StdExpansionSharedPtr> >
                 &elmtToTrace = m_traceMap->GetElmtToTrace();
 
-            ASSERTL1(outarray.num_elements() >= m_trace->GetNpoints(),
-                     "input array is of insufficient length");
-            
-            // use m_trace tmp space in element to fill values
-            for(n = 0; n < nexp; ++n)
+            for (i = 0; i < gather.m_extractSrc.size(); ++i)
             {
-                phys_offset = GetPhys_Offset(n);
-                
-                for(e = 0; e < (*m_exp)[n]->GetNfaces(); ++e)
-                {
-                    offset = m_trace->GetPhys_Offset(elmtToTrace[n][e]->GetElmtId());
-                    (*m_exp)[n]->GetFacePhysVals(e, elmtToTrace[n][e],
-                                                 inarray + phys_offset,
-                                                 e_tmp = outarray + offset);
-                }
+                outarray[gather.m_extractDst[i]] =
+                    inarray[gather.m_extractSrc[i]];
+            }
+
+            for (i = 0; i < gather.m_extractInterp.size(); ++i)
+            {
+                const TraceGather::InterpFace &face =
+                    gather.m_extractInterp[i];
+                const StdRegions::StdExpansionSharedPtr &trace =
+                    elmtToTrace[face.m_elmt][face.m_face];
+                int offset = m_trace->GetPhys_Offset(trace->GetElmtId());
+
+                (*m_exp)[face.m_elmt]->GetFacePhysVals(
+                    face.m_face, trace,
+                    inarray + GetPhys_Offset(face.m_elmt),
+                    e_tmp = outarray + offset);
             }
         }
         
@@ -2397,7 +2628,6 @@
                                                           const NekDouble x3_in)
         {
             int i;
-            int npoints;
             int nbnd = m_bndCondExpansions.num_elements();
             MultiRegions::ExpListSharedPtr locExpList;
 
@@ -2407,14 +2637,7 @@
                    SpatialDomains::eTimeDependent)
                 {
                     locExpList = m_bndCondExpansions[i];
-                    npoints = locExpList->GetNpoints();
-                    
-                    Array<OneD,NekDouble> x0(npoints,0.0);
-                    Array<OneD,NekDouble> x1(npoints,0.0);
-                    Array<OneD,NekDouble> x2(npoints,0.0);
-                    
-                    locExpList->GetCoords(x0,x1,x2);
-                    
+
                     if(m_bndConditions[i]->GetBoundaryConditionType()
                        == SpatialDomains::eDirichlet)
                     {
@@ -2434,7 +2657,7 @@
 
                              std::vector<LibUtilities::FieldDefinitionsSharedPtr> FieldDef;
                              std::vector<std::vector<NekDouble> > FieldData;
-                             Import(filebcs,FieldDef, FieldData);
+                             locExpList->ImportCached(filebcs, FieldDef, FieldData);
 
                              // copy FieldData into locExpList
                              locExpList->ExtractDataToCoeffs(
@@ -2452,7 +2675,7 @@
                             LibUtilities::Equation  condition = boost::static_pointer_cast<
                                 SpatialDomains::DirichletBoundaryCondition >(m_bndConditions[i])->m_dirichletCondition;
                             
-                            condition.Evaluate(x0,x1,x2,time,locExpList->UpdatePhys());
+                            locExpList->EvaluateEquation(condition,time,locExpList->UpdatePhys());
                             
                             locExpList->FwdTrans_BndConstrained(locExpList->GetPhys(),
                                                                 locExpList->UpdateCoeffs());
@@ -2465,7 +2688,7 @@
                         SpatialDomains::NeumannBoundaryCondition
                             >(m_bndConditions[i])->m_neumannCondition;
                         
-                        condition.Evaluate(x0,x1,x2,time,locExpList->UpdatePhys());
+                        locExpList->EvaluateEquation(condition,time,locExpList->UpdatePhys());
                         
                         locExpList->IProductWRTBase(locExpList->GetPhys(),
                                                     locExpList->UpdateCoeffs());
@@ -2482,15 +2705,14 @@
                         SpatialDomains::RobinBoundaryCondition
                             >(m_bndConditions[i])->m_robinPrimitiveCoeff;
                         
-                        condition.Evaluate(x0,x1,x2,time,locExpList->UpdatePhys());
+                        locExpList->EvaluateEquation(condition,time,locExpList->UpdatePhys());
                         
                         locExpList->IProductWRTBase(locExpList->GetPhys(),
                                                     locExpList->UpdateCoeffs());
                         
                         // put primitive coefficient into the physical space
                         // storage
-                        coeff.Evaluate(x0,x1,x2,time,
-                                       locExpList->UpdatePhys());
+                        locExpList->EvaluateEquation(coeff,time,locExpList->UpdatePhys());
                         
                     }
                     else
@@ -134,6 +134,39 @@ namespace Nektar
              */
             vector<int> m_periodicFwdCopy;
             vector<int> m_periodicBwdCopy;
+
+            /**
+             * @brief Flat gather of the element physical values onto the
+             * trace space, built on first use by #SetUpTraceGather.
+             *
+             * Index lists are split by pass: entries [offset[0], offset[1])
+             * belong to traces exchanged with other processes and
+             * [offset[1], offset[2]) to the remainder. Faces whose points
+             * need interpolating are extracted through GetFacePhysVals.
+             */
+            struct TraceGather
+            {
+                struct InterpFace
+                {
+                    int  m_elmt;
+                    int  m_face;
+                    bool m_fwd;
+                };
+
+                int                m_fwdOffset[3];
+                int                m_bwdOffset[3];
+                vector<int>        m_fwdSrc;
+                vector<int>        m_fwdDst;
+                vector<int>        m_bwdSrc;
+                vector<int>        m_bwdDst;
+                vector<InterpFace> m_interp[2];
+                /// Gather used by #v_ExtractTracePhys, where the last
+                /// element adjacent to a trace sets its values.
+                vector<int>        m_extractSrc;
+                vector<int>        m_extractDst;
+                vector<InterpFace> m_extractInterp;
+            };
+            boost::shared_ptr<TraceGather> m_traceGather;
             
             void SetUpDG(const std::string = "DefaultVar");
             bool SameTypeOfBoundaryConditions(const DisContField3D &In);
@@ -147,6 +180,16 @@ namespace Nektar
 
             bool IsLeftAdjacentFace(const int n, const int e);
 
+            void SetUpTraceGather();
+            void GatherTracePhys(
+                const int                           pass,
+                const Array<OneD, const NekDouble> &field,
+                      Array<OneD,       NekDouble> &Fwd,
+                      Array<OneD,       NekDouble> &Bwd);
+            void FillBwdWithBoundConds(
+                const Array<OneD, const NekDouble> &Fwd,
+                      Array<OneD,       NekDouble> &Bwd);
+
             virtual void v_GetFwdBwdTracePhys(
                 Array<OneD,NekDouble> &Fwd,
                 Array<OneD,NekDouble> &Bwd);
@@ -154,6 +197,11 @@ namespace Nektar
                 const Array<OneD,const NekDouble> &field,
                       Array<OneD,      NekDouble> &Fwd,
                       Array<OneD,      NekDouble> &Bwd);
+            virtual void v_MultiGetFwdBwdTracePhys(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
             virtual void v_ExtractTracePhys(
                       Array<OneD,       NekDouble> &outarray);
             virtual void v_ExtractTracePhys(
@@ -49,6 +49,16 @@
 #include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
 #include <LibUtilities/LinearAlgebra/NekTypeDefs.hpp>
 #include <LibUtilities/LinearAlgebra/NekMatrix.hpp>
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/Thread.h>
+
+#include <SpatialDomains/Geometry2D.h>
+#include <SpatialDomains/Geometry3D.h>
+
+#include <boost/bind.hpp>
+#include <boost/functional/hash.hpp>
+#include <cmath>
+#include <sstream>
 
 
 namespace Nektar
@@ -94,6 +104,8 @@ namespace Nektar
             m_phys_offset(),
             m_offset_elmt_id(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
+            m_builtElmtLoops(MemoryManager<ElmtLoopSet>::AllocateSharedPtr()),
+            m_collections(MemoryManager<CollectionVector>::AllocateSharedPtr()),
             m_WaveSpace(false)
         {
             SetExpType(eNoType);
@@ -121,6 +133,8 @@ namespace Nektar
             m_phys_offset(),
             m_offset_elmt_id(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
+            m_builtElmtLoops(MemoryManager<ElmtLoopSet>::AllocateSharedPtr()),
+            m_collections(MemoryManager<CollectionVector>::AllocateSharedPtr()),
             m_WaveSpace(false)
         {
             SetExpType(eNoType);
@@ -149,6 +163,8 @@ namespace Nektar
             m_phys_offset(),
             m_offset_elmt_id(),
             m_blockMat(MemoryManager<BlockMatrixMap>::AllocateSharedPtr()),
+            m_builtElmtLoops(MemoryManager<ElmtLoopSet>::AllocateSharedPtr()),
+            m_collections(MemoryManager<CollectionVector>::AllocateSharedPtr()),
             m_WaveSpace(false)
         {
             SetExpType(eNoType);
@@ -172,6 +188,8 @@ namespace Nektar
             m_offset_elmt_id(in.m_offset_elmt_id),
             m_globalOptParam(in.m_globalOptParam),
             m_blockMat(in.m_blockMat),
+            m_builtElmtLoops(in.m_builtElmtLoops),
+            m_collections(in.m_collections),
             m_WaveSpace(false)
         {
             SetExpType(eNoType);
@@ -274,17 +292,524 @@ namespace Nektar
         {
             // Retrieve the block matrix using the given key.
             const DNekScalBlkMatSharedPtr& blockmat = GetBlockMatrix(gkey);
-            int nrows = blockmat->GetRows();
-            int ncols = blockmat->GetColumns();
+            int nblocks = blockmat->GetNumberOfBlockRows();
+
+            Array<OneD, int> rowOffset(nblocks+1, 0);
+            Array<OneD, int> colOffset(nblocks+1, 0);
+            for(int i = 0; i < nblocks; ++i)
+            {
+                rowOffset[i+1] = rowOffset[i]
+                               + blockmat->GetNumberOfRowsInBlockRow(i);
+                colOffset[i+1] = colOffset[i]
+                               + blockmat->GetNumberOfColumnsInBlockColumn(i);
+            }
+
+            // Perform the block matrix-vector multiplies.
+            LibUtilities::GetThreadPool().ParallelFor(nblocks,
+                boost::bind(&ExpList::MultiplyByBlockMatrix_Range, this,
+                            boost::cref(blockmat),
+                            boost::cref(rowOffset), boost::cref(colOffset),
+                            _1, _2, boost::cref(inarray), boost::ref(outarray)));
+        }
+
+        void ExpList::MultiplyByBlockMatrix_Range(
+                                const DNekScalBlkMatSharedPtr     &blockmat,
+                                const Array<OneD, const int>      &rowOffset,
+                                const Array<OneD, const int>      &colOffset,
+                                const int                          start,
+                                const int                          end,
+                                const Array<OneD,const NekDouble> &inarray,
+                                      Array<OneD,      NekDouble> &outarray)
+        {
+            for(int i = start; i < end; ++i)
+            {
+                int nrows = rowOffset[i+1] - rowOffset[i];
+                int ncols = colOffset[i+1] - colOffset[i];
+                if(nrows == 0 || ncols == 0)
+                {
+                    continue;
+                }
+
+                const DNekScalMat *block = blockmat->GetBlockPtr(i,i);
+                if(!block)
+                {
+                    Vmath::Zero(nrows, &outarray[rowOffset[i]], 1);
+                    continue;
+                }
+
+                // Create NekVectors from the given data arrays
+                NekVector<NekDouble> in (ncols, inarray + colOffset[i],
+                                         eWrapper);
+                NekVector<NekDouble> out(nrows, outarray + rowOffset[i],
+                                         eWrapper);
+
+                // Perform matrix-vector multiply.
+                Multiply(out, *block, in);
+            }
+        }
+
+
+        /**
+         * Consecutive elements (in the storage order of #m_coeffs and
+         * #m_phys) which share the same standard expansion and geometry type
+         * are grouped into a single Collection. The collections are created
+         * on first use and shared between copies of this expansion list.
+         */
+        const CollectionVector &ExpList::GetCollections()
+        {
+            if(m_collections->size() == 0 && m_exp->size() > 0)
+            {
+                LocalRegions::ExpansionVector group;
+                int coeffOffset = 0;
+                int physOffset  = 0;
+                int n, eid;
+
+                for(n = 0; n < m_exp->size(); ++n)
+                {
+                    eid = m_offset_elmt_id[n];
+                    const LocalRegions::ExpansionSharedPtr &exp = (*m_exp)[eid];
+
+                    // Start a new collection if this element is not
+                    // compatible or not contiguous with the current group.
+                    if(group.size() > 0 &&
+                       (!Collection::IsCompatible(group[0], exp) ||
+                        m_coeff_offset[eid] != coeffOffset
+                            + (int)group.size()*group[0]->GetNcoeffs() ||
+                        m_phys_offset[eid]  != physOffset
+                            + (int)group.size()*group[0]->GetTotPoints()))
+                    {
+                        m_collections->push_back(
+                            MemoryManager<Collection>::AllocateSharedPtr(
+                                group, coeffOffset, physOffset));
+                        group.clear();
+                    }
+
+                    if(group.size() == 0)
+                    {
+                        coeffOffset = m_coeff_offset[eid];
+                        physOffset  = m_phys_offset[eid];
+                    }
+                    group.push_back(exp);
+                }
+
+                m_collections->push_back(
+                    MemoryManager<Collection>::AllocateSharedPtr(
+                        group, coeffOffset, physOffset));
+            }
+
+            return *m_collections;
+        }
+
+
+        /**
+         * @param   inarray     Local coefficients of all elements.
+         * @param   outarray    Physical values at the quadrature points.
+         */
+        void ExpList::BwdTrans_Collection(
+                                const Array<OneD,const NekDouble> &inarray,
+                                      Array<OneD,      NekDouble> &outarray)
+        {
+            const CollectionVector &collections = GetCollections();
+            Array<OneD, NekDouble> tmp_outarray;
+
+            for(int n = 0; n < collections.size(); ++n)
+            {
+                collections[n]->BwdTrans(
+                    inarray + collections[n]->GetCoeffOffset(),
+                    tmp_outarray = outarray + collections[n]->GetPhysOffset());
+            }
+        }
+
+
+        /**
+         * @param   inarray     Physical values at the quadrature points.
+         * @param   outarray    Inner products with respect to the local
+         *                      basis of all elements.
+         */
+        void ExpList::IProductWRTBase_Collection(
+                                const Array<OneD,const NekDouble> &inarray,
+                                      Array<OneD,      NekDouble> &outarray)
+        {
+            const CollectionVector &collections = GetCollections();
+            Array<OneD, NekDouble> tmp_outarray;
+
+            for(int n = 0; n < collections.size(); ++n)
+            {
+                collections[n]->IProductWRTBase(
+                    inarray + collections[n]->GetPhysOffset(),
+                    tmp_outarray = outarray + collections[n]->GetCoeffOffset());
+            }
+        }
+
+
+        /**
+         * Derivatives are only evaluated for the directions for which the
+         * output array is not empty.
+         */
+        void ExpList::PhysDeriv_Collection(
+                                const Array<OneD,const NekDouble> &inarray,
+                                      Array<OneD,      NekDouble> &out_d0,
+                                      Array<OneD,      NekDouble> &out_d1,
+                                      Array<OneD,      NekDouble> &out_d2)
+        {
+            const CollectionVector &collections = GetCollections();
+            Array<OneD, NekDouble> e_out_d0;
+            Array<OneD, NekDouble> e_out_d1;
+            Array<OneD, NekDouble> e_out_d2;
+            int offset;
+
+            for(int n = 0; n < collections.size(); ++n)
+            {
+                offset = collections[n]->GetPhysOffset();
+
+                e_out_d0 = out_d0 + offset;
+                if(out_d1.num_elements())
+                {
+                    e_out_d1 = out_d1 + offset;
+                }
+                if(out_d2.num_elements())
+                {
+                    e_out_d2 = out_d2 + offset;
+                }
+                collections[n]->PhysDeriv(inarray + offset,
+                                          e_out_d0, e_out_d1, e_out_d2);
+            }
+        }
+
+
+        /**
+         * Each candidate implementation of the optimisable operations is
+         * timed on this expansion list and the fastest is retained in
+         * #m_globalOptParam. Without an assembly map the elemental,
+         * block-matrix (per shape type) and collection evaluations are
+         * compared. With an assembly map, the global matrix evaluation of
+         * the matrix operators is compared against the local evaluation
+         * followed by assembly.
+         *
+         * If an auto-tune cache file is specified the parameters are
+         * loaded from it when an entry for this mesh and expansion exists,
+         * and are stored in it otherwise.
+         *
+         * @param   locToGloMap Local to global mapping, if the global matrix
+         *                      candidates should be considered.
+         */
+        void ExpList::AutoTuneGlobalOptParam(
+            const AssemblyMapSharedPtr &locToGloMap)
+        {
+            int n, i;
+            NekDouble time, bestTime;
+            bool verbose = m_session->DefinesCmdLineArgument("verbose") &&
+                           m_comm->GetRank() == 0;
+
+            std::string key = GetAutoTuneKey();
+            if(locToGloMap)
+            {
+                key += "_CG";
+            }
+
+            if(m_globalOptParam->ImportAutoTuneCache(key))
+            {
+                if(verbose)
+                {
+                    cout << "Auto-tune: loaded parameters for " << key
+                         << " from " << m_globalOptParam->GetAutoTuneCache()
+                         << endl;
+                }
+                return;
+            }
+
+            if(!locToGloMap)
+            {
+                // Shapes may be absent on some processes, so decisions are
+                // based on the global element counts.
+                Array<OneD, int> numElmts(
+                    m_globalOptParam->GetShapeNumElements().num_elements());
+                Vmath::Vcopy(numElmts.num_elements(),
+                             m_globalOptParam->GetShapeNumElements(), 1,
+                             numElmts, 1);
+                m_comm->AllReduce(numElmts, LibUtilities::ReduceSum);
+
+                const NekOptimize::OptimizationOperationType ops[] = {
+                    NekOptimize::eBwdTrans,
+                    NekOptimize::eIProductWRTBase,
+                    NekOptimize::eMassMatrixOp,
+                    NekOptimize::eLaplacianMatrixOp,
+                    NekOptimize::eHelmholtzMatrixOp,
+                    NekOptimize::ePhysDeriv
+                };
+                const int nops = sizeof(ops)/sizeof(ops[0]);
+
+                for(i = 0; i < nops; ++i)
+                {
+                    const NekOptimize::OptimizationOperationType op = ops[i];
+
+                    m_globalOptParam->SetCollectionOp(op, false);
+                    bestTime = AutoTuneTime(op, locToGloMap);
+
+                    // Block matrices are considered shape by shape.
+                    if(op != NekOptimize::ePhysDeriv)
+                    {
+                        for(n = 0; n < numElmts.num_elements(); ++n)
+                        {
+                            if(numElmts[n] == 0)
+                            {
+                                continue;
+                            }
+
+                            m_globalOptParam->SetBlockMatOp(op, n, true);
+                            time = AutoTuneTime(op, locToGloMap);
+
+                            if(time < bestTime)
+                            {
+                                bestTime = time;
+                            }
+                            else
+                            {
+                                m_globalOptParam->SetBlockMatOp(op, n, false);
+                            }
+                        }
+                    }
+
+                    if(op == NekOptimize::eBwdTrans        ||
+                       op == NekOptimize::eIProductWRTBase ||
+                       op == NekOptimize::ePhysDeriv)
+                    {
+                        m_globalOptParam->SetCollectionOp(op, true);
+                        time = AutoTuneTime(op, locToGloMap);
+
+                        if(time < bestTime)
+                        {
+                            bestTime = time;
+                        }
+                        else
+                        {
+                            m_globalOptParam->SetCollectionOp(op, false);
+                        }
+                    }
+
+                    if(verbose)
+                    {
+                        cout << "Auto-tune: "
+                             << NekOptimize::OptimizationOperationTypeMap[op]
+                             << " " << bestTime << "s" << endl;
+                    }
+                }
+
+                // Block matrices of rejected candidates are no longer
+                // needed; those retained are regenerated on demand.
+                m_blockMat->clear();
+            }
+            else
+            {
+                const NekOptimize::OptimizationOperationType ops[] = {
+                    NekOptimize::eMassMatrixOp,
+                    NekOptimize::eLaplacianMatrixOp,
+                    NekOptimize::eHelmholtzMatrixOp
+                };
+                const int nops = sizeof(ops)/sizeof(ops[0]);
+
+                for(i = 0; i < nops; ++i)
+                {
+                    const NekOptimize::OptimizationOperationType op = ops[i];
+
+                    m_globalOptParam->SetGlobalMatOp(op, false);
+                    bestTime = AutoTuneTime(op, locToGloMap);
+
+                    m_globalOptParam->SetGlobalMatOp(op, true);
+                    time = AutoTuneTime(op, locToGloMap);
+
+                    if(time < bestTime)
+                    {
+                        bestTime = time;
+                    }
+                    else
+                    {
+                        m_globalOptParam->SetGlobalMatOp(op, false);
+                    }
 
-            // Create NekVectors from the given data arrays
-            NekVector<NekDouble> in (ncols,inarray, eWrapper);
-            NekVector<      NekDouble> out(nrows,outarray,eWrapper);
+                    if(verbose)
+                    {
+                        cout << "Auto-tune: global "
+                             << NekOptimize::OptimizationOperationTypeMap[op]
+                             << " " << bestTime << "s" << endl;
+                    }
+                }
+            }
 
-            // Perform matrix-vector multiply.
-            out = (*blockmat)*in;
+            if(m_comm->GetRank() == 0)
+            {
+                m_globalOptParam->ExportAutoTuneCache(key);
+            }
+            m_comm->Block();
         }
 
+        /**
+         * The key combines the element shapes, identifiers, vertex
+         * coordinates and basis keys of the whole (possibly partitioned)
+         * mesh, together with the number of processes. Element hashes are
+         * summed modulo a prime so that the result does not depend on the
+         * partitioning and the sum remains exact in double precision.
+         */
+        std::string ExpList::GetAutoTuneKey()
+        {
+            const NekDouble modulus = 2147483647.0;
+            NekDouble hash = 0.0;
+            int i, j;
+
+            for(i = 0; i < (*m_exp).size(); ++i)
+            {
+                LocalRegions::ExpansionSharedPtr exp = (*m_exp)[i];
+                SpatialDomains::GeometrySharedPtr geom = exp->GetGeom();
+                std::size_t seed = 0;
+
+                boost::hash_combine(seed, (int) exp->DetShapeType());
+                boost::hash_combine(seed, geom->GetGlobalID());
+
+                for(j = 0; j < exp->GetNumBases(); ++j)
+                {
+                    const LibUtilities::BasisKey bkey
+                                        = exp->GetBasis(j)->GetBasisKey();
+                    boost::hash_combine(seed, (int) bkey.GetBasisType());
+                    boost::hash_combine(seed, bkey.GetNumModes());
+                    boost::hash_combine(seed, (int) bkey.GetPointsType());
+                    boost::hash_combine(seed, bkey.GetNumPoints());
+                }
+
+                for(j = 0; j < geom->GetNumVerts(); ++j)
+                {
+                    SpatialDomains::PointGeomSharedPtr vert;
+                    if(exp->GetShapeDimension() == 2)
+                    {
+                        vert = boost::dynamic_pointer_cast<
+                            SpatialDomains::Geometry2D>(geom)->GetVertex(j);
+                    }
+                    else if(exp->GetShapeDimension() == 3)
+                    {
+                        vert = boost::dynamic_pointer_cast<
+                            SpatialDomains::Geometry3D>(geom)->GetVertex(j);
+                    }
+
+                    if(vert)
+                    {
+                        boost::hash_combine(seed, vert->x());
+                        boost::hash_combine(seed, vert->y());
+                        boost::hash_combine(seed, vert->z());
+                    }
+                }
+
+                hash = std::fmod(hash + (NekDouble)(seed % 2147483647UL),
+                                 modulus);
+            }
+
+            int nel = (*m_exp).size();
+            m_comm->AllReduce(hash, LibUtilities::ReduceSum);
+            m_comm->AllReduce(nel,  LibUtilities::ReduceSum);
+            hash = std::fmod(hash, modulus);
+
+            std::stringstream key;
+            key << "NP" << m_comm->GetSize() << "_NEL" << nel << "_"
+                << std::hex << (unsigned long) hash;
+            return key.str();
+        }
+
+        /**
+         * The operation is evaluated once to generate any matrices it
+         * requires, once to estimate its cost, and then repeatedly for
+         * approximately 0.02 seconds. The maximum time over all processes
+         * is returned so that every process makes the same choice.
+         *
+         * @param   op          Operation to time.
+         * @param   locToGloMap If defined, matrix operators are evaluated
+         *                      in global coefficient space.
+         * @returns Time per evaluation in seconds.
+         */
+        NekDouble ExpList::AutoTuneTime(
+            const NekOptimize::OptimizationOperationType op,
+            const AssemblyMapSharedPtr                  &locToGloMap)
+        {
+            int i, r;
+            StdRegions::MatrixType mtype = StdRegions::eMass;
+            StdRegions::ConstFactorMap factors;
+
+            switch(op)
+            {
+            case NekOptimize::eLaplacianMatrixOp:
+                mtype = StdRegions::eLaplacian;
+                break;
+            case NekOptimize::eHelmholtzMatrixOp:
+                mtype = StdRegions::eHelmholtz;
+                factors[StdRegions::eFactorLambda] = 1.0;
+                break;
+            default:
+                break;
+            }
+            GlobalMatrixKey gkey(mtype, locToGloMap, factors);
+
+            int nmax = max(m_ncoeffs, m_npoints);
+            Array<OneD, NekDouble> inarray (nmax, 1.0);
+            Array<OneD, NekDouble> outarray(nmax, 0.0);
+
+            // The list may be empty on some processes, so all three
+            // derivative directions are allocated.
+            Array<OneD, Array<OneD, NekDouble> > deriv(3);
+            for(i = 0; i < 3; ++i)
+            {
+                deriv[i] = Array<OneD, NekDouble>(m_npoints, 0.0);
+            }
+
+            Timer     timer;
+            NekDouble elapsed = 0.0;
+            int       nrep    = 1;
+
+            for(int stage = 0; stage < 3; ++stage)
+            {
+                timer.Start();
+                for(r = 0; r < nrep; ++r)
+                {
+                    switch(op)
+                    {
+                    case NekOptimize::eBwdTrans:
+                        BwdTrans_IterPerExp(inarray, outarray);
+                        break;
+                    case NekOptimize::eIProductWRTBase:
+                        IProductWRTBase_IterPerExp(inarray, outarray);
+                        break;
+                    case NekOptimize::ePhysDeriv:
+                        PhysDeriv(inarray, deriv[0], deriv[1], deriv[2]);
+                        break;
+                    case NekOptimize::eMassMatrixOp:
+                    case NekOptimize::eLaplacianMatrixOp:
+                    case NekOptimize::eHelmholtzMatrixOp:
+                        if(locToGloMap)
+                        {
+                            GeneralMatrixOp(gkey, inarray, outarray, eGlobal);
+                        }
+                        else
+                        {
+                            GeneralMatrixOp_IterPerExp(gkey, inarray,
+                                                       outarray);
+                        }
+                        break;
+                    default:
+                        ASSERTL0(false, "Auto-tuning not set up for this "
+                                        "operation.");
+                        break;
+                    }
+                }
+                timer.Stop();
+                elapsed = timer.TimePerTest(nrep);
+
+                if(stage == 1)
+                {
+                    m_comm->AllReduce(elapsed, LibUtilities::ReduceMax);
+                    nrep = (int) min(100.0,
+                                     max(1.0, 0.02/max(elapsed, 1.0e-9)));
+                }
+            }
+
+            m_comm->AllReduce(elapsed, LibUtilities::ReduceMax);
+            return elapsed;
+        }
 
         /**
          * The operation is evaluated locally for every element by the function
@@ -301,6 +826,13 @@ namespace Nektar
                                 const Array<OneD, const NekDouble> &inarray,
                                       Array<OneD,       NekDouble> &outarray)
         {
+            if(m_globalOptParam &&
+               m_globalOptParam->DoCollectionOp(NekOptimize::eIProductWRTBase))
+            {
+                IProductWRTBase_Collection(inarray,outarray);
+                return;
+            }
+
             // get optimisation information about performing block
             // matrix multiplies
             const Array<OneD, const bool>  doBlockMatOp
@@ -327,17 +859,35 @@ namespace Nektar
                 }
                 else
                 {
-                    int    i;
-                    for(i = 0; i < num_elmts[n]; ++i)
-                    {
-                        eid = m_offset_elmt_id[cnt++];
-                        (*m_exp)[eid]->IProductWRTBase(inarray+m_phys_offset[eid],
-                                                       tmp_outarray = outarray+m_coeff_offset[eid]);
-                    }
+                    ElmtParallelFor(
+                        GlobalMatrixKey(StdRegions::eIProductWRTBase, shape[n]),
+                        cnt, num_elmts[n],
+                        boost::bind(&ExpList::IProductWRTBase_ElmtRange, this,
+                                    cnt, _1, _2, boost::cref(inarray),
+                                    boost::ref(outarray)));
+                    cnt += num_elmts[n];
                 }
             }
         }
 
+        void ExpList::IProductWRTBase_ElmtRange(
+                                const int                          offset,
+                                const int                          start,
+                                const int                          end,
+                                const Array<OneD,const NekDouble> &inarray,
+                                      Array<OneD,      NekDouble> &outarray)
+        {
+            Array<OneD,NekDouble> tmp_outarray;
+            int eid;
+
+            for(int i = offset + start; i < offset + end; ++i)
+            {
+                eid = m_offset_elmt_id[i];
+                (*m_exp)[eid]->IProductWRTBase(inarray+m_phys_offset[eid],
+                                               tmp_outarray = outarray+m_coeff_offset[eid]);
+            }
+        }
+
         /**
          * The operation is evaluated locally for every element by the function
          * StdRegions#StdExpansion#IProductWRTDerivBase.
@@ -404,13 +954,34 @@ namespace Nektar
                                   Array<OneD, NekDouble> &out_d0,
                                   Array<OneD, NekDouble> &out_d1,
                                   Array<OneD, NekDouble> &out_d2)
+        {
+            if(m_globalOptParam &&
+               m_globalOptParam->DoCollectionOp(NekOptimize::ePhysDeriv))
+            {
+                PhysDeriv_Collection(inarray,out_d0,out_d1,out_d2);
+                return;
+            }
+
+            LibUtilities::GetThreadPool().ParallelFor((*m_exp).size(),
+                boost::bind(&ExpList::PhysDeriv_ElmtRange, this, _1, _2,
+                            boost::cref(inarray), boost::ref(out_d0),
+                            boost::ref(out_d1), boost::ref(out_d2)));
+        }
+
+        void ExpList::PhysDeriv_ElmtRange(
+                                const int                          start,
+                                const int                          end,
+                                const Array<OneD,const NekDouble> &inarray,
+                                      Array<OneD,      NekDouble> &out_d0,
+                                      Array<OneD,      NekDouble> &out_d1,
+                                      Array<OneD,      NekDouble> &out_d2)
         {
             int  i;
             Array<OneD, NekDouble> e_out_d0;
             Array<OneD, NekDouble> e_out_d1;
             Array<OneD, NekDouble> e_out_d2;
 
-            for(i= 0; i < (*m_exp).size(); ++i)
+            for(i= start; i < end; ++i)
             {
                 e_out_d0 = out_d0 + m_phys_offset[i];
                 if(out_d1.num_elements())
@@ -773,34 +1344,51 @@ namespace Nektar
                 }
                 else
                 {
-                    int i;
-                    int nvarcoeffs = gkey.GetNVarCoeffs();
-
-                    for(i= 0; i < num_elmts[n]; ++i)
-                    {
-                        // need to be initialised with zero size for non variable coefficient case
-                        StdRegions::VarCoeffMap varcoeffs;
+                    ElmtParallelFor(gkey, cnt, num_elmts[n],
+                        boost::bind(&ExpList::GeneralMatrixOp_ElmtRange, this,
+                                    boost::cref(gkey), cnt, _1, _2,
+                                    boost::cref(inarray),
+                                    boost::ref(outarray)));
+                    cnt += num_elmts[n];
+                }
+            }
+        }
 
-                        eid = m_offset_elmt_id[cnt++];
-                        if(nvarcoeffs>0)
-                        {
-                            StdRegions::VarCoeffMap::const_iterator x;
-                            for (x = gkey.GetVarCoeffs().begin(); x != gkey.GetVarCoeffs().end(); ++x)
-                            {
-                                varcoeffs[x->first] = x->second + m_phys_offset[eid];
-                            }
-                        }
+        void ExpList::GeneralMatrixOp_ElmtRange(
+                                const GlobalMatrixKey             &gkey,
+                                const int                          offset,
+                                const int                          start,
+                                const int                          end,
+                                const Array<OneD,const NekDouble> &inarray,
+                                      Array<OneD,      NekDouble> &outarray)
+        {
+            Array<OneD,NekDouble> tmp_outarray;
+            int nvarcoeffs = gkey.GetNVarCoeffs();
+            int eid;
 
-                        StdRegions::StdMatrixKey mkey(gkey.GetMatrixType(),
-                                                      (*m_exp)[eid]->DetShapeType(),
-                                                      *((*m_exp)[eid]),
-                                                      gkey.GetConstFactors(),varcoeffs);
+            for(int i = offset + start; i < offset + end; ++i)
+            {
+                // need to be initialised with zero size for non variable coefficient case
+                StdRegions::VarCoeffMap varcoeffs;
 
-                        (*m_exp)[eid]->GeneralMatrixOp(inarray + m_coeff_offset[eid],
-                                                       tmp_outarray = outarray+m_coeff_offset[eid],
-                                                       mkey);
+                eid = m_offset_elmt_id[i];
+                if(nvarcoeffs>0)
+                {
+                    StdRegions::VarCoeffMap::const_iterator x;
+                    for (x = gkey.GetVarCoeffs().begin(); x != gkey.GetVarCoeffs().end(); ++x)
+                    {
+                        varcoeffs[x->first] = x->second + m_phys_offset[eid];
                     }
                 }
+
+                StdRegions::StdMatrixKey mkey(gkey.GetMatrixType(),
+                                              (*m_exp)[eid]->DetShapeType(),
+                                              *((*m_exp)[eid]),
+                                              gkey.GetConstFactors(),varcoeffs);
+
+                (*m_exp)[eid]->GeneralMatrixOp(inarray + m_coeff_offset[eid],
+                                               tmp_outarray = outarray+m_coeff_offset[eid],
+                                               mkey);
             }
         }
 
@@ -1148,6 +1736,13 @@ namespace Nektar
         void ExpList::v_BwdTrans_IterPerExp(const Array<OneD, const NekDouble> &inarray,
 											Array<OneD, NekDouble> &outarray)
         {
+            if(m_globalOptParam &&
+               m_globalOptParam->DoCollectionOp(NekOptimize::eBwdTrans))
+            {
+                BwdTrans_Collection(inarray,outarray);
+                return;
+            }
+
             // get optimisation information about performing block
             // matrix multiplies
             const Array<OneD, const bool>  doBlockMatOp
@@ -1173,18 +1768,69 @@ namespace Nektar
                 }
                 else
                 {
-                    int  i;
-
-                    for(i= 0; i < num_elmts[n]; ++i)
-                    {
-                        eid = m_offset_elmt_id[cnt++];
-                        (*m_exp)[eid]->BwdTrans(inarray + m_coeff_offset[eid],
-                                   tmp_outarray = outarray+m_phys_offset[eid]);
-                    }
+                    ElmtParallelFor(
+                        GlobalMatrixKey(StdRegions::eBwdTrans, shape[n]),
+                        cnt, num_elmts[n],
+                        boost::bind(&ExpList::BwdTrans_ElmtRange, this,
+                                    cnt, _1, _2, boost::cref(inarray),
+                                    boost::ref(outarray)));
+                    cnt += num_elmts[n];
                 }
             }
         }
 
+        /**
+         * Elements build matrices and other data on first use, some of
+         * which, such as bases, points and geometric factors, is shared
+         * with other elements. The first evaluation of each loop is
+         * therefore serial, so that this data is never built by several
+         * threads at once, and only later evaluations use the pool.
+         * Physical derivatives only read data built with the points or
+         * guarded by the geometric factors, and always use the pool.
+         *
+         * @param   key         Matrix key identifying the loop.
+         * @param   offset      Position in #m_offset_elmt_id of the first
+         *                      element of the loop.
+         * @param   n           Number of elements.
+         * @param   func        Function evaluating the elements in the
+         *                      range [start, end) relative to @a offset.
+         */
+        void ExpList::ElmtParallelFor(
+                                const GlobalMatrixKey               &key,
+                                const int                            offset,
+                                const int                            n,
+                                const LibUtilities::ThreadRangeFunc &func)
+        {
+            LibUtilities::ThreadPool &pool = LibUtilities::GetThreadPool();
+
+            if (pool.GetNumThreads() > 1 &&
+                m_builtElmtLoops->insert(std::make_pair(key, offset)).second)
+            {
+                func(0, n);
+                return;
+            }
+
+            pool.ParallelFor(n, func);
+        }
+
+        void ExpList::BwdTrans_ElmtRange(
+                                const int                          offset,
+                                const int                          start,
+                                const int                          end,
+                                const Array<OneD,const NekDouble> &inarray,
+                                      Array<OneD,      NekDouble> &outarray)
+        {
+            Array<OneD,NekDouble> tmp_outarray;
+            int eid;
+
+            for(int i = offset + start; i < offset + end; ++i)
+            {
+                eid = m_offset_elmt_id[i];
+                (*m_exp)[eid]->BwdTrans(inarray + m_coeff_offset[eid],
+                                        tmp_outarray = outarray+m_phys_offset[eid]);
+            }
+        }
+
         LocalRegions::ExpansionSharedPtr& ExpList::GetExp(
                     const Array<OneD, const NekDouble> &gloCoord)
         {
@@ -1208,50 +1854,137 @@ namespace Nektar
          */
         int ExpList::GetExpIndex(
                                  const Array<OneD, const NekDouble> &gloCoord,
-                                 NekDouble tol)
+                                 NekDouble tol,
+                                 bool returnNearest)
         {
             Array<OneD, NekDouble> Lcoords(gloCoord.num_elements()); 
             
-            return GetExpIndex(gloCoord,Lcoords,tol);
+            return GetExpIndex(gloCoord,Lcoords,tol,returnNearest);
         }
         
 
+        /**
+         * The elements whose bounding box contains the point are found
+         * from #m_pointLocator, which is built on the first call, and only
+         * these are tested. If none of them contains the point, -1 is
+         * returned; points outside the bounding box of all local elements,
+         * e.g. those held by other processes, are rejected without testing
+         * any element. Only if \a returnNearest is set are all elements
+         * searched and the element with the smallest residual returned.
+         */
         int ExpList::GetExpIndex(const Array<OneD, const NekDouble> &gloCoords,
                                  Array<OneD, NekDouble> &locCoords,
-                                 NekDouble tol)
+                                 NekDouble tol,
+                                 bool returnNearest)
         {
-            static int start = 0;
-            NekDouble resid, min_resid = NekConstants::kNekMinResidInit;
-            int min_elmt;
-            Array<OneD, NekDouble> min_locCoords(locCoords.num_elements());
+            NekDouble resid;
 
-            // start search at previous element or 0 
-            for (int i = start; i < (*m_exp).size(); ++i)
+            if (!m_pointLocator)
             {
-                if ((*m_exp)[i]->GetGeom()->ContainsPoint(gloCoords, locCoords,
-                                                          tol, resid))
+                m_pointLocator = MemoryManager<PointLocator>
+                    ::AllocateSharedPtr(*m_exp);
+            }
+
+            int elmt = m_pointLocator->FindElement(gloCoords, locCoords,
+                                                   tol, resid);
+            if (elmt >= 0 || !returnNearest)
+            {
+                return elmt;
+            }
+
+            return GetExpIndexNearest(gloCoords, locCoords, tol);
+        }
+
+
+        /**
+         * Points are located in turn, testing the element found for the
+         * previous point first since consecutive points are usually close.
+         */
+        void ExpList::GetExpIndices(
+            const Array<OneD, const Array<OneD, NekDouble> > &gloCoords,
+                  Array<OneD, int>                           &elmtIds,
+                  Array<OneD, Array<OneD, NekDouble> >       &locCoords,
+            NekDouble tol,
+            bool returnNearest)
+        {
+            int i, d;
+            int dim  = gloCoords.num_elements();
+            int npts = dim > 0 ? gloCoords[0].num_elements() : 0;
+            int hint = -1;
+            NekDouble resid;
+
+            Array<OneD, NekDouble> gloPt(3, 0.0);
+            Array<OneD, NekDouble> locPt(3, 0.0);
+
+            if (!m_pointLocator)
+            {
+                m_pointLocator = MemoryManager<PointLocator>
+                    ::AllocateSharedPtr(*m_exp);
+            }
+
+            if (elmtIds.num_elements() < npts)
+            {
+                elmtIds = Array<OneD, int>(npts);
+            }
+
+            if (locCoords.num_elements() < 3)
+            {
+                locCoords = Array<OneD, Array<OneD, NekDouble> >(3);
+            }
+
+            for (d = 0; d < 3; ++d)
+            {
+                if (locCoords[d].num_elements() < npts)
                 {
-                    start = i;
-                    return i;
+                    locCoords[d] = Array<OneD, NekDouble>(npts, 0.0);
                 }
-                else
+            }
+
+            for (i = 0; i < npts; ++i)
+            {
+                for (d = 0; d < dim; ++d)
                 {
-                    if(resid < min_resid)
-                    {
-                        min_resid = resid;
-                        min_elmt  = i;
-                        Vmath::Vcopy(locCoords.num_elements(), locCoords,    1,
-                                                               min_locCoords,1);
-                    }
+                    gloPt[d] = gloCoords[d][i];
+                }
+
+                int elmt = m_pointLocator->FindElement(gloPt, locPt, tol,
+                                                       resid, hint);
+                if (elmt < 0 && returnNearest)
+                {
+                    elmt = GetExpIndexNearest(gloPt, locPt, tol);
+                }
+
+                elmtIds[i] = elmt;
+                if (elmt >= 0)
+                {
+                    hint = elmt;
+                }
+                for (d = 0; d < 3; ++d)
+                {
+                    locCoords[d][i] = locPt[d];
                 }
             }
+        }
+
 
-            for (int i = 0; i < start; ++i)
+        /**
+         * Tests every element and returns the element with the smallest
+         * residual if none contains the point.
+         */
+        int ExpList::GetExpIndexNearest(
+            const Array<OneD, const NekDouble> &gloCoords,
+                  Array<OneD, NekDouble>       &locCoords,
+            NekDouble tol)
+        {
+            NekDouble resid, min_resid = NekConstants::kNekMinResidInit;
+            int min_elmt = 0;
+            Array<OneD, NekDouble> min_locCoords(locCoords.num_elements());
+
+            for (int i = 0; i < (*m_exp).size(); ++i)
             {
                 if ((*m_exp)[i]->GetGeom()->ContainsPoint(gloCoords, locCoords,
-                                                          tol,resid))
+                                                          tol, resid))
                 {
-                    start = i;
                     return i;
                 }
                 else
@@ -1265,7 +1998,7 @@ namespace Nektar
                     }
                 }
             }
-            
+
             std::string msg = "Failed to find point in element to tolerance of "
                                 + boost::lexical_cast<std::string>(resid)
                                 + " using nearest point found";
@@ -1924,6 +2657,77 @@ namespace Nektar
 
         }
         
+        /**
+         * Boundary conditions and forcing functions are evaluated on the
+         * same quadrature points at every time step, so from the second
+         * call onwards the values of the subexpressions of @a eqn which do
+         * not depend on time are kept and only the time-dependent ones are
+         * recomputed. The first call evaluates @a eqn directly, since
+         * initial conditions and steady boundary conditions are evaluated
+         * only once. If @a x2_in is set it replaces the third coordinate,
+         * as on the planes of a homogeneous expansion.
+         */
+        void ExpList::EvaluateEquation(
+            const LibUtilities::Equation &eqn,
+            const NekDouble               time,
+                  Array<OneD, NekDouble> &outarray,
+            const NekDouble               x2_in)
+        {
+            EquationCache &entry = m_equationCache[
+                EquationCacheKey(eqn.GetExpression(), x2_in)];
+
+            if (entry.m_calls < 2)
+            {
+                Array<OneD, NekDouble> x0(m_npoints, 0.0);
+                Array<OneD, NekDouble> x1(m_npoints, 0.0);
+                Array<OneD, NekDouble> x2(m_npoints, 0.0);
+
+                GetCoords(x0, x1, x2);
+                if (x2_in != NekConstants::kNekUnsetDouble)
+                {
+                    Vmath::Fill(m_npoints, x2_in, x2, 1);
+                }
+
+                if (++entry.m_calls < 2)
+                {
+                    eqn.Evaluate(x0, x1, x2, time, outarray);
+                    return;
+                }
+
+                eqn.EvaluateSpatial(x0, x1, x2, entry.m_values);
+            }
+
+            eqn.EvaluateCached(m_npoints, entry.m_values, time, outarray);
+        }
+
+        /**
+         * File-based boundary conditions and functions are re-evaluated at
+         * every time step, but the file is only read on the first call.
+         */
+        void ExpList::ImportCached(
+            const std::string &fileName,
+            std::vector<LibUtilities::FieldDefinitionsSharedPtr> &fielddefs,
+            std::vector<std::vector<NekDouble> >                 &fielddata)
+        {
+            std::map<std::string, std::pair<
+                std::vector<LibUtilities::FieldDefinitionsSharedPtr>,
+                std::vector<std::vector<NekDouble> > > >::iterator it =
+                    m_importCache.find(fileName);
+
+            if (it == m_importCache.end())
+            {
+                it = m_importCache.insert(make_pair(fileName, make_pair(
+                    std::vector<LibUtilities::FieldDefinitionsSharedPtr>(),
+                    std::vector<std::vector<NekDouble> >()))).first;
+
+                LibUtilities::FieldIO f(m_session->GetComm());
+                f.Import(fileName, it->second.first, it->second.second);
+            }
+
+            fielddefs = it->second.first;
+            fielddata = it->second.second;
+        }
+
         /// Extract the data in fielddata into the coeffs
         void ExpList::ExtractDataToCoeffs(
                                    LibUtilities::FieldDefinitionsSharedPtr &fielddef,
@@ -2167,6 +2971,18 @@ namespace Nektar
                      "This method is not defined or valid for this class type");
         }
 
+        void ExpList::v_MultiGetFwdBwdTracePhys(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd)
+        {
+            for (int i = 0; i < fields.num_elements(); ++i)
+            {
+                fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
+            }
+        }
+
         void ExpList::v_ExtractTracePhys(Array<OneD,NekDouble> &outarray)
         {
             ASSERTL0(false,
@@ -2200,6 +3016,25 @@ namespace Nektar
         {
             ASSERTL0(false, "HelmSolve not implemented.");
         }
+
+        /**
+         * Solves each field in turn. Continuous expansions override this to
+         * solve all fields together.
+         */
+        void ExpList::v_MultiHelmSolve(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff)
+        {
+            for (int i = 0; i < fields.num_elements(); ++i)
+            {
+                fields[i]->HelmSolve(inarray[i], outarray[i], flags, factors,
+                                     varcoeff);
+            }
+        }
 		
         void ExpList::v_LinearAdvectionDiffusionReactionSolve(
                        const Array<OneD, Array<OneD, NekDouble> > &velocity,
@@ -39,19 +39,25 @@
 #include <MultiRegions/MultiRegionsDeclspec.h>
 #include <LibUtilities/Communication/Comm.h>
 #include <LibUtilities/BasicUtils/SessionReader.h>
+#include <LibUtilities/BasicUtils/Equation.h>
 #include <MultiRegions/MultiRegions.hpp>
 #include <LocalRegions/Expansion.h>
 #include <MultiRegions/GlobalMatrix.h>
 #include <MultiRegions/GlobalMatrixKey.h>
 #include <SpatialDomains/MeshGraph.h>
 #include <MultiRegions/GlobalOptimizationParameters.h>
+#include <MultiRegions/Collection.h>
+#include <MultiRegions/PointLocator.h>
 #include <boost/enable_shared_from_this.hpp>
 #include <MultiRegions/AssemblyMap/AssemblyMap.h>
 
 #include <LibUtilities/Communication/Transposition.h>
+#include <LibUtilities/BasicUtils/Thread.h>
 
 #include <tinyxml/tinyxml.h>
 
+#include <set>
+
 namespace Nektar
 {
     namespace MultiRegions
@@ -96,6 +102,9 @@ namespace Nektar
         typedef map<GlobalMatrixKey,DNekScalBlkMatSharedPtr> BlockMatrixMap;
         /// A shared pointer to a BlockMatrixMap.
         typedef boost::shared_ptr<BlockMatrixMap> BlockMatrixMapShPtr;
+        /// A set of elemental loops, identified by a matrix key and the
+        /// position of their first element.
+        typedef std::set<std::pair<GlobalMatrixKey, int> > ElmtLoopSet;
 			       
 
         /// Base class for all multi-elemental spectral/hp expansions.
@@ -266,6 +275,17 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing =
                                 NullNekDouble1DArray);
 
+            /// Solve the helmholtz problem of this expansion for several
+            /// fields which share its operator
+            inline void HelmSolve(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff =
+                                StdRegions::NullVarCoeffMap);
+
             /// Solve Advection Diffusion Reaction
             inline void LinearAdvectionDiffusionReactionSolve(
                 const Array<OneD, Array<OneD, NekDouble> > &velocity,
@@ -578,11 +598,14 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &gloCoord);
 
             /** This function returns the index of the local elemental
-             * expansion containing the arbitrary point given by \a gloCoord.
+             * expansion containing the arbitrary point given by \a gloCoord,
+             * or -1 if no element contains it. If \a returnNearest is set,
+             * the element nearest to the point is returned instead of -1.
              **/
             MULTI_REGIONS_EXPORT int GetExpIndex(
                 const Array<OneD, const NekDouble> &gloCoord,
-                NekDouble tol = 0.0);
+                NekDouble tol = 0.0,
+                bool returnNearest = false);
 
             /** This function returns the index and the Local
              * Cartesian Coordinates \a locCoords of the local
@@ -592,7 +615,22 @@ namespace Nektar
             MULTI_REGIONS_EXPORT int GetExpIndex(
                 const Array<OneD, const NekDouble> &gloCoords, 
                       Array<OneD, NekDouble>       &locCoords,
-                NekDouble tol = 0.0);
+                NekDouble tol = 0.0,
+                bool returnNearest = false);
+
+            /** This function returns the indices and local coordinates of
+             * the elemental expansions containing a set of points. The
+             * coordinates are given per direction, i.e. \a gloCoords[d][i]
+             * is the d-th coordinate of point i, and \a locCoords follows
+             * the same layout. Points outside all elements are given the
+             * index -1, unless \a returnNearest is set.
+             **/
+            MULTI_REGIONS_EXPORT void GetExpIndices(
+                const Array<OneD, const Array<OneD, NekDouble> > &gloCoords,
+                      Array<OneD, int>                           &elmtIds,
+                      Array<OneD, Array<OneD, NekDouble> >       &locCoords,
+                NekDouble tol = 0.0,
+                bool returnNearest = false);
 
             /// Get the start offset position for a global list of #m_coeffs
             /// correspoinding to element n.
@@ -692,6 +730,14 @@ namespace Nektar
                       Array<OneD,NekDouble> &Fwd,
                       Array<OneD,NekDouble> &Bwd);
 
+            /// Extract the forwards and backwards trace spaces of several
+            /// fields which share the trace of this expansion
+            inline void GetFwdBwdTracePhys(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+
             inline void ExtractTracePhys(Array<OneD,NekDouble> &outarray);
 
             inline void ExtractTracePhys(
@@ -709,6 +755,20 @@ namespace Nektar
                 const NekDouble = NekConstants::kNekUnsetDouble,
                 const NekDouble = NekConstants::kNekUnsetDouble);
 
+            /// Evaluates an expression at the quadrature points, reusing its
+            /// time-independent part on repeated calls.
+            MULTI_REGIONS_EXPORT void EvaluateEquation(
+                const LibUtilities::Equation &eqn,
+                const NekDouble               time,
+                      Array<OneD, NekDouble> &outarray,
+                const NekDouble               x2_in =
+                                                NekConstants::kNekUnsetDouble);
+
+            /// Imports a field file, keeping its contents for repeated calls.
+            MULTI_REGIONS_EXPORT void ImportCached(
+                const std::string &fileName,
+                std::vector<LibUtilities::FieldDefinitionsSharedPtr> &fielddefs,
+                std::vector<std::vector<NekDouble> >                 &fielddata);
 
             // Routines for continous matrix solution
             /// This function calculates the result of the multiplication of a
@@ -958,12 +1018,51 @@ namespace Nektar
             NekOptimize::GlobalOptParamSharedPtr m_globalOptParam;
 
             BlockMatrixMapShPtr  m_blockMat;
+
+            /// Elemental loops, identified by a matrix key and the position
+            /// of their first element, which have already been evaluated
+            /// once. Shared with copies, which hold the same elements.
+            boost::shared_ptr<ElmtLoopSet> m_builtElmtLoops;
+
+            /// Groups of consecutive elements sharing the same standard
+            /// expansion and geometry type, created on first use.
+            CollectionVectorShPtr m_collections;
+
+            /// Bounding box bins of the elements used to locate points,
+            /// created on first use.
+            PointLocatorSharedPtr m_pointLocator;
+
+            /// Time-independent part of an expression evaluated by
+            /// #EvaluateEquation at the quadrature points.
+            struct EquationCache
+            {
+                EquationCache() : m_calls(0) {}
+
+                int                    m_calls;
+                Array<OneD, NekDouble> m_values;
+            };
+            typedef std::pair<std::string, NekDouble> EquationCacheKey;
+
+            /// Cached expressions, keyed by expression and homogeneous
+            /// coordinate.
+            std::map<EquationCacheKey, EquationCache> m_equationCache;
+
+            /// Contents of the files read by #ImportCached.
+            std::map<std::string, std::pair<
+                std::vector<LibUtilities::FieldDefinitionsSharedPtr>,
+                std::vector<std::vector<NekDouble> > > > m_importCache;
 			
             //@todo should this be in ExpList or ExpListHomogeneous1D.cpp
             // it's a bool which determine if the expansion is in the wave space (coefficient space)
             // or not
             bool m_WaveSpace;
 			
+            /// Locates a point by testing all elements.
+            int GetExpIndexNearest(
+                const Array<OneD, const NekDouble> &gloCoords,
+                      Array<OneD, NekDouble>       &locCoords,
+                NekDouble tol);
+
             /// This function assembles the block diagonal matrix of local
             /// matrices of the type \a mtype.
             const DNekScalBlkMatSharedPtr GenBlockMatrix(
@@ -977,6 +1076,102 @@ namespace Nektar
                 const Array<OneD,const NekDouble> &inarray,
                       Array<OneD,      NekDouble> &outarray);
 
+            /// Multiplies the diagonal blocks [start, end) of a block
+            /// matrix.
+            void MultiplyByBlockMatrix_Range(
+                const DNekScalBlkMatSharedPtr     &blockmat,
+                const Array<OneD, const int>      &rowOffset,
+                const Array<OneD, const int>      &colOffset,
+                const int                          start,
+                const int                          end,
+                const Array<OneD,const NekDouble> &inarray,
+                      Array<OneD,      NekDouble> &outarray);
+
+            /// Evaluates an elemental loop on the thread pool, serially
+            /// the first time it is run.
+            void ElmtParallelFor(
+                const GlobalMatrixKey                 &key,
+                const int                              offset,
+                const int                              n,
+                const LibUtilities::ThreadRangeFunc   &func);
+
+            /// Elemental backward transformation of the elements at
+            /// positions [offset+start, offset+end) of #m_offset_elmt_id.
+            void BwdTrans_ElmtRange(
+                const int                          offset,
+                const int                          start,
+                const int                          end,
+                const Array<OneD,const NekDouble> &inarray,
+                      Array<OneD,      NekDouble> &outarray);
+
+            /// Elemental inner product of the elements at positions
+            /// [offset+start, offset+end) of #m_offset_elmt_id.
+            void IProductWRTBase_ElmtRange(
+                const int                          offset,
+                const int                          start,
+                const int                          end,
+                const Array<OneD,const NekDouble> &inarray,
+                      Array<OneD,      NekDouble> &outarray);
+
+            /// Elemental physical derivatives of the elements [start, end).
+            void PhysDeriv_ElmtRange(
+                const int                          start,
+                const int                          end,
+                const Array<OneD,const NekDouble> &inarray,
+                      Array<OneD,      NekDouble> &out_d0,
+                      Array<OneD,      NekDouble> &out_d1,
+                      Array<OneD,      NekDouble> &out_d2);
+
+            /// Elemental matrix operation of the elements at positions
+            /// [offset+start, offset+end) of #m_offset_elmt_id.
+            void GeneralMatrixOp_ElmtRange(
+                const GlobalMatrixKey             &gkey,
+                const int                          offset,
+                const int                          start,
+                const int                          end,
+                const Array<OneD,const NekDouble> &inarray,
+                      Array<OneD,      NekDouble> &outarray);
+
+            /// Returns the multi-element collections of this expansion
+            /// list, creating them if necessary.
+            const CollectionVector &GetCollections();
+
+            /// Evaluates the backward transformation using the
+            /// multi-element collections.
+            void BwdTrans_Collection(
+                const Array<OneD,const NekDouble> &inarray,
+                      Array<OneD,      NekDouble> &outarray);
+
+            /// Evaluates the inner product with respect to the basis using
+            /// the multi-element collections.
+            void IProductWRTBase_Collection(
+                const Array<OneD,const NekDouble> &inarray,
+                      Array<OneD,      NekDouble> &outarray);
+
+            /// Evaluates the physical derivatives using the multi-element
+            /// collections.
+            void PhysDeriv_Collection(
+                const Array<OneD,const NekDouble> &inarray,
+                      Array<OneD,      NekDouble> &out_d0,
+                      Array<OneD,      NekDouble> &out_d1,
+                      Array<OneD,      NekDouble> &out_d2);
+
+            /// Selects the evaluation strategy of each optimisable operation
+            /// by timing the candidate implementations on this expansion.
+            void AutoTuneGlobalOptParam(
+                const AssemblyMapSharedPtr &locToGloMap
+                                            = NullAssemblyMapSharedPtr);
+
+            /// Identifier of the mesh and expansion used to index the
+            /// auto-tune cache.
+            std::string GetAutoTuneKey();
+
+            /// Time per evaluation of an operation with the current
+            /// optimisation parameters.
+            NekDouble AutoTuneTime(
+                const NekOptimize::OptimizationOperationType op,
+                const AssemblyMapSharedPtr                  &locToGloMap);
+
             /// Generates a global matrix from the given key and map.
             boost::shared_ptr<GlobalMatrix>  GenGlobalMatrix(
                 const GlobalMatrixKey &mkey,
@@ -1066,6 +1261,12 @@ namespace Nektar
                       Array<OneD,NekDouble> &Fwd,
                       Array<OneD,NekDouble> &Bwd);
 
+            virtual void v_MultiGetFwdBwdTracePhys(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                      Array<OneD,       Array<OneD, NekDouble> > &Bwd);
+
             virtual void v_ExtractTracePhys(
                 Array<OneD,NekDouble> &outarray);
 
@@ -1086,6 +1287,14 @@ namespace Nektar
                 const StdRegions::VarCoeffMap &varcoeff,
                 const Array<OneD, const NekDouble> &dirForcing);
 
+            virtual void v_MultiHelmSolve(
+                const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+                const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                      Array<OneD,       Array<OneD, NekDouble> > &outarray,
+                const FlagList &flags,
+                const StdRegions::ConstFactorMap &factors,
+                const StdRegions::VarCoeffMap &varcoeff);
+
             virtual void v_LinearAdvectionDiffusionReactionSolve(
                 const Array<OneD, Array<OneD, NekDouble> > &velocity,
                 const Array<OneD, const NekDouble> &inarray,
@@ -1577,6 +1786,25 @@ namespace Nektar
             v_HelmSolve(inarray, outarray, flags, factors, varcoeff, dirForcing);
         }
 
+        /**
+         * Solves the Helmholtz problem with forcing @a inarray[i] and the
+         * boundary conditions of @a fields[i] for each i, where all fields
+         * share the discretisation and operator of this expansion. On
+         * entry @a outarray[i] holds the initial guess as for the single
+         * field version.
+         */
+        inline void ExpList::HelmSolve(
+            const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &outarray,
+            const FlagList &flags,
+            const StdRegions::ConstFactorMap &factors,
+            const StdRegions::VarCoeffMap &varcoeff)
+        {
+            v_MultiHelmSolve(fields, inarray, outarray, flags, factors,
+                             varcoeff);
+        }
+
 
         /**
          *
@@ -2021,6 +2249,22 @@ namespace Nektar
             v_GetFwdBwdTracePhys(field,Fwd,Bwd);
         }
 
+        /**
+         * Fills @a Fwd[i] and @a Bwd[i] from @a inarray[i] and the boundary
+         * conditions of @a fields[i] for each i, where all fields share the
+         * discretisation of this expansion. Equivalent to calling
+         * GetFwdBwdTracePhys on each field, but may extract and exchange the
+         * traces of all fields together.
+         */
+        inline void ExpList::GetFwdBwdTracePhys(
+            const Array<OneD, boost::shared_ptr<ExpList> > &fields,
+            const Array<OneD, const Array<OneD, NekDouble> > &inarray,
+                  Array<OneD,       Array<OneD, NekDouble> > &Fwd,
+                  Array<OneD,       Array<OneD, NekDouble> > &Bwd)
+        {
+            v_MultiGetFwdBwdTracePhys(fields, inarray, Fwd, Bwd);
+        }
+
         inline void ExpList::ExtractTracePhys(Array<OneD,NekDouble> &outarray)
         {
             v_ExtractTracePhys(outarray);
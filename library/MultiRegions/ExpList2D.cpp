@@ -965,6 +965,14 @@ namespace Nektar
 
             m_globalOptParam = MemoryManager<NekOptimize::GlobalOptParam>
                 ::AllocateSharedPtr(m_session,2,NumShape);
+
+            // Only the domain is tuned. Boundary regions of a 3D mesh take
+            // the choices made for the domain (see DisContField3D).
+            if(m_globalOptParam->DoAutoTune() &&
+               !(m_graph && m_graph->GetMeshDimension() > 2))
+            {
+                AutoTuneGlobalOptParam();
+            }
         }
 
         void ExpList2D::v_WriteVtkPieceHeader(
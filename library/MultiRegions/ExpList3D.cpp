@@ -453,6 +453,11 @@ namespace Nektar
             int three = 3;
             m_globalOptParam = MemoryManager<NekOptimize::GlobalOptParam>
                 ::AllocateSharedPtr(m_session,three,NumShape);
+
+            if(m_globalOptParam->DoAutoTune())
+            {
+                AutoTuneGlobalOptParam();
+            }
         }
 
         void ExpList3D::v_WriteVtkPieceHeader(std::ofstream &outfile, int expansion)
@@ -271,6 +271,9 @@ namespace Nektar
             //Padding operations variables
             bool m_dealiasing;
             int m_padsize;
+            /// Workspace for the padded pencils of the dealiased product,
+            /// allocated on first use.
+            Array<OneD, NekDouble> m_padWsp;
 
             /// Spectral vanishing Viscosity coefficient for stabilisation 
             Array<OneD, NekDouble> m_specVanVisc;
@@ -45,7 +45,7 @@ namespace Nektar
 {
     namespace MultiRegions
     {
-        std::string GlobalLinSys::lookupIds[8] = {
+        std::string GlobalLinSys::lookupIds[9] = {
             LibUtilities::SessionReader::RegisterEnumValue(
                 "GlobalSysSoln", "DirectFull",
                 MultiRegions::eDirectFullMatrix),
@@ -69,7 +69,10 @@ namespace Nektar
                 MultiRegions::eXxtFullMatrix),
             LibUtilities::SessionReader::RegisterEnumValue(
                 "GlobalSysSoln", "XxtStaticCond",
-                MultiRegions::eXxtStaticCond)
+                MultiRegions::eXxtStaticCond),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "GlobalSysSoln", "DirectSparseStaticCond",
+                MultiRegions::eDirectSparseStaticCond)
         };
 
         std::string GlobalLinSys::def = LibUtilities::SessionReader::
@@ -383,6 +386,23 @@ namespace Nektar
             vExp->DropLocStaticCondMatrix(matkey);
         }
 
+        /**
+         * @brief Solves the system for several right-hand sides.
+         *
+         * By default each right-hand side is solved separately; derived
+         * classes may override this to share the work between them.
+         */
+        void GlobalLinSys::v_MultiSolve(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap)
+        {
+            for (int i = 0; i < in.num_elements(); ++i)
+            {
+                v_Solve(in[i], out[i], locToGloMap);
+            }
+        }
+
         void GlobalLinSys::v_InitObject()
         {
             NEKERROR(ErrorUtil::efatal, "Method does not exist" );
@@ -37,6 +37,7 @@
 
 #include <MultiRegions/MultiRegionsDeclspec.h>
 #include <LibUtilities/BasicUtils/NekFactory.hpp>
+#include <LibUtilities/BasicUtils/Profiler.h>
 #include <MultiRegions/GlobalLinSysKey.h>
 #include <boost/enable_shared_from_this.hpp>
 #include <MultiRegions/ExpList.h>
@@ -97,6 +98,12 @@ namespace Nektar
                 const Array<OneD, const NekDouble> &dirForcing
                     = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides at once.
+            inline void Solve(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap);
+
             /// Returns a shared pointer to the current object.
             boost::shared_ptr<GlobalLinSys> GetSharedThisPtr()
             {
@@ -129,6 +136,11 @@ namespace Nektar
             virtual DNekScalBlkMatSharedPtr v_GetStaticCondBlock(unsigned int n);
             virtual void                    v_DropStaticCondBlock(unsigned int n);
 
+            virtual void v_MultiSolve(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap);
+
         private:
             /// Solve a linear system based on mapping.
             virtual void v_Solve(
@@ -179,9 +191,24 @@ namespace Nektar
                     const AssemblyMapSharedPtr &locToGloMap,
                     const Array<OneD, const NekDouble> &dirForcing)
         {
+            LibUtilities::ProfileRegion region("GlobalLinSys::Solve");
             v_Solve(in,out,locToGloMap,dirForcing);
         }
 
+        /**
+         * Solves the system for each of the right-hand sides @a in, with
+         * @a out holding the initial guesses (including the Dirichlet
+         * values) on entry.
+         */
+        inline void GlobalLinSys::Solve(
+                    const Array<OneD, const Array<OneD, NekDouble> > &in,
+                          Array<OneD,       Array<OneD, NekDouble> > &out,
+                    const AssemblyMapSharedPtr &locToGloMap)
+        {
+            LibUtilities::ProfileRegion region("GlobalLinSys::Solve");
+            v_MultiSolve(in,out,locToGloMap);
+        }
+
 
         /**
          *
@@ -34,6 +34,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <MultiRegions/GlobalLinSysDirectStaticCond.h>
+#include <LibUtilities/BasicUtils/SessionReader.h>
+
+#include <algorithm>
 
 namespace Nektar
 {
@@ -43,9 +46,20 @@ namespace Nektar
          * @class GlobalLinSysDirect
          *
          * Solves a linear system using single- or multi-level static
-         * condensation.
+         * condensation. With DirectSparseStaticCond the condensed boundary
+         * system is instead assembled in sparse form and factorised with a
+         * supernodal Cholesky factorisation, in a nested dissection ordering.
          */
 
+        /// Writes the name of an item in the layout of the solver summary.
+        static std::ostream &SummaryItem(const std::string &name)
+        {
+            cout << "\t";
+            cout.width(20);
+            cout << name << ": ";
+            return cout;
+        }
+
         /**
          * Registers the class with the Factory.
          */
@@ -61,6 +75,13 @@ namespace Nektar
                     GlobalLinSysDirectStaticCond::create,
                     "Direct multi-level static condensation.");
 
+        string GlobalLinSysDirectStaticCond::className3
+                = GetGlobalLinSysFactory().RegisterCreatorFunction(
+                    "DirectSparseStaticCond",
+                    GlobalLinSysDirectStaticCond::create,
+                    "Direct static condensation with a sparse boundary "
+                    "system.");
+
         /**
          * For a matrix system of the form @f[
          * \left[ \begin{array}{cc}
@@ -88,7 +109,8 @@ namespace Nektar
                 : GlobalLinSysDirect(pKey, pExpList, pLocToGloMap)
         {
             ASSERTL1((pKey.GetGlobalSysSolnType()==eDirectStaticCond)||
-                     (pKey.GetGlobalSysSolnType()==eDirectMultiLevelStaticCond),
+                     (pKey.GetGlobalSysSolnType()==eDirectMultiLevelStaticCond)||
+                     (pKey.GetGlobalSysSolnType()==eDirectSparseStaticCond),
                      "This constructor is only valid when using static "
                      "condensation");
             ASSERTL1(pKey.GetGlobalSysSolnType()
@@ -241,7 +263,12 @@ namespace Nektar
                 }
 
                 // solve boundary system
-                if(atLastLevel)
+                if(atLastLevel && m_sparseChol)
+                {
+                    m_sparseChol->Solve(F_HomBnd.GetPtr(),
+                                        V_GlobHomBnd.GetPtr());
+                }
+                else if(atLastLevel)
                 {
                     m_linSys->Solve(F_HomBnd,V_GlobHomBnd);
                 }
@@ -368,7 +395,14 @@ namespace Nektar
             case StdRegions::eHelmholtz:
             case StdRegions::eHybridDGHelmBndLam:
                 {
-                    if( (2*(bwidth+1)) < rows)
+                    // The sparse factorisation makes no use of the
+                    // bandwidth.
+                    if(m_linSysKey.GetGlobalSysSolnType()
+                                == eDirectSparseStaticCond)
+                    {
+                        matStorage = ePOSITIVE_DEFINITE_SYMMETRIC;
+                    }
+                    else if( (2*(bwidth+1)) < rows)
                     {
                         matStorage = ePOSITIVE_DEFINITE_SYMMETRIC_BANDED; 
                     }
@@ -396,6 +430,9 @@ namespace Nektar
         /**
          * Assemble the schur complement matrix from the block matrices stored
          * in #m_blkMatrices and the given local to global mapping information.
+         * For DirectSparseStaticCond with a symmetric matrix, only the lower
+         * triangle is assembled in coordinate format and factorised into
+         * #m_sparseChol; non-symmetric systems fall back to a dense matrix.
          * @param   locToGloMap Local to global mapping information.
          */
         void GlobalLinSysDirectStaticCond::AssembleSchurComplement(
@@ -418,8 +455,12 @@ namespace Nektar
             NekDouble zero = 0.0;
 
             DNekMatSharedPtr Gmat;
+            COOTripletVector cooMat;
             int bwidth = pLocToGloMap->GetBndSystemBandWidth();
-         
+            bool sparse = m_linSysKey.GetGlobalSysSolnType()
+                                == eDirectSparseStaticCond
+                       && matStorage != eFULL;
+
             switch(matStorage)
             {
             case ePOSITIVE_DEFINITE_SYMMETRIC_BANDED:
@@ -440,8 +481,11 @@ namespace Nektar
             case ePOSITIVE_DEFINITE_SYMMETRIC:
             case eFULL:
                 {
-                    Gmat = MemoryManager<DNekMat>
-                        ::AllocateSharedPtr(rows, cols, zero, matStorage);
+                    if (!sparse)
+                    {
+                        Gmat = MemoryManager<DNekMat>
+                            ::AllocateSharedPtr(rows, cols, zero, matStorage);
+                    }
                 }
                 break;
             default:
@@ -450,6 +494,19 @@ namespace Nektar
                 }
             }
             
+            // Reserve the lower triangle of every block, as entries shared
+            // between elements are only merged once all are assembled.
+            if (sparse)
+            {
+                size_t nEntries = 0;
+                for(n = 0; n < SchurCompl->GetNumberOfBlockRows(); ++n)
+                {
+                    size_t nBlk = SchurCompl->GetBlock(n,n)->GetRows();
+                    nEntries += nBlk*(nBlk+1)/2;
+                }
+                cooMat.reserve(nEntries);
+            }
+
             // fill global matrix
             DNekScalMatSharedPtr loc_mat;
             int loc_lda;
@@ -473,7 +530,18 @@ namespace Nektar
                                                                  - NumDirBCs;
                             sign2 = pLocToGloMap->GetLocalToGlobalBndSign(cnt+j);
 
-                            if(gid2 >= 0)
+                            if(gid2 >= 0 && sparse)
+                            {
+                                // Only the lower triangle is used by the
+                                // sparse factorisation.
+                                if(gid1 >= gid2)
+                                {
+                                    cooMat.push_back(std::make_pair(
+                                        CoordType(gid1,gid2),
+                                        sign1*sign2*(*loc_mat)(i,j)));
+                                }
+                            }
+                            else if(gid2 >= 0)
                             {
                                 // As the global matrix should be
                                 // symmetric, only add the value for
@@ -493,7 +561,57 @@ namespace Nektar
                 cnt += loc_lda;
             }
 
-            if(rows)
+            if(rows && sparse)
+            {
+                // Sort by row and column, and sum the contributions of
+                // different elements to the same entry.
+                std::sort(cooMat.begin(), cooMat.end());
+                COOTripletVector::iterator last = cooMat.begin();
+                COOTripletVector::iterator it;
+                for(it = cooMat.begin(); it != cooMat.end(); ++it)
+                {
+                    if(it == last)
+                    {
+                        continue;
+                    }
+                    if(it->first == last->first)
+                    {
+                        last->second += it->second;
+                    }
+                    else
+                    {
+                        *(++last) = *it;
+                    }
+                }
+                if(!cooMat.empty())
+                {
+                    cooMat.erase(last + 1, cooMat.end());
+                }
+
+                m_sparseChol = MemoryManager<SupernodalCholesky>
+                    ::AllocateSharedPtr(rows, cooMat);
+
+                // Linear systems are built on first use, after the solver
+                // summary has been written, so the factorisation is
+                // reported in the same format when it is built.
+                boost::shared_ptr<ExpList> expList = m_expList.lock();
+                if (expList->GetComm()->GetRank() == 0)
+                {
+                    SummaryItem("Sparse Cholesky")
+                        << rows << " rows, "
+                        << m_sparseChol->GetNumSupernodes()
+                        << " supernodes" << endl;
+                    SummaryItem("Factor Size")
+                        << m_sparseChol->GetFactorNonZeros()
+                        << " nonzeros" << endl;
+                    SummaryItem("Factor Memory")
+                        << m_sparseChol->GetFactorMemory()/1048576.0
+                        << " MB" << endl;
+                    SummaryItem("Factorisation Time")
+                        << m_sparseChol->GetFactorTime() << " s" << endl;
+                }
+            }
+            else if(rows)
             {
                 PointerWrapper w = eWrapper;
                 m_linSys = MemoryManager<DNekLinSys>::AllocateSharedPtr(Gmat,w);
@@ -37,6 +37,7 @@
 
 #include <MultiRegions/GlobalLinSysDirect.h>
 #include <MultiRegions/MultiRegionsDeclspec.h>
+#include <LibUtilities/LinearAlgebra/SupernodalCholesky.hpp>
 
 namespace Nektar
 {
@@ -67,6 +68,7 @@ namespace Nektar
             /// Name of class
             MULTI_REGIONS_EXPORT static std::string className;
             static std::string className2;
+            static std::string className3;
 
             /// Constructor for full direct matrix solve.
             MULTI_REGIONS_EXPORT GlobalLinSysDirectStaticCond(
@@ -106,6 +108,10 @@ namespace Nektar
             DNekScalBlkMatSharedPtr m_C;
             DNekScalBlkMatSharedPtr m_invD;
 
+            /// Sparse factorisation of the boundary system, used in place
+            /// of #m_linSys for DirectSparseStaticCond.
+            SupernodalCholeskySharedPtr m_sparseChol;
+
             /// Solve the linear system for given input and output vectors
             /// using a specified local to global map.
             virtual void v_Solve(
@@ -39,6 +39,19 @@ namespace Nektar
 {
     namespace MultiRegions
     {
+        std::string GlobalLinSysIterative::IterativeMethodLookupIds[2] = {
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "IterativeMethod", "ConjugateGradient",
+                MultiRegions::eConjugateGradient),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "IterativeMethod", "PipelinedConjugateGradient",
+                MultiRegions::ePipelinedConjugateGradient)
+        };
+
+        std::string GlobalLinSysIterative::IterativeMethodDef =
+            LibUtilities::SessionReader::RegisterDefaultSolverInfo(
+                "IterativeMethod", "ConjugateGradient");
+
         /**
          * @class GlobalLinSysIterative
          *
@@ -56,6 +69,7 @@ namespace Nektar
                   m_precon(NullPreconditionerSharedPtr),
                   m_totalIterations(0),
                   m_useProjection(false),
+                  m_iterativeMethod(pLocToGloMap->GetIterativeMethod()),
                   m_numPrevSols(0)
         {
             LibUtilities::SessionReaderSharedPtr vSession
@@ -387,6 +401,12 @@ namespace Nektar
                 m_precon -> BuildPreconditioner();
             }
 
+            if (m_iterativeMethod == ePipelinedConjugateGradient)
+            {
+                DoPipelinedConjugateGradient(nGlobal, pInput, pOutput, nDir);
+                return;
+            }
+
             // Get the communicator for performing data exchanges
             LibUtilities::CommSharedPtr vComm
                 = m_expList.lock()->GetComm()->GetRowComm();
@@ -547,6 +567,430 @@ namespace Nektar
             }
         }
 
+        /**
+         * Solve a global linear system for several right-hand sides with the
+         * same operator. Each right-hand side follows the iteration of
+         * DoConjugateGradient, but the iterations run in lock step so that
+         * the operator is applied to all search directions together (see
+         * v_DoMultiMatrixMultiply) and the inner products of all of them are
+         * reduced in a single exchange. A right-hand side drops out of the
+         * iteration once it has converged.
+         *
+         * The vectors are stored one after the other, each of length @a
+         * nGlobal.
+         *
+         * @param       pInput      Input residuals of all DOFs.
+         * @param       pOutput     Solution vectors of all DOFs.
+         * @param       pRhsMagnitude  Normalisation of the stopping
+         *                          criterion of each right-hand side, or
+         *                          NekConstants::kNekUnsetDouble to use the
+         *                          initial residual.
+         */
+        void GlobalLinSysIterative::DoMultiConjugateGradient(
+                    const int nGlobal,
+                    const int nVec,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &plocToGloMap,
+                    const int nDir,
+                    const Array<OneD,const NekDouble> &pRhsMagnitude)
+        {
+            if (!m_precon)
+            {
+                MultiRegions::PreconditionerType pType = plocToGloMap->GetPreconType();
+                std::string PreconType = MultiRegions::PreconditionerTypeMap[pType];
+                v_UniqueMap();
+                m_precon = GetPreconFactory().CreateInstance(PreconType,GetSharedThisPtr(),plocToGloMap);
+                m_precon -> BuildPreconditioner();
+            }
+
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+
+            // Get vector sizes
+            int nNonDir = nGlobal - nDir;
+            int j, k;
+
+            // Allocate array storage
+            Array<OneD, NekDouble> w_A    (nVec*nGlobal, 0.0);
+            Array<OneD, NekDouble> s_A    (nVec*nGlobal, 0.0);
+            Array<OneD, NekDouble> p_A    (nVec*nNonDir, 0.0);
+            Array<OneD, NekDouble> r_A    (nVec*nNonDir, 0.0);
+            Array<OneD, NekDouble> q_A    (nVec*nNonDir, 0.0);
+            Array<OneD, NekDouble> tmp;
+
+            Array<OneD, NekDouble> alpha  (nVec, 0.0);
+            Array<OneD, NekDouble> beta   (nVec, 0.0);
+            Array<OneD, NekDouble> rho    (nVec, 0.0);
+            Array<OneD, NekDouble> rhsMag (nVec, 0.0);
+            Array<OneD, NekDouble> vExchange(3*nVec, 0.0);
+            std::vector<bool>      active (nVec, true);
+            int                    nActive = nVec;
+
+            for (j = 0; j < nVec; ++j)
+            {
+                // Copy initial residual from input and zero the homogeneous
+                // part of the solution
+                Vmath::Vcopy(nNonDir, pInput.get() + j*nGlobal + nDir, 1,
+                                      r_A.get()    + j*nNonDir,        1);
+                Vmath::Zero (nNonDir, pOutput.get() + j*nGlobal + nDir, 1);
+
+                // evaluate initial residual error for exit check
+                vExchange[j] = Vmath::Dot2(nNonDir,
+                                           r_A + j*nNonDir,
+                                           r_A + j*nNonDir,
+                                           m_map + nDir);
+            }
+
+            vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+            m_totalIterations = 0;
+            for (j = 0; j < nVec; ++j)
+            {
+                rhsMag[j] = pRhsMagnitude[j] == NekConstants::kNekUnsetDouble
+                    ? 1.0/vExchange[j] : pRhsMagnitude[j];
+
+                // If input residual is less than tolerance skip solve.
+                if (vExchange[j] < m_tolerance * m_tolerance * rhsMag[j])
+                {
+                    active[j] = false;
+                    --nActive;
+                }
+                else
+                {
+                    m_precon->DoPreconditioner(
+                        r_A + j*nNonDir, tmp = w_A + j*nGlobal + nDir);
+                }
+            }
+
+            if (nActive == 0)
+            {
+                return;
+            }
+
+            m_totalIterations = 1;
+            v_DoMultiMatrixMultiply(nGlobal, nVec, w_A, s_A);
+
+            for (j = 0; j < nVec; ++j)
+            {
+                vExchange[2*j]   = Vmath::Dot2(nNonDir,
+                                               r_A + j*nNonDir,
+                                               w_A + j*nGlobal + nDir,
+                                               m_map + nDir);
+                vExchange[2*j+1] = Vmath::Dot2(nNonDir,
+                                               s_A + j*nGlobal + nDir,
+                                               w_A + j*nGlobal + nDir,
+                                               m_map + nDir);
+            }
+
+            vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+            for (j = 0; j < nVec; ++j)
+            {
+                if (active[j])
+                {
+                    rho[j]   = vExchange[2*j];
+                    alpha[j] = rho[j]/vExchange[2*j+1];
+                }
+            }
+
+            // Continue until all right-hand sides have converged
+            for (k = 0; nActive > 0; ++k)
+            {
+                ASSERTL0(k < 5000,
+                         "Exceeded maximum number of iterations (5000)");
+
+                for (j = 0; j < nVec; ++j)
+                {
+                    if (!active[j])
+                    {
+                        continue;
+                    }
+
+                    NekDouble *p = p_A.get()     + j*nNonDir;
+                    NekDouble *q = q_A.get()     + j*nNonDir;
+                    NekDouble *r = r_A.get()     + j*nNonDir;
+                    NekDouble *w = w_A.get()     + j*nGlobal + nDir;
+                    NekDouble *s = s_A.get()     + j*nGlobal + nDir;
+                    NekDouble *x = pOutput.get() + j*nGlobal + nDir;
+
+                    // Compute new search direction p_k, q_k
+                    Vmath::Svtvp(nNonDir, beta[j], p, 1, w, 1, p, 1);
+                    Vmath::Svtvp(nNonDir, beta[j], q, 1, s, 1, q, 1);
+
+                    // Update solution x_{k+1}
+                    Vmath::Svtvp(nNonDir, alpha[j], p, 1, x, 1, x, 1);
+
+                    // Update residual vector r_{k+1}
+                    Vmath::Svtvp(nNonDir, -alpha[j], q, 1, r, 1, r, 1);
+
+                    // Apply preconditioner
+                    m_precon->DoPreconditioner(
+                        r_A + j*nNonDir, tmp = w_A + j*nGlobal + nDir);
+                }
+
+                // Apply the operator to all search directions together.
+                // Converged right-hand sides have zero search directions.
+                v_DoMultiMatrixMultiply(nGlobal, nVec, w_A, s_A);
+
+                Vmath::Zero(3*nVec, vExchange, 1);
+                for (j = 0; j < nVec; ++j)
+                {
+                    if (!active[j])
+                    {
+                        continue;
+                    }
+
+                    // <r_{k+1}, w_{k+1}>
+                    vExchange[3*j]   = Vmath::Dot2(nNonDir,
+                                                   r_A + j*nNonDir,
+                                                   w_A + j*nGlobal + nDir,
+                                                   m_map + nDir);
+                    // <s_{k+1}, w_{k+1}>
+                    vExchange[3*j+1] = Vmath::Dot2(nNonDir,
+                                                   s_A + j*nGlobal + nDir,
+                                                   w_A + j*nGlobal + nDir,
+                                                   m_map + nDir);
+                    // <r_{k+1}, r_{k+1}>
+                    vExchange[3*j+2] = Vmath::Dot2(nNonDir,
+                                                   r_A + j*nNonDir,
+                                                   r_A + j*nNonDir,
+                                                   m_map + nDir);
+                }
+
+                // Perform inner-product exchanges of all right-hand sides
+                vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+                m_totalIterations++;
+
+                for (j = 0; j < nVec; ++j)
+                {
+                    if (!active[j])
+                    {
+                        continue;
+                    }
+
+                    NekDouble rho_new = vExchange[3*j];
+                    NekDouble mu      = vExchange[3*j+1];
+                    NekDouble eps     = vExchange[3*j+2];
+
+                    // test if norm is within tolerance
+                    if (eps < m_tolerance * m_tolerance * rhsMag[j])
+                    {
+                        active[j] = false;
+                        --nActive;
+                        Vmath::Zero(nNonDir,
+                                    w_A.get() + j*nGlobal + nDir, 1);
+                        continue;
+                    }
+
+                    // Compute search direction and solution coefficients
+                    beta[j]  = rho_new/rho[j];
+                    alpha[j] = rho_new/(mu - rho_new*beta[j]/alpha[j]);
+                    rho[j]   = rho_new;
+                }
+            }
+
+            if (m_verbose && m_root)
+            {
+                cout << "CG iterations made = " << m_totalIterations
+                     << " for " << nVec << " right-hand sides using "
+                     << "tolerance of " << m_tolerance << endl;
+            }
+        }
+
+        /**
+         * Solve a global linear system using the pipelined preconditioned
+         * conjugate gradient method (Ghysels and Vanroose, Parallel
+         * Computing 40, 2014). It is algebraically equivalent to
+         * DoConjugateGradient, but the single global reduction of each
+         * iteration is started with a non-blocking call and completed only
+         * after the preconditioner and the matrix-vector product of that
+         * iteration, so that its latency is hidden behind local work. This
+         * costs four extra vector updates per iteration and slightly weaker
+         * numerical stability, so it pays off when the reductions dominate,
+         * i.e. at large process counts.
+         *
+         * The preconditioner must have been built by the caller.
+         *
+         * @param       pInput      Input residual  of all DOFs.
+         * @param       pOutput     Solution vector of all DOFs.
+         */
+        void GlobalLinSysIterative::DoPipelinedConjugateGradient(
+                                                        const int nGlobal,
+                                                        const Array<OneD,const NekDouble> &pInput,
+                                                        Array<OneD,      NekDouble> &pOutput,
+                                                        const int nDir)
+        {
+            // Get the communicator for performing data exchanges
+            LibUtilities::CommSharedPtr vComm
+                = m_expList.lock()->GetComm()->GetRowComm();
+            LibUtilities::CommRequestSharedPtr vRequest
+                = vComm->CreateRequest(1);
+
+            // Get vector sizes
+            int nNonDir = nGlobal - nDir;
+
+            // Allocate array storage. Vectors to which the operator is
+            // applied (u, m) and its results (w, n) hold all DOFs; the
+            // Dirichlet part of u and m is kept zero.
+            Array<OneD, NekDouble> u_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> w_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> m_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> n_A    (nGlobal, 0.0);
+            Array<OneD, NekDouble> r_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> p_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> s_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> q_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> z_A    (nNonDir, 0.0);
+            Array<OneD, NekDouble> tmp, wk, mk;
+
+            NekDouble alpha = 0.0, beta, gamma, gamma_old = 0.0, delta, eps;
+            Array<OneD, NekDouble> vExchange(3, 0.0);
+
+            // Copy initial residual from input
+            Vmath::Vcopy(nNonDir, &pInput[nDir], 1, &r_A[0], 1);
+            // zero homogeneous out array ready for solution updates
+            // Should not be earlier in case input vector is same as
+            // output and above copy has been peformed
+            Vmath::Zero(nNonDir, tmp = pOutput + nDir, 1);
+
+            // evaluate initial residual error for exit check
+            vExchange[2] = Vmath::Dot2(nNonDir,
+                                       r_A,
+                                       r_A,
+                                       m_map + nDir);
+
+            vComm->AllReduce(vExchange, Nektar::LibUtilities::ReduceSum);
+
+            eps = vExchange[2];
+
+            if(m_rhs_magnitude == NekConstants::kNekUnsetDouble)
+            {
+                m_rhs_magnitude = 1.0/vExchange[2];
+            }
+
+            // If input residual is less than tolerance skip solve.
+            if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
+            {
+                if (m_verbose && m_root)
+                {
+                    cout << "CG iterations made = " << m_totalIterations
+                         << " using tolerance of "  << m_tolerance
+                         << " (error = " << sqrt(eps/m_rhs_magnitude) << ")" << endl;
+                }
+                m_rhs_magnitude = NekConstants::kNekUnsetDouble;
+                return;
+            }
+
+            // u_0 = M r_0, w_0 = A u_0
+            m_precon->DoPreconditioner(r_A, tmp = u_A + nDir);
+            v_DoMatrixMultiply(u_A, w_A);
+
+            m_totalIterations = 1;
+
+            for (int k = 0; ; ++k)
+            {
+                ASSERTL0(k < 5000,
+                         "Exceeded maximum number of iterations (5000)");
+
+                // <r_k, u_k>, <w_k, u_k> and <r_k, r_k>, reduced together
+                vExchange[0] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           u_A + nDir,
+                                           m_map + nDir);
+                vExchange[1] = Vmath::Dot2(nNonDir,
+                                           w_A + nDir,
+                                           u_A + nDir,
+                                           m_map + nDir);
+                vExchange[2] = Vmath::Dot2(nNonDir,
+                                           r_A,
+                                           r_A,
+                                           m_map + nDir);
+
+                vComm->IAllReduce(vExchange,
+                                  Nektar::LibUtilities::ReduceSum,
+                                  vRequest, 0);
+
+                // m_k = M w_k, n_k = A m_k while the reduction completes
+                wk = w_A + nDir;
+                mk = m_A + nDir;
+                m_precon->DoPreconditioner(wk, mk);
+                v_DoMatrixMultiply(m_A, n_A);
+
+                vComm->WaitAll(vRequest);
+
+                gamma = vExchange[0];
+                delta = vExchange[1];
+                eps   = vExchange[2];
+
+                // test if norm is within tolerance
+                if (eps < m_tolerance * m_tolerance * m_rhs_magnitude)
+                {
+                    if (m_verbose && m_root)
+                    {
+                        cout << "CG iterations made = " << m_totalIterations
+                             << " using tolerance of "  << m_tolerance
+                             << " (error = " << sqrt(eps/m_rhs_magnitude) << ")"
+                             << endl;
+                    }
+                    m_rhs_magnitude = NekConstants::kNekUnsetDouble;
+                    break;
+                }
+
+                // Compute search direction and solution coefficients
+                if (k > 0)
+                {
+                    beta  = gamma/gamma_old;
+                    alpha = gamma/(delta - beta*gamma/alpha);
+                }
+                else
+                {
+                    beta  = 0.0;
+                    alpha = gamma/delta;
+                }
+                gamma_old = gamma;
+
+                // z_k = n_k + beta z_{k-1}, q_k = m_k + beta q_{k-1}
+                // s_k = w_k + beta s_{k-1}, p_k = u_k + beta p_{k-1}
+                Vmath::Svtvp(nNonDir, beta, &z_A[0], 1, &n_A[nDir], 1, &z_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &q_A[0], 1, &m_A[nDir], 1, &q_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &s_A[0], 1, &w_A[nDir], 1, &s_A[0], 1);
+                Vmath::Svtvp(nNonDir, beta, &p_A[0], 1, &u_A[nDir], 1, &p_A[0], 1);
+
+                // Update solution x_{k+1}
+                Vmath::Svtvp(nNonDir, alpha, &p_A[0], 1, &pOutput[nDir], 1, &pOutput[nDir], 1);
+
+                // Update residual r_{k+1} and the recurrences for
+                // u_{k+1} = M r_{k+1} and w_{k+1} = A u_{k+1}
+                Vmath::Svtvp(nNonDir, -alpha, &s_A[0], 1, &r_A[0],    1, &r_A[0],    1);
+                Vmath::Svtvp(nNonDir, -alpha, &q_A[0], 1, &u_A[nDir], 1, &u_A[nDir], 1);
+                Vmath::Svtvp(nNonDir, -alpha, &z_A[0], 1, &w_A[nDir], 1, &w_A[nDir], 1);
+
+                m_totalIterations++;
+            }
+        }
+
+        /**
+         * Applies the operator to each vector in turn. Derived classes
+         * override this to apply it to all vectors together.
+         */
+        void GlobalLinSysIterative::v_DoMultiMatrixMultiply(
+                    const int nGlobal,
+                    const int nVec,
+                    const Array<OneD, NekDouble>& pInput,
+                          Array<OneD, NekDouble>& pOutput)
+        {
+            Array<OneD, NekDouble> in, out;
+            for (int j = 0; j < nVec; ++j)
+            {
+                in  = pInput  + j*nGlobal;
+                out = pOutput + j*nGlobal;
+                v_DoMatrixMultiply(in, out);
+            }
+        }
+
         void GlobalLinSysIterative::Set_Rhs_Magnitude(const NekVector<NekDouble> &pIn)
         {
 
@@ -61,7 +61,18 @@ namespace Nektar
 
             MULTI_REGIONS_EXPORT virtual ~GlobalLinSysIterative();
 
+            /// Applies the operator of the system to a global vector.
+            inline void DoMatrixMultiply(
+                    const Array<OneD, NekDouble>& pInput,
+                          Array<OneD, NekDouble>& pOutput)
+            {
+                v_DoMatrixMultiply(pInput, pOutput);
+            }
+
         protected:
+            static std::string IterativeMethodLookupIds[2];
+            static std::string IterativeMethodDef;
+
             /// Global to universal unique map
             Array<OneD, int>                            m_map;
 
@@ -81,6 +92,9 @@ namespace Nektar
             /// Whether to apply projection technique
             bool                                        m_useProjection;
 
+            /// Conjugate gradient variant to use
+            IterativeMethod                             m_iterativeMethod;
+
             /// Provide verbose output and root if parallel. 
             bool                                        m_root;
             bool                                        m_verbose;
@@ -109,7 +123,32 @@ namespace Nektar
                     const int pNumDir);
 
 
+            /// Pipelined iterative solve
+            void DoPipelinedConjugateGradient(
+                    const int pNumRows,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const int pNumDir);
+
+            /// Conjugate gradient solve for several right-hand sides
+            void DoMultiConjugateGradient(
+                    const int pNumRows,
+                    const int pNumVec,
+                    const Array<OneD,const NekDouble> &pInput,
+                          Array<OneD,      NekDouble> &pOutput,
+                    const AssemblyMapSharedPtr &locToGloMap,
+                    const int pNumDir,
+                    const Array<OneD,const NekDouble> &pRhsMagnitude);
+
             void Set_Rhs_Magnitude(const NekVector<NekDouble> &pIn);
+
+            /// Applies the operator to @a pNumVec global vectors of length
+            /// @a pNumRows stored one after the other.
+            virtual void v_DoMultiMatrixMultiply(
+                    const int pNumRows,
+                    const int pNumVec,
+                    const Array<OneD, NekDouble>& pInput,
+                          Array<OneD, NekDouble>& pOutput);
             
         private:
 
@@ -346,6 +346,145 @@ namespace Nektar
 
 
 
+        /**
+         * Solves the system for several right-hand sides which share the
+         * operator, e.g. the velocity components of a Navier-Stokes solve.
+         * The elemental static condensation matrices are applied to all
+         * right-hand sides together with BLAS 3 calls and the condensed
+         * boundary system is solved with DoMultiConjugateGradient.
+         *
+         * This covers single-level static condensation without the low
+         * energy basis transformation and without the projection technique
+         * for successive right-hand sides; in all other cases the right-hand
+         * sides are solved one after the other. The choice depends only on
+         * data which is the same on all processes.
+         */
+        void GlobalLinSysIterativeStaticCond::v_MultiSolve(
+            const Array<OneD, const Array<OneD, NekDouble> > &in,
+                  Array<OneD,       Array<OneD, NekDouble> > &out,
+            const AssemblyMapSharedPtr                       &pLocToGloMap)
+        {
+            int nVec = in.num_elements();
+            PreconditionerType pType = pLocToGloMap->GetPreconType();
+
+            if (nVec < 2 || m_useProjection ||
+                pLocToGloMap->GetLowestStaticCondLevel() > 0 ||
+                !pLocToGloMap->AtLastLevel() ||
+                pType == eLowEnergy || pType == eLinearWithLowEnergy)
+            {
+                GlobalLinSys::v_MultiSolve(in, out, pLocToGloMap);
+                return;
+            }
+
+            int nGlobDofs          = pLocToGloMap->GetNumGlobalCoeffs();
+            int nGlobBndDofs       = pLocToGloMap->GetNumGlobalBndCoeffs();
+            int nDirBndDofs        = pLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nGlobHomBndDofs    = nGlobBndDofs - nDirBndDofs;
+            int nLocBndDofs        = pLocToGloMap->GetNumLocalBndCoeffs();
+            int nIntDofs           = nGlobDofs - nGlobBndDofs;
+            int j;
+
+            // Column-major blocks of the boundary and interior parts of the
+            // right-hand sides and solutions.
+            Array<OneD, NekDouble> F_Bnd   (nVec*nGlobBndDofs);
+            Array<OneD, NekDouble> F_Int   (nVec*nIntDofs);
+            Array<OneD, NekDouble> V_Bnd   (nVec*nGlobBndDofs);
+            Array<OneD, NekDouble> V_Int   (nVec*nIntDofs);
+            Array<OneD, NekDouble> V_LocBnd(nVec*nLocBndDofs);
+            Array<OneD, NekDouble> W_LocBnd(nVec*nLocBndDofs);
+            Array<OneD, NekDouble> rhsMag  (nVec, 0.0);
+
+            for (j = 0; j < nVec; ++j)
+            {
+                Vmath::Vcopy(nGlobBndDofs, in[j].get(),  1,
+                                           F_Bnd.get() + j*nGlobBndDofs, 1);
+                Vmath::Vcopy(nIntDofs,     in[j].get()  + nGlobBndDofs, 1,
+                                           F_Int.get() + j*nIntDofs,     1);
+                Vmath::Vcopy(nGlobBndDofs, out[j].get(), 1,
+                                           V_Bnd.get() + j*nGlobBndDofs, 1);
+
+                // set up normalisation factor for right hand side
+                rhsMag[j] = Vmath::Dot(nGlobBndDofs,
+                                       F_Bnd.get() + j*nGlobBndDofs, 1,
+                                       F_Bnd.get() + j*nGlobBndDofs, 1);
+            }
+
+            m_expList.lock()->GetComm()->GetRowComm()->AllReduce(
+                rhsMag, Nektar::LibUtilities::ReduceSum);
+
+            for (j = 0; j < nVec; ++j)
+            {
+                rhsMag[j] = rhsMag[j] > 1e-6 ? rhsMag[j] : 1.0;
+            }
+
+            if(nGlobHomBndDofs)
+            {
+                // construct boundary forcing, including the dirichlet
+                // boundary forcing
+                Array<OneD, NekDouble> V_GlobHomBndTmp(nVec*nGlobBndDofs);
+
+                pLocToGloMap->MultiGlobalToLocalBnd(V_Bnd, V_LocBnd, nVec);
+                MultiplyBlockDiagonal(*m_S1Blk, nVec, V_LocBnd, nLocBndDofs,
+                                      W_LocBnd, nLocBndDofs, 0.0);
+                if (nIntDofs)
+                {
+                    MultiplyBlockDiagonal(*m_BinvD, nVec, F_Int, nIntDofs,
+                                          W_LocBnd, nLocBndDofs, 1.0);
+                }
+                pLocToGloMap->MultiAssembleBnd(W_LocBnd, V_GlobHomBndTmp,
+                                               nVec);
+
+                for (j = 0; j < nVec; ++j)
+                {
+                    NekDouble *f = F_Bnd.get() + j*nGlobBndDofs + nDirBndDofs;
+                    Vmath::Vsub(nGlobHomBndDofs, f, 1,
+                                V_GlobHomBndTmp.get() + j*nGlobBndDofs
+                                                      + nDirBndDofs, 1,
+                                f, 1);
+                }
+
+                // solve boundary system for the difference from the initial
+                // solution and add it back
+                Array<OneD, NekDouble> pert(nVec*nGlobBndDofs, 0.0);
+                DoMultiConjugateGradient(nGlobBndDofs, nVec, F_Bnd, pert,
+                                         pLocToGloMap, nDirBndDofs, rhsMag);
+
+                for (j = 0; j < nVec; ++j)
+                {
+                    NekDouble *v = V_Bnd.get() + j*nGlobBndDofs + nDirBndDofs;
+                    Vmath::Vadd(nGlobHomBndDofs, v, 1,
+                                pert.get() + j*nGlobBndDofs + nDirBndDofs, 1,
+                                v, 1);
+                }
+            }
+
+            // solve interior system
+            if(nIntDofs)
+            {
+                if(nGlobHomBndDofs || nDirBndDofs)
+                {
+                    pLocToGloMap->MultiGlobalToLocalBnd(V_Bnd, V_LocBnd,
+                                                        nVec);
+                    Array<OneD, NekDouble> CV(nVec*nIntDofs);
+                    MultiplyBlockDiagonal(*m_C, nVec, V_LocBnd, nLocBndDofs,
+                                          CV, nIntDofs, 0.0);
+                    Vmath::Vsub(nVec*nIntDofs, F_Int, 1, CV, 1, F_Int, 1);
+                }
+
+                MultiplyBlockDiagonal(*m_invD, nVec, F_Int, nIntDofs,
+                                      V_Int, nIntDofs, 0.0);
+            }
+
+            for (j = 0; j < nVec; ++j)
+            {
+                Vmath::Vcopy(nGlobBndDofs, V_Bnd.get() + j*nGlobBndDofs, 1,
+                                           out[j].get(), 1);
+                Vmath::Vcopy(nIntDofs,     V_Int.get() + j*nIntDofs,     1,
+                                           out[j].get() + nGlobBndDofs,  1);
+            }
+        }
+
+
         /**
          * If at the last level of recursion (or the only level in the case of
          * single-level static condensation), assemble the Schur complement.
@@ -1024,6 +1163,150 @@ namespace Nektar
             }
         }
 
+        /**
+         * As v_DoMatrixMultiply, but for @a nVec vectors stored one after the
+         * other. The dense elemental blocks are applied to all vectors with
+         * one BLAS 3 call each and the process-boundary values of all vectors
+         * are exchanged in a single gather-scatter operation.
+         */
+        void GlobalLinSysIterativeStaticCond::v_DoMultiMatrixMultiply(
+                const int nGlobal,
+                const int nVec,
+                const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput)
+        {
+            int nLocal = m_locToGloMap->GetNumLocalBndCoeffs();
+            int nDir   = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+            int i, j, cnt;
+            Array<OneD, NekDouble> in, out;
+
+            bool doGlobalOp = m_expList.lock()->GetGlobalOptParam()->
+                    DoGlobalMatOp(m_linSysKey.GetMatrixType());
+
+            if(doGlobalOp)
+            {
+                // Do matrix multiply globally
+                for (j = 0; j < nVec; ++j)
+                {
+                    in  = pInput  + j*nGlobal + nDir;
+                    out = pOutput + j*nGlobal + nDir;
+                    m_sparseSchurCompl->Multiply(in,out);
+                }
+                m_locToGloMap->MultiUniversalAssembleBnd(pOutput, nVec, nDir);
+                return;
+            }
+
+            if (m_multiWsp.num_elements() < 2*nVec*nLocal)
+            {
+                m_multiWsp = Array<OneD, NekDouble>(2*nVec*nLocal);
+            }
+            Array<OneD, NekDouble> tmpout = m_multiWsp + nVec*nLocal;
+
+            m_locToGloMap->MultiGlobalToLocalBnd(pInput, m_multiWsp, nVec);
+
+            if (m_sparseSchurCompl)
+            {
+                // Do matrix multiply locally using block-diagonal sparse matrix
+                for (j = 0; j < nVec; ++j)
+                {
+                    in  = m_multiWsp + j*nLocal;
+                    out = tmpout     + j*nLocal;
+                    m_sparseSchurCompl->Multiply(in,out);
+                }
+            }
+            else
+            {
+                // Do matrix multiply locally, using direct BLAS calls
+                for (i = cnt = 0; i < m_denseBlocks.size(); cnt += m_rows[i], ++i)
+                {
+                    const int rows = m_rows[i];
+                    Blas::Dgemm('N', 'N', rows, nVec, rows,
+                                m_scale[i], m_denseBlocks[i], rows,
+                                m_multiWsp.get()+cnt, nLocal,
+                                0.0, tmpout.get()+cnt, nLocal);
+                }
+            }
+
+            m_locToGloMap->MultiAssembleBnd(tmpout, pOutput, nVec);
+        }
+
+        /**
+         * Computes \f$ Y = \beta Y + A X \f$ for the block diagonal matrix
+         * \f$ A \f$, where \f$ X \f$ and \f$ Y \f$ hold @a nVec columns
+         * with leading dimensions @a ldIn and @a ldOut.
+         */
+        void GlobalLinSysIterativeStaticCond::MultiplyBlockDiagonal(
+                const DNekScalBlkMat               &pMat,
+                const int                           nVec,
+                const Array<OneD, const NekDouble> &pInput,
+                const int                           ldIn,
+                      Array<OneD,       NekDouble> &pOutput,
+                const int                           ldOut,
+                const NekDouble                     beta)
+        {
+            int n, j, row = 0, col = 0;
+
+            for (n = 0; n < pMat.GetNumberOfBlockRows(); ++n)
+            {
+                const int rows = pMat.GetNumberOfRowsInBlockRow(n);
+                const int cols = pMat.GetNumberOfColumnsInBlockColumn(n);
+                const DNekScalMat *blk = pMat.GetBlockPtr(n, n);
+
+                if (rows == 0)
+                {
+                    col += cols;
+                    continue;
+                }
+
+                if (!blk || cols == 0)
+                {
+                    for (j = 0; j < nVec && beta != 1.0; ++j)
+                    {
+                        NekDouble *y = pOutput.get() + j*ldOut + row;
+                        if (beta == 0.0)
+                        {
+                            Vmath::Zero(rows, y, 1);
+                        }
+                        else
+                        {
+                            Vmath::Smul(rows, beta, y, 1, y, 1);
+                        }
+                    }
+                }
+                else if (blk->GetStorageType() == eFULL)
+                {
+                    const char trans = blk->GetTransposeFlag();
+                    Blas::Dgemm(trans, 'N', rows, nVec, cols,
+                                blk->Scale(), blk->GetRawPtr(),
+                                trans == 'N' ? rows : cols,
+                                pInput.get()  + col, ldIn, beta,
+                                pOutput.get() + row, ldOut);
+                }
+                else
+                {
+                    for (j = 0; j < nVec; ++j)
+                    {
+                        NekVector<NekDouble> x(cols,
+                                               pInput.get() + j*ldIn + col);
+                        NekVector<NekDouble> y = (*blk) * x;
+                        NekDouble *out = pOutput.get() + j*ldOut + row;
+                        if (beta == 0.0)
+                        {
+                            Vmath::Vcopy(rows, &y[0], 1, out, 1);
+                        }
+                        else
+                        {
+                            Vmath::Svtvp(rows, beta, out, 1, &y[0], 1,
+                                         out, 1);
+                        }
+                    }
+                }
+
+                row += rows;
+                col += cols;
+            }
+        }
+
         void GlobalLinSysIterativeStaticCond::v_UniqueMap()
         {
             m_map = m_locToGloMap->GetGlobalToUniversalBndMapUnique();
@@ -149,6 +149,8 @@ namespace Nektar
             boost::shared_ptr<AssemblyMap>           m_locToGloMap;
             /// Workspace array for matrix multiplication
             Array<OneD, NekDouble>                   m_wsp;
+            /// Workspace array for multiple right-hand side multiplication
+            Array<OneD, NekDouble>                   m_multiWsp;
             /// Preconditioner object.
             PreconditionerSharedPtr                  m_precon;
 
@@ -166,6 +168,12 @@ namespace Nektar
                 const Array<OneD, const NekDouble>  &dirForcing
                     = NullNekDouble1DArray);
 
+            /// Solve the linear system for several right-hand sides at once.
+            virtual void v_MultiSolve(
+                const Array<OneD, const Array<OneD, NekDouble> > &in,
+                      Array<OneD,       Array<OneD, NekDouble> > &out,
+                const AssemblyMapSharedPtr                       &locToGloMap);
+
             virtual void v_InitObject();
 
             /// Initialise this object
@@ -197,7 +205,26 @@ namespace Nektar
                     const Array<OneD, NekDouble>& pInput,
                           Array<OneD, NekDouble>& pOutput);
 
+            /// Perform a Schur-complement matrix multiply operation on
+            /// several vectors at once.
+            virtual void v_DoMultiMatrixMultiply(
+                    const int pNumRows,
+                    const int pNumVec,
+                    const Array<OneD, NekDouble>& pInput,
+                          Array<OneD, NekDouble>& pOutput);
+
             virtual void v_UniqueMap();
+
+            /// Multiplies @a pNumVec column-major vectors by a block diagonal
+            /// matrix.
+            static void MultiplyBlockDiagonal(
+                    const DNekScalBlkMat               &pMat,
+                    const int                           pNumVec,
+                    const Array<OneD, const NekDouble> &pInput,
+                    const int                           pLdInput,
+                          Array<OneD,       NekDouble> &pOutput,
+                    const int                           pLdOutput,
+                    const NekDouble                     pBeta);
         };
     }
 }
@@ -43,6 +43,24 @@ namespace Nektar
 {
     namespace NekOptimize
     {
+        /**
+         * Returns the name of the XML attribute which holds the block
+         * matrix flag of the given shape, or zero if there is none.
+         */
+        static const char *ShapeAttribute(const LibUtilities::ShapeType shape)
+        {
+            switch(shape)
+            {
+            case LibUtilities::eTriangle:      return "TRI";
+            case LibUtilities::eQuadrilateral: return "QUAD";
+            case LibUtilities::eTetrahedron:   return "TET";
+            case LibUtilities::ePyramid:       return "PYR";
+            case LibUtilities::ePrism:         return "PRISM";
+            case LibUtilities::eHexahedron:    return "HEX";
+            default:                           return 0;
+            }
+        }
+
         /**
          * @class GlobalOptParam
          *
@@ -56,8 +74,11 @@ namespace Nektar
          */
         GlobalOptParam::GlobalOptParam(const int nel):
             m_doGlobalMatOp(SIZE_OptimizeOperationType,false),
+            m_doCollectionOp(SIZE_OptimizeOperationType,false),
             m_shapeList(1,LibUtilities::eNoShapeType),
-            m_shapeNumElements(1,nel)
+            m_shapeNumElements(1,nel),
+            m_doAutoTune(false),
+            m_autoTuneCache("")
         {
             Array<OneD, bool> set_false(1,false);
             m_doBlockMatOp = Array<OneD, Array<OneD, bool > > 
@@ -70,7 +91,10 @@ namespace Nektar
          */
         GlobalOptParam::GlobalOptParam(const LibUtilities::SessionReaderSharedPtr& pSession, const int dim,
                                          const Array<OneD, const int> &NumShapeElements):
-            m_doGlobalMatOp(SIZE_OptimizeOperationType,false)
+            m_doGlobalMatOp(SIZE_OptimizeOperationType,false),
+            m_doCollectionOp(SIZE_OptimizeOperationType,false),
+            m_doAutoTune(false),
+            m_autoTuneCache("")
         {
             int i;
             int numShapes = 0;
@@ -144,6 +168,32 @@ namespace Nektar
                         "GLOBALOPTIMIZATIONPARAMETERS tag.").c_str());
             }
 
+            TiXmlElement* autoTune = paramList->FirstChildElement("AUTOTUNE");
+            if(autoTune)
+            {
+                int value;
+                int err = autoTune->QueryIntAttribute("VALUE", &value);
+                ASSERTL0(err == TIXML_SUCCESS,
+                         "Unable to read AUTOTUNE attribute VALUE.");
+                m_doAutoTune = (bool) value;
+
+                const char *cache = autoTune->Attribute("CACHE");
+                if(cache)
+                {
+                    m_autoTuneCache = std::string(cache);
+                }
+            }
+
+            ReadOperations(paramList);
+        }
+
+        /**
+         * Reads the optimisation flags of each operation listed as a child
+         * of \a paramList. Operations which are not listed are left
+         * unchanged.
+         */
+        void GlobalOptParam::ReadOperations(TiXmlElement *paramList)
+        {
             int n;
             for(n = 0; n < SIZE_OptimizeOperationType; n++)
             {
@@ -170,6 +220,24 @@ namespace Nektar
                         m_doGlobalMatOp[n] = (bool) value;
                     }
 
+                    arrayElement = operationType
+                                        ->FirstChildElement("DO_COLLECTION_OP");
+                    if(arrayElement)
+                    {
+                        int value;
+                        int err;
+
+                        err = arrayElement->QueryIntAttribute("VALUE", &value);
+                        ASSERTL0(err == TIXML_SUCCESS,(
+                           std::string("Unable to read DO_COLLECTION_OP "
+                                       "attribute VALUE for ")
+                         + std::string(OptimizationOperationTypeMap[n])
+                         + std::string(".")
+                        ));
+
+                        m_doCollectionOp[n] = (bool) value;
+                    }
+
                     arrayElement
                         = operationType->FirstChildElement("DO_BLOCK_MAT_OP");
                     if(arrayElement)
@@ -177,75 +245,161 @@ namespace Nektar
                         int value;
                         int err;
 
-                        switch (dim)
+                        for(int i = 0; i < m_shapeList.num_elements(); ++i)
                         {
-                        case 1:
-                            break;
-                        case 2:
-                            err = arrayElement->QueryIntAttribute("TRI", &value);
-                            ASSERTL0(err == TIXML_SUCCESS, (
-                               std::string("Unable to read DO_BLOCK_MAT_OP "
-                                           "attribute TRI for ")
-                             + std::string(OptimizationOperationTypeMap[n])
-                               + std::string(".")));
-
-                            m_doBlockMatOp[n][0] = (bool) value;
+                            const char *attr = ShapeAttribute(m_shapeList[i]);
+                            if(!attr)
+                            {
+                                continue;
+                            }
 
-                            err = arrayElement->QueryIntAttribute("QUAD", &value);
+                            err = arrayElement->QueryIntAttribute(attr, &value);
                             ASSERTL0(err == TIXML_SUCCESS, (
                                std::string("Unable to read DO_BLOCK_MAT_OP "
-                                           "attribute QUAD for ")
+                                           "attribute ") + std::string(attr)
+                             + std::string(" for ")
                              + std::string(OptimizationOperationTypeMap[n])
                              + std::string(".")));
 
-                            m_doBlockMatOp[n][1] = (bool) value;
-                            break;
-                        case 3:
-                            err = arrayElement->QueryIntAttribute("TET", &value);
-                            ASSERTL0(err == TIXML_SUCCESS, (
-                               std::string("Unable to read DO_BLOCK_MAT_OP "
-                                           "attribute TET for ")
-                             + std::string(OptimizationOperationTypeMap[n])
-                             + std::string(".")));
+                            m_doBlockMatOp[n][i] = (bool) value;
+                        }
+                    }
+                }
+            }
+        }
 
-                            m_doBlockMatOp[n][0] = (bool) value;
+        /**
+         * Writes the optimisation flags of all operations as children of
+         * \a paramList, in the format read by ReadOperations.
+         */
+        void GlobalOptParam::WriteOperations(TiXmlElement *paramList) const
+        {
+            for(int n = 0; n < SIZE_OptimizeOperationType; n++)
+            {
+                TiXmlElement *operationType
+                    = new TiXmlElement(OptimizationOperationTypeMap[n]);
 
-                            err = arrayElement->QueryIntAttribute("PYR", &value);
-                            ASSERTL0(err == TIXML_SUCCESS, (
-                               std::string("Unable to read DO_BLOCK_MAT_OP "
-                                           "attribute PYR for ")
-                             + std::string(OptimizationOperationTypeMap[n])
-                             + std::string(".")));
+                TiXmlElement *arrayElement
+                    = new TiXmlElement("DO_GLOBAL_MAT_OP");
+                arrayElement->SetAttribute("VALUE", m_doGlobalMatOp[n] ? 1 : 0);
+                operationType->LinkEndChild(arrayElement);
 
-                            m_doBlockMatOp[n][1] = (bool) value;
+                arrayElement = new TiXmlElement("DO_COLLECTION_OP");
+                arrayElement->SetAttribute("VALUE",
+                                           m_doCollectionOp[n] ? 1 : 0);
+                operationType->LinkEndChild(arrayElement);
 
-                            err = arrayElement->QueryIntAttribute("PRISM", &value);
-                            ASSERTL0(err == TIXML_SUCCESS, (
-                               std::string("Unable to read DO_BLOCK_MAT_OP "
-                                           "attribute PRISM for ")
-                             + std::string(OptimizationOperationTypeMap[n])
-                             + std::string(".")));
+                arrayElement = new TiXmlElement("DO_BLOCK_MAT_OP");
+                for(int i = 0; i < m_shapeList.num_elements(); ++i)
+                {
+                    const char *attr = ShapeAttribute(m_shapeList[i]);
+                    if(attr)
+                    {
+                        arrayElement->SetAttribute(
+                            attr, m_doBlockMatOp[n][i] ? 1 : 0);
+                    }
+                }
+                operationType->LinkEndChild(arrayElement);
 
-                            m_doBlockMatOp[n][2] = (bool) value;
+                paramList->LinkEndChild(operationType);
+            }
+        }
 
-                            err = arrayElement->QueryIntAttribute("HEX", &value);
-                            ASSERTL0(err == TIXML_SUCCESS, (
-                               std::string("Unable to read DO_BLOCK_MAT_OP "
-                                           "attribute HEX for ")
-                             + std::string(OptimizationOperationTypeMap[n])
-                             + std::string(".")));
+        /**
+         * The cache file holds one ENTRY element per mesh and expansion,
+         * identified by its KEY attribute, inside an AUTOTUNECACHE block.
+         *
+         * @param   key         Identifier of the mesh and expansion.
+         * @returns True if an entry was found and loaded.
+         */
+        bool GlobalOptParam::ImportAutoTuneCache(const std::string &key)
+        {
+            if(m_autoTuneCache == "")
+            {
+                return false;
+            }
 
-                            m_doBlockMatOp[n][3] = (bool) value;
-                            break;
+            TiXmlDocument doc;
+            if(!doc.LoadFile(m_autoTuneCache))
+            {
+                return false;
+            }
 
-                            break;
+            TiXmlHandle docHandle(&doc);
+            TiXmlElement* entry = docHandle.FirstChildElement("NEKTAR")
+                                           .FirstChildElement("AUTOTUNECACHE")
+                                           .FirstChildElement("ENTRY")
+                                           .Element();
 
-                        }
-                    }
+            for(; entry; entry = entry->NextSiblingElement("ENTRY"))
+            {
+                const char *entryKey = entry->Attribute("KEY");
+                if(entryKey && key == std::string(entryKey))
+                {
+                    ReadOperations(entry);
+                    return true;
                 }
             }
+
+            return false;
         }
 
+        /**
+         * Any existing entry with the same key is replaced; entries for
+         * other meshes are preserved.
+         *
+         * @param   key         Identifier of the mesh and expansion.
+         */
+        void GlobalOptParam::ExportAutoTuneCache(const std::string &key) const
+        {
+            if(m_autoTuneCache == "")
+            {
+                return;
+            }
+
+            TiXmlDocument doc;
+            TiXmlElement *cache = 0;
+
+            if(doc.LoadFile(m_autoTuneCache))
+            {
+                TiXmlHandle docHandle(&doc);
+                cache = docHandle.FirstChildElement("NEKTAR")
+                                 .FirstChildElement("AUTOTUNECACHE")
+                                 .Element();
+            }
+
+            if(!cache)
+            {
+                doc.Clear();
+                doc.LinkEndChild(new TiXmlDeclaration("1.0", "utf-8", ""));
+                TiXmlElement *root = new TiXmlElement("NEKTAR");
+                doc.LinkEndChild(root);
+                cache = new TiXmlElement("AUTOTUNECACHE");
+                root->LinkEndChild(cache);
+            }
+
+            TiXmlElement *entry = cache->FirstChildElement("ENTRY");
+            while(entry)
+            {
+                TiXmlElement *next = entry->NextSiblingElement("ENTRY");
+                const char *entryKey = entry->Attribute("KEY");
+                if(entryKey && key == std::string(entryKey))
+                {
+                    cache->RemoveChild(entry);
+                }
+                entry = next;
+            }
+
+            entry = new TiXmlElement("ENTRY");
+            entry->SetAttribute("KEY", key);
+            WriteOperations(entry);
+            cache->LinkEndChild(entry);
+
+            bool saveOkay = doc.SaveFile(m_autoTuneCache);
+            ASSERTL0(saveOkay, (std::string("Unable to write auto-tune "
+                                            "cache file: ") +
+                                m_autoTuneCache).c_str());
+        }
 
     } // end of namespace
 } // end of namespace
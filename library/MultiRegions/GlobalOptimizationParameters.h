@@ -39,6 +39,9 @@
 #include <LibUtilities/BasicUtils/SessionReader.h>
 #include <StdRegions/StdRegions.hpp>
 #include <MultiRegions/MultiRegionsDeclspec.h>
+#include <string>
+
+class TiXmlElement;
 
 namespace Nektar
 {
@@ -56,6 +59,7 @@ namespace Nektar
             eWeakDerivMatrixOp,
             eHelmholtzMatrixOp,
             eHybridDGHelmBndLamMatrixOp,
+            ePhysDeriv,
             SIZE_OptimizeOperationType
         };
 
@@ -69,7 +73,8 @@ namespace Nektar
             "LaplacianMatrixIJOp",
             "WeakDerivMatrixOp",
             "HelmholtzMatrixOp",
-            "HybridDGHelmBndLamMatrixOp"
+            "HybridDGHelmBndLamMatrixOp",
+            "PhysDeriv"
         };
 
         /// Processes global optimisation parameters from a session.
@@ -92,14 +97,58 @@ namespace Nektar
             /// done with a block matrix
             // inline
             inline const Array<OneD, const bool>  &DoBlockMatOp(const StdRegions::MatrixType i) const;
+
+            /// For a given operation, determines if the operation should be
+            /// done by the multi-element collections
+            inline bool DoCollectionOp(const OptimizationOperationType i) const;
             
             inline const Array<OneD, const LibUtilities::ShapeType>  &GetShapeList() const;
             inline const Array<OneD, const int>  &GetShapeNumElements() const; 
 
+            /// Determines if the optimisation parameters should be chosen
+            /// by timing the candidate implementations.
+            inline bool DoAutoTune() const;
+
+            /// Name of the file in which auto-tuned parameters are cached.
+            inline const std::string &GetAutoTuneCache() const;
+
+            /// Sets whether an operation is evaluated globally.
+            inline void SetGlobalMatOp(const OptimizationOperationType i,
+                                       const bool value);
+
+            /// Sets whether an operation is evaluated with a block matrix
+            /// for the given entry of the shape list.
+            inline void SetBlockMatOp(const OptimizationOperationType i,
+                                      const int shape, const bool value);
+
+            /// Sets whether an operation is evaluated by the multi-element
+            /// collections.
+            inline void SetCollectionOp(const OptimizationOperationType i,
+                                        const bool value);
+
+            /// Takes the choice of multi-element collections from \a in,
+            /// e.g. the parameters tuned for the domain.
+            inline void CopyCollectionOps(const GlobalOptParam &in);
+
+            /// Load parameters stored under \a key in the auto-tune cache.
+            MULTI_REGIONS_EXPORT bool ImportAutoTuneCache(
+                const std::string &key);
+
+            /// Store the current parameters under \a key in the auto-tune
+            /// cache.
+            MULTI_REGIONS_EXPORT void ExportAutoTuneCache(
+                const std::string &key) const;
+
         private:
             /// Default constructor should not be called
             GlobalOptParam() {};
 
+            /// Read the per-operation flags from an XML element.
+            void ReadOperations(TiXmlElement *paramList);
+
+            /// Write the per-operation flags to an XML element.
+            void WriteOperations(TiXmlElement *paramList) const;
+
             /// Flags indicating if different matrices should be evaluated
             /// globally.
             Array<OneD,bool> m_doGlobalMatOp;
@@ -110,6 +159,11 @@ namespace Nektar
             /// matrix
             Array<OneD, Array<OneD,bool> > m_doBlockMatOp; 
 
+            /// Flags indicating if different operations should be
+            /// evaluated collectively over groups of elements sharing the
+            /// same standard expansion and geometry type.
+            Array<OneD,bool> m_doCollectionOp;
+
             /// A list ExpansionTypes indicating the order in which
             /// shapes are listed to call the appropriate key for the
             /// block matrices.
@@ -117,6 +171,12 @@ namespace Nektar
 
             /// A list of  number of elements contained within each shape type
             Array<OneD, const int> m_shapeNumElements;
+
+            /// Flag indicating if the parameters are chosen by timing.
+            bool m_doAutoTune;
+
+            /// File in which auto-tuned parameters are cached.
+            std::string m_autoTuneCache;
         };
 
         /// Pointer to a GlobalOptParam object.
@@ -228,6 +288,16 @@ namespace Nektar
             return m_doBlockMatOp[type];
         }
 
+        /**
+         * @param   i           Type of operation.
+         * @returns True if this operation should be evaluated using the
+         *          multi-element collections.
+         */
+        inline bool GlobalOptParam::DoCollectionOp(const OptimizationOperationType i) const
+        {
+            return m_doCollectionOp[i];
+        }
+
         inline const Array<OneD, const int>  &GlobalOptParam::GetShapeNumElements() const
         {
             return m_shapeNumElements;
@@ -238,6 +308,43 @@ namespace Nektar
             return m_shapeList;
         }
 
+        inline bool GlobalOptParam::DoAutoTune() const
+        {
+            return m_doAutoTune;
+        }
+
+        inline const std::string &GlobalOptParam::GetAutoTuneCache() const
+        {
+            return m_autoTuneCache;
+        }
+
+        inline void GlobalOptParam::SetGlobalMatOp(
+            const OptimizationOperationType i, const bool value)
+        {
+            m_doGlobalMatOp[i] = value;
+        }
+
+        inline void GlobalOptParam::SetBlockMatOp(
+            const OptimizationOperationType i, const int shape, const bool value)
+        {
+            m_doBlockMatOp[i][shape] = value;
+        }
+
+        inline void GlobalOptParam::SetCollectionOp(
+            const OptimizationOperationType i, const bool value)
+        {
+            m_doCollectionOp[i] = value;
+        }
+
+        inline void GlobalOptParam::CopyCollectionOps(
+            const GlobalOptParam &in)
+        {
+            for(int i = 0; i < SIZE_OptimizeOperationType; ++i)
+            {
+                m_doCollectionOp[i] = in.m_doCollectionOp[i];
+            }
+        }
+
 
 
     } // end of namespace
@@ -86,6 +86,7 @@ namespace Nektar
             eXxtFullMatrix,
             eXxtStaticCond,
             eXxtMultiLevelStaticCond,
+            eDirectSparseStaticCond,
             eSIZE_GlobalSysSolnType
         };
 
@@ -101,7 +102,22 @@ namespace Nektar
             "IterativeMultiLevelStaticCond",
             "XxtFull",
             "XxtStaticCond",
-            "XxtMultiLevelStaticCond"
+            "XxtMultiLevelStaticCond",
+            "DirectSparseStaticCond"
+        };
+
+        /// Algorithm used by the iterative global linear system solvers.
+        enum IterativeMethod
+        {
+            eConjugateGradient,          ///< Reduced-communication PCG
+            ePipelinedConjugateGradient, ///< Reductions overlapped with work
+            eSIZE_IterativeMethod
+        };
+
+        const char* const IterativeMethodMap[] =
+        {
+            "ConjugateGradient",
+            "PipelinedConjugateGradient"
         };
 
         /// Type of Galerkin projection.
@@ -121,7 +137,8 @@ namespace Nektar
             eLowEnergy,
             eLinearWithLowEnergy,
             eBlock,
-            eLinearWithBlock
+            eLinearWithBlock,
+            ePMultigrid
         };
 
         const char* const PreconditionerTypeMap[] =
@@ -133,7 +150,8 @@ namespace Nektar
 	        "LowEnergyBlock",
             "FullLinearSpaceWithLowEnergyBlock",
             "Block",
-            "FullLinearSpaceWithBlock"
+            "FullLinearSpaceWithBlock",
+            "PMultigrid"
         };
 
 
@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PointLocator.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Bounding box search structure for point location
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <MultiRegions/PointLocator.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
+#include <LibUtilities/BasicConst/NektarUnivConsts.hpp>
+#include <SpatialDomains/Geometry.h>
+#include <algorithm>
+#include <cmath>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * @class PointLocator
+         *
+         * Locating the element which contains an arbitrary point requires
+         * the inversion of the element mapping, which is a Newton iteration
+         * for deformed elements. Rather than attempting this on every
+         * element, the bounding box of each element is computed once from
+         * its quadrature point coordinates and the elements are sorted into
+         * a uniform grid of bins covering the domain. A query then only
+         * inverts the mapping of the elements whose bounding box contains
+         * the point.
+         *
+         * Bounding boxes are enlarged by a fraction of the element size to
+         * account for curved edges lying between quadrature points and for
+         * the tolerance used when testing the local coordinates.
+         */
+
+        /// Relative enlargement of the element bounding boxes.
+        static const NekDouble kBoxPadding = 0.1;
+
+        /**
+         * @param   pExp        Elements of the expansion list.
+         */
+        PointLocator::PointLocator(const LocalRegions::ExpansionVector &pExp)
+            : m_exp(pExp),
+              m_dim(0)
+        {
+            int i, j, d;
+            int nElmt = m_exp.size();
+
+            for (i = 0; i < nElmt; ++i)
+            {
+                m_dim = std::max(m_dim, m_exp[i]->GetCoordim());
+            }
+            m_dim = std::min(m_dim, 3);
+
+            m_boxMin.resize(3*nElmt, 0.0);
+            m_boxMax.resize(3*nElmt, 0.0);
+
+            // Bounding box of each element from its quadrature points.
+            for (i = 0; i < nElmt; ++i)
+            {
+                int npts = m_exp[i]->GetTotPoints();
+                Array<OneD, Array<OneD, NekDouble> > coords(3);
+                for (d = 0; d < 3; ++d)
+                {
+                    coords[d] = Array<OneD, NekDouble>(npts, 0.0);
+                }
+                m_exp[i]->GetCoords(coords[0], coords[1], coords[2]);
+
+                NekDouble size = 0.0;
+                for (d = 0; d < m_dim; ++d)
+                {
+                    m_boxMin[3*i+d] = Vmath::Vmin(npts, &coords[d][0], 1);
+                    m_boxMax[3*i+d] = Vmath::Vmax(npts, &coords[d][0], 1);
+                    size = std::max(size, m_boxMax[3*i+d] - m_boxMin[3*i+d]);
+                }
+
+                NekDouble pad = kBoxPadding*size + NekConstants::kNekZeroTol;
+                for (d = 0; d < m_dim; ++d)
+                {
+                    m_boxMin[3*i+d] -= pad;
+                    m_boxMax[3*i+d] += pad;
+                }
+            }
+
+            // Extent of the grid and the number of directions with a
+            // non-zero extent.
+            NekDouble extent[3] = {0.0, 0.0, 0.0};
+            NekDouble volume    = 1.0;
+            int       nActive   = 0;
+            for (d = 0; d < 3; ++d)
+            {
+                m_min     [d] = 0.0;
+                m_binWidth[d] = 1.0;
+                m_nBins   [d] = 1;
+            }
+
+            for (d = 0; d < m_dim && nElmt > 0; ++d)
+            {
+                NekDouble max = m_boxMax[d];
+                m_min[d] = m_boxMin[d];
+                for (i = 1; i < nElmt; ++i)
+                {
+                    m_min[d] = std::min(m_min[d], m_boxMin[3*i+d]);
+                    max      = std::max(max,      m_boxMax[3*i+d]);
+                }
+                extent[d] = max - m_min[d];
+
+                if (extent[d] > NekConstants::kNekZeroTol)
+                {
+                    volume *= extent[d];
+                    ++nActive;
+                }
+            }
+
+            // Choose the bin width such that there is roughly one element
+            // per bin.
+            if (nActive > 0)
+            {
+                NekDouble width = std::pow(volume/nElmt, 1.0/nActive);
+                for (d = 0; d < m_dim; ++d)
+                {
+                    if (extent[d] > NekConstants::kNekZeroTol)
+                    {
+                        m_nBins[d] = std::max(1, std::min(nElmt,
+                                        (int) std::ceil(extent[d]/width)));
+                        m_binWidth[d] = extent[d]/m_nBins[d];
+                    }
+                }
+            }
+
+            m_bins.resize(m_nBins[0]*m_nBins[1]*m_nBins[2]);
+
+            // Insert each element in all bins overlapped by its bounding box.
+            for (i = 0; i < nElmt; ++i)
+            {
+                int lo[3] = {0, 0, 0};
+                int hi[3] = {0, 0, 0};
+                for (d = 0; d < m_dim; ++d)
+                {
+                    lo[d] = BinCoord(m_boxMin[3*i+d], d);
+                    hi[d] = BinCoord(m_boxMax[3*i+d], d);
+                }
+
+                for (int k = lo[2]; k <= hi[2]; ++k)
+                {
+                    for (j = lo[1]; j <= hi[1]; ++j)
+                    {
+                        for (int l = lo[0]; l <= hi[0]; ++l)
+                        {
+                            m_bins[l + m_nBins[0]*(j + m_nBins[1]*k)]
+                                .push_back(i);
+                        }
+                    }
+                }
+            }
+        }
+
+
+        /**
+         * The element given by @a hint, typically the element found for a
+         * nearby point, is tested first. If no element contains the point,
+         * -1 is returned, and @a locCoords and @a resid hold the local
+         * coordinates and residual of the closest candidate tested.
+         *
+         * @param   gloCoords   Global coordinates of the point.
+         * @param   locCoords   Local coordinates of the point in the
+         *                      element found.
+         * @param   tol         Tolerance on the local coordinates.
+         * @param   resid       Residual of the mapping inversion.
+         * @param   hint        Element to test first, or -1.
+         * @returns Element id, or -1 if not found.
+         */
+        int PointLocator::FindElement(
+            const Array<OneD, const NekDouble> &gloCoords,
+                  Array<OneD, NekDouble>       &locCoords,
+                  NekDouble                     tol,
+                  NekDouble                    &resid,
+                  int                           hint) const
+        {
+            NekDouble r;
+            int       nLoc     = locCoords.num_elements();
+            int       minElmt  = -1;
+            Array<OneD, NekDouble> minLocCoords(nLoc);
+
+            resid = NekConstants::kNekMinResidInit;
+
+            if (hint >= 0 && hint < (int) m_exp.size() &&
+                InBox(gloCoords, hint))
+            {
+                if (m_exp[hint]->GetGeom()->ContainsPoint(
+                        gloCoords, locCoords, tol, r))
+                {
+                    resid = r;
+                    return hint;
+                }
+                resid   = r;
+                minElmt = hint;
+                Vmath::Vcopy(nLoc, locCoords, 1, minLocCoords, 1);
+            }
+
+            // Locate the bin containing the point.
+            int bin[3] = {0, 0, 0};
+            int nDim   = std::min(m_dim, (int) gloCoords.num_elements());
+            for (int d = 0; d < nDim; ++d)
+            {
+                if (gloCoords[d] < m_min[d] ||
+                    gloCoords[d] > m_min[d] + m_nBins[d]*m_binWidth[d])
+                {
+                    return -1;
+                }
+                bin[d] = BinCoord(gloCoords[d], d);
+            }
+
+            const std::vector<int> &candidates =
+                m_bins[bin[0] + m_nBins[0]*(bin[1] + m_nBins[1]*bin[2])];
+
+            for (int i = 0; i < candidates.size(); ++i)
+            {
+                int elmt = candidates[i];
+                if (elmt == hint || !InBox(gloCoords, elmt))
+                {
+                    continue;
+                }
+
+                if (m_exp[elmt]->GetGeom()->ContainsPoint(
+                        gloCoords, locCoords, tol, r))
+                {
+                    resid = r;
+                    return elmt;
+                }
+
+                if (r < resid)
+                {
+                    resid   = r;
+                    minElmt = elmt;
+                    Vmath::Vcopy(nLoc, locCoords, 1, minLocCoords, 1);
+                }
+            }
+
+            if (minElmt >= 0)
+            {
+                Vmath::Vcopy(nLoc, minLocCoords, 1, locCoords, 1);
+            }
+
+            return -1;
+        }
+
+
+        bool PointLocator::InBox(
+            const Array<OneD, const NekDouble> &gloCoords,
+            const int                           elmt) const
+        {
+            int nDim = std::min(m_dim, (int) gloCoords.num_elements());
+            for (int d = 0; d < nDim; ++d)
+            {
+                if (gloCoords[d] < m_boxMin[3*elmt+d] ||
+                    gloCoords[d] > m_boxMax[3*elmt+d])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+
+        int PointLocator::BinCoord(const NekDouble x, const int dir) const
+        {
+            int i = (int) std::floor((x - m_min[dir])/m_binWidth[dir]);
+            return std::max(0, std::min(i, m_nBins[dir] - 1));
+        }
+    }
+}
@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PointLocator.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Bounding box search structure for point location
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_POINTLOCATOR_H
+#define NEKTAR_LIB_MULTIREGIONS_POINTLOCATOR_H
+
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <LocalRegions/Expansion.h>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /// Uniform grid of bins over the element bounding boxes of an
+        /// expansion list, used to locate the element containing a point.
+        class PointLocator
+        {
+        public:
+            /// Build the bins from the elements of an expansion list.
+            MULTI_REGIONS_EXPORT PointLocator(
+                const LocalRegions::ExpansionVector &pExp);
+
+            MULTI_REGIONS_EXPORT ~PointLocator() {}
+
+            /// Find the element containing a point, testing only the
+            /// elements whose bounding box contains the point.
+            MULTI_REGIONS_EXPORT int FindElement(
+                const Array<OneD, const NekDouble> &gloCoords,
+                      Array<OneD, NekDouble>       &locCoords,
+                      NekDouble                     tol,
+                      NekDouble                    &resid,
+                      int                           hint = -1) const;
+
+            /// Number of bins in the grid.
+            inline int GetNumBins() const;
+
+        private:
+            /// Elements of the expansion list.
+            LocalRegions::ExpansionVector m_exp;
+
+            /// Number of coordinate directions used for binning.
+            int m_dim;
+
+            /// Lower corner of the grid.
+            NekDouble m_min[3];
+
+            /// Width of a bin in each direction.
+            NekDouble m_binWidth[3];
+
+            /// Number of bins in each direction.
+            int m_nBins[3];
+
+            /// Lower corner of the bounding box of each element.
+            std::vector<NekDouble> m_boxMin;
+
+            /// Upper corner of the bounding box of each element.
+            std::vector<NekDouble> m_boxMax;
+
+            /// Element ids whose bounding box overlaps each bin.
+            std::vector<std::vector<int> > m_bins;
+
+            /// Determines if a point lies in the bounding box of an element.
+            bool InBox(
+                const Array<OneD, const NekDouble> &gloCoords,
+                const int                           elmt) const;
+
+            /// Bin index of a coordinate in a given direction.
+            int BinCoord(const NekDouble x, const int dir) const;
+        };
+
+        typedef boost::shared_ptr<PointLocator> PointLocatorSharedPtr;
+
+        inline int PointLocator::GetNumBins() const
+        {
+            return m_bins.size();
+        }
+    }
+}
+
+#endif
@@ -42,7 +42,7 @@ namespace Nektar
 {
     namespace MultiRegions
     {
-        std::string Preconditioner::lookupIds[9] = {
+        std::string Preconditioner::lookupIds[10] = {
             LibUtilities::SessionReader::RegisterEnumValue(
                 "Preconditioner", "Null", eNull),
             LibUtilities::SessionReader::RegisterEnumValue(
@@ -61,6 +61,8 @@ namespace Nektar
                 "Preconditioner", "Block",eBlock),
             LibUtilities::SessionReader::RegisterEnumValue(
                 "Preconditioner", "FullLinearSpaceWithBlock",eLinearWithBlock),
+            LibUtilities::SessionReader::RegisterEnumValue(
+                "Preconditioner", "PMultigrid",ePMultigrid),
         };
         std::string Preconditioner::def =
             LibUtilities::SessionReader::RegisterDefaultSolverInfo(
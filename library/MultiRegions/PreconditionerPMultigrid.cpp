@@ -0,0 +1,1048 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PreconditionerPMultigrid.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: p-multigrid preconditioner definition
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LibUtilities/Communication/Xxt.hpp>
+#include <MultiRegions/PreconditionerPMultigrid.h>
+#include <MultiRegions/GlobalLinSysIterative.h>
+#include <math.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * Registers the class with the Factory.
+         */
+        string PreconditionerPMultigrid::className
+                = GetPreconFactory().RegisterCreatorFunction(
+                    "PMultigrid",
+                    PreconditionerPMultigrid::create,
+                    "p-multigrid with algebraic multigrid on the linear space");
+
+        namespace
+        {
+            /// Degree of the Chebyshev smoother on every level.
+            const int       s_smoothDegree = 3;
+            /// Largest number of levels in the hierarchy.
+            const int       s_maxLevels    = 12;
+            /// Global size below which the vertex problem is not coarsened.
+            const int       s_coarseSize   = 200;
+            /// Coarsening stops if a level does not reduce the size by this.
+            const NekDouble s_minReduction = 0.8;
+            /// Strength-of-connection threshold on the vertex level, halved
+            /// on each coarser level.
+            const NekDouble s_strength     = 0.08;
+            /// Number of power iterations used to estimate the spectrum.
+            const int       s_powerIts     = 10;
+
+            /// Pseudo-random value in [0.5,1.5) depending only on @a id, so
+            /// that all processes holding a DOF agree on it.
+            NekDouble StartValue(long id)
+            {
+                NekDouble v = sin(12.9898*id + 78.233)*43758.5453;
+                return 0.5 + v - floor(v);
+            }
+        }
+
+        /**
+         * @class PreconditionerPMultigrid
+         *
+         * Multigrid V-cycle for the statically condensed boundary system.
+         *
+         * The first coarsening is in polynomial order, directly to the linear
+         * space. The vertex modes are a subset of the boundary modes, so
+         * restriction is injection and the coarse operator is the vertex
+         * block of the assembled Schur complement. The vertex problem is then
+         * coarsened by smoothed aggregation until it is small enough to be
+         * solved directly: by a Cholesky factorisation in serial and by XXT
+         * in parallel.
+         *
+         * Every level is smoothed by a Chebyshev polynomial in the Jacobi
+         * preconditioned operator, so the cycle is symmetric and may be used
+         * with the conjugate gradient method.
+         *
+         * In parallel the algebraic levels are stored partially assembled on
+         * each process, in the same way as the elemental operators. DOFs on
+         * process boundaries are never aggregated with other DOFs, so each
+         * process holds identical rows of the prolongation for them and can
+         * form its part of the Galerkin product independently.
+         */
+        PreconditionerPMultigrid::PreconditionerPMultigrid(
+            const boost::shared_ptr<GlobalLinSys> &plinsys,
+            const AssemblyMapSharedPtr &pLocToGloMap)
+            : Preconditioner(plinsys, pLocToGloMap),
+              m_sharedGsh(0),
+              m_crsData(0)
+        {
+        }
+
+        PreconditionerPMultigrid::~PreconditionerPMultigrid()
+        {
+            Gs::Finalise(m_sharedGsh);
+            Xxt::Finalise(m_crsData);
+        }
+
+        void PreconditionerPMultigrid::v_InitObject()
+        {
+        }
+
+        void PreconditionerPMultigrid::v_BuildPreconditioner()
+        {
+            GlobalSysSolnType solvertype =
+                m_locToGloMap->GetGlobalSysSolnType();
+            ASSERTL0(solvertype == eIterativeStaticCond,
+                     "PMultigrid preconditioning is only implemented for "
+                     "the IterativeStaticCond solver");
+
+            m_rowComm = m_locToGloMap->GetComm()->GetRowComm();
+
+            SetUpBoundaryLevel();
+            SetUpVertexLevel();
+            SetUpAggregationLevels();
+            SetUpCoarseSolve();
+        }
+
+        /**
+         * Level 0 uses the matrix-vector product of the iterative solver, on
+         * vectors of all global boundary DOFs. The Dirichlet DOFs at the
+         * start are kept at zero by setting their inverse diagonal to zero.
+         */
+        void PreconditionerPMultigrid::SetUpBoundaryLevel()
+        {
+            int i;
+            int nGlobBnd = m_locToGloMap->GetNumGlobalBndCoeffs();
+            int nDir     = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+
+            m_levels.resize(1);
+            Level &fine = m_levels[0];
+            fine.m_rows = nGlobBnd;
+            AllocateWork(fine);
+
+            // Assemble diagonal contributions across processes
+            Array<OneD, NekDouble> diagonals =
+                AssembleStaticCondGlobalDiagonals();
+            Array<OneD, NekDouble> vOutput(nGlobBnd, 0.0);
+            Array<OneD, NekDouble> tmp;
+            Vmath::Vcopy(nGlobBnd - nDir, diagonals, 1, tmp = vOutput + nDir, 1);
+            m_locToGloMap->UniversalAssembleBnd(vOutput);
+
+            const Array<OneD, const int> &unique =
+                m_locToGloMap->GetGlobalToUniversalBndMapUnique();
+
+            fine.m_invDiag = Array<OneD, NekDouble>(nGlobBnd, 0.0);
+            fine.m_unique  = Array<OneD, int>      (nGlobBnd, 0);
+            for (i = nDir; i < nGlobBnd; ++i)
+            {
+                fine.m_invDiag[i] = 1.0/vOutput[i];
+                fine.m_unique [i] = unique[i];
+            }
+
+            fine.m_lambda = EstimateLambda(0);
+        }
+
+        /**
+         * Level 1 is the linear space. Its operator is extracted from the
+         * elemental Schur complements, so that it is exactly the Galerkin
+         * projection of level 0.
+         */
+        void PreconditionerPMultigrid::SetUpVertexLevel()
+        {
+            int i, j, n, cnt, gid1, gid2;
+            NekDouble sign1, sign2;
+
+            boost::shared_ptr<MultiRegions::ExpList>
+                expList = ((m_linsys.lock())->GetLocMat()).lock();
+            m_vertLocToGloMap = m_locToGloMap->XxtLinearSpaceMap(*expList);
+
+            int nGlobBnd = m_locToGloMap->GetNumGlobalBndCoeffs();
+            int nVertLoc = m_vertLocToGloMap->GetNumLocalCoeffs();
+            int nVertGlo = m_vertLocToGloMap->GetNumGlobalCoeffs();
+            int nVertDir = m_vertLocToGloMap->GetNumGlobalDirBndCoeffs();
+            int nVert    = nVertGlo - nVertDir;
+
+            // Map between boundary DOFs and non-Dirichlet vertex DOFs. The
+            // boundary map of the linear space map stores the original
+            // global IDs.
+            Array<OneD, int> fineToVert(nGlobBnd, -1);
+            m_vertToFine = Array<OneD, int>(nVert, -1);
+            for (i = 0; i < nVertLoc; ++i)
+            {
+                gid1 = m_vertLocToGloMap->GetLocalToGlobalMap(i) - nVertDir;
+                if (gid1 >= 0)
+                {
+                    gid2 = m_vertLocToGloMap->GetLocalToGlobalBndMap(i);
+                    m_vertToFine[gid1] = gid2;
+                    fineToVert  [gid2] = gid1;
+                }
+            }
+
+            // Extract vertex-vertex entries of the elemental Schur
+            // complements.
+            COOMatType coo;
+            DNekScalBlkMatSharedPtr loc_mat;
+            DNekScalMatSharedPtr    bnd_mat;
+            for (cnt = n = 0; n < m_linsys.lock()->GetNumBlocks(); ++n)
+            {
+                loc_mat = (m_linsys.lock())->GetStaticCondBlock(n);
+                bnd_mat = loc_mat->GetBlock(0, 0);
+                int bnd_row = bnd_mat->GetRows();
+
+                for (i = 0; i < bnd_row; ++i)
+                {
+                    gid1 = fineToVert[
+                        m_locToGloMap->GetLocalToGlobalBndMap(cnt + i)];
+                    if (gid1 < 0)
+                    {
+                        continue;
+                    }
+                    sign1 = m_locToGloMap->GetLocalToGlobalBndSign(cnt + i);
+
+                    for (j = 0; j < bnd_row; ++j)
+                    {
+                        gid2 = fineToVert[
+                            m_locToGloMap->GetLocalToGlobalBndMap(cnt + j)];
+                        if (gid2 < 0)
+                        {
+                            continue;
+                        }
+                        sign2 = m_locToGloMap->GetLocalToGlobalBndSign(cnt + j);
+                        coo[std::make_pair(gid1, gid2)]
+                            += sign1*sign2*(*bnd_mat)(i, j);
+                    }
+                }
+                cnt += bnd_row;
+            }
+
+            m_levels.resize(2);
+            Level &vert = m_levels[1];
+            vert.m_rows = nVert;
+            AllocateWork(vert);
+            CooToCsr(nVert, nVert, coo, vert.m_A);
+
+            // Count the processes holding each vertex to find those on
+            // process boundaries.
+            Array<OneD, NekDouble> mult(nVertGlo, 0.0);
+            for (i = 0; i < nVertLoc; ++i)
+            {
+                mult[m_vertLocToGloMap->GetLocalToGlobalMap(i)] = 1.0;
+            }
+            m_vertLocToGloMap->UniversalAssemble(mult);
+
+            const Array<OneD, const int> &univ =
+                m_vertLocToGloMap->GetGlobalToUniversalMap();
+            const Array<OneD, const int> &unique =
+                m_vertLocToGloMap->GetGlobalToUniversalMapUnique();
+            bool parallel = univ.num_elements() > 0;
+
+            vert.m_invMult = Array<OneD, NekDouble>(nVert);
+            vert.m_unique  = Array<OneD, int>      (nVert);
+            std::vector<long> sharedId;
+            for (i = 0; i < nVert; ++i)
+            {
+                vert.m_invMult[i] = 1.0/mult[i + nVertDir];
+                vert.m_unique [i] = parallel ? unique[i + nVertDir] : 1;
+                if (mult[i + nVertDir] > 1.5)
+                {
+                    vert.m_shared.push_back(i);
+                    sharedId.push_back(univ[i + nVertDir]);
+                }
+            }
+
+            int nShared = sharedId.size();
+            m_sharedId  = Array<OneD, long>(nShared);
+            m_sharedBuf = Array<OneD, NekDouble>(nShared);
+            for (i = 0; i < nShared; ++i)
+            {
+                m_sharedId[i] = sharedId[i];
+            }
+            m_sharedGsh = Gs::Init(m_sharedId, m_rowComm);
+
+            SetUpLevelDiagonal(1);
+            vert.m_lambda = EstimateLambda(1);
+        }
+
+        /**
+         * Coarsens the vertex problem by smoothed aggregation. The
+         * tentative prolongation is piecewise constant on each aggregate
+         * and is smoothed by one damped Jacobi step. DOFs on process
+         * boundaries keep an identity row.
+         */
+        void PreconditionerPMultigrid::SetUpAggregationLevels()
+        {
+            int i, j, l, k;
+
+            for (l = 1; l < s_maxLevels - 1; ++l)
+            {
+                Level &fine = m_levels[l];
+                int n = fine.m_rows;
+
+                // Number of DOFs on this level across all processes.
+                Array<OneD, NekDouble> counts(2, 0.0);
+                for (i = 0; i < n; ++i)
+                {
+                    counts[0] += fine.m_unique[i];
+                }
+
+                std::vector<int> agg;
+                int nAgg;
+                Aggregate(l, s_strength*pow(0.5, l - 1), agg, nAgg);
+
+                // Shared DOFs are counted once on the coarse level as well.
+                int nShared = fine.m_shared.size();
+                counts[1] = nAgg - nShared;
+                for (k = 0; k < nShared; ++k)
+                {
+                    counts[1] += fine.m_unique[fine.m_shared[k]];
+                }
+                m_rowComm->AllReduce(counts, LibUtilities::ReduceSum);
+
+                if (counts[0] <= s_coarseSize ||
+                    counts[1] > s_minReduction*counts[0])
+                {
+                    break;
+                }
+
+                // Smoothed prolongation P = (I - omega D^{-1} A) P_tent.
+                NekDouble omega = 4.0/(3.0*fine.m_lambda);
+                std::vector<bool> isShared(n, false);
+                for (k = 0; k < nShared; ++k)
+                {
+                    isShared[fine.m_shared[k]] = true;
+                }
+
+                CsrMatrix &P = fine.m_P;
+                P.m_rows = n;
+                P.m_cols = nAgg;
+                P.m_rowPtr.assign(n + 1, 0);
+                P.m_colIdx.clear();
+                P.m_val.clear();
+
+                std::vector<NekDouble> accum(nAgg, 0.0);
+                std::vector<int>       marker(nAgg, -1);
+                std::vector<int>       cols;
+                for (i = 0; i < n; ++i)
+                {
+                    cols.clear();
+                    cols.push_back(agg[i]);
+                    marker[agg[i]] = i;
+                    accum [agg[i]] = 1.0;
+
+                    if (!isShared[i])
+                    {
+                        NekDouble scale = omega*fine.m_invDiag[i];
+                        for (j = fine.m_A.m_rowPtr[i];
+                             j < fine.m_A.m_rowPtr[i+1]; ++j)
+                        {
+                            int c = agg[fine.m_A.m_colIdx[j]];
+                            if (marker[c] != i)
+                            {
+                                marker[c] = i;
+                                accum [c] = 0.0;
+                                cols.push_back(c);
+                            }
+                            accum[c] -= scale*fine.m_A.m_val[j];
+                        }
+                    }
+
+                    for (j = 0; j < cols.size(); ++j)
+                    {
+                        P.m_colIdx.push_back(cols[j]);
+                        P.m_val   .push_back(accum[cols[j]]);
+                    }
+                    P.m_rowPtr[i+1] = P.m_colIdx.size();
+                }
+
+                // Galerkin product P^T A P, partially assembled like A.
+                CsrMatrix AP, Pt;
+                Level coarse;
+                SparseProduct(fine.m_A, P, AP);
+                SparseTranspose(P, Pt);
+                SparseProduct(Pt, AP, coarse.m_A);
+
+                // The first nShared aggregates are the shared DOFs, in the
+                // same order as on the fine level.
+                coarse.m_rows    = nAgg;
+                coarse.m_invMult = Array<OneD, NekDouble>(nAgg, 1.0);
+                coarse.m_unique  = Array<OneD, int>      (nAgg, 1);
+                for (k = 0; k < nShared; ++k)
+                {
+                    coarse.m_shared.push_back(k);
+                    coarse.m_invMult[k] = fine.m_invMult[fine.m_shared[k]];
+                    coarse.m_unique [k] = fine.m_unique [fine.m_shared[k]];
+                }
+                AllocateWork(coarse);
+
+                m_levels.push_back(coarse);
+                SetUpLevelDiagonal(l + 1);
+                m_levels[l + 1].m_lambda = EstimateLambda(l + 1);
+            }
+        }
+
+        /**
+         * Standard three-phase aggregation over the DOFs which are not on a
+         * process boundary. The shared DOFs are placed first, each in an
+         * aggregate of its own.
+         */
+        void PreconditionerPMultigrid::Aggregate(
+            const int          level,
+            const NekDouble    strength,
+            std::vector<int>  &agg,
+            int               &nAgg)
+        {
+            int i, j, k;
+            const Level     &lev = m_levels[level];
+            const CsrMatrix &A   = lev.m_A;
+            int n = lev.m_rows;
+
+            agg.assign(n, -1);
+            nAgg = 0;
+            for (k = 0; k < lev.m_shared.size(); ++k)
+            {
+                agg[lev.m_shared[k]] = nAgg++;
+            }
+
+            // Mark the strong connections between interior DOFs.
+            std::vector<bool> strong(A.m_colIdx.size(), false);
+            for (i = 0; i < n; ++i)
+            {
+                if (agg[i] >= 0)
+                {
+                    continue;
+                }
+                for (j = A.m_rowPtr[i]; j < A.m_rowPtr[i+1]; ++j)
+                {
+                    k = A.m_colIdx[j];
+                    if (k != i && agg[k] < 0 &&
+                        fabs(A.m_val[j]) >= strength *
+                            sqrt(1.0/fabs(lev.m_invDiag[i]*lev.m_invDiag[k])))
+                    {
+                        strong[j] = true;
+                    }
+                }
+            }
+            int nRoot = nAgg;
+
+            // Phase 1: DOFs whose strong neighbours are all free become the
+            // root of a new aggregate.
+            for (i = 0; i < n; ++i)
+            {
+                if (agg[i] >= 0)
+                {
+                    continue;
+                }
+
+                bool free = true;
+                for (j = A.m_rowPtr[i]; j < A.m_rowPtr[i+1] && free; ++j)
+                {
+                    free = !strong[j] || agg[A.m_colIdx[j]] < 0;
+                }
+                if (!free)
+                {
+                    continue;
+                }
+
+                agg[i] = nAgg;
+                for (j = A.m_rowPtr[i]; j < A.m_rowPtr[i+1]; ++j)
+                {
+                    if (strong[j])
+                    {
+                        agg[A.m_colIdx[j]] = nAgg;
+                    }
+                }
+                ++nAgg;
+            }
+
+            // Phase 2: join the most strongly connected aggregate of phase 1.
+            std::vector<int> agg1(agg);
+            for (i = 0; i < n; ++i)
+            {
+                if (agg1[i] >= 0)
+                {
+                    continue;
+                }
+
+                NekDouble best = 0.0;
+                for (j = A.m_rowPtr[i]; j < A.m_rowPtr[i+1]; ++j)
+                {
+                    k = A.m_colIdx[j];
+                    if (strong[j] && agg1[k] >= nRoot &&
+                        fabs(A.m_val[j]) > best)
+                    {
+                        best   = fabs(A.m_val[j]);
+                        agg[i] = agg1[k];
+                    }
+                }
+            }
+
+            // Phase 3: the remaining DOFs form aggregates with their free
+            // strong neighbours.
+            for (i = 0; i < n; ++i)
+            {
+                if (agg[i] >= 0)
+                {
+                    continue;
+                }
+
+                agg[i] = nAgg;
+                for (j = A.m_rowPtr[i]; j < A.m_rowPtr[i+1]; ++j)
+                {
+                    if (strong[j] && agg[A.m_colIdx[j]] < 0)
+                    {
+                        agg[A.m_colIdx[j]] = nAgg;
+                    }
+                }
+                ++nAgg;
+            }
+        }
+
+        /**
+         * The coarsest level is factorised directly in serial. In parallel
+         * it is passed to XXT, with universal IDs for the aggregates chosen
+         * above those of the vertices.
+         */
+        void PreconditionerPMultigrid::SetUpCoarseSolve()
+        {
+            int i, j, k;
+            Level &lev = m_levels.back();
+            int n = lev.m_rows;
+
+            if (m_rowComm->GetSize() == 1)
+            {
+                if (n == 0)
+                {
+                    return;
+                }
+
+                DNekMatSharedPtr mat = MemoryManager<DNekMat>
+                    ::AllocateSharedPtr(n, n, 0.0,
+                                        ePOSITIVE_DEFINITE_SYMMETRIC);
+                for (i = 0; i < n; ++i)
+                {
+                    for (j = lev.m_A.m_rowPtr[i]; j < lev.m_A.m_rowPtr[i+1]; ++j)
+                    {
+                        if (lev.m_A.m_colIdx[j] >= i)
+                        {
+                            mat->SetValue(i, lev.m_A.m_colIdx[j],
+                                          lev.m_A.m_val[j]);
+                        }
+                    }
+                }
+
+                PointerWrapper w = eWrapper;
+                m_coarseLinSys = MemoryManager<DNekLinSys>
+                    ::AllocateSharedPtr(mat, w);
+                return;
+            }
+
+            int maxId = 0;
+            for (k = 0; k < m_sharedId.num_elements(); ++k)
+            {
+                maxId = std::max(maxId, (int) m_sharedId[k]);
+            }
+            const Array<OneD, const int> &univ =
+                m_vertLocToGloMap->GetGlobalToUniversalMap();
+            for (k = 0; k < univ.num_elements(); ++k)
+            {
+                maxId = std::max(maxId, univ[k]);
+            }
+            m_rowComm->AllReduce(maxId, LibUtilities::ReduceMax);
+
+            unsigned long rank  = m_rowComm->GetRank();
+            unsigned long nproc = m_rowComm->GetSize();
+            Array<OneD, unsigned long> vId(n);
+            for (i = 0; i < n; ++i)
+            {
+                vId[i] = maxId + 1 + rank + nproc*i;
+            }
+            for (k = 0; k < lev.m_shared.size(); ++k)
+            {
+                vId[lev.m_shared[k]] = m_sharedId[k];
+            }
+
+            int nz = lev.m_A.m_val.size();
+            Array<OneD, unsigned int> vAi(nz);
+            Array<OneD, unsigned int> vAj(nz);
+            Array<OneD, NekDouble>    vAr(nz);
+            for (i = k = 0; i < n; ++i)
+            {
+                for (j = lev.m_A.m_rowPtr[i]; j < lev.m_A.m_rowPtr[i+1];
+                     ++j, ++k)
+                {
+                    vAi[k] = i;
+                    vAj[k] = lev.m_A.m_colIdx[j];
+                    vAr[k] = lev.m_A.m_val[j];
+                }
+            }
+
+            m_crsData = Xxt::Init(n, vId, vAi, vAj, vAr, m_rowComm);
+        }
+
+        /**
+         * Computes the inverse of the assembled diagonal of an algebraic
+         * level.
+         */
+        void PreconditionerPMultigrid::SetUpLevelDiagonal(const int level)
+        {
+            int i, j;
+            Level &lev = m_levels[level];
+
+            Array<OneD, NekDouble> diag(lev.m_rows, 0.0);
+            for (i = 0; i < lev.m_rows; ++i)
+            {
+                for (j = lev.m_A.m_rowPtr[i]; j < lev.m_A.m_rowPtr[i+1]; ++j)
+                {
+                    if (lev.m_A.m_colIdx[j] == i)
+                    {
+                        diag[i] += lev.m_A.m_val[j];
+                    }
+                }
+            }
+            SumShared(level, diag);
+
+            lev.m_invDiag = Array<OneD, NekDouble>(lev.m_rows);
+            for (i = 0; i < lev.m_rows; ++i)
+            {
+                lev.m_invDiag[i] = 1.0/diag[i];
+            }
+        }
+
+        /**
+         * Estimates the largest eigenvalue of \f$ D^{-1} A \f$ by power
+         * iteration, using the Rayleigh quotient \f$ x^T A x / x^T D x \f$.
+         */
+        NekDouble PreconditionerPMultigrid::EstimateLambda(const int level)
+        {
+            int i, k;
+            Level &lev = m_levels[level];
+            int n = lev.m_rows;
+            Array<OneD, NekDouble> &x = lev.m_d;
+            Array<OneD, NekDouble> &w = lev.m_w;
+
+            if (level == 0)
+            {
+                const Array<OneD, const int> &univ =
+                    m_locToGloMap->GetGlobalToUniversalBndMap();
+                for (i = 0; i < n; ++i)
+                {
+                    x[i] = lev.m_invDiag[i] == 0.0 ? 0.0 : StartValue(univ[i]);
+                }
+            }
+            else
+            {
+                for (i = 0; i < n; ++i)
+                {
+                    x[i] = StartValue(i);
+                }
+                for (k = 0; k < lev.m_shared.size(); ++k)
+                {
+                    x[lev.m_shared[k]] = StartValue(m_sharedId[k]);
+                }
+            }
+
+            NekDouble lambda = 1.0;
+            Array<OneD, NekDouble> vals(2);
+            for (k = 0; k < s_powerIts; ++k)
+            {
+                ApplyOperator(level, x, w);
+
+                vals[0] = vals[1] = 0.0;
+                for (i = 0; i < n; ++i)
+                {
+                    if (lev.m_unique[i] == 1 && lev.m_invDiag[i] != 0.0)
+                    {
+                        vals[0] += x[i]*w[i];
+                        vals[1] += x[i]*x[i]/lev.m_invDiag[i];
+                    }
+                }
+                m_rowComm->AllReduce(vals, LibUtilities::ReduceSum);
+
+                if (vals[0] <= 0.0 || vals[1] <= 0.0)
+                {
+                    break;
+                }
+                lambda = vals[0]/vals[1];
+
+                Vmath::Vmul(n, lev.m_invDiag, 1, w, 1, x, 1);
+                Vmath::Smul(n, 1.0/lambda, x, 1, x, 1);
+            }
+
+            return lambda;
+        }
+
+        void PreconditionerPMultigrid::ApplyOperator(
+            const int                     level,
+            const Array<OneD, NekDouble> &pInput,
+                  Array<OneD, NekDouble> &pOutput)
+        {
+            if (level == 0)
+            {
+                boost::dynamic_pointer_cast<GlobalLinSysIterative>(
+                    m_linsys.lock())->DoMatrixMultiply(pInput, pOutput);
+                return;
+            }
+
+            const CsrMatrix &A = m_levels[level].m_A;
+            for (int i = 0; i < A.m_rows; ++i)
+            {
+                NekDouble sum = 0.0;
+                for (int j = A.m_rowPtr[i]; j < A.m_rowPtr[i+1]; ++j)
+                {
+                    sum += A.m_val[j]*pInput[A.m_colIdx[j]];
+                }
+                pOutput[i] = sum;
+            }
+            SumShared(level, pOutput);
+        }
+
+        /**
+         * Sums the entries of the process-boundary DOFs of an algebraic
+         * level across processes.
+         */
+        void PreconditionerPMultigrid::SumShared(
+            const int               level,
+            Array<OneD, NekDouble> &pInOut)
+        {
+            if (!m_sharedGsh)
+            {
+                return;
+            }
+
+            const std::vector<int> &shared = m_levels[level].m_shared;
+            int k;
+            for (k = 0; k < shared.size(); ++k)
+            {
+                m_sharedBuf[k] = pInOut[shared[k]];
+            }
+            Gs::Gather(m_sharedBuf, Gs::gs_add, m_sharedGsh);
+            for (k = 0; k < shared.size(); ++k)
+            {
+                pInOut[shared[k]] = m_sharedBuf[k];
+            }
+        }
+
+        /**
+         * Applies #s_smoothDegree steps of Chebyshev iteration to
+         * \f$ A x = b \f$ on the given level, targeting the eigenvalues of
+         * \f$ D^{-1} A \f$ in \f$ [0.1\lambda, 1.1\lambda] \f$.
+         */
+        void PreconditionerPMultigrid::Smooth(
+            const int  level,
+            const bool zeroGuess)
+        {
+            Level &lev = m_levels[level];
+            int n = lev.m_rows;
+
+            NekDouble upper = 1.1*lev.m_lambda;
+            NekDouble lower = 0.1*lev.m_lambda;
+            NekDouble theta = 0.5*(upper + lower);
+            NekDouble delta = 0.5*(upper - lower);
+            NekDouble sigma = theta/delta;
+            NekDouble rho   = 1.0/sigma;
+
+            if (zeroGuess)
+            {
+                Vmath::Zero (n, lev.m_x, 1);
+                Vmath::Vcopy(n, lev.m_b, 1, lev.m_r, 1);
+            }
+            else
+            {
+                ApplyOperator(level, lev.m_x, lev.m_w);
+                Vmath::Vsub(n, lev.m_b, 1, lev.m_w, 1, lev.m_r, 1);
+            }
+
+            Vmath::Vmul(n, lev.m_invDiag, 1, lev.m_r, 1, lev.m_d, 1);
+            Vmath::Smul(n, 1.0/theta, lev.m_d, 1, lev.m_d, 1);
+
+            for (int k = 0; k < s_smoothDegree; ++k)
+            {
+                Vmath::Vadd(n, lev.m_x, 1, lev.m_d, 1, lev.m_x, 1);
+                if (k == s_smoothDegree - 1)
+                {
+                    break;
+                }
+
+                ApplyOperator(level, lev.m_d, lev.m_w);
+                Vmath::Vsub(n, lev.m_r, 1, lev.m_w, 1, lev.m_r, 1);
+
+                NekDouble rhoNew = 1.0/(2.0*sigma - rho);
+                Vmath::Smul (n, rhoNew*rho, lev.m_d, 1, lev.m_d, 1);
+                Vmath::Vmul (n, lev.m_invDiag, 1, lev.m_r, 1, lev.m_w, 1);
+                Vmath::Svtvp(n, 2.0*rhoNew/delta, lev.m_w, 1,
+                             lev.m_d, 1, lev.m_d, 1);
+                rho = rhoNew;
+            }
+        }
+
+        /**
+         * Restricts the residual of @a level to the right-hand side of the
+         * next coarser level. Contributions from shared DOFs are weighted by
+         * their inverse multiplicity before summing across processes.
+         */
+        void PreconditionerPMultigrid::Restrict(const int level)
+        {
+            int i, j;
+            Level &fine   = m_levels[level];
+            Level &coarse = m_levels[level + 1];
+
+            if (level == 0)
+            {
+                Vmath::Gathr(coarse.m_rows, fine.m_r, m_vertToFine, coarse.m_b);
+                return;
+            }
+
+            const CsrMatrix &P = fine.m_P;
+            Vmath::Zero(coarse.m_rows, coarse.m_b, 1);
+            for (i = 0; i < P.m_rows; ++i)
+            {
+                NekDouble r = fine.m_r[i]*fine.m_invMult[i];
+                for (j = P.m_rowPtr[i]; j < P.m_rowPtr[i+1]; ++j)
+                {
+                    coarse.m_b[P.m_colIdx[j]] += P.m_val[j]*r;
+                }
+            }
+            SumShared(level + 1, coarse.m_b);
+        }
+
+        /**
+         * Adds the prolongated solution of the next coarser level to the
+         * solution of @a level.
+         */
+        void PreconditionerPMultigrid::Prolong(const int level)
+        {
+            int i, j;
+            Level &fine   = m_levels[level];
+            Level &coarse = m_levels[level + 1];
+
+            if (level == 0)
+            {
+                for (i = 0; i < coarse.m_rows; ++i)
+                {
+                    fine.m_x[m_vertToFine[i]] += coarse.m_x[i];
+                }
+                return;
+            }
+
+            const CsrMatrix &P = fine.m_P;
+            for (i = 0; i < P.m_rows; ++i)
+            {
+                NekDouble sum = 0.0;
+                for (j = P.m_rowPtr[i]; j < P.m_rowPtr[i+1]; ++j)
+                {
+                    sum += P.m_val[j]*coarse.m_x[P.m_colIdx[j]];
+                }
+                fine.m_x[i] += sum;
+            }
+        }
+
+        void PreconditionerPMultigrid::CoarseSolve()
+        {
+            Level &lev = m_levels.back();
+            int n = lev.m_rows;
+
+            if (m_coarseLinSys)
+            {
+                NekVector<NekDouble> b(n, lev.m_b, eWrapper);
+                NekVector<NekDouble> x(n, lev.m_x, eWrapper);
+                m_coarseLinSys->Solve(b, x);
+            }
+            else if (m_crsData)
+            {
+                // XXT sums the contributions of all processes to the
+                // right-hand side.
+                Vmath::Vmul(n, lev.m_b, 1, lev.m_invMult, 1, lev.m_r, 1);
+                Xxt::Solve(lev.m_x, m_crsData, lev.m_r);
+            }
+            else
+            {
+                Vmath::Zero(n, lev.m_x, 1);
+            }
+        }
+
+        void PreconditionerPMultigrid::VCycle(const int level)
+        {
+            if (level == m_levels.size() - 1)
+            {
+                CoarseSolve();
+                return;
+            }
+
+            Level &lev = m_levels[level];
+            int n = lev.m_rows;
+
+            Smooth(level, true);
+
+            ApplyOperator(level, lev.m_x, lev.m_w);
+            Vmath::Vsub(n, lev.m_b, 1, lev.m_w, 1, lev.m_r, 1);
+            Restrict(level);
+
+            VCycle(level + 1);
+
+            Prolong(level);
+            Smooth(level, false);
+        }
+
+        /**
+         *
+         */
+        void PreconditionerPMultigrid::v_DoPreconditioner(
+                const Array<OneD, NekDouble>& pInput,
+                Array<OneD, NekDouble>& pOutput)
+        {
+            int nGlobBnd = m_locToGloMap->GetNumGlobalBndCoeffs();
+            int nDir     = m_locToGloMap->GetNumGlobalDirBndCoeffs();
+            Level &fine  = m_levels[0];
+            Array<OneD, NekDouble> tmp;
+
+            Vmath::Zero (nDir, fine.m_b, 1);
+            Vmath::Vcopy(nGlobBnd - nDir, pInput, 1, tmp = fine.m_b + nDir, 1);
+
+            VCycle(0);
+
+            Vmath::Vcopy(nGlobBnd - nDir, tmp = fine.m_x + nDir, 1, pOutput, 1);
+        }
+
+        void PreconditionerPMultigrid::AllocateWork(Level &lev)
+        {
+            lev.m_x = Array<OneD, NekDouble>(lev.m_rows, 0.0);
+            lev.m_b = Array<OneD, NekDouble>(lev.m_rows, 0.0);
+            lev.m_r = Array<OneD, NekDouble>(lev.m_rows, 0.0);
+            lev.m_d = Array<OneD, NekDouble>(lev.m_rows, 0.0);
+            lev.m_w = Array<OneD, NekDouble>(lev.m_rows, 0.0);
+        }
+
+        void PreconditionerPMultigrid::CooToCsr(
+            const int         rows,
+            const int         cols,
+            const COOMatType &coo,
+                  CsrMatrix  &mat)
+        {
+            mat.m_rows = rows;
+            mat.m_cols = cols;
+            mat.m_rowPtr.assign(rows + 1, 0);
+            mat.m_colIdx.resize(coo.size());
+            mat.m_val   .resize(coo.size());
+
+            // Entries are ordered by row and then column.
+            int k = 0;
+            for (COOMatTypeConstIt it = coo.begin(); it != coo.end(); ++it, ++k)
+            {
+                mat.m_rowPtr[it->first.first + 1]++;
+                mat.m_colIdx[k] = it->first.second;
+                mat.m_val   [k] = it->second;
+            }
+            for (k = 0; k < rows; ++k)
+            {
+                mat.m_rowPtr[k+1] += mat.m_rowPtr[k];
+            }
+        }
+
+        void PreconditionerPMultigrid::SparseTranspose(
+            const CsrMatrix &A,
+                  CsrMatrix &At)
+        {
+            int i, j;
+            At.m_rows = A.m_cols;
+            At.m_cols = A.m_rows;
+            At.m_rowPtr.assign(A.m_cols + 1, 0);
+            At.m_colIdx.resize(A.m_colIdx.size());
+            At.m_val   .resize(A.m_val.size());
+
+            for (j = 0; j < A.m_colIdx.size(); ++j)
+            {
+                At.m_rowPtr[A.m_colIdx[j] + 1]++;
+            }
+            for (i = 0; i < A.m_cols; ++i)
+            {
+                At.m_rowPtr[i+1] += At.m_rowPtr[i];
+            }
+
+            std::vector<int> pos(At.m_rowPtr.begin(), At.m_rowPtr.end() - 1);
+            for (i = 0; i < A.m_rows; ++i)
+            {
+                for (j = A.m_rowPtr[i]; j < A.m_rowPtr[i+1]; ++j)
+                {
+                    int p = pos[A.m_colIdx[j]]++;
+                    At.m_colIdx[p] = i;
+                    At.m_val   [p] = A.m_val[j];
+                }
+            }
+        }
+
+        void PreconditionerPMultigrid::SparseProduct(
+            const CsrMatrix &A,
+            const CsrMatrix &B,
+                  CsrMatrix &C)
+        {
+            int i, j, k;
+            C.m_rows = A.m_rows;
+            C.m_cols = B.m_cols;
+            C.m_rowPtr.assign(A.m_rows + 1, 0);
+            C.m_colIdx.clear();
+            C.m_val.clear();
+
+            std::vector<NekDouble> accum (B.m_cols, 0.0);
+            std::vector<int>       marker(B.m_cols, -1);
+            std::vector<int>       cols;
+            for (i = 0; i < A.m_rows; ++i)
+            {
+                cols.clear();
+                for (j = A.m_rowPtr[i]; j < A.m_rowPtr[i+1]; ++j)
+                {
+                    int       r = A.m_colIdx[j];
+                    NekDouble a = A.m_val[j];
+                    for (k = B.m_rowPtr[r]; k < B.m_rowPtr[r+1]; ++k)
+                    {
+                        int c = B.m_colIdx[k];
+                        if (marker[c] != i)
+                        {
+                            marker[c] = i;
+                            accum [c] = 0.0;
+                            cols.push_back(c);
+                        }
+                        accum[c] += a*B.m_val[k];
+                    }
+                }
+
+                std::sort(cols.begin(), cols.end());
+                for (j = 0; j < cols.size(); ++j)
+                {
+                    C.m_colIdx.push_back(cols[j]);
+                    C.m_val   .push_back(accum[cols[j]]);
+                }
+                C.m_rowPtr[i+1] = C.m_colIdx.size();
+            }
+        }
+    }
+}
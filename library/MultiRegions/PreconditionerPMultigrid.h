@@ -0,0 +1,189 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File PreconditionerPMultigrid.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: p-multigrid preconditioner header
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_PRECONDITIONERPMULTIGRID_H
+#define NEKTAR_LIB_MULTIREGIONS_PRECONDITIONERPMULTIGRID_H
+
+#include <vector>
+
+#include <MultiRegions/GlobalLinSys.h>
+#include <MultiRegions/Preconditioner.h>
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <MultiRegions/AssemblyMap/AssemblyMapCG.h>
+#include <LibUtilities/LinearAlgebra/SparseMatrixFwd.hpp>
+
+namespace Xxt
+{
+    struct crs_data;
+}
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        class PreconditionerPMultigrid;
+        typedef boost::shared_ptr<PreconditionerPMultigrid>
+            PreconditionerPMultigridSharedPtr;
+
+        class PreconditionerPMultigrid: public Preconditioner
+        {
+        public:
+            /// Creates an instance of this class
+            static PreconditionerSharedPtr create(
+                        const boost::shared_ptr<GlobalLinSys> &plinsys,
+                        const boost::shared_ptr<AssemblyMap>
+                                                               &pLocToGloMap)
+            {
+                PreconditionerSharedPtr p = MemoryManager<
+                    PreconditionerPMultigrid>::AllocateSharedPtr(
+                        plinsys, pLocToGloMap);
+                p->InitObject();
+                return p;
+            }
+
+            /// Name of class
+            static std::string className;
+
+            MULTI_REGIONS_EXPORT PreconditionerPMultigrid(
+                         const boost::shared_ptr<GlobalLinSys> &plinsys,
+                         const AssemblyMapSharedPtr &pLocToGloMap);
+
+            MULTI_REGIONS_EXPORT
+            virtual ~PreconditionerPMultigrid();
+
+        private:
+            /// Compressed sparse row matrix used on the algebraic levels.
+            struct CsrMatrix
+            {
+                int                    m_rows;
+                int                    m_cols;
+                std::vector<int>       m_rowPtr;
+                std::vector<int>       m_colIdx;
+                std::vector<NekDouble> m_val;
+            };
+
+            /// One level of the multigrid hierarchy.
+            struct Level
+            {
+                int                    m_rows;
+                /// Operator on levels >= 1, partially assembled on DOFs
+                /// shared with other processes.
+                CsrMatrix              m_A;
+                /// Prolongation from the next coarser level (levels >= 1).
+                CsrMatrix              m_P;
+                /// Inverse of the assembled diagonal, zero on Dirichlet DOFs.
+                Array<OneD, NekDouble> m_invDiag;
+                /// Inverse of the number of processes holding each DOF.
+                Array<OneD, NekDouble> m_invMult;
+                /// Set to one for the DOFs included in dot products.
+                Array<OneD, int>       m_unique;
+                /// Index of each process-boundary DOF, in the order used by
+                /// #m_sharedGsh.
+                std::vector<int>       m_shared;
+                /// Estimate of the largest eigenvalue of D^{-1} A.
+                NekDouble              m_lambda;
+                /// Solution, right-hand side and work vectors.
+                Array<OneD, NekDouble> m_x;
+                Array<OneD, NekDouble> m_b;
+                Array<OneD, NekDouble> m_r;
+                Array<OneD, NekDouble> m_d;
+                Array<OneD, NekDouble> m_w;
+            };
+
+            /// Level 0 is the condensed boundary system, level 1 the linear
+            /// vertex space and any further levels come from aggregation.
+            std::vector<Level>          m_levels;
+            boost::shared_ptr<AssemblyMap> m_vertLocToGloMap;
+            /// Boundary DOF of level 0 for each vertex DOF of level 1.
+            Array<OneD, int>            m_vertToFine;
+            LibUtilities::CommSharedPtr m_rowComm;
+            /// Universal IDs of the process-boundary vertex DOFs.
+            Array<OneD, long>           m_sharedId;
+            Gs::gs_data                *m_sharedGsh;
+            Array<OneD, NekDouble>      m_sharedBuf;
+            /// Coarsest level solver in serial and in parallel.
+            DNekLinSysSharedPtr         m_coarseLinSys;
+            struct Xxt::crs_data       *m_crsData;
+
+            virtual void v_InitObject();
+
+            virtual void v_DoPreconditioner(
+                      const Array<OneD, NekDouble>& pInput,
+                      Array<OneD, NekDouble>& pOutput);
+
+            virtual void v_BuildPreconditioner();
+
+            void SetUpBoundaryLevel();
+            void SetUpVertexLevel();
+            void SetUpAggregationLevels();
+            void SetUpCoarseSolve();
+
+            void Aggregate(
+                const int          level,
+                const NekDouble    strength,
+                std::vector<int>  &agg,
+                int               &nAgg);
+            void SetUpLevelDiagonal(const int level);
+            NekDouble EstimateLambda(const int level);
+
+            void ApplyOperator(
+                const int                     level,
+                const Array<OneD, NekDouble> &pInput,
+                      Array<OneD, NekDouble> &pOutput);
+            void SumShared(const int level, Array<OneD, NekDouble> &pInOut);
+            void Smooth(const int level, const bool zeroGuess);
+            void Restrict(const int level);
+            void Prolong(const int level);
+            void CoarseSolve();
+            void VCycle(const int level);
+
+            static void AllocateWork(Level &lev);
+            static void CooToCsr(
+                const int         rows,
+                const int         cols,
+                const COOMatType &coo,
+                      CsrMatrix  &mat);
+            static void SparseTranspose(
+                const CsrMatrix &A,
+                      CsrMatrix &At);
+            static void SparseProduct(
+                const CsrMatrix &A,
+                const CsrMatrix &B,
+                      CsrMatrix &C);
+        };
+    }
+}
+
+#endif
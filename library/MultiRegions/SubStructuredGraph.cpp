@@ -1071,6 +1071,74 @@ namespace Nektar
             }
         }
 
+        void NestedDissectionReordering(const BoostGraph& graph,
+                                        Array<OneD, int>& perm,
+                                        Array<OneD, int>& iperm)
+        {
+            int nGraphVerts = boost::num_vertices(graph);
+            int nGraphEdges = boost::num_edges   (graph);
+
+            ASSERTL1(perm. num_elements() >= nGraphVerts &&
+                     iperm.num_elements() >= nGraphVerts,
+                     "Non-matching dimensions");
+
+            if (!nGraphEdges)
+            {
+                NoReordering(graph, perm, iperm);
+                return;
+            }
+
+            // Convert the boost graph to the adjacency-list format required by
+            // METIS. In contrast to MultiLevelBisectionReordering, the
+            // ordering returned by METIS is used as is: separators are
+            // numbered after the subgraphs they split, which is the
+            // fill-reducing ordering wanted by a sparse Cholesky
+            // factorisation.
+            int acnt = 0;
+            int vcnt = 0;
+            BoostVertexIterator    vertit, vertit_end;
+            BoostAdjacencyIterator adjvertit, adjvertit_end;
+            Array<OneD, int> xadj(nGraphVerts+1,0);
+            Array<OneD, int> adjncy(2*nGraphEdges);
+
+            for (boost::tie(vertit, vertit_end) = boost::vertices(graph);
+                 vertit != vertit_end; ++vertit)
+            {
+                for (boost::tie(adjvertit, adjvertit_end) =
+                         boost::adjacent_vertices(*vertit,graph);
+                     adjvertit != adjvertit_end;
+                     ++adjvertit)
+                {
+                    adjncy[acnt++] = *adjvertit;
+                }
+                xadj[++vcnt] = acnt;
+            }
+
+            // The separator tree is not needed, but AS_METIS_NodeND still
+            // requires storage for it.
+            Array<OneD, int> septree(nGraphVerts*10,-1);
+            Array<OneD, int> perm_tmp (nGraphVerts);
+            Array<OneD, int> iperm_tmp(nGraphVerts);
+
+            try
+            {
+                Metis::as_onmetis(nGraphVerts,xadj,adjncy,perm_tmp,iperm_tmp,
+                                  septree);
+            }
+            catch(...)
+            {
+                NEKERROR(ErrorUtil::efatal,
+                         "Error in calling metis (the size of the separator"
+                         " tree might not be sufficient)");
+            }
+
+            for (int i = 0; i < nGraphVerts; ++i)
+            {
+                perm [i] = perm_tmp [i];
+                iperm[i] = iperm_tmp[i];
+            }
+        }
+
         void NoReordering(const BoostGraph& graph,
                           Array<OneD, int>& perm,
                           Array<OneD, int>& iperm)
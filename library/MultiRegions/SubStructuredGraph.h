@@ -275,6 +275,13 @@ namespace Nektar
         // polynomial order of the expansion and there is still room for
         // optimisation here.
 
+        // Fill-reducing nested dissection ordering from METIS, for use with
+        // sparse direct factorisations.
+        MULTI_REGIONS_EXPORT void NestedDissectionReordering(
+            const BoostGraph& graph,
+            Array<OneD, int>& perm,
+            Array<OneD, int>& iperm);
+
         MULTI_REGIONS_EXPORT void NoReordering(const BoostGraph& graph,
                           Array<OneD, int>& perm,
                           Array<OneD, int>& iperm);
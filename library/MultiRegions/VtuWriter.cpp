@@ -0,0 +1,414 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File VtuWriter.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Binary VTK unstructured grid writer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <fstream>
+#include <sstream>
+
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <MultiRegions/VtuWriter.h>
+
+#include "zlib.h"
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /// Uncompressed size of the blocks compressed by zlib, as used by
+        /// vtkZLibDataCompressor.
+        static const size_t s_vtuBlockSize = 32768;
+
+        /// VTK cell types of the linear sub-cells of 1D, 2D and 3D elements.
+        static const unsigned char s_vtuCellType[4] = {1, 3, 9, 12};
+
+        static std::string Base64Encode(const std::string &in)
+        {
+            static const char table[] =
+                "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+                "0123456789+/";
+
+            const size_t         n = in.size();
+            const unsigned char *p = (const unsigned char *) in.data();
+            std::string          out;
+            out.reserve(4*((n + 2)/3));
+
+            size_t i;
+            for (i = 0; i + 2 < n; i += 3)
+            {
+                out += table[  p[i]           >> 2];
+                out += table[((p[i]   & 0x03) << 4) | (p[i+1] >> 4)];
+                out += table[((p[i+1] & 0x0f) << 2) | (p[i+2] >> 6)];
+                out += table[  p[i+2] & 0x3f];
+            }
+
+            if (i + 1 == n)
+            {
+                out += table[  p[i]           >> 2];
+                out += table[ (p[i]   & 0x03) << 4];
+                out += "==";
+            }
+            else if (i + 2 == n)
+            {
+                out += table[  p[i]           >> 2];
+                out += table[((p[i]   & 0x03) << 4) | (p[i+1] >> 4)];
+                out += table[ (p[i+1] & 0x0f) << 2];
+                out += '=';
+            }
+
+            return out;
+        }
+
+        VtuWriter::VtuWriter(const ExpListSharedPtr &pExp)
+            : m_exp(pExp), m_base64(false), m_compress(false)
+        {
+            ASSERTL0(m_exp->GetExpType() != e3DH1D &&
+                     m_exp->GetExpType() != e3DH2D,
+                     "Binary VTU output does not support homogeneous "
+                     "expansions.");
+        }
+
+        void VtuWriter::AddField(
+            const std::string                  &name,
+            const Array<OneD, const NekDouble> &phys)
+        {
+            ASSERTL0(phys.num_elements() >= m_exp->GetTotPoints(),
+                     "Field " + name + " is smaller than the expansion.");
+            m_fieldNames.push_back(name);
+            m_fields.push_back(phys);
+        }
+
+        std::string VtuWriter::Write(const std::string &outname)
+        {
+            LibUtilities::CommSharedPtr vComm = m_exp->GetComm();
+            const int nProc = vComm->GetSize();
+
+            if (nProc == 1)
+            {
+                WritePiece(outname);
+                return outname;
+            }
+
+            const size_t dot   = outname.find_last_of('.');
+            const size_t slash = outname.find_last_of('/');
+            std::string  start = outname;
+            std::string  ext   = ".vtu";
+            if (dot != std::string::npos &&
+                (slash == std::string::npos || dot > slash))
+            {
+                start = outname.substr(0, dot);
+                ext   = outname.substr(dot);
+            }
+
+            std::vector<std::string> pieces(nProc);
+            for (int i = 0; i < nProc; ++i)
+            {
+                pieces[i] = start + "_P" + boost::lexical_cast<std::string>(i)
+                                  + ext;
+            }
+
+            WritePiece(pieces[vComm->GetRank()]);
+
+            const std::string index = start + ".pvtu";
+            if (vComm->GetRank() == 0)
+            {
+                WriteIndex(index, pieces);
+            }
+            return index;
+        }
+
+        /**
+         * Writes the points, the sub-cells and the fields of this process
+         * as one piece. Point i is quadrature point i of the expansion
+         * list, so the sub-cells of each element index the points from its
+         * physical offset.
+         */
+        void VtuWriter::WritePiece(const std::string &filename)
+        {
+            const int nElmt = m_exp->GetExpSize();
+            const int nPts  = m_exp->GetTotPoints();
+            int e, i, j, k;
+
+            // Coordinates of the quadrature points
+            std::vector<NekDouble> points(3*nPts, 0.0);
+            int nCells = 0;
+            int nConn  = 0;
+            for (e = 0; e < nElmt; ++e)
+            {
+                LocalRegions::ExpansionSharedPtr exp = m_exp->GetExp(e);
+                const int nq     = exp->GetTotPoints();
+                const int offset = m_exp->GetPhys_Offset(e);
+                const int dim    = exp->GetShapeDimension();
+
+                Array<OneD, NekDouble> x(nq, 0.0), y(nq, 0.0), z(nq, 0.0);
+                exp->GetCoords(x, y, z);
+                for (i = 0; i < nq; ++i)
+                {
+                    points[3*(offset+i)  ] = x[i];
+                    points[3*(offset+i)+1] = y[i];
+                    points[3*(offset+i)+2] = z[i];
+                }
+
+                int nSub = 1;
+                for (i = 0; i < dim; ++i)
+                {
+                    nSub *= exp->GetNumPoints(i) - 1;
+                }
+                nCells += nSub;
+                nConn  += nSub << dim;
+            }
+
+            // Linear sub-cell connectivity
+            std::vector<boost::int32_t> conn;
+            std::vector<boost::int32_t> offsets;
+            std::vector<unsigned char>  types;
+            conn.reserve(nConn);
+            offsets.reserve(nCells);
+            types.reserve(nCells);
+            for (e = 0; e < nElmt; ++e)
+            {
+                LocalRegions::ExpansionSharedPtr exp = m_exp->GetExp(e);
+                const int o   = m_exp->GetPhys_Offset(e);
+                const int dim = exp->GetShapeDimension();
+                const int n0  = exp->GetNumPoints(0);
+                const int n1  = dim > 1 ? exp->GetNumPoints(1) : 2;
+                const int n2  = dim > 2 ? exp->GetNumPoints(2) : 2;
+                const int n01 = n0*n1;
+
+                for (k = 0; k < n2 - 1; ++k)
+                {
+                    for (j = 0; j < n1 - 1; ++j)
+                    {
+                        for (i = 0; i < n0 - 1; ++i)
+                        {
+                            const int p = o + k*n01 + j*n0 + i;
+                            conn.push_back(p);
+                            conn.push_back(p + 1);
+                            if (dim > 1)
+                            {
+                                conn.push_back(p + n0 + 1);
+                                conn.push_back(p + n0);
+                            }
+                            if (dim > 2)
+                            {
+                                conn.push_back(p + n01);
+                                conn.push_back(p + n01 + 1);
+                                conn.push_back(p + n01 + n0 + 1);
+                                conn.push_back(p + n01 + n0);
+                            }
+                            offsets.push_back(conn.size());
+                            types.push_back(s_vtuCellType[dim]);
+                        }
+                    }
+                }
+            }
+
+            // Encode all arrays, recording their offsets in the appended
+            // data section.
+            std::vector<std::string> blocks;
+            blocks.push_back(EncodeArray(
+                points.empty()  ? 0 : &points[0],
+                points.size()*sizeof(NekDouble)));
+            blocks.push_back(EncodeArray(
+                conn.empty()    ? 0 : &conn[0],
+                conn.size()*sizeof(boost::int32_t)));
+            blocks.push_back(EncodeArray(
+                offsets.empty() ? 0 : &offsets[0],
+                offsets.size()*sizeof(boost::int32_t)));
+            blocks.push_back(EncodeArray(
+                types.empty()   ? 0 : &types[0],
+                types.size()));
+
+            std::vector<float> values(nPts);
+            for (i = 0; i < m_fields.size(); ++i)
+            {
+                for (j = 0; j < nPts; ++j)
+                {
+                    values[j] = m_fields[i][j];
+                }
+                blocks.push_back(EncodeArray(
+                    values.empty() ? 0 : &values[0], nPts*sizeof(float)));
+            }
+
+            std::vector<size_t> blockOffset(blocks.size(), 0);
+            for (i = 1; i < blocks.size(); ++i)
+            {
+                blockOffset[i] = blockOffset[i-1] + blocks[i-1].size();
+            }
+
+            const boost::int32_t one = 1;
+            const std::string order  = *(const char *) &one ?
+                                            "LittleEndian" : "BigEndian";
+
+            std::ofstream outfile(filename.c_str(),
+                                  std::ios::out | std::ios::binary);
+            ASSERTL0(outfile.good(), "Unable to open file " + filename);
+
+            outfile << "<?xml version=\"1.0\"?>\n"
+                    << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" "
+                    << "byte_order=\"" << order << "\" "
+                    << "header_type=\"UInt64\"";
+            if (m_compress)
+            {
+                outfile << " compressor=\"vtkZLibDataCompressor\"";
+            }
+            outfile << ">\n"
+                    << "  <UnstructuredGrid>\n"
+                    << "    <Piece NumberOfPoints=\"" << nPts
+                    << "\" NumberOfCells=\"" << nCells << "\">\n"
+                    << "      <Points>\n"
+                    << "        <DataArray type=\"Float64\" "
+                    << "NumberOfComponents=\"3\" format=\"appended\" "
+                    << "offset=\"" << blockOffset[0] << "\"/>\n"
+                    << "      </Points>\n"
+                    << "      <Cells>\n"
+                    << "        <DataArray type=\"Int32\" "
+                    << "Name=\"connectivity\" format=\"appended\" "
+                    << "offset=\"" << blockOffset[1] << "\"/>\n"
+                    << "        <DataArray type=\"Int32\" "
+                    << "Name=\"offsets\" format=\"appended\" "
+                    << "offset=\"" << blockOffset[2] << "\"/>\n"
+                    << "        <DataArray type=\"UInt8\" "
+                    << "Name=\"types\" format=\"appended\" "
+                    << "offset=\"" << blockOffset[3] << "\"/>\n"
+                    << "      </Cells>\n"
+                    << "      <PointData>\n";
+            for (i = 0; i < m_fields.size(); ++i)
+            {
+                outfile << "        <DataArray type=\"Float32\" Name=\""
+                        << m_fieldNames[i] << "\" format=\"appended\" "
+                        << "offset=\"" << blockOffset[4+i] << "\"/>\n";
+            }
+            outfile << "      </PointData>\n"
+                    << "    </Piece>\n"
+                    << "  </UnstructuredGrid>\n"
+                    << "  <AppendedData encoding=\""
+                    << (m_base64 ? "base64" : "raw") << "\">\n"
+                    << "   _";
+            for (i = 0; i < blocks.size(); ++i)
+            {
+                outfile.write(blocks[i].data(), blocks[i].size());
+            }
+            outfile << "\n  </AppendedData>\n"
+                    << "</VTKFile>\n";
+        }
+
+        void VtuWriter::WriteIndex(
+            const std::string              &filename,
+            const std::vector<std::string> &pieces)
+        {
+            std::ofstream outfile(filename.c_str());
+            ASSERTL0(outfile.good(), "Unable to open file " + filename);
+
+            outfile << "<?xml version=\"1.0\"?>\n"
+                    << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\">\n"
+                    << "  <PUnstructuredGrid GhostLevel=\"0\">\n"
+                    << "    <PPoints>\n"
+                    << "      <PDataArray type=\"Float64\" "
+                    << "NumberOfComponents=\"3\"/>\n"
+                    << "    </PPoints>\n"
+                    << "    <PPointData>\n";
+            for (unsigned int i = 0; i < m_fieldNames.size(); ++i)
+            {
+                outfile << "      <PDataArray type=\"Float32\" Name=\""
+                        << m_fieldNames[i] << "\"/>\n";
+            }
+            outfile << "    </PPointData>\n";
+
+            // Pieces are referenced relative to the index file
+            for (unsigned int i = 0; i < pieces.size(); ++i)
+            {
+                const size_t slash = pieces[i].find_last_of('/');
+                outfile << "    <Piece Source=\""
+                        << (slash == std::string::npos ? pieces[i]
+                                : pieces[i].substr(slash + 1))
+                        << "\"/>\n";
+            }
+            outfile << "  </PUnstructuredGrid>\n"
+                    << "</VTKFile>\n";
+        }
+
+        /**
+         * Returns the appended data of an array. Uncompressed data is
+         * preceded by its size in bytes. Compressed data is split into
+         * blocks of #s_vtuBlockSize bytes which are compressed separately,
+         * and preceded by the number of blocks, the block size, the size of
+         * the last partial block and the compressed size of each block. In
+         * base64 encoding the header of compressed data is encoded
+         * separately from the blocks.
+         */
+        std::string VtuWriter::EncodeArray(
+            const void   *data,
+            const size_t  nBytes)
+        {
+            const char *src = (const char *) data;
+
+            if (!m_compress)
+            {
+                boost::uint64_t header = nBytes;
+                std::string     out((const char *) &header, sizeof(header));
+                out.append(src, nBytes);
+                return m_base64 ? Base64Encode(out) : out;
+            }
+
+            const size_t nBlocks = (nBytes + s_vtuBlockSize - 1)
+                                        / s_vtuBlockSize;
+            std::vector<boost::uint64_t> header(3 + nBlocks);
+            header[0] = nBlocks;
+            header[1] = s_vtuBlockSize;
+            header[2] = nBytes % s_vtuBlockSize;
+
+            std::string compressed;
+            std::string buffer(compressBound(s_vtuBlockSize), '\0');
+            for (size_t b = 0; b < nBlocks; ++b)
+            {
+                const size_t start = b*s_vtuBlockSize;
+                const size_t size  = std::min(s_vtuBlockSize, nBytes - start);
+                uLongf       len   = buffer.size();
+                ASSERTL0(compress2((Bytef *) &buffer[0], &len,
+                                   (const Bytef *) src + start, size,
+                                   Z_DEFAULT_COMPRESSION) == Z_OK,
+                         "Failed to compress VTU data.");
+                header[3 + b] = len;
+                compressed.append(buffer, 0, len);
+            }
+
+            const std::string head((const char *) &header[0],
+                                   header.size()*sizeof(boost::uint64_t));
+            return m_base64 ? Base64Encode(head) + Base64Encode(compressed)
+                            : head + compressed;
+        }
+    }
+}
@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File VtuWriter.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Binary VTK unstructured grid writer
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_LIB_MULTIREGIONS_VTUWRITER_H
+#define NEKTAR_LIB_MULTIREGIONS_VTUWRITER_H
+
+#include <string>
+#include <vector>
+
+#include <MultiRegions/MultiRegionsDeclspec.h>
+#include <MultiRegions/ExpList.h>
+
+namespace Nektar
+{
+    namespace MultiRegions
+    {
+        /**
+         * @brief Writes fields of an expansion list as a single VTK
+         * unstructured grid in the appended binary format.
+         *
+         * All elements are merged into one piece whose points are the
+         * quadrature points of the expansion list and whose cells are the
+         * linear sub-cells between neighbouring points of each element.
+         * The data may be written raw or base64 encoded, optionally
+         * compressed with zlib. In parallel every process writes its own
+         * file and the root process writes a .pvtu index of them.
+         */
+        class VtuWriter
+        {
+        public:
+            MULTI_REGIONS_EXPORT VtuWriter(const ExpListSharedPtr &pExp);
+
+            /// Adds a field given at the quadrature points of the
+            /// expansion list.
+            MULTI_REGIONS_EXPORT void AddField(
+                const std::string                  &name,
+                const Array<OneD, const NekDouble> &phys);
+
+            /// Selects base64 rather than raw encoding of the data.
+            void SetBase64(bool base64)
+            {
+                m_base64 = base64;
+            }
+
+            /// Selects zlib compression of the data.
+            void SetCompress(bool compress)
+            {
+                m_compress = compress;
+            }
+
+            /// Writes @a outname, or in parallel the files outname_P<rank>
+            /// with the extension of @a outname and the index outname with
+            /// the extension .pvtu. Returns the name of the file to open.
+            MULTI_REGIONS_EXPORT std::string Write(
+                const std::string &outname);
+
+        private:
+            ExpListSharedPtr                     m_exp;
+            bool                                 m_base64;
+            bool                                 m_compress;
+            std::vector<std::string>             m_fieldNames;
+            std::vector<Array<OneD, const NekDouble> > m_fields;
+
+            void WritePiece(const std::string &filename);
+
+            void WriteIndex(
+                const std::string              &filename,
+                const std::vector<std::string> &pieces);
+
+            std::string EncodeArray(
+                const void   *data,
+                const size_t  nBytes);
+        };
+    }
+}
+
+#endif
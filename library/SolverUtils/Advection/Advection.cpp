@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <SolverUtils/Advection/Advection.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 namespace Nektar
 {
@@ -61,6 +62,7 @@ namespace Nektar
             const Array<OneD, Array<OneD, NekDouble> >        &inarray,
                   Array<OneD, Array<OneD, NekDouble> >        &outarray)
         {
+            LibUtilities::ProfileRegion region("Advection::Advect");
             v_Advect(nConvectiveFields, fields, advVel, inarray, outarray);
         }
 
@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <SolverUtils/Advection/AdvectionWeakDG.h>
+#include <LibUtilities/Memory/ScratchArena.hpp>
 #include <iostream>
 #include <iomanip>
 
@@ -86,6 +87,10 @@ namespace Nektar
             int nTracePointsTot = fields[0]->GetTrace()->GetTotPoints();
             int i, j;
 
+            // Workspace is taken from the scratch arena of this thread and
+            // released on return.
+            ScratchScope scratch("AdvectionWeakDG::Advect");
+
             Array<OneD, Array<OneD, NekDouble> > tmp(nConvectiveFields);
             Array<OneD, Array<OneD, Array<OneD, NekDouble> > > fluxvector(
                 nConvectiveFields);
@@ -97,7 +102,7 @@ namespace Nektar
                     Array<OneD, Array<OneD, NekDouble> >(m_spaceDim);
                 for (j = 0; j < m_spaceDim; ++j)
                 {
-                    fluxvector[i][j] = Array<OneD, NekDouble>(nPointsTot);
+                    fluxvector[i][j] = scratch.Allocate(nPointsTot);
                 }
             }
 
@@ -109,7 +114,7 @@ namespace Nektar
             // Get the advection part (without numerical flux)
             for(i = 0; i < nConvectiveFields; ++i)
             {
-                tmp[i] = Array<OneD, NekDouble>(nCoeffs, 0.0);
+                tmp[i] = scratch.Allocate(nCoeffs, 0.0);
 
                 for (j = 0; j < nDim; ++j)
                 {
@@ -123,15 +128,22 @@ namespace Nektar
             Array<OneD, Array<OneD, NekDouble> > Fwd    (nConvectiveFields);
             Array<OneD, Array<OneD, NekDouble> > Bwd    (nConvectiveFields);
             Array<OneD, Array<OneD, NekDouble> > numflux(nConvectiveFields);
+            Array<OneD, Array<OneD, NekDouble> > physfield(nConvectiveFields);
+            Array<OneD, MultiRegions::ExpListSharedPtr> convFields(
+                nConvectiveFields);
 
             for(i = 0; i < nConvectiveFields; ++i)
             {
-                Fwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                Bwd[i]     = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                numflux[i] = Array<OneD, NekDouble>(nTracePointsTot, 0.0);
-                fields[i]->GetFwdBwdTracePhys(inarray[i], Fwd[i], Bwd[i]);
+                Fwd[i]        = scratch.Allocate(nTracePointsTot, 0.0);
+                Bwd[i]        = scratch.Allocate(nTracePointsTot, 0.0);
+                numflux[i]    = scratch.Allocate(nTracePointsTot, 0.0);
+                physfield[i]  = inarray[i];
+                convFields[i] = fields[i];
             }
 
+            // Extract and exchange the traces of all fields together.
+            fields[0]->GetFwdBwdTracePhys(convFields, physfield, Fwd, Bwd);
+
             m_riemann->Solve(Fwd, Bwd, numflux);
 
             // Evaulate <\phi, \hat{F}\cdot n> - OutField[i]
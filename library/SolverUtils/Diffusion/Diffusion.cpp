@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <SolverUtils/Diffusion/Diffusion.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 
 namespace Nektar
 {
@@ -60,6 +61,7 @@ namespace Nektar
             const Array<OneD, Array<OneD, NekDouble> >        &inarray,
                   Array<OneD, Array<OneD, NekDouble> >        &outarray)
         {
+            LibUtilities::ProfileRegion region("Diffusion::Diffuse");
             v_Diffuse(nConvectiveFields, fields, inarray, outarray);
         }
     }
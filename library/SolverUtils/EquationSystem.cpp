@@ -37,6 +37,7 @@
 #include <SolverUtils/EquationSystem.h>
 
 #include <LocalRegions/MatrixKey.h>
+#include <LocalRegions/MatrixCache.h>
 #include <LibUtilities/BasicUtils/Equation.h>
 #include <MultiRegions/ContField1D.h>
 #include <MultiRegions/ContField2D.h>
@@ -112,7 +113,7 @@ namespace Nektar
 
             // Instantiate a field reader/writer
             m_fld = MemoryManager<LibUtilities::FieldIO>
-                ::AllocateSharedPtr(m_session->GetComm());
+                ::AllocateSharedPtr(m_session);
 
             // Read the geometry and the expansion information
             m_graph = SpatialDomains::MeshGraph::Read(m_session);
@@ -228,6 +229,20 @@ namespace Nektar
                 m_session->MatchSolverInfo("SPECTRALHPDEALIASING", "On", 
                                            m_specHP_dealiasing, false);
             }
+
+            // Optionally share elemental matrices between elements with
+            // equivalent regular geometry
+            bool matrixCache;
+            m_session->MatchSolverInfo("ElementalMatrixCache", "True",
+                                       matrixCache, false);
+            if (matrixCache)
+            {
+                LocalRegions::MatrixCache::EnableCache();
+            }
+            else
+            {
+                LocalRegions::MatrixCache::DisableCache();
+            }
  
             // Options to determine type of projection from file or directly 
             // from constructor
@@ -654,10 +669,18 @@ namespace Nektar
          */
         EquationSystem::~EquationSystem()
         {
+            if (LocalRegions::MatrixCache::IsEnabled() &&
+                m_session->DefinesCmdLineArgument("verbose") &&
+                m_session->GetComm()->GetRank() == 0)
+            {
+                LocalRegions::MatrixCache::PrintStatistics(cout);
+            }
+
             LibUtilities::NekManager<LocalRegions::MatrixKey,
                 DNekScalMat, LocalRegions::MatrixKey::opLess>::ClearManager();
             LibUtilities::NekManager<LocalRegions::MatrixKey,
                 DNekScalBlkMat, LocalRegions::MatrixKey::opLess>::ClearManager();
+            LocalRegions::MatrixCache::Clear();
         }
 
         /**
@@ -750,20 +773,30 @@ namespace Nektar
             vType = m_session->GetFunctionType(pFunctionName, pFieldName);
             if (vType == LibUtilities::eFunctionTypeExpression)
             {
-                Array<OneD,NekDouble> x0(nq);
-                Array<OneD,NekDouble> x1(nq);
-                Array<OneD,NekDouble> x2(nq);
-                
-                // Get the coordinates (assuming all fields have the same
-                // discretisation)
-                m_fields[0]->GetCoords(x0,x1,x2);
+                // Evaluate on the quadrature points (assuming all fields
+                // have the same discretisation), reusing the
+                // time-independent part of the expression.
                 LibUtilities::EquationSharedPtr ffunc
                     = m_session->GetFunction(pFunctionName, pFieldName);
 
-                ffunc->Evaluate(x0,x1,x2,pTime,pArray);
+                m_fields[0]->EvaluateEquation(*ffunc, pTime, pArray);
             }
             else if (vType == LibUtilities::eFunctionTypeFile)
             {
+                // Functions read from file do not depend on time, so the
+                // file is only imported once for each number of quadrature
+                // points the function is evaluated on.
+                std::pair<std::string, unsigned int> key(
+                    pFunctionName + ":" + pFieldName, nq);
+                std::map<std::pair<std::string, unsigned int>,
+                         Array<OneD, NekDouble> >::iterator x =
+                    m_fileFunctionCache.find(key);
+                if (x != m_fileFunctionCache.end())
+                {
+                    Vmath::Vcopy(nq, x->second, 1, pArray, 1);
+                    return;
+                }
+
                 std::string filename
                     = m_session->GetFunctionFilename(pFunctionName, pFieldName);
                 std::vector<LibUtilities::FieldDefinitionsSharedPtr> FieldDef;
@@ -814,6 +847,10 @@ namespace Nektar
 
 
                 m_fields[0]->BwdTrans_IterPerExp(vCoeffs, pArray);
+
+                Array<OneD, NekDouble> &cached = m_fileFunctionCache[key];
+                cached = Array<OneD, NekDouble>(nq);
+                Vmath::Vcopy(nq, pArray, 1, cached, 1);
             }
         }
 
@@ -2105,6 +2142,12 @@ namespace Nektar
                                   "Mixed Continuous Galerkin and Discontinuous");
             }
             
+            if (m_session->DefinesSolverInfo("GlobalSysSoln"))
+            {
+                AddSummaryItem(s, "Global Sys Soln.",
+                               m_session->GetSolverInfo("GlobalSysSoln"));
+            }
+
             if (m_session->DefinesSolverInfo("DiffusionType"))
             {
                 std::string DiffusionType;
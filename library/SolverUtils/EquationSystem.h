@@ -395,6 +395,10 @@ namespace Nektar
             LibUtilities::SessionReaderSharedPtr        m_session;
             /// Field input/output
             LibUtilities::FieldIOSharedPtr              m_fld;
+            /// Values of file-based functions keyed by function and field
+            /// name and the number of quadrature points evaluated on.
+            std::map<std::pair<std::string, unsigned int>,
+                     Array<OneD, NekDouble> >           m_fileFunctionCache;
             /// Array holding all dependent variables.
             Array<OneD, MultiRegions::ExpListSharedPtr> m_fields;
             /// Base fields.
@@ -61,7 +61,7 @@ namespace Nektar
             m_outputFrequency = atoi(pParams.find("OutputFrequency")->second.c_str());
             m_outputIndex = 0;
             m_index = 0;
-            m_fld = MemoryManager<LibUtilities::FieldIO>::AllocateSharedPtr(pSession->GetComm());
+            m_fld = MemoryManager<LibUtilities::FieldIO>::AllocateSharedPtr(pSession);
 
         }
 
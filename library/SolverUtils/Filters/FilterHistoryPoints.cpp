@@ -34,15 +34,46 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <LibUtilities/Memory/NekMemoryManager.hpp>
+#include <LibUtilities/LinearAlgebra/Blas.hpp>
+#include <algorithm>
 #include <iomanip>
 #include <SolverUtils/Filters/FilterHistoryPoints.h>
 
+#include <boost/algorithm/string/predicate.hpp>
+
 namespace Nektar
 {
     namespace SolverUtils
     {
         std::string FilterHistoryPoints::className = GetFilterFactory().RegisterCreatorFunction("HistoryPoints", FilterHistoryPoints::create);
 
+        /// Identifier at the start of a binary history file.
+        static const char kBinaryHistoryMagic[8] =
+            {'N','E','K','T','A','R','H','P'};
+
+        /**
+         * @class FilterHistoryPoints
+         *
+         * Records the value of every field at a set of points. The point
+         * is located once, and the process holding it keeps the weights
+         * which interpolate the physical values of its element at the
+         * point, so each output step evaluates all points held by a process
+         * as one sparse matrix-vector product. Only the processes holding
+         * points send their values to the root process, which writes them.
+         *
+         * With the parameter OutputFormat set to Binary the output is
+         * written as
+         * - the identifier NEKTARHP;
+         * - the number of points, the number of fields and a flag which is
+         *   one for homogeneous expansions in wavespace, as 32-bit
+         *   integers;
+         * - for each field, the length of its name as a 32-bit integer,
+         *   followed by the name;
+         * - the coordinates of each point, as three doubles;
+         * - for each output step, the time followed by the values of all
+         *   fields at each point in turn, as doubles.
+         */
+
         /**
          *
          */
@@ -76,6 +107,17 @@ namespace Nektar
                 m_outputFrequency = atoi(pParams.find("OutputFrequency")->second.c_str());
             }
 
+            m_outputBinary = false;
+            if (pParams.find("OutputFormat") != pParams.end())
+            {
+                const std::string format =
+                                    pParams.find("OutputFormat")->second;
+                ASSERTL0(boost::iequals(format, "Ascii") ||
+                         boost::iequals(format, "Binary"),
+                         "OutputFormat must be Ascii or Binary.");
+                m_outputBinary = boost::iequals(format, "Binary");
+            }
+
 
             m_session->MatchSolverInfo("Homogeneous","1D",m_isHomogeneous1D,false);
             
@@ -116,7 +158,6 @@ namespace Nektar
                      "No history points in stream.");
 
             m_index = 0;
-            m_historyList.clear();
 
             // Read history points
             Array<OneD, NekDouble>  gloCoord(3,0.0);
@@ -156,16 +197,34 @@ namespace Nektar
             Array<OneD, int>  procList(m_historyPoints.size(), -1);
             Array<OneD, int> idList(m_historyPoints.size());
             std::vector<Array<OneD, NekDouble> > LocCoords; 
+
+            // Locate all history points at once
+            Array<OneD, Array<OneD, NekDouble> > gloCoords(3);
+            Array<OneD, Array<OneD, NekDouble> > locCoordsAll;
+            for (int j = 0; j < 3; ++j)
+            {
+                gloCoords[j] = Array<OneD, NekDouble>(m_historyPoints.size());
+            }
+            for (i = 0; i < m_historyPoints.size(); ++i)
+            {
+                m_historyPoints[i]->GetCoords(  gloCoords[0][i],
+                                                gloCoords[1][i],
+                                                gloCoords[2][i]);
+            }
+            // Points outside this partition are given the index -1. In
+            // serial the nearest element is used for points just outside
+            // the domain.
+            pFields[0]->GetExpIndices(gloCoords, idList, locCoordsAll,
+                                      NekConstants::kGeomFactorsTol,
+                                      vComm->GetSize() == 1);
             
             for (i = 0; i < m_historyPoints.size(); ++i)
             {
                 Array<OneD, NekDouble>  locCoords(3);
-
-                m_historyPoints[i]->GetCoords(  gloCoord[0],
-                                                gloCoord[1],
-                                                gloCoord[2]);
-
-                idList[i] = pFields[0]->GetExpIndex(gloCoord,locCoords);
+                for (int j = 0; j < 3; ++j)
+                {
+                    locCoords[j] = locCoordsAll[j][i];
+                }
             
                 // Save Local coordinates for later
                 LocCoords.push_back(locCoords);
@@ -200,25 +259,37 @@ namespace Nektar
             }
             vComm->AllReduce(procList, LibUtilities::ReduceMax);
 
-            // Determine the element in which each history point resides.
-            // If point is not in mesh (on this process), id is -1.
+            // Set up the interpolation of the points held by this process.
+            // If a point lies on a partition boundary, only the process with
+            // the maximum rank retains possession.
+            m_probeIds.clear();
+            m_probeElmt.clear();
+            m_probePhysOffset.clear();
+            m_probeWeights.clear();
+            m_probeWeightPtr.clear();
+            m_probeElmts.clear();
+            m_remoteProbeIds.clear();
             for (i = 0; i < m_historyPoints.size(); ++i)
             {
-                // If point lies on partition boundary, only the proc with max
-                // rank retains posession.
                 if (procList[i] != vRank)
                 {
                     idList[i] = -1;
                 }
                 if (idList[i] != -1)
                 {
-                    m_historyLocalPointMap[m_historyList.size()] = i;
-                    m_historyList.push_back(
-                                     std::pair<SpatialDomains::PointGeomSharedPtr,
-                                     Array<OneD, NekDouble> >
-                                     (m_historyPoints[i], LocCoords[i]));
+                    SetUpProbe(pFields[0], i, idList[i], LocCoords[i]);
+                }
+                else if (vRank == 0 && procList[i] > 0)
+                {
+                    m_remoteProbeIds[procList[i]].push_back(i);
                 }
             }
+            m_probeWeightPtr.push_back(m_probeWeights.size());
+
+            std::vector<int> elmts(m_probeElmt);
+            std::sort(elmts.begin(), elmts.end());
+            m_probeElmts.assign(elmts.begin(),
+                                std::unique(elmts.begin(), elmts.end()));
 
             // Collate the element ID list across processes and check each
             // history point is allocated to a process
@@ -237,22 +308,90 @@ namespace Nektar
                              " cannot be found in the mesh.");
                 }
 
-                // Open output stream
-                m_outputStream.open(m_outputFile.c_str());
-                m_outputStream << "# History data for variables (:";
+                WriteHeader(pFields);
+            }
+            v_Update(pFields, time);
+        }
 
-                for (i = 0; i < pFields.num_elements(); ++i)
-                {
-                    m_outputStream << m_session->GetVariable(i) <<",";
-                }
 
-                if(m_isHomogeneous1D)
+        /**
+         * Stores the weights which interpolate the physical values of
+         * element @a expId at the point with local coordinates @a locCoord.
+         * These are the products of the one-dimensional Lagrange
+         * interpolants in each collapsed coordinate direction, as used by
+         * StdPhysEvaluate.
+         */
+        void FilterHistoryPoints::SetUpProbe(
+            const MultiRegions::ExpListSharedPtr &pField,
+            const int                             pointId,
+            const int                             expId,
+            const Array<OneD, const NekDouble>   &locCoord)
+        {
+            LocalRegions::ExpansionSharedPtr exp = pField->GetExp(expId);
+            const int nBases = exp->GetNumBases();
+            const int nq     = exp->GetTotPoints();
+
+            Array<OneD, NekDouble> eta(3, 0.0);
+            if (nBases == 1)
+            {
+                eta[0] = locCoord[0];
+            }
+            else
+            {
+                exp->LocCoordToLocCollapsed(locCoord, eta);
+            }
+
+            const int offset = m_probeWeights.size();
+            m_probeWeights.resize(offset + nq, 1.0);
+
+            int stride = 1;
+            for (int d = 0; d < nBases; ++d)
+            {
+                const int              nqd = exp->GetBasis(d)->GetNumPoints();
+                DNekMatSharedPtr       I   = exp->GetBasis(d)->GetI(eta + d);
+                const NekDouble       *Id  = &(I->GetPtr())[0];
+                for (int q = 0; q < nq; ++q)
                 {
-                    m_outputStream << ") at points:";
+                    m_probeWeights[offset + q] *= Id[(q / stride) % nqd];
                 }
-                else
+                stride *= nqd;
+            }
+
+            m_probeIds.push_back(pointId);
+            m_probeElmt.push_back(expId);
+            m_probePhysOffset.push_back(pField->GetPhys_Offset(expId));
+            m_probeWeightPtr.push_back(offset);
+        }
+
+
+        /**
+         * Opens the output file on the root process and writes the list of
+         * points.
+         */
+        void FilterHistoryPoints::WriteHeader(
+            const Array<OneD, const MultiRegions::ExpListSharedPtr> &pFields)
+        {
+            Array<OneD, NekDouble> gloCoord(3, 0.0);
+            int i;
+
+            if (m_outputBinary)
+            {
+                m_outputStream.open(m_outputFile.c_str(),
+                                    std::ios::out | std::ios::binary);
+
+                int header[3];
+                header[0] = m_historyPoints.size();
+                header[1] = pFields.num_elements();
+                header[2] = m_isHomogeneous1D ? 1 : 0;
+                m_outputStream.write(kBinaryHistoryMagic, 8);
+                m_outputStream.write((const char *) header, sizeof(header));
+
+                for (i = 0; i < pFields.num_elements(); ++i)
                 {
-                    m_outputStream << ") at points:" << endl;
+                    const std::string var = m_session->GetVariable(i);
+                    const int         len = var.size();
+                    m_outputStream.write((const char *) &len, sizeof(int));
+                    m_outputStream.write(var.c_str(), len);
                 }
 
                 for (i = 0; i < m_historyPoints.size(); ++i)
@@ -260,23 +399,49 @@ namespace Nektar
                     m_historyPoints[i]->GetCoords(  gloCoord[0],
                                                     gloCoord[1],
                                                     gloCoord[2]);
-
-                    m_outputStream << "# \t" << i;
-                    m_outputStream.width(8);
-                    m_outputStream << gloCoord[0];
-                    m_outputStream.width(8);
-                    m_outputStream << gloCoord[1];
-                    m_outputStream.width(8);
-                    m_outputStream << gloCoord[2];
-                    m_outputStream << endl;
+                    m_outputStream.write((const char *) &gloCoord[0],
+                                         3*sizeof(NekDouble));
                 }
+                return;
+            }
 
-                if(m_isHomogeneous1D)
-                {
-                    m_outputStream << "(in Wavespace)" << endl;
-                }
+            m_outputStream.open(m_outputFile.c_str());
+            m_outputStream << "# History data for variables (:";
+
+            for (i = 0; i < pFields.num_elements(); ++i)
+            {
+                m_outputStream << m_session->GetVariable(i) <<",";
+            }
+
+            if(m_isHomogeneous1D)
+            {
+                m_outputStream << ") at points:";
+            }
+            else
+            {
+                m_outputStream << ") at points:" << endl;
+            }
+
+            for (i = 0; i < m_historyPoints.size(); ++i)
+            {
+                m_historyPoints[i]->GetCoords(  gloCoord[0],
+                                                gloCoord[1],
+                                                gloCoord[2]);
+
+                m_outputStream << "# \t" << i;
+                m_outputStream.width(8);
+                m_outputStream << gloCoord[0];
+                m_outputStream.width(8);
+                m_outputStream << gloCoord[1];
+                m_outputStream.width(8);
+                m_outputStream << gloCoord[2];
+                m_outputStream << endl;
+            }
+
+            if(m_isHomogeneous1D)
+            {
+                m_outputStream << "(in Wavespace)" << endl;
             }
-            v_Update(pFields, time);
         }
 
 
@@ -295,81 +460,89 @@ namespace Nektar
             int k         = 0;
             int numPoints = m_historyPoints.size();
             int numFields = pFields.num_elements();
+            int numLocal  = m_probeIds.size();
             LibUtilities::CommSharedPtr vComm = pFields[0]->GetComm();
-            Array<OneD, NekDouble> data(numPoints*numFields, 0.0);
-            Array<OneD, NekDouble> gloCoord(3, 0.0);
-            std::list<std::pair<SpatialDomains::PointGeomSharedPtr, Array<OneD, NekDouble> > >::iterator x;
-            
-            Array<OneD, NekDouble> physvals;
-            Array<OneD, NekDouble> locCoord;
-            int expId;
+            Array<OneD, NekDouble> local(numLocal*numFields, 0.0);
 
-            // Pull out data values field by field
+            // Evaluate the points held by this process field by field
             for (j = 0; j < numFields; ++j)
             {
-                if(m_isHomogeneous1D)
+                MultiRegions::ExpListSharedPtr field = m_isHomogeneous1D
+                    ? pFields[j]->GetPlane(m_outputPlane) : pFields[j];
+                Array<OneD, NekDouble> &phys = field->UpdatePhys();
+
+                // transform elemental data if required.
+                if (pFields[j]->GetPhysState() == false)
                 {
-                    for (k = 0, x = m_historyList.begin(); x != m_historyList.end(); 
-                         ++x, ++k)
+                    Array<OneD, NekDouble> tmp;
+                    for (k = 0; k < m_probeElmts.size(); ++k)
                     {
-                        locCoord = (*x).second;
-                        expId    = (*x).first->GetVid();
-
-                        physvals = pFields[j]->GetPlane(m_outputPlane)->UpdatePhys() + pFields[j]->GetPhys_Offset(expId);
-                        
-                        // transform elemental data if required. 
-                        if(pFields[j]->GetPhysState() == false)
-                        {
-                            pFields[j]->GetPlane(m_outputPlane)->GetExp(expId)->BwdTrans(pFields[j]->GetPlane(m_outputPlane)->GetCoeffs() + pFields[j]->GetCoeff_Offset(expId),physvals);
-                        }
-
-                        // interpolate point can do with zero plane methods
-                        data[m_historyLocalPointMap[k]*numFields+j] = pFields[j]->GetExp(expId)->StdPhysEvaluate(locCoord,physvals);
-                        
+                        const int expId = m_probeElmts[k];
+                        field->GetExp(expId)->BwdTrans(
+                            field->GetCoeffs() + pFields[j]->GetCoeff_Offset(expId),
+                            tmp = phys + pFields[j]->GetPhys_Offset(expId));
                     }
                 }
-                else
-                {
-                    for (k = 0, x = m_historyList.begin(); x != m_historyList.end(); ++x, ++k)
-                    {
-                        locCoord = (*x).second;
-                        expId    = (*x).first->GetVid();
 
-                        physvals = pFields[j]->UpdatePhys() + pFields[j]->GetPhys_Offset(expId);
-                        
-                        // transform elemental data if required. 
-                        if(pFields[j]->GetPhysState() == false)
-                        {
-                            pFields[j]->GetExp(expId)->BwdTrans(pFields[j]->GetCoeffs() + pFields[j]->GetCoeff_Offset(expId),physvals);
-                        }
+                for (k = 0; k < numLocal; ++k)
+                {
+                    const int w = m_probeWeightPtr[k];
+                    local[k*numFields+j] = Blas::Ddot(
+                        m_probeWeightPtr[k+1] - w, &m_probeWeights[w], 1,
+                        &phys[m_probePhysOffset[k]], 1);
+                }
+            }
 
-                        // interpolate point
-                        data[m_historyLocalPointMap[k]*numFields+j] = pFields[j]->GetExp(expId)->StdPhysEvaluate(locCoord,physvals);
-                        
-                    }
+            // Processes holding points send them to the root process
+            if (vComm->GetRank() != 0)
+            {
+                if (numLocal > 0)
+                {
+                    vComm->Send(0, local);
                 }
+                return;
             }
 
-            // Exchange history data
-            // This could be improved to reduce communication but works for now
-            vComm->AllReduce(data, LibUtilities::ReduceSum);
+            Array<OneD, NekDouble> data(numPoints*numFields, 0.0);
+            for (k = 0; k < numLocal; ++k)
+            {
+                Vmath::Vcopy(numFields, &local[k*numFields], 1,
+                             &data[m_probeIds[k]*numFields], 1);
+            }
 
-            // Only the root process writes out history data
-            if (vComm->GetRank() == 0)
+            std::map<int, std::vector<int> >::const_iterator it;
+            for (it = m_remoteProbeIds.begin(); it != m_remoteProbeIds.end();
+                 ++it)
             {
+                const std::vector<int> &ids = it->second;
+                Array<OneD, NekDouble> remote(ids.size()*numFields);
+                vComm->Recv(it->first, remote);
+                for (k = 0; k < ids.size(); ++k)
+                {
+                    Vmath::Vcopy(numFields, &remote[k*numFields], 1,
+                                 &data[ids[k]*numFields], 1);
+                }
+            }
 
-                // Write data values point by point
-                for (k = 0; k < m_historyPoints.size(); ++k)
+            if (m_outputBinary)
+            {
+                m_outputStream.write((const char *) &time, sizeof(NekDouble));
+                m_outputStream.write((const char *) &data[0],
+                                     numPoints*numFields*sizeof(NekDouble));
+                return;
+            }
+
+            // Write data values point by point
+            for (k = 0; k < numPoints; ++k)
+            {
+                m_outputStream.width(8);
+                m_outputStream << setprecision(6) << time;
+                for (j = 0; j < numFields; ++j)
                 {
-                    m_outputStream.width(8);
-                    m_outputStream << setprecision(6) << time;
-                    for (int j = 0; j < numFields; ++j)
-                    {
-                        m_outputStream.width(25);
-                        m_outputStream << setprecision(16) << data[k*numFields+j];
-                    }
-                    m_outputStream << endl;
+                    m_outputStream.width(25);
+                    m_outputStream << setprecision(16) << data[k*numFields+j];
                 }
+                m_outputStream << endl;
             }
         }
 
@@ -76,12 +76,35 @@ namespace Nektar
             unsigned int                            m_outputFrequency;
             unsigned int                            m_outputPlane; // plane to take history point from if using a homogeneous1D expansion
             bool                                    m_isHomogeneous1D;
+            bool                                    m_outputBinary;
             std::string                             m_outputFile;
             std::ofstream                           m_outputStream;
             std::stringstream                       m_historyPointStream;
-            std::list<std::pair<SpatialDomains::PointGeomSharedPtr,
-                                Array<OneD, NekDouble> > > m_historyList;
-            std::map<int, int >                     m_historyLocalPointMap;
+
+            /// Global index of each history point owned by this process.
+            std::vector<int>                        m_probeIds;
+            /// Element and physical offset of each owned point.
+            std::vector<int>                        m_probeElmt;
+            std::vector<int>                        m_probePhysOffset;
+            /// Interpolation weights of the owned points, with those of
+            /// point k starting at m_probeWeightPtr[k].
+            std::vector<NekDouble>                  m_probeWeights;
+            std::vector<int>                        m_probeWeightPtr;
+            /// Elements holding at least one owned point.
+            std::vector<int>                        m_probeElmts;
+            /// On the root process, the global indices of the points owned
+            /// by each other process holding points.
+            std::map<int, std::vector<int> >        m_remoteProbeIds;
+
+            void SetUpProbe(
+                const MultiRegions::ExpListSharedPtr &pField,
+                const int                             pointId,
+                const int                             expId,
+                const Array<OneD, const NekDouble>   &locCoord);
+
+            void WriteHeader(
+                const Array<OneD, const MultiRegions::ExpListSharedPtr>
+                                                                    &pFields);
         };
     }
 }
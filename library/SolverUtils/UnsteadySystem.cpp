@@ -38,6 +38,7 @@
 
 #include <LibUtilities/TimeIntegration/TimeIntegrationWrapper.h>
 #include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/Profiler.h>
 #include <MultiRegions/AssemblyMap/AssemblyMapDG.h>
 #include <SolverUtils/UnsteadySystem.h>
 
@@ -168,6 +169,8 @@ namespace Nektar
         {
             ASSERTL0(m_intScheme != 0, "No time integration scheme.");
 
+            LibUtilities::ProfileRegion solveRegion("UnsteadySystem::DoSolve");
+
             int i, nchk = 1;
             int nvariables = 0;
             int nfields = m_fields.num_elements();
@@ -276,8 +279,11 @@ namespace Nektar
                 }
 
                 timer.Start();
-                fields = m_intScheme->TimeIntegrate(
-                    step, m_timestep, m_intSoln, m_ode);
+                {
+                    LibUtilities::ProfileRegion region("TimeIntegrate");
+                    fields = m_intScheme->TimeIntegrate(
+                        step, m_timestep, m_intSoln, m_ode);
+                }
                 timer.Stop();
 
                 m_time  += m_timestep;
@@ -313,26 +319,33 @@ namespace Nektar
                 }
 
                 // Transform data into coefficient space
-                for (i = 0; i < nvariables; ++i)
                 {
-                    m_fields[m_intVariables[i]]->SetPhys(fields[i]);
-                    m_fields[m_intVariables[i]]->FwdTrans_IterPerExp(
-                        fields[i],
-                        m_fields[m_intVariables[i]]->UpdateCoeffs());
-                    m_fields[m_intVariables[i]]->SetPhysState(false);
+                    LibUtilities::ProfileRegion region("FwdTrans");
+                    for (i = 0; i < nvariables; ++i)
+                    {
+                        m_fields[m_intVariables[i]]->SetPhys(fields[i]);
+                        m_fields[m_intVariables[i]]->FwdTrans_IterPerExp(
+                            fields[i],
+                            m_fields[m_intVariables[i]]->UpdateCoeffs());
+                        m_fields[m_intVariables[i]]->SetPhysState(false);
+                    }
                 }
                 
                 // Update filters
-                std::vector<FilterSharedPtr>::iterator x;
-                for (x = m_filters.begin(); x != m_filters.end(); ++x)
                 {
-                    (*x)->Update(m_fields, m_time);
+                    LibUtilities::ProfileRegion region("Filters");
+                    std::vector<FilterSharedPtr>::iterator x;
+                    for (x = m_filters.begin(); x != m_filters.end(); ++x)
+                    {
+                        (*x)->Update(m_fields, m_time);
+                    }
                 }
                 
                 // Write out checkpoint files
                 if ((m_checksteps && step && !((step + 1) % m_checksteps)) ||
                     doCheckTime)
                 {
+                    LibUtilities::ProfileRegion region("Checkpoint");
                     if(m_HomogeneousType == eHomogeneous1D)
                     {
                         vector<bool> transformed(nfields, false);
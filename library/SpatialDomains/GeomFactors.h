@@ -37,6 +37,7 @@
 #define NEKTAR_SPATIALDOMAINS_GEOMFACTORS_H
 
 #include <boost/unordered_set.hpp>
+#include <boost/thread/mutex.hpp>
 
 #include <LibUtilities/Foundations/Basis.h>
 #include <SpatialDomains/SpatialDomains.hpp>
@@ -147,6 +148,9 @@ namespace SpatialDomains
             /// DerivFactors vector cache
             std::map<LibUtilities::PointsKeyVector, Array<TwoD, NekDouble> >
                                                 m_derivFactorCache;
+            /// Guards the caches, since factors may be shared by elements
+            /// evaluated on different threads.
+            boost::mutex m_cacheMutex;
 
         private:
             /// Tests if the element is valid and not self-intersecting.
@@ -220,6 +224,7 @@ namespace SpatialDomains
     inline const Array<OneD, const NekDouble> GeomFactors::GetJac(
             const LibUtilities::PointsKeyVector &keyTgt)
     {
+        boost::mutex::scoped_lock lock(m_cacheMutex);
         std::map<LibUtilities::PointsKeyVector,
                  Array<OneD, NekDouble> >::const_iterator x;
 
@@ -260,6 +265,7 @@ namespace SpatialDomains
     inline const Array<TwoD, const NekDouble> GeomFactors::GetDerivFactors(
             const LibUtilities::PointsKeyVector &keyTgt)
     {
+        boost::mutex::scoped_lock lock(m_cacheMutex);
         std::map<LibUtilities::PointsKeyVector,
                  Array<TwoD, NekDouble> >::const_iterator x;
 
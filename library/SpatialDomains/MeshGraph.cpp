@@ -54,6 +54,8 @@
 #include <SpatialDomains/MeshGraph1D.h>
 #include <SpatialDomains/MeshGraph2D.h>
 #include <SpatialDomains/MeshGraph3D.h>
+#include <LibUtilities/BasicUtils/CompressData.h>
+#include <LibUtilities/BasicUtils/MeshEntities.hpp>
 
 // These are required for the Write(...) and Import(...) functions.
 #include <boost/archive/iterators/base64_from_binary.hpp>
@@ -389,9 +391,28 @@ namespace Nektar
                 zmove = expEvaluator.Evaluate(expr_id);
             }
 
+            int indx;
+
+            if (LibUtilities::CompressData::IsCompressed(element))
+            {
+                std::vector<LibUtilities::MeshVertex> vertData;
+                LibUtilities::CompressData::ReadCompressedData(element,
+                                                               vertData);
+
+                for (int i = 0; i < vertData.size(); ++i)
+                {
+                    indx = vertData[i].id;
+                    m_vertSet[indx] = MemoryManager<PointGeom>
+                        ::AllocateSharedPtr(m_spaceDimension, indx,
+                                            vertData[i].x*xscale + xmove,
+                                            vertData[i].y*yscale + ymove,
+                                            vertData[i].z*zscale + zmove);
+                }
+                return;
+            }
+
             TiXmlElement *vertex = element->FirstChildElement("V");
 
-            int indx;
             int nextVertexNumber = -1;
 
             while (vertex)
@@ -1107,6 +1128,78 @@ namespace Nektar
                 return;
             }
 
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                std::vector<LibUtilities::MeshCurvedInfo> edgeInfo;
+                std::vector<LibUtilities::MeshCurvedInfo> faceInfo;
+                std::vector<NekDouble> points;
+
+                TiXmlElement *x = field->FirstChildElement();
+                while (x)
+                {
+                    std::string tag(x->ValueStr());
+                    if (tag == "E")
+                    {
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, edgeInfo);
+                    }
+                    else if (tag == "F")
+                    {
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, faceInfo);
+                    }
+                    else if (tag == "POINTS")
+                    {
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, points);
+                    }
+                    else
+                    {
+                        ASSERTL0(false, "Unknown compressed curve tag: " + tag);
+                    }
+                    x = x->NextSiblingElement();
+                }
+
+                // As for the text format, only the points of curved edges
+                // are scaled.
+                std::vector<LibUtilities::MeshCurvedInfo> *info[2] =
+                    { &edgeInfo, &faceInfo };
+                CurveVector *curves[2] = { &m_curvedEdges, &m_curvedFaces };
+                NekDouble scale[2][3] = { { xscale, yscale, zscale },
+                                          { 1.0,    1.0,    1.0    } };
+
+                for (int t = 0; t < 2; ++t)
+                {
+                    for (int i = 0; i < info[t]->size(); ++i)
+                    {
+                        const LibUtilities::MeshCurvedInfo &c = (*info[t])[i];
+
+                        ASSERTL0(c.ptype >= 0 &&
+                                 c.ptype < LibUtilities::SIZE_PointsType,
+                                 "Invalid points type.");
+                        ASSERTL0(3 * ((size_t)c.ptoffset + c.npoints)
+                                     <= points.size(),
+                                 "Curve points lie outside the POINTS data.");
+
+                        CurveSharedPtr curve(MemoryManager<Curve>
+                            ::AllocateSharedPtr(c.entityid,
+                                (LibUtilities::PointsType)c.ptype));
+
+                        size_t k = 3 * (size_t)c.ptoffset;
+                        for (int j = 0; j < c.npoints; ++j, k += 3)
+                        {
+                            curve->m_points.push_back(MemoryManager<PointGeom>
+                                ::AllocateSharedPtr(m_meshDimension, c.id,
+                                                    points[k]  *scale[t][0],
+                                                    points[k+1]*scale[t][1],
+                                                    points[k+2]*scale[t][2]));
+                        }
+                        curves[t]->push_back(curve);
+                    }
+                }
+                return;
+            }
+
             /// All curves are of the form: "<? ID="#" TYPE="GLL OR other
             /// points type" NUMPOINTS="#"> ... </?>", with ? being an
             /// element type (either E or F).
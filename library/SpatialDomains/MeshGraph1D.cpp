@@ -36,6 +36,8 @@
 
 #include <SpatialDomains/MeshGraph1D.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
+#include <LibUtilities/BasicUtils/CompressData.h>
+#include <LibUtilities/BasicUtils/MeshEntities.hpp>
 #include <tinyxml/tinyxml.h>
 
 namespace Nektar
@@ -105,6 +107,28 @@ namespace Nektar
 
             ASSERTL0(field, "Unable to find ELEMENT tag in file.");
 
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                TiXmlElement *x = field->FirstChildElement("S");
+                ASSERTL0(x, "At least one element must be specified.");
+
+                std::vector<LibUtilities::MeshEdge> segData;
+                LibUtilities::CompressData::ReadCompressedData(x, segData);
+                ASSERTL0(segData.size() > 0,
+                         "At least one element must be specified.");
+
+                for (int i = 0; i < segData.size(); ++i)
+                {
+                    int indx = segData[i].id;
+                    PointGeomSharedPtr v1 = GetVertex(segData[i].v0);
+                    PointGeomSharedPtr v2 = GetVertex(segData[i].v1);
+                    SegGeomSharedPtr seg = MemoryManager<SegGeom>::AllocateSharedPtr(indx, v1,v2);
+                    seg->SetGlobalID(indx);
+                    m_segGeoms[indx] = seg;
+                }
+                return;
+            }
+
             int nextElementNumber = -1;
 
             /// All elements are of the form: "<S ID = n> ... </S>", with
@@ -37,6 +37,8 @@
 #include <SpatialDomains/SegGeom.h>
 #include <SpatialDomains/TriGeom.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
+#include <LibUtilities/BasicUtils/CompressData.h>
+#include <LibUtilities/BasicUtils/MeshEntities.hpp>
 #include <tinyxml/tinyxml.h>
 
 namespace Nektar
@@ -106,6 +108,28 @@ namespace Nektar
 
             ASSERTL0(field, "Unable to find EDGE tag in file.");
 
+            int i,indx;
+
+            // Curved Edges
+            map<int, int> edge_curved;
+            for(i = 0; i < m_curvedEdges.size(); ++i)
+            {
+                edge_curved[m_curvedEdges[i]->m_curveID] = i;
+            }
+
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                std::vector<LibUtilities::MeshEdge> edgeData;
+                LibUtilities::CompressData::ReadCompressedData(field, edgeData);
+
+                for (i = 0; i < edgeData.size(); ++i)
+                {
+                    CreateSegGeom(edgeData[i].id, edgeData[i].v0,
+                                  edgeData[i].v1, edge_curved);
+                }
+                return;
+            }
+
             /// All elements are of the form: "<E ID="#"> ... </E>", with
             /// ? being the element type.
             /// Read the ID field first.
@@ -118,16 +142,8 @@ namespace Nektar
             /// cannot handle missing edge numbers as we could with
             /// missing element numbers due to the text block format.
             std::string edgeStr;
-            int i,indx;
             int nextEdgeNumber = -1;
 
-            // Curved Edges
-            map<int, int> edge_curved;
-            for(i = 0; i < m_curvedEdges.size(); ++i)
-            {
-                edge_curved[m_curvedEdges[i]->m_curveID] = i;
-            }
-
             while(edge)
             {
                 nextEdgeNumber++;
@@ -159,22 +175,7 @@ namespace Nektar
                         // entry if we don't check here.
                         if (!edgeDataStrm.fail())
                         {
-                            PointGeomSharedPtr vertices[2] = {GetVertex(vertex1), GetVertex(vertex2)};
-
-                            SegGeomSharedPtr edge;
-
-                            if(edge_curved.count(indx) == 0)
-                            {
-                                edge = MemoryManager<SegGeom>::AllocateSharedPtr(indx, m_spaceDimension, vertices);
-                                edge->SetGlobalID(indx); // Set global mesh id
-                            }
-                            else
-                            {
-                                edge = MemoryManager<SegGeom>::AllocateSharedPtr(indx, m_spaceDimension, vertices, m_curvedEdges[edge_curved.find(indx)->second]);
-                                edge->SetGlobalID(indx); //Set global mesh id
-                            }
-
-                            m_segGeoms[indx] = edge;
+                            CreateSegGeom(indx, vertex1, vertex2, edge_curved);
                         }
                     }
                 }
@@ -202,12 +203,53 @@ namespace Nektar
 
             // Set up curve map for curved elements on an embedded manifold.
             map<int, int> faceCurves;
-            map<int,int>::iterator x;
             for (int i = 0; i < m_curvedFaces.size(); ++i)
             {
                 faceCurves[m_curvedFaces[i]->m_curveID] = i;
             }
 
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                TiXmlElement *x = field->FirstChildElement();
+                while (x)
+                {
+                    std::string elementType(x->ValueStr());
+
+                    if (elementType == "T")
+                    {
+                        std::vector<LibUtilities::MeshTri> triData;
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, triData);
+
+                        for (int i = 0; i < triData.size(); ++i)
+                        {
+                            CreateTriGeom(triData[i].id, triData[i].e,
+                                          faceCurves);
+                        }
+                    }
+                    else if (elementType == "Q")
+                    {
+                        std::vector<LibUtilities::MeshQuad> quadData;
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, quadData);
+
+                        for (int i = 0; i < quadData.size(); ++i)
+                        {
+                            CreateQuadGeom(quadData[i].id, quadData[i].e,
+                                           faceCurves);
+                        }
+                    }
+                    else
+                    {
+                        ASSERTL0(false, "Unknown 2D element type: "
+                                        + elementType);
+                    }
+
+                    x = x->NextSiblingElement();
+                }
+                return;
+            }
+
             int nextElementNumber = -1;
 
             /// All elements are of the form: "<? ID="#"> ... </?>", with
@@ -249,51 +291,18 @@ namespace Nektar
                     if (elementType == "T")
                     {
                         // Read three edge numbers
-                        int edge1, edge2, edge3;
+                        int edges[TriGeom::kNedges];
                         std::istringstream elementDataStrm(elementStr.c_str());
 
                         try
                         {
-                            elementDataStrm >> edge1;
-                            elementDataStrm >> edge2;
-                            elementDataStrm >> edge3;
+                            elementDataStrm >> edges[0];
+                            elementDataStrm >> edges[1];
+                            elementDataStrm >> edges[2];
 
                             ASSERTL0(!elementDataStrm.fail(), (std::string("Unable to read element data for TRIANGLE: ") + elementStr).c_str());
 
-                            /// Create a TriGeom to hold the new definition.
-                            SegGeomSharedPtr edges[TriGeom::kNedges] =
-                        {
-                            GetSegGeom(edge1),
-                            GetSegGeom(edge2),
-                            GetSegGeom(edge3)
-                        };
-
-                            StdRegions::Orientation edgeorient[TriGeom::kNedges] =
-                        {
-                            SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
-                            SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
-                            SegGeom::GetEdgeOrientation(*edges[2], *edges[0])
-                        };
-
-                            TriGeomSharedPtr trigeom;
-                            if ((x = faceCurves.find(indx)) == faceCurves.end())
-                            {
-                                trigeom = MemoryManager<TriGeom>
-                                            ::AllocateSharedPtr(indx,
-                                                    edges,
-                                                    edgeorient);
-                            }
-                            else
-                            {
-                                trigeom = MemoryManager<TriGeom>
-                                            ::AllocateSharedPtr(indx,
-                                                    edges,
-                                                    edgeorient,
-                                                    m_curvedFaces[x->second]);
-                            }
-                            trigeom->SetGlobalID(indx);
-
-                            m_triGeoms[indx] = trigeom;
+                            CreateTriGeom(indx, edges, faceCurves);
                         }
                         catch(...)
                         {
@@ -303,51 +312,19 @@ namespace Nektar
                     else if (elementType == "Q")
                     {
                         // Read four edge numbers
-                        int edge1, edge2, edge3, edge4;
+                        int edges[QuadGeom::kNedges];
                         std::istringstream elementDataStrm(elementStr.c_str());
 
                         try
                         {
-                            elementDataStrm >> edge1;
-                            elementDataStrm >> edge2;
-                            elementDataStrm >> edge3;
-                            elementDataStrm >> edge4;
+                            elementDataStrm >> edges[0];
+                            elementDataStrm >> edges[1];
+                            elementDataStrm >> edges[2];
+                            elementDataStrm >> edges[3];
 
                             ASSERTL0(!elementDataStrm.fail(), (std::string("Unable to read element data for QUAD: ") + elementStr).c_str());
 
-                            /// Create a QuadGeom to hold the new definition.
-                            SegGeomSharedPtr edges[QuadGeom::kNedges] =
-                        {GetSegGeom(edge1),GetSegGeom(edge2),
-                         GetSegGeom(edge3),GetSegGeom(edge4)};
-
-                            StdRegions::Orientation edgeorient[QuadGeom::kNedges] =
-                        {
-                            SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
-                            SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
-                            SegGeom::GetEdgeOrientation(*edges[2], *edges[3]),
-                            SegGeom::GetEdgeOrientation(*edges[3], *edges[0])
-                        };
-
-                            QuadGeomSharedPtr quadgeom;
-                            if ((x = faceCurves.find(indx)) == faceCurves.end())
-                            {
-                                quadgeom = MemoryManager<QuadGeom>
-                                            ::AllocateSharedPtr(indx,
-                                                    edges,
-                                                    edgeorient);
-                            }
-                            else
-                            {
-                                quadgeom = MemoryManager<QuadGeom>
-                                            ::AllocateSharedPtr(indx,
-                                                    edges,
-                                                    edgeorient,
-                                                    m_curvedFaces[x->second]);
-                            }
-                            quadgeom->SetGlobalID(indx);
-
-                            m_quadGeoms[indx] = quadgeom;
-
+                            CreateQuadGeom(indx, edges, faceCurves);
                         }
                         catch(...)
                         {
@@ -360,6 +337,117 @@ namespace Nektar
                 }
         }
 
+        /**
+         * Creates the edge @a indx between two vertices, attaching its
+         * curve if it is listed in @a edgeCurves.
+         */
+        void MeshGraph2D::CreateSegGeom(int indx, int vertex1, int vertex2,
+                                        const map<int, int> &edgeCurves)
+        {
+            PointGeomSharedPtr vertices[2] = {GetVertex(vertex1), GetVertex(vertex2)};
+
+            SegGeomSharedPtr edge;
+            map<int, int>::const_iterator x = edgeCurves.find(indx);
+
+            if (x == edgeCurves.end())
+            {
+                edge = MemoryManager<SegGeom>::AllocateSharedPtr(indx, m_spaceDimension, vertices);
+            }
+            else
+            {
+                edge = MemoryManager<SegGeom>::AllocateSharedPtr(indx, m_spaceDimension, vertices, m_curvedEdges[x->second]);
+            }
+            edge->SetGlobalID(indx); // Set global mesh id
+
+            m_segGeoms[indx] = edge;
+        }
+
+        /**
+         * Creates the triangle @a indx from the IDs of its three edges,
+         * attaching its curve if it is listed in @a faceCurves.
+         */
+        void MeshGraph2D::CreateTriGeom(int indx, const int *edgeIDs,
+                                        const map<int, int> &faceCurves)
+        {
+            /// Create a TriGeom to hold the new definition.
+            SegGeomSharedPtr edges[TriGeom::kNedges] =
+            {
+                GetSegGeom(edgeIDs[0]),
+                GetSegGeom(edgeIDs[1]),
+                GetSegGeom(edgeIDs[2])
+            };
+
+            StdRegions::Orientation edgeorient[TriGeom::kNedges] =
+            {
+                SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
+                SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
+                SegGeom::GetEdgeOrientation(*edges[2], *edges[0])
+            };
+
+            TriGeomSharedPtr trigeom;
+            map<int, int>::const_iterator x = faceCurves.find(indx);
+            if (x == faceCurves.end())
+            {
+                trigeom = MemoryManager<TriGeom>
+                            ::AllocateSharedPtr(indx,
+                                    edges,
+                                    edgeorient);
+            }
+            else
+            {
+                trigeom = MemoryManager<TriGeom>
+                            ::AllocateSharedPtr(indx,
+                                    edges,
+                                    edgeorient,
+                                    m_curvedFaces[x->second]);
+            }
+            trigeom->SetGlobalID(indx);
+
+            m_triGeoms[indx] = trigeom;
+        }
+
+        /**
+         * Creates the quadrilateral @a indx from the IDs of its four edges,
+         * attaching its curve if it is listed in @a faceCurves.
+         */
+        void MeshGraph2D::CreateQuadGeom(int indx, const int *edgeIDs,
+                                         const map<int, int> &faceCurves)
+        {
+            /// Create a QuadGeom to hold the new definition.
+            SegGeomSharedPtr edges[QuadGeom::kNedges] =
+            {GetSegGeom(edgeIDs[0]),GetSegGeom(edgeIDs[1]),
+             GetSegGeom(edgeIDs[2]),GetSegGeom(edgeIDs[3])};
+
+            StdRegions::Orientation edgeorient[QuadGeom::kNedges] =
+            {
+                SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
+                SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
+                SegGeom::GetEdgeOrientation(*edges[2], *edges[3]),
+                SegGeom::GetEdgeOrientation(*edges[3], *edges[0])
+            };
+
+            QuadGeomSharedPtr quadgeom;
+            map<int, int>::const_iterator x = faceCurves.find(indx);
+            if (x == faceCurves.end())
+            {
+                quadgeom = MemoryManager<QuadGeom>
+                            ::AllocateSharedPtr(indx,
+                                    edges,
+                                    edgeorient);
+            }
+            else
+            {
+                quadgeom = MemoryManager<QuadGeom>
+                            ::AllocateSharedPtr(indx,
+                                    edges,
+                                    edgeorient,
+                                    m_curvedFaces[x->second]);
+            }
+            quadgeom->SetGlobalID(indx);
+
+            m_quadGeoms[indx] = quadgeom;
+        }
+
         void MeshGraph2D::ReadComposites(TiXmlDocument &doc)
         {
             TiXmlHandle docHandle(&doc);
@@ -227,6 +227,13 @@ namespace Nektar
             void ResolveGeomRef(const std::string &prevToken, const std::string &token,
                     Composite& composite);
 
+            void CreateSegGeom (int indx, int vertex1, int vertex2,
+                                const std::map<int, int> &edgeCurves);
+            void CreateTriGeom (int indx, const int *edgeIDs,
+                                const std::map<int, int> &faceCurves);
+            void CreateQuadGeom(int indx, const int *edgeIDs,
+                                const std::map<int, int> &faceCurves);
+
 #ifdef OLD
             bool   m_geoFacDefined;
 #endif
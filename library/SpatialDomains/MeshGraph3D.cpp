@@ -37,6 +37,8 @@
 #include <SpatialDomains/MeshGraph3D.h>
 #include <SpatialDomains/TriGeom.h>
 #include <LibUtilities/BasicUtils/ParseUtils.hpp>
+#include <LibUtilities/BasicUtils/CompressData.h>
+#include <LibUtilities/BasicUtils/MeshEntities.hpp>
 #include <tinyxml/tinyxml.h>
 
 namespace Nektar
@@ -107,6 +109,28 @@ namespace Nektar
 
             ASSERTL0(field, "Unable to find EDGE tag in file.");
 
+            int i,indx;
+
+            // Curved Edges
+            map<int, int> edge_curved;
+            for(i = 0; i < m_curvedEdges.size(); ++i)
+            {
+                edge_curved[m_curvedEdges[i]->m_curveID] = i;
+            }
+
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                std::vector<LibUtilities::MeshEdge> edgeData;
+                LibUtilities::CompressData::ReadCompressedData(field, edgeData);
+
+                for (i = 0; i < edgeData.size(); ++i)
+                {
+                    CreateSegGeom(edgeData[i].id, edgeData[i].v0,
+                                  edgeData[i].v1, edge_curved);
+                }
+                return;
+            }
+
             /// All elements are of the form: "<E ID="#"> ... </E>", with
             /// ? being the element type.
             /// Read the ID field first.
@@ -118,16 +142,8 @@ namespace Nektar
             /// edge list.  We cannot handle missing edge numbers as we could
             /// with missing element numbers due to the text block format.
             std::string edgeStr;
-            int i,indx;
             int nextEdgeNumber = -1;
 
-            // Curved Edges
-            map<int, int> edge_curved;
-            for(i = 0; i < m_curvedEdges.size(); ++i)
-            {
-                edge_curved[m_curvedEdges[i]->m_curveID] = i;
-            }
-
             while(edge)
             {
                 nextEdgeNumber++;
@@ -157,19 +173,7 @@ namespace Nektar
                         // don't check here.
                         if (!edgeDataStrm.fail())
                         {
-                            PointGeomSharedPtr vertices[2] = {GetVertex(vertex1), GetVertex(vertex2)};
-                            SegGeomSharedPtr edge;
-
-                            if (edge_curved.count(indx) == 0)
-                            {
-                                edge = MemoryManager<SegGeom>::AllocateSharedPtr(indx, m_spaceDimension, vertices);
-                            }
-                            else
-                            {
-                                edge = MemoryManager<SegGeom>::AllocateSharedPtr(indx, m_spaceDimension, vertices, m_curvedEdges[edge_curved.find(indx)->second]);
-                            }
-
-                            m_segGeoms[indx] = edge;
+                            CreateSegGeom(indx, vertex1, vertex2, edge_curved);
                         }
                     }
                 }
@@ -201,6 +205,47 @@ namespace Nektar
                 face_curved[m_curvedFaces[i]->m_curveID] = i;
             }
 
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                TiXmlElement *x = field->FirstChildElement();
+                while (x)
+                {
+                    std::string faceType(x->ValueStr());
+
+                    if (faceType == "T")
+                    {
+                        std::vector<LibUtilities::MeshTri> triData;
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, triData);
+
+                        for (int i = 0; i < triData.size(); ++i)
+                        {
+                            CreateTriGeom(triData[i].id, triData[i].e,
+                                          face_curved);
+                        }
+                    }
+                    else if (faceType == "Q")
+                    {
+                        std::vector<LibUtilities::MeshQuad> quadData;
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, quadData);
+
+                        for (int i = 0; i < quadData.size(); ++i)
+                        {
+                            CreateQuadGeom(quadData[i].id, quadData[i].e,
+                                           face_curved);
+                        }
+                    }
+                    else
+                    {
+                        ASSERTL0(false, "Unknown 3D face type: " + faceType);
+                    }
+
+                    x = x->NextSiblingElement();
+                }
+                return;
+            }
+
             /// All faces are of the form: "<? ID="#"> ... </?>", with
             /// ? being an element type (either Q or T).
 
@@ -236,46 +281,18 @@ namespace Nektar
                 if (elementType == "T")
                 {
                     // Read three edge numbers
-                    int edge1, edge2, edge3;
+                    int edges[TriGeom::kNedges];
                     std::istringstream elementDataStrm(elementStr.c_str());
 
                     try
                     {
-                        elementDataStrm >> edge1;
-                        elementDataStrm >> edge2;
-                        elementDataStrm >> edge3;
+                        elementDataStrm >> edges[0];
+                        elementDataStrm >> edges[1];
+                        elementDataStrm >> edges[2];
 
                         ASSERTL0(!elementDataStrm.fail(), (std::string("Unable to read face data for TRIANGLE: ") + elementStr).c_str());
 
-                        /// Create a TriGeom to hold the new definition.
-                        SegGeomSharedPtr edges[TriGeom::kNedges] =
-                        {
-                            GetSegGeom(edge1),
-                            GetSegGeom(edge2),
-                            GetSegGeom(edge3)
-                        };
-
-                        StdRegions::Orientation edgeorient[TriGeom::kNedges] =
-                        {
-                            SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
-                            SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
-                            SegGeom::GetEdgeOrientation(*edges[2], *edges[0])
-                        };
-                        
-                        TriGeomSharedPtr trigeom;
-                        
-                        if (face_curved.count(indx) == 0)
-                        {
-                            trigeom = MemoryManager<TriGeom>::AllocateSharedPtr(indx, edges, edgeorient);
-                        }
-                        else
-                        {
-                            trigeom = MemoryManager<TriGeom>::AllocateSharedPtr(indx, edges, edgeorient, m_curvedFaces[face_curved.find(indx)->second]);
-                        }
-                        
-                        trigeom->SetGlobalID(indx);
-
-                        m_triGeoms[indx] = trigeom;
+                        CreateTriGeom(indx, edges, face_curved);
                     }
                     catch(...)
                     {
@@ -286,43 +303,19 @@ namespace Nektar
                 else if (elementType == "Q")
                 {
                     // Read four edge numbers
-                    int edge1, edge2, edge3, edge4;
+                    int edges[QuadGeom::kNedges];
                     std::istringstream elementDataStrm(elementStr.c_str());
 
                     try
                     {
-                        elementDataStrm >> edge1;
-                        elementDataStrm >> edge2;
-                        elementDataStrm >> edge3;
-                        elementDataStrm >> edge4;
+                        elementDataStrm >> edges[0];
+                        elementDataStrm >> edges[1];
+                        elementDataStrm >> edges[2];
+                        elementDataStrm >> edges[3];
 
                         ASSERTL0(!elementDataStrm.fail(), (std::string("Unable to read face data for QUAD: ") + elementStr).c_str());
 
-                        /// Create a QuadGeom to hold the new definition.
-                        SegGeomSharedPtr edges[QuadGeom::kNedges] =
-                        {GetSegGeom(edge1),GetSegGeom(edge2),
-                         GetSegGeom(edge3),GetSegGeom(edge4)};
-
-                        StdRegions::Orientation edgeorient[QuadGeom::kNedges] =
-                        {
-                            SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
-                            SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
-                            SegGeom::GetEdgeOrientation(*edges[2], *edges[3]),
-                            SegGeom::GetEdgeOrientation(*edges[3], *edges[0])
-                        };
-
-                        QuadGeomSharedPtr quadgeom;
-
-                        if (face_curved.count(indx) == 0)
-                        {
-                            quadgeom = MemoryManager<QuadGeom>::AllocateSharedPtr(indx, edges, edgeorient);
-                        } else {
-                            quadgeom = MemoryManager<QuadGeom>::AllocateSharedPtr(indx, edges, edgeorient, m_curvedFaces[face_curved.find(indx)->second]);
-                        }
-                        quadgeom->SetGlobalID(indx);
-
-                        m_quadGeoms[indx] = quadgeom;
-
+                        CreateQuadGeom(indx, edges, face_curved);
                     }
                     catch(...)
                     {
@@ -347,6 +340,69 @@ namespace Nektar
 
             ASSERTL0(field, "Unable to find ELEMENT tag in file.");
 
+            if (LibUtilities::CompressData::IsCompressed(field))
+            {
+                TiXmlElement *x = field->FirstChildElement();
+                while (x)
+                {
+                    std::string elementType(x->ValueStr());
+
+                    //A - tet, P - pyramid, R - prism, H - hex
+                    if (elementType == "A")
+                    {
+                        std::vector<LibUtilities::MeshTet> tetData;
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, tetData);
+
+                        for (int i = 0; i < tetData.size(); ++i)
+                        {
+                            CreateTetGeom(tetData[i].id, tetData[i].f);
+                        }
+                    }
+                    else if (elementType == "P")
+                    {
+                        std::vector<LibUtilities::MeshPyr> pyrData;
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, pyrData);
+
+                        for (int i = 0; i < pyrData.size(); ++i)
+                        {
+                            CreatePyrGeom(pyrData[i].id, pyrData[i].f);
+                        }
+                    }
+                    else if (elementType == "R")
+                    {
+                        std::vector<LibUtilities::MeshPrism> prismData;
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, prismData);
+
+                        for (int i = 0; i < prismData.size(); ++i)
+                        {
+                            CreatePrismGeom(prismData[i].id, prismData[i].f);
+                        }
+                    }
+                    else if (elementType == "H")
+                    {
+                        std::vector<LibUtilities::MeshHex> hexData;
+                        LibUtilities::CompressData::ReadCompressedData(
+                            x, hexData);
+
+                        for (int i = 0; i < hexData.size(); ++i)
+                        {
+                            CreateHexGeom(hexData[i].id, hexData[i].f);
+                        }
+                    }
+                    else
+                    {
+                        ASSERTL0(false, "Unknown 3D element type: "
+                                        + elementType);
+                    }
+
+                    x = x->NextSiblingElement();
+                }
+                return;
+            }
+
             int nextElementNumber = -1;
 
             /// All elements are of the form: "<? ID="#"> ... </?>", with
@@ -388,57 +444,22 @@ namespace Nektar
                 std::istringstream elementDataStrm(elementStr.c_str());
 
                 /// Parse out the element components corresponding to type of element.
+                int faceIDs[HexGeom::kNfaces];
 
                 // Tetrahedral
                 if (elementType == "A")
                 {
                     try
                     {
-                        /// Create arrays for the tri and quad faces.
-                        const int kNfaces = TetGeom::kNfaces;
-                        const int kNtfaces = TetGeom::kNtfaces;
-                        const int kNqfaces = TetGeom::kNqfaces;
-                        TriGeomSharedPtr tfaces[kNtfaces];
-                        //QuadGeomSharedPtr qfaces[kNqfaces];
-                        int Ntfaces = 0;
-                        int Nqfaces = 0;
-
-                        /// Fill the arrays and make sure there aren't too many faces.
-                        std::stringstream errorstring;
-                        errorstring << "Element " << indx << " must have " << kNtfaces << " triangle face(s), and " << kNqfaces << " quadrilateral face(s).";
-                        for (int i = 0; i < kNfaces; i++)
+                        for (int i = 0; i < TetGeom::kNfaces; i++)
                         {
-                            int faceID;
-                            elementDataStrm >> faceID;
-                            Geometry2DSharedPtr face = GetGeometry2D(faceID);
-                            if (face == Geometry2DSharedPtr() ||
-                                (face->GetShapeType() != LibUtilities::eTriangle && face->GetShapeType() != LibUtilities::eQuadrilateral))
-                            {
-                                std::stringstream errorstring;
-                                errorstring << "Element " << indx << " has invalid face: " << faceID;
-                                ASSERTL0(false, errorstring.str().c_str());
-                            }
-                            else if (face->GetShapeType() == LibUtilities::eTriangle)
-                            {
-                                ASSERTL0(Ntfaces < kNtfaces, errorstring.str().c_str());
-                                tfaces[Ntfaces++] = boost::static_pointer_cast<TriGeom>(face);
-                            }
-                            else if (face->GetShapeType() == LibUtilities::eQuadrilateral)
-                            {
-                                ASSERTL0(Nqfaces < kNqfaces, errorstring.str().c_str());
-                            }
+                            elementDataStrm >> faceIDs[i];
                         }
 
-                        /// Make sure all of the face indicies could be read, and that there weren't too few.
+                        /// Make sure all of the face indicies could be read.
                         ASSERTL0(!elementDataStrm.fail(), (std::string("Unable to read element data for TETRAHEDRON: ") + elementStr).c_str());
-                        ASSERTL0(Ntfaces == kNtfaces, errorstring.str().c_str());
-                        ASSERTL0(Nqfaces == kNqfaces, errorstring.str().c_str());
-
-                        TetGeomSharedPtr tetgeom(MemoryManager<TetGeom>::AllocateSharedPtr(tfaces));
-                        tetgeom->SetGlobalID(indx);
 
-                        m_tetGeoms[indx] = tetgeom;
-                        PopulateFaceToElMap(tetgeom, kNfaces);
+                        CreateTetGeom(indx, faceIDs);
                     }
                     catch(...)
                     {
@@ -451,54 +472,15 @@ namespace Nektar
                 {
                     try
                     {
-                        /// Create arrays for the tri and quad faces.
-                        const int kNfaces = PyrGeom::kNfaces;
-                        const int kNtfaces = PyrGeom::kNtfaces;
-                        const int kNqfaces = PyrGeom::kNqfaces;
-                        Geometry2DSharedPtr faces[kNfaces];
-                        int Nfaces  = 0;
-                        int Ntfaces = 0;
-                        int Nqfaces = 0;
-
-                        /// Fill the arrays and make sure there aren't too many faces.
-                        std::stringstream errorstring;
-                        errorstring << "Element " << indx << " must have " << kNtfaces << " triangle face(s), and " << kNqfaces << " quadrilateral face(s).";
-                        for (int i = 0; i < kNfaces; i++)
+                        for (int i = 0; i < PyrGeom::kNfaces; i++)
                         {
-                            int faceID;
-                            elementDataStrm >> faceID;
-                            Geometry2DSharedPtr face = GetGeometry2D(faceID);
-                            if (face == Geometry2DSharedPtr() ||
-                                (face->GetShapeType() != LibUtilities::eTriangle && face->GetShapeType() != LibUtilities::eQuadrilateral))
-                            {
-                                std::stringstream errorstring;
-                                errorstring << "Element " << indx << " has invalid face: " << faceID;
-                                ASSERTL0(false, errorstring.str().c_str());
-                            }
-                            else if (face->GetShapeType() == LibUtilities::eTriangle)
-                            {
-                                ASSERTL0(Ntfaces < kNtfaces, errorstring.str().c_str());
-                                faces[Nfaces++] = boost::static_pointer_cast<TriGeom>(face);
-                                Ntfaces++;
-                            }
-                            else if (face->GetShapeType() == LibUtilities::eQuadrilateral)
-                            {
-                                ASSERTL0(Nqfaces < kNqfaces, errorstring.str().c_str());
-                                faces[Nfaces++] = boost::static_pointer_cast<QuadGeom>(face);
-                                Nqfaces++;
-                            }
+                            elementDataStrm >> faceIDs[i];
                         }
 
-                        /// Make sure all of the face indicies could be read, and that there weren't too few.
+                        /// Make sure all of the face indicies could be read.
                         ASSERTL0(!elementDataStrm.fail(), (std::string("Unable to read element data for PYRAMID: ") + elementStr).c_str());
-                        ASSERTL0(Ntfaces == kNtfaces, errorstring.str().c_str());
-                        ASSERTL0(Nqfaces == kNqfaces, errorstring.str().c_str());
-
-                        PyrGeomSharedPtr pyrgeom(MemoryManager<PyrGeom>::AllocateSharedPtr(faces));
-                        pyrgeom->SetGlobalID(indx);
 
-                        m_pyrGeoms[indx] = pyrgeom;
-                        PopulateFaceToElMap(pyrgeom, kNfaces);
+                        CreatePyrGeom(indx, faceIDs);
                     }
                     catch(...)
                     {
@@ -511,57 +493,15 @@ namespace Nektar
                 {
                     try
                     {
-                        /// Create arrays for the tri and quad faces.
-                        const int kNfaces = PrismGeom::kNfaces;
-                        const int kNtfaces = PrismGeom::kNtfaces;
-                        const int kNqfaces = PrismGeom::kNqfaces;
-                        Geometry2DSharedPtr faces[kNfaces];
-                        int Ntfaces = 0;
-                        int Nqfaces = 0;
-                        int Nfaces  = 0;
-
-                        /// Fill the arrays and make sure there aren't too many faces.
-                        std::stringstream errorstring;
-                        errorstring << "Element " << indx << " must have " 
-                                    << kNtfaces << " triangle face(s), and " 
-                                    << kNqfaces << " quadrilateral face(s).";
-                        
-                        for (int i = 0; i < kNfaces; i++)
+                        for (int i = 0; i < PrismGeom::kNfaces; i++)
                         {
-                            int faceID;
-                            elementDataStrm >> faceID;
-                            Geometry2DSharedPtr face = GetGeometry2D(faceID);
-                            if (face == Geometry2DSharedPtr() ||
-                                (face->GetShapeType() != LibUtilities::eTriangle && face->GetShapeType() != LibUtilities::eQuadrilateral))
-                            {
-                                std::stringstream errorstring;
-                                errorstring << "Element " << indx << " has invalid face: " << faceID;
-                                ASSERTL0(false, errorstring.str().c_str());
-                            }
-                            else if (face->GetShapeType() == LibUtilities::eTriangle)
-                            {
-                                ASSERTL0(Ntfaces < kNtfaces, errorstring.str().c_str());
-                                faces[Nfaces++] = boost::static_pointer_cast<TriGeom>(face);
-                                Ntfaces++;
-                            }
-                            else if (face->GetShapeType() == LibUtilities::eQuadrilateral)
-                            {
-                                ASSERTL0(Nqfaces < kNqfaces, errorstring.str().c_str());
-                                faces[Nfaces++] = boost::static_pointer_cast<QuadGeom>(face);
-                                Nqfaces++;
-                            }
+                            elementDataStrm >> faceIDs[i];
                         }
 
-                        /// Make sure all of the face indicies could be read, and that there weren't too few.
+                        /// Make sure all of the face indicies could be read.
                         ASSERTL0(!elementDataStrm.fail(), (std::string("Unable to read element data for PRISM: ") + elementStr).c_str());
-                        ASSERTL0(Ntfaces == kNtfaces, errorstring.str().c_str());
-                        ASSERTL0(Nqfaces == kNqfaces, errorstring.str().c_str());
-
-                        PrismGeomSharedPtr prismgeom(MemoryManager<PrismGeom>::AllocateSharedPtr(faces));
-                        prismgeom->SetGlobalID(indx);
 
-                        m_prismGeoms[indx] = prismgeom;
-                        PopulateFaceToElMap(prismgeom, kNfaces);
+                        CreatePrismGeom(indx, faceIDs);
                     }
                     catch(...)
                     {
@@ -574,52 +514,15 @@ namespace Nektar
                 {
                     try
                     {
-                        /// Create arrays for the tri and quad faces.
-                        const int kNfaces = HexGeom::kNfaces;
-                        const int kNtfaces = HexGeom::kNtfaces;
-                        const int kNqfaces = HexGeom::kNqfaces;
-                        //TriGeomSharedPtr tfaces[kNtfaces];
-                        QuadGeomSharedPtr qfaces[kNqfaces];
-                        int Ntfaces = 0;
-                        int Nqfaces = 0;
-
-                        /// Fill the arrays and make sure there aren't too many faces.
-                        std::stringstream errorstring;
-                        errorstring << "Element " << indx << " must have " << kNtfaces << " triangle face(s), and " << kNqfaces << " quadrilateral face(s).";
-                        for (int i = 0; i < kNfaces; i++)
+                        for (int i = 0; i < HexGeom::kNfaces; i++)
                         {
-                            int faceID;
-                            elementDataStrm >> faceID;
-                            Geometry2DSharedPtr face = GetGeometry2D(faceID);
-                            if (face == Geometry2DSharedPtr() ||
-                                (face->GetShapeType() != LibUtilities::eTriangle && face->GetShapeType() != LibUtilities::eQuadrilateral))
-                            {
-                                std::stringstream errorstring;
-                                errorstring << "Element " << indx << " has invalid face: " << faceID;
-                                ASSERTL0(false, errorstring.str().c_str());
-                            }
-                            else if (face->GetShapeType() == LibUtilities::eTriangle)
-                            {
-                                ASSERTL0(Ntfaces < kNtfaces, errorstring.str().c_str());
-                                //tfaces[Ntfaces++] = boost::static_pointer_cast<TriGeom>(face);
-                            }
-                            else if (face->GetShapeType() == LibUtilities::eQuadrilateral)
-                            {
-                                ASSERTL0(Nqfaces < kNqfaces, errorstring.str().c_str());
-                                qfaces[Nqfaces++] = boost::static_pointer_cast<QuadGeom>(face);
-                            }
+                            elementDataStrm >> faceIDs[i];
                         }
 
-                        /// Make sure all of the face indicies could be read, and that there weren't too few.
+                        /// Make sure all of the face indicies could be read.
                         ASSERTL0(!elementDataStrm.fail(), (std::string("Unable to read element data for HEXAHEDRAL: ") + elementStr).c_str());
-                        ASSERTL0(Ntfaces == kNtfaces, errorstring.str().c_str());
-                        ASSERTL0(Nqfaces == kNqfaces, errorstring.str().c_str());
-
-                        HexGeomSharedPtr hexgeom(MemoryManager<HexGeom>::AllocateSharedPtr(qfaces));
-                        hexgeom->SetGlobalID(indx);
 
-                        m_hexGeoms[indx] = hexgeom;
-                        PopulateFaceToElMap(hexgeom, kNfaces);
+                        CreateHexGeom(indx, faceIDs);
                     }
                     catch(...)
                     {
@@ -633,6 +536,219 @@ namespace Nektar
             }
         }
 
+        /**
+         * Creates the edge @a indx between two vertices, attaching its
+         * curve if it is listed in @a edgeCurves.
+         */
+        void MeshGraph3D::CreateSegGeom(int indx, int vertex1, int vertex2,
+                                        const map<int, int> &edgeCurves)
+        {
+            PointGeomSharedPtr vertices[2] = {GetVertex(vertex1), GetVertex(vertex2)};
+            SegGeomSharedPtr edge;
+            map<int, int>::const_iterator x = edgeCurves.find(indx);
+
+            if (x == edgeCurves.end())
+            {
+                edge = MemoryManager<SegGeom>::AllocateSharedPtr(indx, m_spaceDimension, vertices);
+            }
+            else
+            {
+                edge = MemoryManager<SegGeom>::AllocateSharedPtr(indx, m_spaceDimension, vertices, m_curvedEdges[x->second]);
+            }
+
+            m_segGeoms[indx] = edge;
+        }
+
+        /**
+         * Creates the triangular face @a indx from the IDs of its three
+         * edges, attaching its curve if it is listed in @a faceCurves.
+         */
+        void MeshGraph3D::CreateTriGeom(int indx, const int *edgeIDs,
+                                        const map<int, int> &faceCurves)
+        {
+            /// Create a TriGeom to hold the new definition.
+            SegGeomSharedPtr edges[TriGeom::kNedges] =
+            {
+                GetSegGeom(edgeIDs[0]),
+                GetSegGeom(edgeIDs[1]),
+                GetSegGeom(edgeIDs[2])
+            };
+
+            StdRegions::Orientation edgeorient[TriGeom::kNedges] =
+            {
+                SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
+                SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
+                SegGeom::GetEdgeOrientation(*edges[2], *edges[0])
+            };
+
+            TriGeomSharedPtr trigeom;
+            map<int, int>::const_iterator x = faceCurves.find(indx);
+
+            if (x == faceCurves.end())
+            {
+                trigeom = MemoryManager<TriGeom>::AllocateSharedPtr(indx, edges, edgeorient);
+            }
+            else
+            {
+                trigeom = MemoryManager<TriGeom>::AllocateSharedPtr(indx, edges, edgeorient, m_curvedFaces[x->second]);
+            }
+
+            trigeom->SetGlobalID(indx);
+
+            m_triGeoms[indx] = trigeom;
+        }
+
+        /**
+         * Creates the quadrilateral face @a indx from the IDs of its four
+         * edges, attaching its curve if it is listed in @a faceCurves.
+         */
+        void MeshGraph3D::CreateQuadGeom(int indx, const int *edgeIDs,
+                                         const map<int, int> &faceCurves)
+        {
+            /// Create a QuadGeom to hold the new definition.
+            SegGeomSharedPtr edges[QuadGeom::kNedges] =
+            {GetSegGeom(edgeIDs[0]),GetSegGeom(edgeIDs[1]),
+             GetSegGeom(edgeIDs[2]),GetSegGeom(edgeIDs[3])};
+
+            StdRegions::Orientation edgeorient[QuadGeom::kNedges] =
+            {
+                SegGeom::GetEdgeOrientation(*edges[0], *edges[1]),
+                SegGeom::GetEdgeOrientation(*edges[1], *edges[2]),
+                SegGeom::GetEdgeOrientation(*edges[2], *edges[3]),
+                SegGeom::GetEdgeOrientation(*edges[3], *edges[0])
+            };
+
+            QuadGeomSharedPtr quadgeom;
+            map<int, int>::const_iterator x = faceCurves.find(indx);
+
+            if (x == faceCurves.end())
+            {
+                quadgeom = MemoryManager<QuadGeom>::AllocateSharedPtr(indx, edges, edgeorient);
+            }
+            else
+            {
+                quadgeom = MemoryManager<QuadGeom>::AllocateSharedPtr(indx, edges, edgeorient, m_curvedFaces[x->second]);
+            }
+            quadgeom->SetGlobalID(indx);
+
+            m_quadGeoms[indx] = quadgeom;
+        }
+
+        /**
+         * Looks up the faces of the element @a indx, in the order given by
+         * @a faceIDs, and checks the element has @a kNtfaces triangular and
+         * @a kNqfaces quadrilateral faces.
+         */
+        void MeshGraph3D::GetElementFaces(int indx, const int *faceIDs,
+                                          int kNfaces, int kNtfaces,
+                                          int kNqfaces,
+                                          Geometry2DSharedPtr *faces)
+        {
+            int Ntfaces = 0;
+            int Nqfaces = 0;
+
+            /// Fill the arrays and make sure there aren't too many faces.
+            std::stringstream errorstring;
+            errorstring << "Element " << indx << " must have " 
+                        << kNtfaces << " triangle face(s), and " 
+                        << kNqfaces << " quadrilateral face(s).";
+
+            for (int i = 0; i < kNfaces; i++)
+            {
+                Geometry2DSharedPtr face = GetGeometry2D(faceIDs[i]);
+                if (face == Geometry2DSharedPtr() ||
+                    (face->GetShapeType() != LibUtilities::eTriangle && face->GetShapeType() != LibUtilities::eQuadrilateral))
+                {
+                    std::stringstream errorstring;
+                    errorstring << "Element " << indx << " has invalid face: " << faceIDs[i];
+                    ASSERTL0(false, errorstring.str().c_str());
+                }
+                else if (face->GetShapeType() == LibUtilities::eTriangle)
+                {
+                    ASSERTL0(Ntfaces < kNtfaces, errorstring.str().c_str());
+                    Ntfaces++;
+                }
+                else if (face->GetShapeType() == LibUtilities::eQuadrilateral)
+                {
+                    ASSERTL0(Nqfaces < kNqfaces, errorstring.str().c_str());
+                    Nqfaces++;
+                }
+                faces[i] = face;
+            }
+
+            /// Make sure there weren't too few faces of either type.
+            ASSERTL0(Ntfaces == kNtfaces, errorstring.str().c_str());
+            ASSERTL0(Nqfaces == kNqfaces, errorstring.str().c_str());
+        }
+
+        void MeshGraph3D::CreateTetGeom(int indx, const int *faceIDs)
+        {
+            const int kNfaces = TetGeom::kNfaces;
+            Geometry2DSharedPtr faces[kNfaces];
+            GetElementFaces(indx, faceIDs, kNfaces, TetGeom::kNtfaces,
+                            TetGeom::kNqfaces, faces);
+
+            TriGeomSharedPtr tfaces[kNfaces];
+            for (int i = 0; i < kNfaces; i++)
+            {
+                tfaces[i] = boost::static_pointer_cast<TriGeom>(faces[i]);
+            }
+
+            TetGeomSharedPtr tetgeom(MemoryManager<TetGeom>::AllocateSharedPtr(tfaces));
+            tetgeom->SetGlobalID(indx);
+
+            m_tetGeoms[indx] = tetgeom;
+            PopulateFaceToElMap(tetgeom, kNfaces);
+        }
+
+        void MeshGraph3D::CreatePyrGeom(int indx, const int *faceIDs)
+        {
+            const int kNfaces = PyrGeom::kNfaces;
+            Geometry2DSharedPtr faces[kNfaces];
+            GetElementFaces(indx, faceIDs, kNfaces, PyrGeom::kNtfaces,
+                            PyrGeom::kNqfaces, faces);
+
+            PyrGeomSharedPtr pyrgeom(MemoryManager<PyrGeom>::AllocateSharedPtr(faces));
+            pyrgeom->SetGlobalID(indx);
+
+            m_pyrGeoms[indx] = pyrgeom;
+            PopulateFaceToElMap(pyrgeom, kNfaces);
+        }
+
+        void MeshGraph3D::CreatePrismGeom(int indx, const int *faceIDs)
+        {
+            const int kNfaces = PrismGeom::kNfaces;
+            Geometry2DSharedPtr faces[kNfaces];
+            GetElementFaces(indx, faceIDs, kNfaces, PrismGeom::kNtfaces,
+                            PrismGeom::kNqfaces, faces);
+
+            PrismGeomSharedPtr prismgeom(MemoryManager<PrismGeom>::AllocateSharedPtr(faces));
+            prismgeom->SetGlobalID(indx);
+
+            m_prismGeoms[indx] = prismgeom;
+            PopulateFaceToElMap(prismgeom, kNfaces);
+        }
+
+        void MeshGraph3D::CreateHexGeom(int indx, const int *faceIDs)
+        {
+            const int kNfaces = HexGeom::kNfaces;
+            Geometry2DSharedPtr faces[kNfaces];
+            GetElementFaces(indx, faceIDs, kNfaces, HexGeom::kNtfaces,
+                            HexGeom::kNqfaces, faces);
+
+            QuadGeomSharedPtr qfaces[kNfaces];
+            for (int i = 0; i < kNfaces; i++)
+            {
+                qfaces[i] = boost::static_pointer_cast<QuadGeom>(faces[i]);
+            }
+
+            HexGeomSharedPtr hexgeom(MemoryManager<HexGeom>::AllocateSharedPtr(qfaces));
+            hexgeom->SetGlobalID(indx);
+
+            m_hexGeoms[indx] = hexgeom;
+            PopulateFaceToElMap(hexgeom, kNfaces);
+        }
+
         void MeshGraph3D::ReadComposites(TiXmlDocument &doc)
         {
             TiXmlHandle docHandle(&doc);
@@ -216,6 +216,19 @@ namespace Nektar
                     Composite& composite);
 
         private:
+            void CreateSegGeom  (int indx, int vertex1, int vertex2,
+                                 const std::map<int, int> &edgeCurves);
+            void CreateTriGeom  (int indx, const int *edgeIDs,
+                                 const std::map<int, int> &faceCurves);
+            void CreateQuadGeom (int indx, const int *edgeIDs,
+                                 const std::map<int, int> &faceCurves);
+            void GetElementFaces(int indx, const int *faceIDs, int kNfaces,
+                                 int kNtfaces, int kNqfaces,
+                                 Geometry2DSharedPtr *faces);
+            void CreateTetGeom  (int indx, const int *faceIDs);
+            void CreatePyrGeom  (int indx, const int *faceIDs);
+            void CreatePrismGeom(int indx, const int *faceIDs);
+            void CreateHexGeom  (int indx, const int *faceIDs);
             void PopulateFaceToElMap(Geometry3DSharedPtr element, int kNfaces);
             boost::unordered_map<int, ElementFaceVectorSharedPtr> m_faceToElMap;
 
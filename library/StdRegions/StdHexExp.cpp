@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <StdRegions/StdHexExp.h>
+#include <LibUtilities/Memory/ScratchArena.hpp>
 
 #ifdef max
 #undef max
@@ -400,7 +401,9 @@ namespace Nektar
         void StdHexExp::v_BwdTrans_SumFac(const Array<OneD, const NekDouble>& inarray,
                                          Array<OneD, NekDouble> &outarray)
         {
-            Array<OneD, NekDouble> wsp(m_base[0]->GetNumPoints()*
+            ScratchScope scratch("StdHexExp::BwdTrans_SumFac");
+            Array<OneD, NekDouble> wsp = scratch.Allocate(
+                                       m_base[0]->GetNumPoints()*
                                        m_base[2]->GetNumModes()*
                                        (m_base[1]->GetNumModes() + m_base[1]->GetNumPoints())); // FIX THIS
 
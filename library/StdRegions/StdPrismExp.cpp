@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <StdRegions/StdPrismExp.h>
+#include <LibUtilities/Memory/ScratchArena.hpp>
 
 namespace Nektar
 {
@@ -460,7 +461,9 @@ namespace Nektar
             int  order0 = m_base[0]->GetNumModes();
             int  order1 = m_base[1]->GetNumModes();
             
-            Array<OneD, NekDouble> wsp(nquad2*order1*order0 +
+            ScratchScope scratch("StdPrismExp::BwdTrans_SumFac");
+            Array<OneD, NekDouble> wsp = scratch.Allocate(
+                                       nquad2*order1*order0 +
                                        nquad1*nquad2*order0);
             
             BwdTrans_SumFacKernel(m_base[0]->GetBdata(),
@@ -36,6 +36,7 @@
 #include <StdRegions/StdQuadExp.h>
 #include <StdRegions/StdSegExp.h>
 #include <LibUtilities/Foundations/ManagerAccess.h>
+#include <LibUtilities/Memory/ScratchArena.hpp>
 
 namespace Nektar
 {
@@ -165,7 +166,9 @@ namespace Nektar
                             const Array<OneD, const NekDouble>& inarray,
                             Array<OneD, NekDouble> &outarray)
         {
-            Array<OneD, NekDouble> wsp(m_base[0]->GetNumPoints()* 
+            ScratchScope scratch("StdQuadExp::BwdTrans_SumFac");
+            Array<OneD, NekDouble> wsp = scratch.Allocate(
+                                       m_base[0]->GetNumPoints()*
                                        m_base[1]->GetNumModes());
 
             BwdTrans_SumFacKernel(m_base[0]->GetBdata(),
@@ -37,6 +37,7 @@
 
 
 #include <StdRegions/StdTetExp.h>
+#include <LibUtilities/Memory/ScratchArena.hpp>
 
 namespace Nektar
 {
@@ -553,7 +554,9 @@ namespace Nektar
             int  order0 = m_base[0]->GetNumModes();
             int  order1 = m_base[1]->GetNumModes();
 
-            Array<OneD, NekDouble> wsp(nquad2*order0*order1*(order1+1)/2+
+            ScratchScope scratch("StdTetExp::BwdTrans_SumFac");
+            Array<OneD, NekDouble> wsp = scratch.Allocate(
+                                       nquad2*order0*order1*(order1+1)/2+
                                        nquad2*nquad1*order0);
 
             BwdTrans_SumFacKernel(m_base[0]->GetBdata(),
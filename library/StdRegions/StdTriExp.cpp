@@ -36,6 +36,7 @@
 #include <StdRegions/StdTriExp.h>
 #include <StdRegions/StdNodalTriExp.h>
 #include <StdRegions/StdSegExp.h>       // for StdSegExp, etc
+#include <LibUtilities/Memory/ScratchArena.hpp>
 
 namespace Nektar
 {
@@ -259,7 +260,9 @@ namespace Nektar
             const Array<OneD, const NekDouble>& inarray, 
                   Array<OneD,       NekDouble>& outarray)
         {
-            Array<OneD, NekDouble> wsp(m_base[0]->GetNumPoints()* 
+            ScratchScope scratch("StdTriExp::BwdTrans_SumFac");
+            Array<OneD, NekDouble> wsp = scratch.Allocate(
+                                       m_base[0]->GetNumPoints()*
                                        m_base[1]->GetNumModes());
 
             BwdTrans_SumFacKernel(m_base[0]->GetBdata(),
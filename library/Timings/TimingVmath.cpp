@@ -0,0 +1,211 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
+#include <LibUtilities/BasicUtils/VmathSIMD.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+
+using namespace std;
+using namespace Nektar;
+using namespace Vmath::SIMD;
+
+// Compares the unit-stride Vmath kernels of every instruction set available
+// on this machine against the scalar loops, and the fused kernels against
+// the equivalent chains of unfused calls.
+
+static const int nSizes = 5;
+static const int sizes[nSizes] = {64, 512, 4096, 32768, 262144};
+
+// Roughly the same amount of work for every vector length.
+int NumCalls(int n, int work)
+{
+    return std::max(1, work / n);
+}
+
+enum KernelType
+{
+    eVmul,
+    eVadd,
+    eVdiv,
+    eSvtvp,
+    eVvtvp,
+    eVvtvvtp,
+    SIZE_KernelType
+};
+
+const char* const KernelTypeMap[] =
+{
+    "Vmul",
+    "Vadd",
+    "Vdiv",
+    "Svtvp",
+    "Vvtvp",
+    "Vvtvvtp"
+};
+
+NekDouble TimeKernel(const Kernels &k, KernelType type, int n, int ncalls,
+                     Array<OneD, NekDouble> *in, Array<OneD, NekDouble> &out)
+{
+    const NekDouble *v = &in[0][0];
+    const NekDouble *w = &in[1][0];
+    const NekDouble *x = &in[2][0];
+    const NekDouble *y = &in[3][0];
+    NekDouble       *z = &out[0];
+
+    Timer t;
+    t.Start();
+    for (int i = 0; i < ncalls; ++i)
+    {
+        switch (type)
+        {
+            case eVmul:    k.Vmul   (n, x, y, z);          break;
+            case eVadd:    k.Vadd   (n, x, y, z);          break;
+            case eVdiv:    k.Vdiv   (n, x, y, z);          break;
+            case eSvtvp:   k.Svtvp  (n, 0.5, x, y, z);     break;
+            case eVvtvp:   k.Vvtvp  (n, w, x, y, z);       break;
+            case eVvtvvtp: k.Vvtvvtp(n, v, w, x, y, z);    break;
+            default: break;
+        }
+    }
+    t.Stop();
+
+    return t.TimePerTest(ncalls);
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc > 2)
+    {
+        fprintf(stderr, "Usage: TimingVmath [work]\n");
+        fprintf(stderr, "    where: - work is the number of points processed "
+                        "per kernel and size (default 50000000)\n");
+        exit(1);
+    }
+
+    int work = argc == 2 ? atoi(argv[1]) : 50000000;
+    int n    = sizes[nSizes-1];
+
+    Array<OneD, NekDouble> in[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        in[i] = Array<OneD, NekDouble>(n);
+        for (int j = 0; j < n; ++j)
+        {
+            in[i][j] = 1.0 + 0.001*((i+1)*j % 997);
+        }
+    }
+    Array<OneD, NekDouble> out(n), tmp(n);
+
+    const Kernels &scalar = *GetKernels(eScalar);
+
+    cout << "Active instruction set: "
+         << InstructionSetMap[GetInstructionSet()] << endl << endl;
+
+    // Vectorised kernels against the scalar loops.
+    cout << "Kernel     Size     ISA        Time (us)   Speedup" << endl;
+    for (int t = 0; t < SIZE_KernelType; ++t)
+    {
+        for (int s = 0; s < nSizes; ++s)
+        {
+            int ncalls = NumCalls(sizes[s], work);
+            NekDouble base = TimeKernel(scalar, (KernelType)t, sizes[s],
+                                        ncalls, in, out);
+
+            for (int isa = 0; isa < SIZE_InstructionSet; ++isa)
+            {
+                const Kernels *k = GetKernels((InstructionSet)isa);
+                if (!k)
+                {
+                    continue;
+                }
+
+                NekDouble time = isa == eScalar ? base :
+                    TimeKernel(*k, (KernelType)t, sizes[s], ncalls, in, out);
+
+                printf("%-10s %-8d %-10s %-11.4f %.2f\n", KernelTypeMap[t],
+                       sizes[s], InstructionSetMap[isa], time*1e6,
+                       base/time);
+            }
+        }
+    }
+
+    // Fused kernels against chains of unfused calls through the public
+    // Vmath interface, using the active instruction set.
+    cout << endl << "Kernel     Size     Unfused (us) Fused (us)  Speedup"
+         << endl;
+    for (int s = 0; s < nSizes; ++s)
+    {
+        int ncalls = NumCalls(sizes[s], work);
+        int np     = sizes[s];
+        Timer t;
+
+        // z = alpha*(x*y)
+        t.Start();
+        for (int i = 0; i < ncalls; ++i)
+        {
+            Vmath::Vmul(np, in[2], 1, in[3], 1, out, 1);
+            Vmath::Smul(np, 0.5, out, 1, out, 1);
+        }
+        t.Stop();
+        NekDouble unfused = t.TimePerTest(ncalls);
+
+        t.Start();
+        for (int i = 0; i < ncalls; ++i)
+        {
+            Vmath::Svvt(np, 0.5, in[2], 1, in[3], 1, out, 1);
+        }
+        t.Stop();
+        NekDouble fused = t.TimePerTest(ncalls);
+
+        printf("%-10s %-8d %-12.4f %-11.4f %.2f\n", "Svvt", np,
+               unfused*1e6, fused*1e6, unfused/fused);
+
+        // z = alpha*(w*x) + y
+        t.Start();
+        for (int i = 0; i < ncalls; ++i)
+        {
+            Vmath::Vmul (np, in[1], 1, in[2], 1, tmp, 1);
+            Vmath::Svtvp(np, 0.5, tmp, 1, in[3], 1, out, 1);
+        }
+        t.Stop();
+        unfused = t.TimePerTest(ncalls);
+
+        t.Start();
+        for (int i = 0; i < ncalls; ++i)
+        {
+            Vmath::Svvtvp(np, 0.5, in[1], 1, in[2], 1, in[3], 1, out, 1);
+        }
+        t.Stop();
+        fused = t.TimePerTest(ncalls);
+
+        printf("%-10s %-8d %-12.4f %-11.4f %.2f\n", "Svvtvp", np,
+               unfused*1e6, fused*1e6, unfused/fused);
+
+        // z = v*w + x*y
+        t.Start();
+        for (int i = 0; i < ncalls; ++i)
+        {
+            Vmath::Vmul (np, in[0], 1, in[1], 1, tmp, 1);
+            Vmath::Vvtvp(np, in[2], 1, in[3], 1, tmp, 1, out, 1);
+        }
+        t.Stop();
+        unfused = t.TimePerTest(ncalls);
+
+        t.Start();
+        for (int i = 0; i < ncalls; ++i)
+        {
+            Vmath::Vvtvvtp(np, in[0], 1, in[1], 1, in[2], 1, in[3], 1,
+                           out, 1);
+        }
+        t.Stop();
+        fused = t.TimePerTest(ncalls);
+
+        printf("%-10s %-8d %-12.4f %-11.4f %.2f\n", "Vvtvvtp", np,
+               unfused*1e6, fused*1e6, unfused/fused);
+    }
+
+    return 0;
+}
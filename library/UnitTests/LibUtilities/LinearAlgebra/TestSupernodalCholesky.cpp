@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestSupernodalCholesky.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the sparse supernodal Cholesky factorisation
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include <LibUtilities/LinearAlgebra/SupernodalCholesky.hpp>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace SupernodalCholeskyUnitTests
+    {
+        void AddEntry(COOMatType &A, int i, int j, NekDouble v)
+        {
+            A[std::make_pair(i, j)] += v;
+        }
+
+        // Shifted five-point Laplacian on an n x n grid, lower triangle.
+        void Laplacian(int n, COOMatType &A)
+        {
+            for (int j = 0; j < n; ++j)
+            {
+                for (int i = 0; i < n; ++i)
+                {
+                    int k = j*n + i;
+                    AddEntry(A, k, k, 4.1);
+                    if (i > 0)
+                    {
+                        AddEntry(A, k, k-1, -1.0);
+                    }
+                    if (j > 0)
+                    {
+                        AddEntry(A, k, k-n, -1.0);
+                    }
+                }
+            }
+        }
+
+        void Multiply(int n, const COOMatType &A,
+                      const Array<OneD, NekDouble> &x,
+                            Array<OneD, NekDouble> &y)
+        {
+            for (int i = 0; i < n; ++i)
+            {
+                y[i] = 0.0;
+            }
+
+            for (COOMatTypeConstIt it = A.begin(); it != A.end(); ++it)
+            {
+                int r = it->first.first;
+                int c = it->first.second;
+                y[r] += it->second * x[c];
+                if (r != c)
+                {
+                    y[c] += it->second * x[r];
+                }
+            }
+        }
+
+        NekDouble SolveError(int n, const COOMatType &A)
+        {
+            Array<OneD, NekDouble> x(n), b(n), sol(n);
+            for (int i = 0; i < n; ++i)
+            {
+                x[i] = sin(0.37*i) + 0.5;
+            }
+            Multiply(n, A, x, b);
+
+            SupernodalCholesky chol(n, A);
+            chol.Solve(b, sol);
+
+            NekDouble err = 0.0;
+            for (int i = 0; i < n; ++i)
+            {
+                err = std::max(err, fabs(sol[i] - x[i]));
+            }
+            return err;
+        }
+
+        BOOST_AUTO_TEST_CASE(TestDense)
+        {
+            // Every column has the same pattern so there is one supernode.
+            int n = 6;
+            COOMatType A;
+            for (int j = 0; j < n; ++j)
+            {
+                for (int i = j; i < n; ++i)
+                {
+                    AddEntry(A, i, j, i == j ? n + 1.0 : 1.0/(1 + i + j));
+                }
+            }
+
+            SupernodalCholesky chol(n, A);
+            BOOST_CHECK_EQUAL(chol.GetNumSupernodes(), 1u);
+            BOOST_CHECK_EQUAL(chol.GetFactorNonZeros(), (size_t) n*n);
+            BOOST_CHECK_SMALL(SolveError(n, A), 1e-12);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestLaplacian)
+        {
+            int n = 15;
+            COOMatType A;
+            Laplacian(n, A);
+
+            BOOST_CHECK_SMALL(SolveError(n*n, A), 1e-11);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestDisconnected)
+        {
+            // Block diagonal matrix gives a forest of elimination trees.
+            int n = 4;
+            COOMatType A, B;
+            Laplacian(n, B);
+            A = B;
+            for (COOMatTypeConstIt it = B.begin(); it != B.end(); ++it)
+            {
+                AddEntry(A, it->first.first  + n*n,
+                            it->first.second + n*n, it->second);
+            }
+
+            BOOST_CHECK_SMALL(SolveError(2*n*n, A), 1e-11);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestUpperIgnored)
+        {
+            int n = 5;
+            COOMatType A, B;
+            Laplacian(n, A);
+            B = A;
+            AddEntry(B, 0, 7, 100.0);
+
+            Array<OneD, NekDouble> b(n*n, 1.0), x1(n*n), x2(n*n);
+            SupernodalCholesky(n*n, A).Solve(b, x1);
+            SupernodalCholesky(n*n, B).Solve(b, x2);
+
+            for (int i = 0; i < n*n; ++i)
+            {
+                BOOST_CHECK_EQUAL(x1[i], x2[i]);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestInPlace)
+        {
+            int n = 6;
+            COOMatType A;
+            Laplacian(n, A);
+
+            Array<OneD, NekDouble> b(n*n, 1.0), x(n*n);
+            SupernodalCholesky chol(n*n, A);
+            chol.Solve(b, x);
+            chol.Solve(b, b);
+
+            for (int i = 0; i < n*n; ++i)
+            {
+                BOOST_CHECK_EQUAL(x[i], b[i]);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNotPositiveDefinite)
+        {
+            COOMatType A;
+            AddEntry(A, 0, 0,  1.0);
+            AddEntry(A, 1, 0,  2.0);
+            AddEntry(A, 1, 1,  1.0);
+
+            BOOST_CHECK_THROW(SupernodalCholesky(2, A),
+                              ErrorUtil::NekError);
+        }
+    }
+}
@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestAnalyticExpressionEvaluator.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the cached evaluation of analytic expressions.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LibUtilitiesUnitTestsPrecompiledHeader.h"
+#include <LibUtilities/Interpreter/AnalyticExpressionEvaluator.hpp>
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace AnalyticExpressionEvaluatorUnitTests
+    {
+        using LibUtilities::AnalyticExpressionEvaluator;
+
+        // More points than one evaluation chunk, with a partial last chunk.
+        const int nPoints = 2500;
+
+        void CheckCached(AnalyticExpressionEvaluator &eval,
+                         const std::string           &expr)
+        {
+            Array<OneD, NekDouble> x(nPoints), y(nPoints), z(nPoints);
+            Array<OneD, NekDouble> t(nPoints), exact(nPoints);
+            Array<OneD, NekDouble> cache, cached;
+            for (int i = 0; i < nPoints; ++i)
+            {
+                x[i] = 0.001*i;
+                y[i] = 0.5 + 0.0003*i;
+                z[i] = -0.2*i;
+            }
+
+            int id = eval.DefineFunction("x y z t", expr);
+            eval.EvaluateSpatial(id, x, y, z, cache);
+            BOOST_CHECK_EQUAL(cache.num_elements(),
+                              eval.GetSpatialCacheSize(id)*nPoints);
+
+            for (NekDouble time = 0.1; time < 1.0; time += 0.3)
+            {
+                Vmath::Fill(nPoints, time, t, 1);
+                eval.Evaluate(id, x, y, z, t, exact);
+                eval.EvaluateCached(id, nPoints, cache, time, cached);
+                for (int i = 0; i < nPoints; ++i)
+                {
+                    BOOST_CHECK_EQUAL(cached[i], exact[i]);
+                }
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestSeparable)
+        {
+            AnalyticExpressionEvaluator eval;
+            CheckCached(eval, "x*t + y*z");
+            CheckCached(eval, "exp(-(x*x+y*y))*sin(2*PI*t) + z");
+            CheckCached(eval, "-(x*y)+t*t*x*sqrt(y+1)");
+            CheckCached(eval, "(x<0.5)*t + (x>=0.5)*y");
+        }
+
+        BOOST_AUTO_TEST_CASE(TestTimeOrSpaceOnly)
+        {
+            AnalyticExpressionEvaluator eval;
+            CheckCached(eval, "x+y");
+            CheckCached(eval, "t");
+            CheckCached(eval, "3.0");
+        }
+
+        BOOST_AUTO_TEST_CASE(TestParameters)
+        {
+            // Parameters may change between evaluations, so they are
+            // never cached.
+            AnalyticExpressionEvaluator eval;
+            eval.SetParameter("U0", 2.0);
+            CheckCached(eval, "sin(x)*cos(t) + U0*y");
+
+            int id = eval.DefineFunction("x y z t", "U0*x");
+            Array<OneD, NekDouble> x(nPoints, 1.5), cache, result;
+            eval.EvaluateSpatial(id, x, x, x, cache);
+            eval.SetParameter("U0", 3.0);
+            eval.EvaluateCached(id, nPoints, cache, 0.0, result);
+            BOOST_CHECK_EQUAL(result[0], 4.5);
+        }
+    }
+}
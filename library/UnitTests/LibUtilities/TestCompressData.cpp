@@ -0,0 +1,138 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestCompressData.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the compressed storage of mesh records.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LibUtilitiesUnitTestsPrecompiledHeader.h"
+#include <LibUtilities/BasicUtils/CompressData.h>
+#include <LibUtilities/BasicUtils/MeshEntities.hpp>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace CompressDataUnitTests
+    {
+        using namespace LibUtilities;
+
+        BOOST_AUTO_TEST_CASE(TestVertexRoundTrip)
+        {
+            // Sizes cover all remainders of the base64 padding.
+            for (int n = 0; n < 7; ++n)
+            {
+                std::vector<MeshVertex> in(n), out;
+                for (int i = 0; i < n; ++i)
+                {
+                    in[i].id = i;
+                    in[i].x  = 0.1 * i;
+                    in[i].y  = -1.0 / (i + 1);
+                    in[i].z  = 1e-300 * i;
+                }
+
+                std::string data64;
+                CompressData::ZlibEncodeToBase64Str(in, data64);
+                BOOST_CHECK(data64.find('=') == std::string::npos);
+
+                CompressData::ZlibDecodeFromBase64Str(data64, out);
+                BOOST_REQUIRE_EQUAL(out.size(), in.size());
+                for (int i = 0; i < n; ++i)
+                {
+                    BOOST_CHECK_EQUAL(out[i].id, in[i].id);
+                    BOOST_CHECK_EQUAL(out[i].x,  in[i].x);
+                    BOOST_CHECK_EQUAL(out[i].y,  in[i].y);
+                    BOOST_CHECK_EQUAL(out[i].z,  in[i].z);
+                }
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestLargeRoundTrip)
+        {
+            // Larger than a single zlib output buffer.
+            std::vector<MeshHex> in(100000), out;
+            for (int i = 0; i < in.size(); ++i)
+            {
+                in[i].id = i;
+                for (int j = 0; j < 6; ++j)
+                {
+                    in[i].f[j] = 6 * i + j;
+                }
+            }
+
+            std::string data64;
+            CompressData::ZlibEncodeToBase64Str(in, data64);
+            BOOST_CHECK(data64.size() < in.size() * sizeof(MeshHex));
+
+            // Line breaks, as introduced by reformatting the XML file, are
+            // ignored.
+            for (size_t i = 76; i < data64.size(); i += 77)
+            {
+                data64.insert(i, "\n");
+            }
+
+            CompressData::ZlibDecodeFromBase64Str(data64, out);
+            BOOST_REQUIRE_EQUAL(out.size(), in.size());
+            for (int i = 0; i < in.size(); ++i)
+            {
+                BOOST_CHECK_EQUAL(out[i].id, in[i].id);
+                BOOST_CHECK_EQUAL(out[i].f[5], in[i].f[5]);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestRecordSizeMismatch)
+        {
+            std::vector<MeshEdge> in(3);
+            std::vector<MeshTri>  out;
+            for (int i = 0; i < in.size(); ++i)
+            {
+                in[i].id = i;
+                in[i].v0 = i;
+                in[i].v1 = i + 1;
+            }
+
+            std::string data64;
+            CompressData::ZlibEncodeToBase64Str(in, data64);
+            BOOST_CHECK_THROW(
+                CompressData::ZlibDecodeFromBase64Str(data64, out),
+                ErrorUtil::NekError);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestCorruptData)
+        {
+            std::vector<NekDouble> out;
+            BOOST_CHECK_THROW(
+                CompressData::ZlibDecodeFromBase64Str("AAAAAAAA", out),
+                ErrorUtil::NekError);
+        }
+    }
+}
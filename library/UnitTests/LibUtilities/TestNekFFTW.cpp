@@ -0,0 +1,196 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestNekFFTW.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the batched FFTW transforms.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LibUtilitiesUnitTestsPrecompiledHeader.h"
+#include <LibUtilities/FFT/NektarFFT.h>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+namespace Nektar
+{
+    namespace NekFFTWUnitTests
+    {
+        const int nPoints  = 16;
+        const int nVectors = 5;
+
+        // Vector v holds a mean, a few modes with both real and imaginary
+        // parts and a nonzero Nyquist mode.
+        void FillPhys(Array<OneD, NekDouble> &phys)
+        {
+            for (int v = 0; v < nVectors; ++v)
+            {
+                for (int j = 0; j < nPoints; ++j)
+                {
+                    NekDouble x = 2.0*M_PI*j/nPoints;
+                    phys[v*nPoints+j] = 0.5*(v+1)
+                        + cos(x) - 0.3*v*sin(2*x) + 0.1*sin((v+3)*x)
+                        + 0.25*(v+1)*((j % 2) ? -1.0 : 1.0);
+                }
+            }
+        }
+
+        // Forward transform by direct summation in the Nektar++ ordering:
+        // the real and imaginary parts of mode k in slots 2k and 2k+1, the
+        // mean in slot 0 and a zero in place of the Nyquist mode in slot 1.
+        void DirectFwd(const NekDouble *phys, NekDouble *coef)
+        {
+            for (int k = 0; k < nPoints/2; ++k)
+            {
+                NekDouble re = 0.0, im = 0.0;
+                for (int j = 0; j < nPoints; ++j)
+                {
+                    NekDouble x = 2.0*M_PI*k*j/nPoints;
+                    re += phys[j]*cos(x);
+                    im -= phys[j]*sin(x);
+                }
+                coef[2*k]   = re/nPoints;
+                coef[2*k+1] = im/nPoints;
+            }
+            coef[1] = 0.0;
+        }
+
+        // Unnormalised backward transform by direct summation. Slot 1 is
+        // ignored, as the Nyquist mode is not retained.
+        void DirectBwd(const NekDouble *coef, NekDouble *phys)
+        {
+            for (int j = 0; j < nPoints; ++j)
+            {
+                phys[j] = coef[0];
+                for (int k = 1; k < nPoints/2; ++k)
+                {
+                    NekDouble x = 2.0*M_PI*k*j/nPoints;
+                    phys[j] += 2.0*(coef[2*k]*cos(x) - coef[2*k+1]*sin(x));
+                }
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestFwdMatchesDirectDFT)
+        {
+            LibUtilities::NektarFFTSharedPtr fft =
+                LibUtilities::GetNektarFFTFactory().CreateInstance(
+                    "NekFFTW", nPoints);
+
+            Array<OneD, NekDouble> phys(nPoints*nVectors);
+            Array<OneD, NekDouble> coef(nPoints*nVectors);
+            Array<OneD, NekDouble> exact(nPoints*nVectors);
+            FillPhys(phys);
+
+            fft->FFTFwdTrans(nVectors, phys, coef);
+
+            for (int v = 0; v < nVectors; ++v)
+            {
+                DirectFwd(&phys[v*nPoints], &exact[v*nPoints]);
+
+                Array<OneD, NekDouble> p(nPoints, phys + v*nPoints);
+                Array<OneD, NekDouble> c(nPoints);
+                fft->FFTFwdTrans(p, c);
+
+                for (int j = 0; j < nPoints; ++j)
+                {
+                    BOOST_CHECK_SMALL(coef[v*nPoints+j] - exact[v*nPoints+j],
+                                      1e-12);
+                    BOOST_CHECK_SMALL(c[j] - exact[v*nPoints+j], 1e-12);
+                }
+
+                // Mean in slot 0, Nyquist mode discarded from slot 1.
+                BOOST_CHECK_CLOSE(c[0], 0.5*(v+1), 1e-10);
+                BOOST_CHECK_EQUAL(c[1], 0.0);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestBwdMatchesDirectDFT)
+        {
+            LibUtilities::NektarFFTSharedPtr fft =
+                LibUtilities::GetNektarFFTFactory().CreateInstance(
+                    "NekFFTW", nPoints);
+
+            Array<OneD, NekDouble> coef(nPoints*nVectors);
+            Array<OneD, NekDouble> phys(nPoints*nVectors);
+            Array<OneD, NekDouble> exact(nPoints);
+
+            for (int i = 0; i < nPoints*nVectors; ++i)
+            {
+                coef[i] = cos(0.7*i) + 0.1*i/nPoints;
+            }
+
+            fft->FFTBwdTrans(nVectors, coef, phys);
+
+            for (int v = 0; v < nVectors; ++v)
+            {
+                DirectBwd(&coef[v*nPoints], &exact[0]);
+
+                Array<OneD, NekDouble> c(nPoints, coef + v*nPoints);
+                Array<OneD, NekDouble> p(nPoints);
+                fft->FFTBwdTrans(c, p);
+
+                for (int j = 0; j < nPoints; ++j)
+                {
+                    BOOST_CHECK_SMALL(phys[v*nPoints+j] - exact[j], 1e-12);
+                    BOOST_CHECK_SMALL(p[j] - exact[j], 1e-12);
+                }
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestBatchedRoundTrip)
+        {
+            LibUtilities::NektarFFTSharedPtr fft =
+                LibUtilities::GetNektarFFTFactory().CreateInstance(
+                    "NekFFTW", nPoints);
+
+            Array<OneD, NekDouble> phys(nPoints*nVectors);
+            Array<OneD, NekDouble> coef(nPoints*nVectors);
+            Array<OneD, NekDouble> back(nPoints*nVectors);
+            FillPhys(phys);
+
+            fft->FFTFwdTrans(nVectors, phys, coef);
+            fft->FFTBwdTrans(nVectors, coef, back);
+
+            // The round trip recovers the input less its Nyquist mode.
+            for (int v = 0; v < nVectors; ++v)
+            {
+                for (int j = 0; j < nPoints; ++j)
+                {
+                    NekDouble nyquist = 0.25*(v+1)*((j % 2) ? -1.0 : 1.0);
+                    BOOST_CHECK_SMALL(back[v*nPoints+j] + nyquist
+                                      - phys[v*nPoints+j], 1e-12);
+                }
+            }
+        }
+    }
+}
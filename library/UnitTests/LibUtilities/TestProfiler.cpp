@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestProfiler.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the region nesting and call counts of the profiler.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LibUtilitiesUnitTestsPrecompiledHeader.h"
+#include <LibUtilities/BasicUtils/Profiler.h>
+#include <LibUtilities/Communication/CommSerial.h>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Nektar
+{
+    namespace ProfilerUnitTests
+    {
+        // Columns of a region in the CSV report: depth, then the min, avg
+        // and max of calls, time, comm_calls and comm_bytes.
+        typedef std::map<std::string, std::vector<NekDouble> > RegionMap;
+
+        const int eDepth     = 0;
+        const int eCalls     = 1;
+        const int eCommCalls = 7;
+        const int eCommBytes = 10;
+
+        RegionMap ReportRegions(LibUtilities::Profiler &profiler,
+                                const std::string      &basename)
+        {
+            LibUtilities::CommSharedPtr comm(
+                new LibUtilities::CommSerial(0, NULL));
+            profiler.Report(comm, basename);
+
+            const std::string csvName = basename + ".prof.csv";
+            std::ifstream csv(csvName.c_str());
+            std::string line;
+            RegionMap regions;
+
+            // Skip the header.
+            std::getline(csv, line);
+            while (std::getline(csv, line))
+            {
+                std::vector<std::string> cols;
+                boost::split(cols, line, boost::is_any_of(","));
+                BOOST_REQUIRE_EQUAL(cols.size(), 14u);
+
+                std::vector<NekDouble> &val =
+                    regions[boost::trim_copy_if(cols[0],
+                                                boost::is_any_of("\""))];
+                for (unsigned int i = 1; i < cols.size(); ++i)
+                {
+                    val.push_back(boost::lexical_cast<NekDouble>(cols[i]));
+                }
+            }
+
+            csv.close();
+            std::remove(csvName.c_str());
+            std::remove((basename + ".prof.json").c_str());
+            return regions;
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNestedRegions)
+        {
+            LibUtilities::Profiler profiler;
+            profiler.Enable();
+
+            for (int i = 0; i < 3; ++i)
+            {
+                profiler.Start("Outer");
+                for (int j = 0; j < 2; ++j)
+                {
+                    profiler.Start("Inner");
+                    profiler.AddComm(100);
+                    profiler.Stop();
+                }
+                profiler.Stop();
+            }
+
+            // A region of the same name under a different parent is
+            // recorded separately.
+            profiler.Start("Inner");
+            profiler.Stop();
+
+            RegionMap regions = ReportRegions(profiler, "TestNestedRegions");
+
+            BOOST_REQUIRE_EQUAL(regions.size(), 4u);
+            BOOST_REQUIRE(regions.count("Total"));
+            BOOST_REQUIRE(regions.count("Total/Outer"));
+            BOOST_REQUIRE(regions.count("Total/Outer/Inner"));
+            BOOST_REQUIRE(regions.count("Total/Inner"));
+
+            BOOST_CHECK_EQUAL(regions["Total"][eDepth],             0);
+            BOOST_CHECK_EQUAL(regions["Total/Outer"][eDepth],       1);
+            BOOST_CHECK_EQUAL(regions["Total/Outer/Inner"][eDepth], 2);
+            BOOST_CHECK_EQUAL(regions["Total/Inner"][eDepth],       1);
+
+            BOOST_CHECK_EQUAL(regions["Total"][eCalls],             1);
+            BOOST_CHECK_EQUAL(regions["Total/Outer"][eCalls],       3);
+            BOOST_CHECK_EQUAL(regions["Total/Outer/Inner"][eCalls], 6);
+            BOOST_CHECK_EQUAL(regions["Total/Inner"][eCalls],       1);
+
+            // Communication is inclusive of the child regions.
+            BOOST_CHECK_EQUAL(regions["Total"][eCommCalls],             6);
+            BOOST_CHECK_EQUAL(regions["Total/Outer"][eCommCalls],       6);
+            BOOST_CHECK_EQUAL(regions["Total/Outer/Inner"][eCommCalls], 6);
+            BOOST_CHECK_EQUAL(regions["Total/Inner"][eCommCalls],       0);
+            BOOST_CHECK_EQUAL(regions["Total/Outer"][eCommBytes],     600);
+
+            // Time is inclusive of the child regions.
+            BOOST_CHECK(regions["Total/Outer"][eCalls+3] >=
+                        regions["Total/Outer/Inner"][eCalls+3]);
+            BOOST_CHECK(regions["Total"][eCalls+3] >=
+                        regions["Total/Outer"][eCalls+3]);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestDisabledRegions)
+        {
+            LibUtilities::Profiler profiler;
+
+            // Regions entered before the profiler is enabled are ignored.
+            profiler.Start("Ignored");
+            profiler.AddComm(100);
+            profiler.Stop();
+
+            profiler.Enable();
+
+            // Stopping the root region is ignored.
+            profiler.Stop();
+            profiler.Start("Region");
+            profiler.Stop();
+            profiler.Disable();
+
+            // ... as are regions entered after it is disabled.
+            profiler.Start("Ignored");
+            profiler.Stop();
+
+            RegionMap regions =
+                ReportRegions(profiler, "TestDisabledRegions");
+
+            BOOST_REQUIRE_EQUAL(regions.size(), 2u);
+            BOOST_CHECK_EQUAL(regions["Total"][eCalls],        1);
+            BOOST_CHECK_EQUAL(regions["Total/Region"][eCalls], 1);
+            BOOST_CHECK_EQUAL(regions["Total"][eCommCalls],    0);
+        }
+    }
+}
@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestScratchArena.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the per-thread scratch arena.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LibUtilitiesUnitTestsPrecompiledHeader.h"
+#include <LibUtilities/Memory/ScratchArena.hpp>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace ScratchArenaUnitTests
+    {
+        bool IsAligned(const void *p)
+        {
+            return reinterpret_cast<size_t>(p) % ScratchArena::Alignment == 0;
+        }
+
+        BOOST_AUTO_TEST_CASE(TestAlignmentAndValues)
+        {
+            ScratchScope scratch;
+            Array<OneD, NekDouble> a = scratch.Allocate(3);
+            Array<OneD, NekDouble> b = scratch.Allocate(17, 2.5);
+            Array<OneD, int>       c = scratch.Allocate<int>(5);
+
+            BOOST_CHECK(IsAligned(a.get()));
+            BOOST_CHECK(IsAligned(b.get()));
+            BOOST_CHECK(IsAligned(c.get()));
+            BOOST_CHECK_EQUAL(a.num_elements(), 3u);
+            BOOST_CHECK_EQUAL(b.num_elements(), 17u);
+            BOOST_CHECK(!a.Overlaps(b));
+
+            for (unsigned int i = 0; i < b.num_elements(); ++i)
+            {
+                BOOST_CHECK_EQUAL(b[i], 2.5);
+            }
+
+            // Copies and offsets reference the same storage.
+            Array<OneD, NekDouble> d = b + 4;
+            d[0] = 1.0;
+            BOOST_CHECK_EQUAL(b[4], 1.0);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestScopesRelease)
+        {
+            ScratchArena &arena = ScratchArena::GetThreadArena();
+            size_t inUse = arena.GetBytesInUse();
+            {
+                ScratchScope outer;
+                NekDouble *p = outer.Allocate(10).get();
+                {
+                    ScratchScope inner;
+                    inner.Allocate(100);
+                    BOOST_CHECK(arena.GetBytesInUse() > inUse);
+                }
+                // Storage of the inner scope is reused.
+                ScratchScope again;
+                BOOST_CHECK_EQUAL(again.Allocate(1).get(), p + 16);
+            }
+            BOOST_CHECK_EQUAL(arena.GetBytesInUse(), inUse);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestGrowthAndSteadyState)
+        {
+            ScratchArena &arena = ScratchArena::GetThreadArena();
+            ScratchArena::EnableStatistics();
+            ScratchArena::ResetStatistics();
+
+            // Larger than the first block, so the arena has to grow.
+            const unsigned int n = 100000;
+            for (int k = 0; k < 3; ++k)
+            {
+                ScratchScope scratch("TestGrowth");
+                for (int i = 0; i < 4; ++i)
+                {
+                    Array<OneD, NekDouble> a = scratch.Allocate(n, 1.0*i);
+                    BOOST_CHECK_EQUAL(a[n-1], 1.0*i);
+                }
+            }
+            BOOST_CHECK_EQUAL(arena.GetNumBlocks(), 1u);
+            BOOST_CHECK(arena.GetCapacity() >= 4*n*sizeof(NekDouble));
+
+            ScratchArena::StatisticsMap stats;
+            ScratchArena::GetStatistics(stats);
+            ScratchArena::Statistics &s = stats["TestGrowth"];
+            BOOST_CHECK_EQUAL(s.m_scopes, 3u);
+            BOOST_CHECK_EQUAL(s.m_allocs, 12u);
+            BOOST_CHECK_EQUAL(s.m_bytes,  12*n*sizeof(NekDouble));
+            BOOST_CHECK(s.m_peak >= 4*n*sizeof(NekDouble));
+
+            // Only the first pass takes memory from the heap.
+            size_t heapAllocs = s.m_heapAllocs;
+            BOOST_CHECK(heapAllocs > 0);
+            {
+                ScratchScope scratch("TestGrowth");
+                for (int i = 0; i < 4; ++i)
+                {
+                    scratch.Allocate(n);
+                }
+            }
+            ScratchArena::GetStatistics(stats);
+            BOOST_CHECK_EQUAL(stats["TestGrowth"].m_heapAllocs, heapAllocs);
+
+            ScratchArena::EnableStatistics(false);
+        }
+    }
+}
@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestThread.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the thread pool used by the elemental loops.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LibUtilitiesUnitTestsPrecompiledHeader.h"
+#include <LibUtilities/BasicUtils/Thread.h>
+#include <LibUtilities/BasicUtils/SharedArray.hpp>
+
+#include <boost/bind.hpp>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace ThreadUnitTests
+    {
+        void Scale(const int start, const int end,
+                   const Array<OneD, const double> &in,
+                         Array<OneD,       double> &out)
+        {
+            for (int i = start; i < end; ++i)
+            {
+                // Take references to exercise the shared reference count.
+                Array<OneD, const double> tmp_in  = in  + i;
+                Array<OneD,       double> tmp_out = out + i;
+                tmp_out[0] = 2.0*tmp_in[0];
+            }
+        }
+
+        void Nested(const int start, const int end,
+                    const Array<OneD, const double> &in,
+                          Array<OneD,       double> &out)
+        {
+            LibUtilities::GetThreadPool().ParallelFor(end - start,
+                boost::bind(&Scale, _1, _2, in + start, out + start));
+        }
+
+        BOOST_AUTO_TEST_CASE(TestParallelFor)
+        {
+            LibUtilities::ThreadPool &pool = LibUtilities::GetThreadPool();
+            pool.SetNumThreads(4);
+            BOOST_CHECK_EQUAL(pool.GetNumThreads(), 4u);
+
+            const int n = 1001;
+            Array<OneD, double> in(n, 1.5), out(n, 0.0);
+
+            pool.ParallelFor(n, boost::bind(&Scale, _1, _2,
+                                            boost::cref(in), boost::ref(out)));
+
+            for (int i = 0; i < n; ++i)
+            {
+                BOOST_CHECK_EQUAL(out[i], 3.0);
+            }
+
+            // Fewer iterations than threads.
+            Array<OneD, double> small(3, 0.0);
+            pool.ParallelFor(3, boost::bind(&Scale, _1, _2,
+                                            boost::cref(in), boost::ref(small)));
+            BOOST_CHECK_EQUAL(small[2], 3.0);
+
+            pool.SetNumThreads(1);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestNestedParallelFor)
+        {
+            LibUtilities::ThreadPool &pool = LibUtilities::GetThreadPool();
+            pool.SetNumThreads(3);
+
+            const int n = 100;
+            Array<OneD, double> in(n, 2.0), out(n, 0.0);
+
+            pool.ParallelFor(n, boost::bind(&Nested, _1, _2,
+                                            boost::cref(in), boost::ref(out)));
+
+            for (int i = 0; i < n; ++i)
+            {
+                BOOST_CHECK_EQUAL(out[i], 4.0);
+            }
+
+            pool.SetNumThreads(1);
+        }
+    }
+}
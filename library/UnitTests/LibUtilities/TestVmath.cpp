@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestVmath.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the vectorised Vmath kernels.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include "LibUtilitiesUnitTestsPrecompiledHeader.h"
+#include <LibUtilities/BasicUtils/VmathArray.hpp>
+#include <LibUtilities/BasicUtils/VmathSIMD.h>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace Nektar
+{
+    namespace VmathUnitTests
+    {
+        using namespace Vmath::SIMD;
+
+        // Odd lengths and offsets exercise the scalar remainder loops and
+        // unaligned loads and stores of every instruction set.
+        const int nSizes = 9;
+        const int sizes[nSizes] = {0, 1, 3, 7, 8, 15, 17, 33, 100};
+        const int maxSize = 104;
+
+        struct Data
+        {
+            Data()
+            {
+                for (int i = 0; i < 4; ++i)
+                {
+                    in[i].resize(maxSize);
+                    for (int j = 0; j < maxSize; ++j)
+                    {
+                        in[i][j] = 0.1*(i+1) + 1.0/(j+3) - 0.01*j;
+                    }
+                }
+                out[0].resize(maxSize);
+                out[1].resize(maxSize);
+            }
+
+            std::vector<NekDouble> in[4];
+            std::vector<NekDouble> out[2];
+        };
+
+        // Runs one kernel of table k, writing into d.out[o].
+        void RunKernel(const Kernels &k, int kernel, int n, int off,
+                       Data &d, int o)
+        {
+            const NekDouble *v = &d.in[0][off];
+            const NekDouble *w = &d.in[1][off];
+            const NekDouble *x = &d.in[2][off];
+            const NekDouble *y = &d.in[3][off];
+            NekDouble       *z = &d.out[o][off];
+            const NekDouble  a = 1.7, b = -0.3;
+
+            switch (kernel)
+            {
+                case 0:  k.Vmul   (n, x, y, z);             break;
+                case 1:  k.Vadd   (n, x, y, z);             break;
+                case 2:  k.Vsub   (n, x, y, z);             break;
+                case 3:  k.Vdiv   (n, x, y, z);             break;
+                case 4:  k.Smul   (n, a, x, z);             break;
+                case 5:  k.Sadd   (n, a, x, z);             break;
+                case 6:  k.Svtvp  (n, a, x, y, z);          break;
+                case 7:  k.Vvtvp  (n, w, x, y, z);          break;
+                case 8:  k.Vvtvm  (n, w, x, y, z);          break;
+                case 9:  k.Vvtvvtp(n, v, w, x, y, z);       break;
+                case 10: k.Vvtvvtm(n, v, w, x, y, z);       break;
+                case 11: k.Svtsvtp(n, a, x, b, y, z);       break;
+                case 12: k.Svvt   (n, a, x, y, z);          break;
+                case 13: k.Svvtvp (n, a, w, x, y, z);       break;
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestKernelsMatchScalar)
+        {
+            const Kernels *scalar = GetKernels(eScalar);
+            BOOST_REQUIRE(scalar);
+
+            Data d;
+            for (int isa = 0; isa < SIZE_InstructionSet; ++isa)
+            {
+                const Kernels *k = GetKernels((InstructionSet)isa);
+                if (!k)
+                {
+                    continue;
+                }
+
+                for (int kernel = 0; kernel < 14; ++kernel)
+                {
+                    for (int s = 0; s < nSizes; ++s)
+                    {
+                        for (int off = 0; off < 4; ++off)
+                        {
+                            std::fill(d.out[0].begin(), d.out[0].end(), -1.0);
+                            std::fill(d.out[1].begin(), d.out[1].end(), -1.0);
+
+                            RunKernel(*scalar, kernel, sizes[s], off, d, 0);
+                            RunKernel(*k,      kernel, sizes[s], off, d, 1);
+
+                            BOOST_CHECK_MESSAGE(
+                                memcmp(&d.out[0][0], &d.out[1][0],
+                                       maxSize*sizeof(NekDouble)) == 0,
+                                "Kernel " << kernel << " differs for "
+                                << InstructionSetMap[isa] << " with n = "
+                                << sizes[s] << ", offset = " << off);
+                        }
+                    }
+                }
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestSetInstructionSet)
+        {
+            InstructionSet active = GetInstructionSet();
+            BOOST_CHECK(GetKernels(active) != 0);
+
+            BOOST_CHECK(SetInstructionSet(eScalar));
+            BOOST_CHECK_EQUAL(GetInstructionSet(), eScalar);
+            BOOST_CHECK(GetKernels().Vmul == GetKernels(eScalar)->Vmul);
+
+            BOOST_CHECK(SetInstructionSet(active));
+            BOOST_CHECK_EQUAL(GetInstructionSet(), active);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestFusedStrided)
+        {
+            const int n = 17;
+            Array<OneD, NekDouble> w(2*n), x(2*n), y(2*n);
+            Array<OneD, NekDouble> z1(2*n, 0.0), z2(2*n, 0.0);
+            for (int i = 0; i < 2*n; ++i)
+            {
+                w[i] = 0.5 + i;
+                x[i] = 1.0/(i+1);
+                y[i] = 2.0 - 0.1*i;
+            }
+
+            Vmath::Svvt(n, 3.0, x, 2, y, 2, z1, 2);
+            Vmath::Svvtvp(n, 3.0, w, 2, x, 2, y, 2, z2, 2);
+            for (int i = 0; i < n; ++i)
+            {
+                BOOST_CHECK_EQUAL(z1[2*i], 3.0*(x[2*i]*y[2*i]));
+                BOOST_CHECK_EQUAL(z2[2*i], 3.0*(w[2*i]*x[2*i]) + y[2*i]);
+                BOOST_CHECK_EQUAL(z1[2*i+1], 0.0);
+                BOOST_CHECK_EQUAL(z2[2*i+1], 0.0);
+            }
+
+            // Unit stride goes through the active kernel table.
+            Vmath::Svvt(2*n, 3.0, x, 1, y, 1, z1, 1);
+            Vmath::Svvtvp(2*n, 3.0, w, 1, x, 1, y, 1, z2, 1);
+            for (int i = 0; i < 2*n; ++i)
+            {
+                BOOST_CHECK_EQUAL(z1[i], 3.0*(x[i]*y[i]));
+                BOOST_CHECK_EQUAL(z2[i], 3.0*(w[i]*x[i]) + y[i]);
+            }
+        }
+    }
+}
@@ -0,0 +1,226 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestMatrixCache.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for sharing elemental matrices between elements
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <LocalRegions/QuadExp.h>
+#include <LocalRegions/MatrixCache.h>
+#include <SpatialDomains/QuadGeom.h>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace MatrixCacheTests
+    {
+        // Square element of side h with its lower left corner at (x0, y0).
+        LocalRegions::QuadExpSharedPtr CreateQuad(
+            NekDouble x0, NekDouble y0, NekDouble h)
+        {
+            NekDouble x[] = {x0, x0 + h, x0 + h, x0    };
+            NekDouble y[] = {y0, y0,     y0 + h, y0 + h};
+
+            SpatialDomains::PointGeomSharedPtr verts[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                verts[i] = MemoryManager<SpatialDomains::PointGeom>
+                    ::AllocateSharedPtr(2, i, x[i], y[i], 0.0);
+            }
+
+            SpatialDomains::SegGeomSharedPtr edges[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                SpatialDomains::PointGeomSharedPtr v[] =
+                    {verts[i], verts[(i+1) % 4]};
+                edges[i] = MemoryManager<SpatialDomains::SegGeom>
+                    ::AllocateSharedPtr(i, 2, v);
+            }
+
+            StdRegions::Orientation eorient[4];
+            for (int i = 0; i < 4; ++i)
+            {
+                eorient[i] = SpatialDomains::SegGeom::GetEdgeOrientation(
+                    *edges[i], *edges[(i+1) % 4]);
+            }
+
+            SpatialDomains::QuadGeomSharedPtr geom = MemoryManager<
+                SpatialDomains::QuadGeom>::AllocateSharedPtr(0, edges, eorient);
+
+            const LibUtilities::PointsKey pkey(
+                5, LibUtilities::eGaussLobattoLegendre);
+            const LibUtilities::BasisKey bkey(
+                LibUtilities::eModified_A, 4, pkey);
+
+            return MemoryManager<LocalRegions::QuadExp>
+                ::AllocateSharedPtr(bkey, bkey, geom);
+        }
+
+        void ClearManagers()
+        {
+            LibUtilities::NekManager<LocalRegions::MatrixKey,
+                DNekScalMat, LocalRegions::MatrixKey::opLess>::ClearManager();
+            LibUtilities::NekManager<LocalRegions::MatrixKey,
+                DNekScalBlkMat, LocalRegions::MatrixKey::opLess>::ClearManager();
+            LocalRegions::MatrixCache::Clear();
+        }
+
+        // Enables the cache for the duration of a test, and disables and
+        // clears it afterwards so that later tests see the default.
+        struct CacheFixture
+        {
+            CacheFixture()
+            {
+                ClearManagers();
+                LocalRegions::MatrixCache::EnableCache();
+            }
+
+            ~CacheFixture()
+            {
+                LocalRegions::MatrixCache::DisableCache();
+                ClearManagers();
+            }
+        };
+
+        void CheckEqual(const DNekScalMat &a, const DNekScalMat &b)
+        {
+            BOOST_REQUIRE_EQUAL(a.GetRows(),    b.GetRows());
+            BOOST_REQUIRE_EQUAL(a.GetColumns(), b.GetColumns());
+            for (unsigned int i = 0; i < a.GetRows(); ++i)
+            {
+                for (unsigned int j = 0; j < a.GetColumns(); ++j)
+                {
+                    BOOST_CHECK_SMALL(a(i,j) - b(i,j), 1e-12);
+                }
+            }
+        }
+
+        BOOST_FIXTURE_TEST_CASE(TestTranslatedElements, CacheFixture)
+        {
+            LocalRegions::QuadExpSharedPtr e0 = CreateQuad(0.0, 0.0, 0.5);
+            LocalRegions::QuadExpSharedPtr e1 = CreateQuad(3.5, 1.0, 0.5);
+
+            DNekScalMatSharedPtr l0 =
+                e0->GetLocMatrix(StdRegions::eLaplacian);
+            DNekScalMatSharedPtr l1 =
+                e1->GetLocMatrix(StdRegions::eLaplacian);
+
+            BOOST_CHECK_EQUAL(LocalRegions::MatrixCache::GetNumMisses(), 1u);
+            BOOST_CHECK_EQUAL(LocalRegions::MatrixCache::GetNumHits(),   1u);
+            BOOST_CHECK(l0->GetOwnedMatrix() == l1->GetOwnedMatrix());
+            CheckEqual(*l0, *l1);
+        }
+
+        BOOST_FIXTURE_TEST_CASE(TestScaledElements, CacheFixture)
+        {
+            LocalRegions::QuadExpSharedPtr e0 = CreateQuad(0.0, 0.0, 0.5);
+            LocalRegions::QuadExpSharedPtr e1 = CreateQuad(1.0, 0.0, 2.0);
+            LocalRegions::QuadExpSharedPtr e2 = CreateQuad(1.0, 0.0, 2.0);
+
+            // The weak derivative is homogeneous in the element size, so the
+            // larger element reuses the matrix of the smaller one.
+            e0->GetLocMatrix(StdRegions::eWeakDeriv0);
+            DNekScalMatSharedPtr d1 =
+                e1->GetLocMatrix(StdRegions::eWeakDeriv0);
+            BOOST_CHECK_EQUAL(LocalRegions::MatrixCache::GetNumHits(), 1u);
+
+            LocalRegions::MatrixCache::DisableCache();
+            DNekScalMatSharedPtr d2 =
+                e2->GetLocMatrix(StdRegions::eWeakDeriv0);
+            CheckEqual(*d1, *d2);
+            LocalRegions::MatrixCache::EnableCache();
+
+            // The Helmholtz operator is not, so it is only shared between
+            // elements of the same size.
+            StdRegions::ConstFactorMap factors;
+            factors[StdRegions::eFactorLambda] = 1.5;
+            e0->GetLocMatrix(StdRegions::eHelmholtz, factors);
+            e1->GetLocMatrix(StdRegions::eHelmholtz, factors);
+            BOOST_CHECK_EQUAL(LocalRegions::MatrixCache::GetNumHits(), 1u);
+        }
+
+        BOOST_FIXTURE_TEST_CASE(TestMassMatrices, CacheFixture)
+        {
+            LocalRegions::QuadExpSharedPtr e0 = CreateQuad(0.0, 0.0, 0.5);
+            LocalRegions::QuadExpSharedPtr e1 = CreateQuad(1.0, 0.0, 2.0);
+            LocalRegions::QuadExpSharedPtr e2 = CreateQuad(1.0, 0.0, 2.0);
+
+            // The mass matrix scales as h^d and its inverse as h^-d, so
+            // both are shared between elements of different sizes.
+            e0->GetLocMatrix(StdRegions::eMass);
+            e0->GetLocMatrix(StdRegions::eInvMass);
+            DNekScalMatSharedPtr m1 = e1->GetLocMatrix(StdRegions::eMass);
+            DNekScalMatSharedPtr i1 = e1->GetLocMatrix(StdRegions::eInvMass);
+            BOOST_CHECK_EQUAL(LocalRegions::MatrixCache::GetNumMisses(), 2u);
+            BOOST_CHECK_EQUAL(LocalRegions::MatrixCache::GetNumHits(),   2u);
+
+            LocalRegions::MatrixCache::DisableCache();
+            CheckEqual(*m1, *e2->GetLocMatrix(StdRegions::eMass));
+            CheckEqual(*i1, *e2->GetLocMatrix(StdRegions::eInvMass));
+        }
+
+        BOOST_FIXTURE_TEST_CASE(TestStaticCondMatrix, CacheFixture)
+        {
+            LocalRegions::QuadExpSharedPtr e0 = CreateQuad(0.0, 0.0, 0.5);
+            LocalRegions::QuadExpSharedPtr e1 = CreateQuad(0.5, 0.0, 0.5);
+            LocalRegions::QuadExpSharedPtr e2 = CreateQuad(0.0, 0.5, 0.5);
+
+            StdRegions::ConstFactorMap factors;
+            factors[StdRegions::eFactorLambda] = 1.5;
+
+            LocalRegions::MatrixKey k0(StdRegions::eHelmholtz,
+                                       e0->DetShapeType(), *e0, factors);
+            LocalRegions::MatrixKey k1(StdRegions::eHelmholtz,
+                                       e1->DetShapeType(), *e1, factors);
+            LocalRegions::MatrixKey k2(StdRegions::eHelmholtz,
+                                       e2->DetShapeType(), *e2, factors);
+
+            DNekScalBlkMatSharedPtr s0 = e0->GetLocStaticCondMatrix(k0);
+            DNekScalBlkMatSharedPtr s1 = e1->GetLocStaticCondMatrix(k1);
+
+            BOOST_CHECK(s0->GetBlock(0,0)->GetOwnedMatrix() ==
+                        s1->GetBlock(0,0)->GetOwnedMatrix());
+
+            LocalRegions::MatrixCache::DisableCache();
+            DNekScalBlkMatSharedPtr s2 = e2->GetLocStaticCondMatrix(k2);
+            for (int i = 0; i < 2; ++i)
+            {
+                for (int j = 0; j < 2; ++j)
+                {
+                    CheckEqual(*s1->GetBlock(i,j), *s2->GetBlock(i,j));
+                }
+            }
+        }
+    }
+}
@@ -761,6 +761,91 @@ namespace Nektar
             }
         }
     
+        BOOST_AUTO_TEST_CASE(TestAlignment)
+        {
+            // Arrays of at least detail::ArrayAlignment bytes are aligned;
+            // small arrays keep at least 8-byte alignment.
+            unsigned int sizes[] = {0, 1, 3, 7, 8, 9, 100, 1000, 100000};
+            for (unsigned int i = 0; i < sizeof(sizes)/sizeof(unsigned int); ++i)
+            {
+                Array<OneD, NekDouble> a(sizes[i], 1.0);
+                BOOST_CHECK(a.IsAligned(8));
+                BOOST_CHECK(a.GetAlignment() >= 8);
+
+                if (sizes[i]*sizeof(NekDouble) >= detail::ArrayAlignment)
+                {
+                    BOOST_CHECK(a.IsAligned());
+                    BOOST_CHECK(a.GetAlignment() >= detail::ArrayAlignment);
+                }
+
+                for (unsigned int j = 0; j < sizes[i]; ++j)
+                {
+                    BOOST_CHECK_EQUAL(a[j], 1.0);
+                }
+            }
+
+            // The alignment of an offset array follows its first element.
+            Array<OneD, NekDouble> b(64);
+            Array<OneD, NekDouble> c = b + 1;
+            BOOST_CHECK(c.IsAligned(8));
+            if (b.IsAligned(64))
+            {
+                BOOST_CHECK_EQUAL(c.GetAlignment(), 8u);
+            }
+
+            Array<OneD, const NekDouble> d(100, 2.0);
+            BOOST_CHECK(d.IsAligned(8));
+        }
+
+        BOOST_AUTO_TEST_CASE(TestAlignedStorageCounting)
+        {
+            // The reference count lives in the same allocation as the
+            // elements, so copies, offsets and reassignment must release
+            // the storage exactly once.
+            {
+                CountedObject<double>::ClearCounters();
+
+                Array<OneD, CountedObject<double> > a(20);
+                {
+                    Array<OneD, CountedObject<double> > b(a);
+                    Array<OneD, CountedObject<double> > c = a + 5;
+                    Array<OneD, const CountedObject<double> > d(a);
+                    b = c;
+                    BOOST_CHECK_EQUAL(b.num_elements(), 15u);
+                    BOOST_CHECK_EQUAL(b.get(), a.get() + 5);
+                }
+                CountedObject<double>::Check(20, 0, 0, 0, 0, 0);
+
+                a = Array<OneD, CountedObject<double> >(3);
+                CountedObject<double>::Check(23, 0, 20, 0, 0, 0);
+            }
+            CountedObject<double>::Check(23, 0, 23, 0, 0, 0);
+
+            // Self-assignment keeps the storage.
+            Array<OneD, NekDouble> e(50, 3.0);
+            e = e;
+            BOOST_CHECK_EQUAL(e[49], 3.0);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestUnownedStorage)
+        {
+            NekDouble storage[6] = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+            {
+                Array<OneD, NekDouble> a(6, storage, eUnownedStorage);
+                Array<OneD, NekDouble> b(a);
+                Array<OneD, NekDouble> c = a + 2;
+                Array<OneD, NekDouble> d(10);
+                d = c;
+
+                BOOST_CHECK_EQUAL(a.get(), storage);
+                BOOST_CHECK_EQUAL(c[0], 2.0);
+                BOOST_CHECK_EQUAL(d.num_elements(), 4u);
+                b[5] = 10.0;
+            }
+            // The storage is left untouched by the arrays.
+            BOOST_CHECK_EQUAL(storage[5], 10.0);
+        }
+
         BOOST_AUTO_TEST_CASE(TestSharedPtr)
         {
             boost::shared_ptr<double> a(new double[10]);
@@ -33,6 +33,8 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <iomanip>
+
 #include <LibUtilities/BasicUtils/VmathArray.hpp>
 
 #include <CardiacEPSolver/CellModels/CellModel.h>
@@ -40,8 +42,16 @@
 #include <StdRegions/StdNodalTriExp.h>
 //#include <LibUtilities/LinearAlgebra/Blas.hpp>
 
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/bind.hpp>
+
 namespace Nektar
 {
+    /// Number of points integrated together by the fused kernels. One block
+    /// of the solution, derivatives and tau values of the largest models
+    /// fits in the level 1 data cache.
+    static const int s_cellBlockSize = 64;
+
     CellModelFactory& GetCellModelFactory()
     {
         typedef Loki::SingletonHolder<CellModelFactory,
@@ -59,6 +69,22 @@ namespace Nektar
      * time-integrated using the Rush-Larsen method and for each variable y,
      * the corresponding y_inf and tau_y value is computed by Update(). The tau
      * values are stored in separate storage to inarray/outarray, #m_gates_tau.
+     *
+     * Models may also provide a fused kernel, v_UpdateBlock, which computes
+     * all currents and gate rates point by point. It is used unless the
+     * SOLVERINFO property CellModelEvaluation is set to Vmath. The fused
+     * integration copies blocks of #s_cellBlockSize points into a blocked
+     * structure-of-arrays buffer and performs all substeps on each block
+     * while it is held in cache.
+     *
+     * Models may declare the functions of the membrane potential alone used
+     * by their fused kernel with AddVoltageFunction and compute them in
+     * v_VoltageFunctions. Setting the SOLVERINFO property
+     * CellModelLookupTable to True replaces their evaluation by linear
+     * interpolation in a table over [LookupTableVMin, LookupTableVMax] with
+     * spacing LookupTableStep, which default to -100, 100 and 0.05 mV.
+     * Voltages at which the functions switch between expressions are
+     * declared with AddVoltageBreak and are not interpolated across.
      */
 
     /**
@@ -74,6 +100,16 @@ namespace Nektar
         m_nvar = 0;
         m_useNodal = false;
 
+        std::string evaluation;
+        pSession->LoadSolverInfo("CellModelEvaluation", evaluation, "Fused");
+        ASSERTL0(boost::iequals(evaluation, "Fused") ||
+                 boost::iequals(evaluation, "Vmath"),
+                 "CellModelEvaluation must be Fused or Vmath.");
+        m_fused = boost::iequals(evaluation, "Fused");
+
+        pSession->MatchSolverInfo("CellModelLookupTable", "True",
+                                  m_useLookupTable, false);
+
         // Number of points in nodal space is the number of coefficients
         // in modified basis
         std::set<enum LibUtilities::ShapeType> s;
@@ -139,6 +175,31 @@ namespace Nektar
             m_gates_tau[i] = Array<OneD, NekDouble>(m_nq);
         }
 
+        if (v_HasFusedKernel())
+        {
+            const int nGates = m_gates.size();
+            m_blockData = Array<OneD, NekDouble>(
+                            (2*m_nvar + nGates)*s_cellBlockSize, 0.0);
+            m_blockSol.resize(m_nvar);
+            m_blockWsp.resize(m_nvar);
+            m_blockTau.resize(nGates);
+            for (unsigned int i = 0; i < m_nvar; ++i)
+            {
+                m_blockSol[i] = &m_blockData[i*s_cellBlockSize];
+                m_blockWsp[i] = &m_blockData[(m_nvar + i)*s_cellBlockSize];
+            }
+            for (unsigned int i = 0; i < nGates; ++i)
+            {
+                m_blockTau[i] =
+                    &m_blockData[(2*m_nvar + i)*s_cellBlockSize];
+            }
+        }
+
+        if (m_useLookupTable)
+        {
+            BuildLookupTable();
+        }
+
         if (m_session->DefinesFunction("CellModelInitialConditions"))
         {
             LoadCellModel();
@@ -213,30 +274,36 @@ namespace Nektar
 
         NekDouble delta_t = (time - m_lastTime)/m_substeps;
 
-
-        // Perform substepping
-        for (unsigned int i = 0; i < m_substeps - 1; ++i)
+        if (GetFused())
         {
-            Update(m_cellSol, m_wsp, time);
-            // Voltage
-            Vmath::Svtvp(m_nq, delta_t, m_wsp[0], 1, m_cellSol[0], 1, m_cellSol[0], 1);
-            // Ion concentrations
-            for (unsigned int j = 0; j < m_concentrations.size(); ++j)
-            {
-                Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
-            }
-            // Gating variables: Rush-Larsen scheme
-            for (unsigned int j = 0; j < m_gates.size(); ++j)
+            TimeIntegrateFused(delta_t);
+        }
+        else
+        {
+            // Perform substepping
+            for (unsigned int i = 0; i < m_substeps - 1; ++i)
             {
-                Vmath::Sdiv(m_nq, -delta_t, m_gates_tau[j], 1, m_gates_tau[j], 1);
-                Vmath::Vexp(m_nq, m_gates_tau[j], 1, m_gates_tau[j], 1);
-                Vmath::Vsub(m_nq, m_cellSol[m_gates[j]], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
-                Vmath::Vvtvp(m_nq, m_cellSol[m_gates[j]], 1, m_gates_tau[j], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+                Update(m_cellSol, m_wsp, time);
+                // Voltage
+                Vmath::Svtvp(m_nq, delta_t, m_wsp[0], 1, m_cellSol[0], 1, m_cellSol[0], 1);
+                // Ion concentrations
+                for (unsigned int j = 0; j < m_concentrations.size(); ++j)
+                {
+                    Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
+                }
+                // Gating variables: Rush-Larsen scheme
+                for (unsigned int j = 0; j < m_gates.size(); ++j)
+                {
+                    Vmath::Sdiv(m_nq, -delta_t, m_gates_tau[j], 1, m_gates_tau[j], 1);
+                    Vmath::Vexp(m_nq, m_gates_tau[j], 1, m_gates_tau[j], 1);
+                    Vmath::Vsub(m_nq, m_cellSol[m_gates[j]], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+                    Vmath::Vvtvp(m_nq, m_cellSol[m_gates[j]], 1, m_gates_tau[j], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+                }
             }
-        }
 
-        // Perform final cell model step
-        Update(m_cellSol, m_wsp, time);
+            // Perform final cell model step
+            Update(m_cellSol, m_wsp, time);
+        }
 
         // Output dV/dt from last step but integrate remaining cell model vars
         // Transform cell model I_total from nodal to modal space
@@ -268,22 +335,202 @@ namespace Nektar
             Vmath::Vcopy(m_nq, m_wsp[0], 1, outarray[0], 1);
         }
 
-        // Ion concentrations
+        // The fused integration has already advanced the remaining variables
+        if (!GetFused())
+        {
+            // Ion concentrations
+            for (unsigned int j = 0; j < m_concentrations.size(); ++j)
+            {
+                Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
+            }
+
+            // Gating variables: Rush-Larsen scheme
+            for (unsigned int j = 0; j < m_gates.size(); ++j)
+            {
+                Vmath::Sdiv(m_nq, -delta_t, m_gates_tau[j], 1, m_gates_tau[j], 1);
+                Vmath::Vexp(m_nq, m_gates_tau[j], 1, m_gates_tau[j], 1);
+                Vmath::Vsub(m_nq, m_cellSol[m_gates[j]], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+                Vmath::Vvtvp(m_nq, m_cellSol[m_gates[j]], 1, m_gates_tau[j], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+            }
+        }
+
+        m_lastTime = time;
+    }
+
+    /**
+     * Integrates the cell model for one PDE time-step using the fused
+     * kernel. Each block of points is copied into #m_blockData, all
+     * substeps are taken on it, and the solution and the derivatives of the
+     * final substep are copied back to #m_cellSol and #m_wsp. The same
+     * forward Euler and Rush-Larsen updates as TimeIntegrate are applied
+     * point by point.
+     */
+    void CellModel::TimeIntegrateFused(const NekDouble delta_t)
+    {
+        for (int start = 0; start < m_nq; start += s_cellBlockSize)
+        {
+            const int n = min(s_cellBlockSize, m_nq - start);
+
+            for (unsigned int k = 0; k < m_nvar; ++k)
+            {
+                Vmath::Vcopy(n, &m_cellSol[k][start], 1, m_blockSol[k], 1);
+            }
+
+            for (unsigned int i = 0; i < m_substeps - 1; ++i)
+            {
+                v_UpdateBlock(n, &m_blockSol[0], &m_blockWsp[0],
+                              &m_blockTau[0]);
+                IntegrateBlock(n, delta_t, true);
+            }
+
+            // Final step: only the voltage derivative is returned, the
+            // remaining variables are integrated.
+            v_UpdateBlock(n, &m_blockSol[0], &m_blockWsp[0], &m_blockTau[0]);
+            IntegrateBlock(n, delta_t, false);
+
+            for (unsigned int k = 0; k < m_nvar; ++k)
+            {
+                Vmath::Vcopy(n, m_blockSol[k], 1, &m_cellSol[k][start], 1);
+                Vmath::Vcopy(n, m_blockWsp[k], 1, &m_wsp[k][start], 1);
+            }
+        }
+    }
+
+    /**
+     * Advances the concentrations and gates of the current block, and the
+     * voltage if @a voltage is set, by one substep.
+     */
+    void CellModel::IntegrateBlock(
+            const int       n,
+            const NekDouble delta_t,
+            const bool      voltage)
+    {
+        int i;
+
+        if (voltage)
+        {
+            NekDouble       *x  = m_blockSol[0];
+            const NekDouble *dx = m_blockWsp[0];
+            for (i = 0; i < n; ++i)
+            {
+                x[i] += delta_t*dx[i];
+            }
+        }
+
         for (unsigned int j = 0; j < m_concentrations.size(); ++j)
         {
-            Vmath::Svtvp(m_nq, delta_t, m_wsp[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1, m_cellSol[m_concentrations[j]], 1);
+            NekDouble       *x  = m_blockSol[m_concentrations[j]];
+            const NekDouble *dx = m_blockWsp[m_concentrations[j]];
+            for (i = 0; i < n; ++i)
+            {
+                x[i] += delta_t*dx[i];
+            }
         }
 
-        // Gating variables: Rush-Larsen scheme
         for (unsigned int j = 0; j < m_gates.size(); ++j)
         {
-            Vmath::Sdiv(m_nq, -delta_t, m_gates_tau[j], 1, m_gates_tau[j], 1);
-            Vmath::Vexp(m_nq, m_gates_tau[j], 1, m_gates_tau[j], 1);
-            Vmath::Vsub(m_nq, m_cellSol[m_gates[j]], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
-            Vmath::Vvtvp(m_nq, m_cellSol[m_gates[j]], 1, m_gates_tau[j], 1, m_wsp[m_gates[j]], 1, m_cellSol[m_gates[j]], 1);
+            NekDouble       *x     = m_blockSol[m_gates[j]];
+            const NekDouble *x_inf = m_blockWsp[m_gates[j]];
+            const NekDouble *x_tau = m_blockTau[j];
+            for (i = 0; i < n; ++i)
+            {
+                x[i] = (x[i] - x_inf[i])*exp(-delta_t/x_tau[i]) + x_inf[i];
+            }
+        }
+    }
+
+    void CellModel::GenerateSummary(SummaryList& s)
+    {
+        v_GenerateSummary(s);
+
+        if (m_useLookupTable && m_lookupTable.GetNumFunctions() > 0)
+        {
+            SolverUtils::AddSummaryItem(s, "Cell lookup table",
+                boost::lexical_cast<std::string>(m_lookupTable.GetVMin())
+                + " to " +
+                boost::lexical_cast<std::string>(m_lookupTable.GetVMax())
+                + " mV, step " +
+                boost::lexical_cast<std::string>(m_lookupTable.GetStep())
+                + " mV");
+            SolverUtils::AddSummaryItem(s, "Cell lookup error",
+                                        m_lookupTable.GetMaxError());
         }
+    }
 
-        m_lastTime = time;
+    /**
+     * Tabulates the functions declared by the model. The maximum error of
+     * each function, relative to its largest magnitude over the table, is
+     * printed with the verbose option so that the resolution can be chosen.
+     */
+    void CellModel::BuildLookupTable()
+    {
+        ASSERTL0(v_HasFusedKernel() && m_voltageFuncNames.size() > 0,
+                 "This cell model does not support lookup tables.");
+        ASSERTL0(GetFused(),
+                 "Lookup tables require CellModelEvaluation to be Fused.");
+
+        NekDouble vMin, vMax, vStep;
+        m_session->LoadParameter("LookupTableVMin", vMin,  -100.0);
+        m_session->LoadParameter("LookupTableVMax", vMax,   100.0);
+        m_session->LoadParameter("LookupTableStep", vStep,  0.05);
+
+        m_lookupTable.Build(m_voltageFuncNames.size(),
+                boost::bind(&CellModel::v_VoltageFunctions, this, _1, _2),
+                vMin, vMax, vStep, m_voltageBreaks);
+
+        if (m_session->GetComm()->GetRank() == 0 &&
+            m_session->DefinesCmdLineArgument("verbose"))
+        {
+            cout << "Cell model lookup table: "
+                 << m_lookupTable.GetNumPoints() << " points" << endl;
+            for (int j = 0; j < m_voltageFuncNames.size(); ++j)
+            {
+                cout << "  - " << setw(10) << left << m_voltageFuncNames[j]
+                     << " max. relative error: "
+                     << m_lookupTable.GetMaxError(j) << endl;
+            }
+        }
+    }
+
+    void CellModel::v_VoltageFunctions(const NekDouble V, NekDouble *vals)
+    {
+        NEKERROR(ErrorUtil::efatal,
+                 "This cell model does not declare any voltage functions.");
+    }
+
+    void CellModel::v_UpdateBlock(
+            const int               n,
+            const NekDouble *const *in,
+                  NekDouble *const *out,
+                  NekDouble *const *tau)
+    {
+        NEKERROR(ErrorUtil::efatal,
+                 "This cell model does not provide a fused kernel.");
+    }
+
+    /**
+     * Evaluates the fused kernel over all #m_nq points of @a inarray, storing
+     * the gate tau values in #m_gates_tau. Models whose point-wise kernel is
+     * their reference implementation use this for v_Update.
+     */
+    void CellModel::UpdateAllPoints(
+            const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
+                  Array<OneD,        Array<OneD, NekDouble> >&outarray)
+    {
+        std::vector<const NekDouble*> in (m_nvar);
+        std::vector<NekDouble*>       out(m_nvar);
+        std::vector<NekDouble*>       tau(m_gates.size() + 1);
+        for (unsigned int k = 0; k < m_nvar; ++k)
+        {
+            in [k] = &inarray [k][0];
+            out[k] = &outarray[k][0];
+        }
+        for (unsigned int k = 0; k < m_gates.size(); ++k)
+        {
+            tau[k] = &m_gates_tau[k][0];
+        }
+
+        v_UpdateBlock(m_nq, &in[0], &out[0], &tau[0]);
     }
 
     Array<OneD, NekDouble> CellModel::GetCellSolutionCoeffs(unsigned int idx)
@@ -44,6 +44,7 @@
 #include <StdRegions/StdNodalTriExp.h>
 #include <StdRegions/StdNodalTetExp.h>
 #include <SolverUtils/Core/Misc.h>
+#include <CardiacEPSolver/CellModels/VoltageLookupTable.h>
 
 namespace Nektar
 {
@@ -89,10 +90,7 @@ namespace Nektar
         }
 
         /// Print a summary of the cell model
-        void GenerateSummary(SummaryList& s)
-        {
-            v_GenerateSummary(s);
-        }
+        void GenerateSummary(SummaryList& s);
 
         unsigned int GetNumCellVariables()
         {
@@ -108,6 +106,38 @@ namespace Nektar
 
         Array<OneD, NekDouble> GetCellSolution(unsigned int idx);
 
+        /// Select between the fused block kernel and the array-at-a-time
+        /// reference evaluation of the cell model.
+        void SetFused(bool fused)
+        {
+            m_fused = fused;
+        }
+
+        /// Returns true if the fused block kernel is in use.
+        bool GetFused()
+        {
+            return m_fused && v_HasFusedKernel();
+        }
+
+        /// Select whether the functions of the membrane potential declared
+        /// by the model are evaluated from a lookup table.
+        void SetLookupTable(bool table)
+        {
+            m_useLookupTable = table;
+        }
+
+        /// Returns true if the lookup table is in use.
+        bool GetLookupTable()
+        {
+            return m_useLookupTable && m_voltageFuncNames.size() > 0;
+        }
+
+        /// Returns the lookup table, which is built by Initialise.
+        const VoltageLookupTable &GetVoltageLookupTable()
+        {
+            return m_lookupTable;
+        }
+
     protected:
         /// Session
         LibUtilities::SessionReaderSharedPtr m_session;
@@ -142,6 +172,25 @@ namespace Nektar
         /// Storage for gate tau values
         Array<OneD, Array<OneD, NekDouble> > m_gates_tau;
 
+        /// Flag indicating whether the fused block kernel is requested
+        bool m_fused;
+        /// Storage for one block of points in the fused evaluation
+        Array<OneD, NekDouble> m_blockData;
+        /// Per-variable pointers into #m_blockData for the solution,
+        /// derivatives and gate tau values
+        std::vector<NekDouble*> m_blockSol;
+        std::vector<NekDouble*> m_blockWsp;
+        std::vector<NekDouble*> m_blockTau;
+
+        /// Flag indicating whether the voltage functions are tabulated
+        bool m_useLookupTable;
+        /// Table of the voltage functions declared by the model
+        VoltageLookupTable m_lookupTable;
+        /// Names of the functions computed by v_VoltageFunctions
+        std::vector<std::string> m_voltageFuncNames;
+        /// Voltages at which the functions switch between expressions
+        std::vector<NekDouble> m_voltageBreaks;
+
         virtual void v_Update(
                 const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
                       Array<OneD,        Array<OneD, NekDouble> >&outarray,
@@ -156,7 +205,57 @@ namespace Nektar
 
         virtual void v_SetInitialConditions() = 0;
 
+        /// Returns true if the model implements v_UpdateBlock.
+        virtual bool v_HasFusedKernel()
+        {
+            return false;
+        }
+
+        /// Computes the derivatives and gate values for @a n points, where
+        /// variable k of point i is stored at in[k][i].
+        virtual void v_UpdateBlock(
+                const int               n,
+                const NekDouble *const *in,
+                      NekDouble *const *out,
+                      NekDouble *const *tau);
+
+        /// Computes the functions of the membrane potential declared with
+        /// AddVoltageFunction, in the order they were declared.
+        virtual void v_VoltageFunctions(const NekDouble V, NekDouble *vals);
+
+        /// Declares a function of the membrane potential alone which may be
+        /// tabulated, returning its index in the output of
+        /// v_VoltageFunctions.
+        int AddVoltageFunction(const std::string &name)
+        {
+            m_voltageFuncNames.push_back(name);
+            return m_voltageFuncNames.size() - 1;
+        }
+
+        /// Declares a voltage at which the functions computed by
+        /// v_VoltageFunctions switch between expressions, across which the
+        /// lookup table does not interpolate.
+        void AddVoltageBreak(const NekDouble V)
+        {
+            m_voltageBreaks.push_back(V);
+        }
+
+        /// Evaluates v_UpdateBlock over all points of the given arrays
+        void UpdateAllPoints(
+                const Array<OneD, const  Array<OneD, NekDouble> >&inarray,
+                      Array<OneD,        Array<OneD, NekDouble> >&outarray);
+
         void LoadCellModel();
+
+    private:
+        void BuildLookupTable();
+
+        void TimeIntegrateFused(const NekDouble delta_t);
+
+        void IntegrateBlock(
+                const int       n,
+                const NekDouble delta_t,
+                const bool      voltage);
     };
 
 }
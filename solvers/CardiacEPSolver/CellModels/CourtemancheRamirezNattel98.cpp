@@ -56,6 +56,16 @@ namespace Nektar
             LibUtilities::SessionReader::RegisterEnumValue("CellModelVariant",
                     "AF", CourtemancheRamirezNattel98::eAF)
     };
+
+    // Names of the functions of the membrane potential
+    std::string CourtemancheRamirezNattel98::voltageFuncIds[
+                CourtemancheRamirezNattel98::SIZE_VoltageFunction] = {
+            "tau_m",  "m_inf",  "tau_h",  "h_inf",  "tau_j",  "j_inf",
+            "tau_oa", "oa_inf", "tau_oi", "oi_inf", "tau_ua", "ua_inf",
+            "tau_ui", "ui_inf", "tau_xr", "xr_inf", "tau_xs", "xs_inf",
+            "tau_d",  "d_inf",  "tau_f",  "f_inf",  "tau_w",  "w_inf",
+            "I_K1",   "g_Kur",  "I_Kr",   "f_Na_K", "I_NaCa", "I_NaCa_m1"
+    };
     
     // Register default variant
     std::string CourtemancheRamirezNattel98::def =
@@ -149,6 +159,14 @@ namespace Nektar
         m_concentrations.push_back(18);
         m_concentrations.push_back(19);
         m_concentrations.push_back(20);
+
+        for (int i = 0; i < SIZE_VoltageFunction; ++i)
+        {
+            AddVoltageFunction(voltageFuncIds[i]);
+        }
+
+        // The h and j gate rates switch expressions at -40 mV.
+        AddVoltageBreak(-40.0);
     }
     
     
@@ -426,6 +444,12 @@ namespace Nektar
         Vmath::Sadd(n, 1.0, outarray[19], 1, outarray[19], 1);
         Vmath::Vdiv(n, tmp, 1, outarray[19], 1, outarray[19], 1);
 
+        // Flux for the release gates, computed before the gating variables
+        // overwrite the I_Ca_L, I_Na_Ca and I_rel workspace.
+        Array<OneD, NekDouble> &tmp_Fn = outarray[15];
+        Vmath::Svtsvtp(n, 0.5*5e-13/F, tmp_I_Ca_L, 1, -0.2*5e-13/F, tmp_I_Na_Ca, 1, tmp_Fn, 1);
+        Vmath::Svtvm(n, 1e-12*JSR_V_rel, tmp_I_rel, 1, tmp_Fn, 1, tmp_Fn, 1);
+
         // Process gating variables
         const NekDouble * v;
         const NekDouble * x;
@@ -538,10 +562,6 @@ namespace Nektar
             *x_new = 1.0/(1.0+inarray[17][i]/0.00035);
         }
 
-        Array<OneD, NekDouble> &tmp_Fn = outarray[15];
-        Vmath::Svtsvtp(n, 0.5*5e-13/F, tmp_I_Ca_L, 1, -0.2*5e-13/F, tmp_I_Na_Ca, 1, tmp_Fn, 1);
-        Vmath::Svtvm(n, 1e-12*JSR_V_rel, tmp_I_rel, 1, tmp_Fn, 1, tmp_Fn, 1);
-
         // u
         for (i = 0, v = &tmp_Fn[0], x = &inarray[13][0], x_new = &outarray[13][0], x_tau = &m_gates_tau[12][0];
                 i < n; ++i, ++v, ++x, ++x_new, ++x_tau)
@@ -567,6 +587,260 @@ namespace Nektar
     }
 
 
+    /**
+     * Computes the gate time constants and steady states, and the
+     * voltage-dependent factors of the currents, which depend on the
+     * membrane potential alone and may therefore be tabulated.
+     */
+    inline void CourtemancheRamirezNattel98::VoltageFunctions(
+                const NekDouble  V,
+                      NekDouble *g) const
+    {
+        const NekDouble FRT = F/R/T;
+        NekDouble alpha, beta;
+
+        // m
+        alpha = (V == (-47.13)) ? 3.2
+              : (0.32*(V+47.13))/(1.0-exp((-0.1)*(V + 47.13)));
+        beta  = 0.08*exp(-V/11.0);
+        g[eTauM] = 1.0/(alpha + beta);
+        g[eInfM] = alpha*g[eTauM];
+        // h
+        alpha = (V >= -40.0) ? 0.0 : 0.135*exp(-(V+80.0)/6.8);
+        beta  = (V >= -40.0) ? 1.0/(0.13*(1.0+exp(-(V + 10.66)/11.1)))
+              : 3.56*exp(0.079*V)+310000.0*exp(0.35*V);
+        g[eTauH] = 1.0/(alpha + beta);
+        g[eInfH] = alpha*g[eTauH];
+        // j
+        alpha = (V >= -40.0) ? 0.0
+              : (-127140.0*exp(0.2444*V)-3.474e-05*exp(-0.04391*V))
+                *((V+37.78)/(1.0+exp(0.311*(V+79.23))));
+        beta  = (V >= -40.0)
+              ? (0.3*exp(-2.535e-07*V)/(1.0+exp(-0.1*(V+32.0))))
+              : 0.1212*exp(-0.01052*V)/(1.0+exp(-0.1378*(V+40.14)));
+        g[eTauJ] = 1.0/(alpha + beta);
+        g[eInfJ] = alpha*g[eTauJ];
+        // oa
+        alpha = 0.65/(exp(-(V+10.0)/8.5) + exp(-(V-30.0)/59.0));
+        beta  = 0.65/(2.5 + exp((V+82.0)/17.0));
+        g[eTauOa] = 1.0/K_Q10/(alpha + beta);
+        g[eInfOa] = 1.0/(1.0+exp(-(V+20.47)/17.54));
+        // oi
+        alpha = 1.0/(18.53 + exp((V+113.7)/10.95));
+        beta  = 1.0/(35.56 + exp(-(V+1.26)/7.44));
+        g[eTauOi] = 1.0/K_Q10/(alpha + beta);
+        g[eInfOi] = 1.0/(1.0+exp((V+43.1)/5.3));
+        // ua
+        alpha = 0.65/(exp(-(V+10.0)/8.5)+exp(-(V-30.0)/59.0));
+        beta  = 0.65/(2.5+exp((V+82.0)/17.0));
+        g[eTauUa] = 1.0/K_Q10/(alpha + beta);
+        g[eInfUa] = 1.0/(1.0+exp(-(V+30.3)/9.6));
+        // ui
+        alpha = 1.0/(21.0 + exp(-(V-185.0)/28.0));
+        beta  = exp((V-158.0)/16.0);
+        g[eTauUi] = 1.0/K_Q10/(alpha + beta);
+        g[eInfUi] = 1.0/(1.0+exp((V-99.45)/27.48));
+        // xr
+        alpha = 0.0003*(V+14.1)/(1-exp(-(V+14.1)/5.0));
+        beta  = 7.3898e-5*(V-3.3328)/(exp((V-3.3328)/5.1237)-1.0);
+        g[eTauXr] = 1.0/(alpha + beta);
+        g[eInfXr] = 1.0/(1+exp(-(V+14.1)/6.5));
+        // xs
+        alpha = 4e-5*(V-19.9)/(1.0-exp(-(V-19.9)/17.0));
+        beta  = 3.5e-5*(V-19.9)/(exp((V-19.9)/9.0)-1.0);
+        g[eTauXs] = 0.5/(alpha + beta);
+        g[eInfXs] = 1.0/sqrt(1.0+exp(-(V-19.9)/12.7));
+        // d
+        g[eTauD] = (1-exp(-(V+10.0)/6.24))
+                   /(0.035*(V+10.0)*(1+exp(-(V+10.0)/6.24)));
+        g[eInfD] = 1.0/(1.0 + exp(-(V+10)/8.0));
+        // f
+        g[eTauF] = 9.0/(0.0197*exp(-0.0337*0.0337*(V+10.0)*(V+10.0))+0.02);
+        g[eInfF] = exp((-(V + 28.0)) / 6.9)
+                   / (1.0 + exp((-(V + 28.0)) / 6.9));
+        // w
+        g[eTauW] = 6.0*(1.0-exp(-(V-7.9)/5.0))
+                   /(1.0+0.3*exp(-(V-7.9)/5.0))/(V-7.9);
+        g[eInfW] = 1.0 - 1.0/(1.0 + exp(-(V - 40.0)/17.0));
+
+        // Current factors
+        g[eFacK1]   = 1.0/(1.0 + exp(0.07*(V+80.0)));
+        g[eFacKur]  = 0.005 + 0.05/(1.0 + exp(-(V-15.0)/13.0));
+        g[eFacKr]   = 1.0/(1.0 + exp((V+15.0)/22.4));
+        g[eFacNaK]  = 1.0 + 0.1245*exp(-0.1*FRT*V)
+                          + 0.0365*sigma*exp(-FRT*V);
+        g[eFacNaCa] = exp(gamma*FRT*V);
+        g[eFacGm1]  = exp((gamma-1.0)*FRT*V);
+    }
+
+    void CourtemancheRamirezNattel98::v_VoltageFunctions(
+                const NekDouble  V,
+                      NekDouble *vals)
+    {
+        VoltageFunctions(V, vals);
+    }
+
+    /**
+     * Fused equivalent of v_Update. Every point is processed in one pass,
+     * holding the intermediate currents in registers rather than in
+     * workspace arrays. The functions of the membrane potential are taken
+     * from the lookup table if it is enabled.
+     */
+    void CourtemancheRamirezNattel98::v_UpdateBlock(
+                const int               n,
+                const NekDouble *const *in,
+                      NekDouble *const *out,
+                      NekDouble *const *tau)
+    {
+        const NekDouble RTF        = R*T/F;
+        const NekDouble I_Na_K_fac = C_m*I_Na_K_max*K_o/(K_o+K_i);
+        const NekDouble NaCa_fac   = (K_m_Na*K_m_Na*K_m_Na + Na_o*Na_o*Na_o)
+                                        *(K_m_Ca + Ca_o);
+        const NekDouble Na_o3      = Na_o*Na_o*Na_o;
+        const NekDouble FV_i       = 1.0/F/V_i;
+        const bool      useTable   = m_useLookupTable;
+
+        NekDouble g[SIZE_VoltageFunction];
+
+        for (int i = 0; i < n; ++i)
+        {
+            const NekDouble V      = in[0][i];
+            const NekDouble Na_i   = in[16][i];
+            const NekDouble Ca_i   = in[17][i];
+            const NekDouble K_in   = in[18][i];
+            const NekDouble Ca_rel = in[19][i];
+            const NekDouble Ca_up  = in[20][i];
+
+            if (useTable)
+            {
+                m_lookupTable.Evaluate(V, g);
+            }
+            else
+            {
+                VoltageFunctions(V, g);
+            }
+
+            NekDouble dV, dNa, dK;
+
+            // Sodium I_Na and background current
+            const NekDouble V_E_Na  = V - RTF*log(Na_o/Na_i);
+            const NekDouble m       = in[1][i];
+            const NekDouble I_Na    = C_m*g_Na*m*m*m*in[2][i]*in[3][i]*V_E_Na;
+            const NekDouble I_b_Na  = C_m*g_b_Na*V_E_Na;
+            dV  = -I_Na - I_b_Na;
+            dNa = -I_Na - I_b_Na;
+
+            // Potassium currents
+            const NekDouble V_E_K   = V - RTF*log(K_o/K_in);
+            const NekDouble I_K1    = C_m*g_K1*V_E_K*g[eFacK1];
+            const NekDouble o_a     = in[4][i];
+            const NekDouble I_to    = C_m*g_to*o_a*o_a*o_a*in[5][i]*V_E_K;
+            const NekDouble u_a     = in[6][i];
+            const NekDouble I_Kur   = C_m*g_Kur_scaling*g[eFacKur]*V_E_K
+                                        *u_a*u_a*u_a*in[7][i];
+            const NekDouble I_Kr    = C_m*g_Kr*in[8][i]*V_E_K*g[eFacKr];
+            const NekDouble x_s     = in[9][i];
+            const NekDouble I_Ks    = C_m*g_Ks*x_s*x_s*V_E_K;
+            dV -= I_K1 + I_to + I_Kur + I_Kr + I_Ks;
+            dK  = -I_K1 - I_to - I_Kur - I_Kr - I_Ks;
+
+            // Calcium currents
+            const NekDouble I_b_Ca  = C_m*g_b_Ca*(V - 0.5*RTF*log(Ca_o/Ca_i));
+            const NekDouble I_Ca_L  = C_m*g_Ca_L*in[10][i]*in[11][i]*in[12][i]
+                                        *(V - 65.0);
+            dV -= I_b_Ca + I_Ca_L;
+
+            // Na-K pump current
+            const NekDouble I_Na_K  = I_Na_K_fac/((1.0 + pow(K_m_Na_i/Na_i, 1.5))
+                                        *g[eFacNaK]);
+            dV  -= I_Na_K;
+            dNa -= 3.0*I_Na_K;
+            dK  += 2.0*I_Na_K;
+
+            // Na-Ca exchanger current
+            const NekDouble e_gm1   = g[eFacGm1];
+            const NekDouble I_Na_Ca = C_m*I_NaCa_max
+                                        *(Ca_o*Na_i*Na_i*Na_i*g[eFacNaCa]
+                                          - Na_o3*Ca_i*e_gm1)
+                                        /((1.0 + K_sat*e_gm1)*NaCa_fac);
+            dV  -= I_Na_Ca;
+            dNa -= 3.0*I_Na_Ca;
+
+            // Calcium pump current
+            const NekDouble I_p_Ca  = C_m*I_p_Ca_max*Ca_i/(0.0005 + Ca_i);
+            dV -= I_p_Ca;
+
+            out[0] [i] = dV/C_m;
+            out[16][i] = dNa*FV_i;
+            out[18][i] = dK*FV_i;
+
+            // Calcium handling
+            const NekDouble I_tr      = (Ca_up - Ca_rel)/tau_tr;
+            const NekDouble I_up_leak = NSR_I_up_max/NSR_I_Ca_max*Ca_up;
+            const NekDouble I_up      = NSR_I_up_max/(1.0 + NSR_K_up/Ca_i);
+            const NekDouble u         = in[13][i];
+            const NekDouble I_rel     = JSR_K_rel*u*u*in[14][i]*in[15][i]
+                                            *(Ca_rel - Ca_i);
+
+            const NekDouble B1 = ((2.0*I_Na_Ca - I_p_Ca - I_Ca_L - I_b_Ca)
+                                    *0.5/F
+                                  + JSR_V_up*(I_up_leak - I_up)
+                                  + JSR_V_rel*I_rel)/V_i;
+            const NekDouble Cmdn = Km_Cmdn + Ca_i;
+            const NekDouble Trpn = Km_Trpn + Ca_i;
+            const NekDouble B2 = 1.0 + Cmdn_max*Km_Cmdn/(Cmdn*Cmdn)
+                                     + Trpn_max*Km_Trpn/(Trpn*Trpn);
+            const NekDouble Csqn = Km_Csqn + Ca_rel;
+
+            out[17][i] = B1/B2;
+            out[19][i] = (I_tr - I_rel)/(1.0 + Csqn_max*Km_Csqn/(Csqn*Csqn));
+            out[20][i] = I_up - I_up_leak - JSR_V_rel/JSR_V_up*I_tr;
+
+            // Flux for the release gates
+            const NekDouble Fn = 1e-12*JSR_V_rel*I_rel
+                               - (0.5*5e-13/F*I_Ca_L - 0.2*5e-13/F*I_Na_Ca);
+
+            // Gating variables
+            tau[0] [i] = g[eTauM];
+            out[1] [i] = g[eInfM];
+            tau[1] [i] = g[eTauH];
+            out[2] [i] = g[eInfH];
+            tau[2] [i] = g[eTauJ];
+            out[3] [i] = g[eInfJ];
+            tau[3] [i] = g[eTauOa];
+            out[4] [i] = g[eInfOa];
+            tau[4] [i] = g[eTauOi];
+            out[5] [i] = g[eInfOi];
+            tau[5] [i] = g[eTauUa];
+            out[6] [i] = g[eInfUa];
+            tau[6] [i] = g[eTauUi];
+            out[7] [i] = g[eInfUi];
+            tau[7] [i] = g[eTauXr];
+            out[8] [i] = g[eInfXr];
+            tau[8] [i] = g[eTauXs];
+            out[9] [i] = g[eInfXs];
+            tau[9] [i] = g[eTauD];
+            out[10][i] = g[eInfD];
+            tau[10][i] = g[eTauF];
+            out[11][i] = g[eInfF];
+            // f_Ca
+            tau[11][i] = 2.0;
+            out[12][i] = 1.0/(1.0+Ca_i/0.00035);
+
+
+            // u
+            tau[12][i] = 8.0;
+            out[13][i] = 1.0/(1.0 + exp(-(Fn - 3.4175e-13)/1.367e-15));
+            // v
+            tau[13][i] = 1.91 + 2.09/(1.0+exp(-(Fn - 3.4175e-13)/13.67e-16));
+            out[14][i] = 1.0 - 1.0/(1.0 + exp(-(Fn - 6.835e-14)/13.67e-16));
+            // w
+            tau[14][i] = g[eTauW];
+            out[15][i] = g[eInfW];
+        }
+    }
+
+
     /**
     *
     */
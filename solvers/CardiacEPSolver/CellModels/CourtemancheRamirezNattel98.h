@@ -78,6 +78,20 @@ namespace Nektar
 
         virtual std::string v_GetCellVarName(unsigned int idx);
 
+        virtual bool v_HasFusedKernel()
+        {
+            return true;
+        }
+
+        /// Computes all currents and gate rates point by point.
+        virtual void v_UpdateBlock(
+                const int               n,
+                const NekDouble *const *in,
+                      NekDouble *const *out,
+                      NekDouble *const *tau);
+
+        virtual void v_VoltageFunctions(const NekDouble V, NekDouble *vals);
+
     private:
         NekDouble C_m;
         NekDouble g_Na;
@@ -128,8 +142,21 @@ namespace Nektar
         };
         enum Variants model_variant;
 
+        /// Functions of the membrane potential used by v_UpdateBlock
+        enum VoltageFunction {
+            eTauM,  eInfM,  eTauH,  eInfH,  eTauJ,  eInfJ,
+            eTauOa, eInfOa, eTauOi, eInfOi, eTauUa, eInfUa,
+            eTauUi, eInfUi, eTauXr, eInfXr, eTauXs, eInfXs,
+            eTauD,  eInfD,  eTauF,  eInfF,  eTauW,  eInfW,
+            eFacK1, eFacKur, eFacKr, eFacNaK, eFacNaCa, eFacGm1,
+            SIZE_VoltageFunction
+        };
+
         static std::string lookupIds[];
+        static std::string voltageFuncIds[];
         static std::string def;
+
+        void VoltageFunctions(const NekDouble V, NekDouble *g) const;
     };
 
 }
@@ -70,6 +70,18 @@ namespace Nektar
                      Array<OneD,        Array<OneD, NekDouble> >&outarray,
                const NekDouble time);
 
+        virtual bool v_HasFusedKernel()
+        {
+            return true;
+        }
+
+        /// Computes all currents and gate rates point by point.
+        virtual void v_UpdateBlock(
+                const int               n,
+                const NekDouble *const *in,
+                      NekDouble *const *out,
+                      NekDouble *const *tau);
+
         /// Prints a summary of the model parameters.
         virtual void v_GenerateSummary(SummaryList& s);
 
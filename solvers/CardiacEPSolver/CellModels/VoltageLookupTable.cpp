@@ -0,0 +1,220 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File VoltageLookupTable.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Lookup table for functions of the membrane potential.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <algorithm>
+
+#include <boost/math/special_functions/fpclassify.hpp>
+
+#include <LibUtilities/BasicUtils/ErrorUtil.hpp>
+#include <CardiacEPSolver/CellModels/VoltageLookupTable.h>
+
+namespace Nektar
+{
+    VoltageLookupTable::VoltageLookupTable()
+        : m_nFunc(0), m_nPoints(0), m_vMin(0.0), m_step(1.0),
+          m_invStep(1.0), m_maxPos(0.0)
+    {
+    }
+
+    /**
+     * Evaluates @a func at every grid point and records the interpolation
+     * error against @a func at points between the grid points. The grid is
+     * shifted down from @a vMin, if needed, so that the break voltages lie
+     * on grid points. At a break the functions are evaluated just either
+     * side of it.
+     */
+    void VoltageLookupTable::Build(
+            const int                     nFunc,
+            const VoltageFuncType        &func,
+            const NekDouble               vMin,
+            const NekDouble               vMax,
+            const NekDouble               vStep,
+            const std::vector<NekDouble> &breaks)
+    {
+        ASSERTL0(nFunc > 0, "No functions to tabulate.");
+        ASSERTL0(vMax > vMin, "Lookup table range is empty.");
+        ASSERTL0(vStep > 0.0, "Lookup table step must be positive.");
+
+        m_nFunc   = nFunc;
+        m_vMin    = vMin;
+        m_step    = vStep;
+        m_invStep = 1.0/vStep;
+
+        if (breaks.size() > 0)
+        {
+            m_vMin = breaks[0]
+                - ceil((breaks[0] - vMin)*m_invStep - 1e-8)*vStep;
+        }
+
+        m_nPoints = (int) ceil((vMax - m_vMin)*m_invStep - 1e-8) + 1;
+        m_maxPos  = m_nPoints - 1;
+
+        std::vector<bool> isBreak(m_nPoints, false);
+        for (unsigned int k = 0; k < breaks.size(); ++k)
+        {
+            const NekDouble x = (breaks[k] - m_vMin)*m_invStep;
+            const int       i = (int) floor(x + 0.5);
+            ASSERTL0(fabs(x - i) < 1e-6,
+                     "Lookup table breaks must be whole steps apart.");
+            if (i > 0 && i < m_nPoints - 1)
+            {
+                isBreak[i] = true;
+            }
+        }
+
+        // Left and right values at each grid point, equal away from breaks.
+        const NekDouble        delta = 1e-6*vStep;
+        std::vector<NekDouble> left(nFunc), right(nFunc);
+
+        m_table.resize(2*m_nPoints*m_nFunc);
+        for (int i = 0; i < m_nPoints; ++i)
+        {
+            const NekDouble V = m_vMin + i*vStep;
+
+            if (isBreak[i])
+            {
+                func(V - delta, &left[0]);
+                func(V + delta, &right[0]);
+            }
+            else
+            {
+                EvaluateRegular(func, V, &right[0]);
+                left = right;
+            }
+
+            if (i > 0)
+            {
+                std::copy(left.begin(), left.end(),
+                          m_table.begin() + (2*i - 1)*m_nFunc);
+            }
+            std::copy(right.begin(), right.end(),
+                      m_table.begin() + 2*i*m_nFunc);
+        }
+        std::copy(right.begin(), right.end(),
+                  m_table.begin() + (2*m_nPoints - 1)*m_nFunc);
+
+        ComputeError(func);
+    }
+
+    NekDouble VoltageLookupTable::GetMaxError() const
+    {
+        NekDouble err = 0.0;
+        for (int j = 0; j < m_nFunc; ++j)
+        {
+            err = std::max(err, m_maxError[j]);
+        }
+        return err;
+    }
+
+    /**
+     * Several gating rates have removable singularities, such as
+     * \f$ (V-V_0)/(1-e^{-(V-V_0)/k}) \f$ at \f$ V = V_0 \f$, where the
+     * analytic form is not finite. Grid points may fall on these, so any
+     * value which is not finite is replaced by the average of the values
+     * just either side of @a V. Finite values are kept as they are.
+     */
+    void VoltageLookupTable::EvaluateRegular(
+            const VoltageFuncType &func,
+            const NekDouble        V,
+                  NekDouble       *vals) const
+    {
+        func(V, vals);
+
+        const NekDouble delta = 1e-3*m_step;
+        std::vector<NekDouble> lo, hi;
+
+        for (int j = 0; j < m_nFunc; ++j)
+        {
+            if ((boost::math::isfinite)(vals[j]))
+            {
+                continue;
+            }
+
+            if (lo.empty())
+            {
+                lo.resize(m_nFunc);
+                hi.resize(m_nFunc);
+                func(V - delta, &lo[0]);
+                func(V + delta, &hi[0]);
+            }
+            vals[j] = 0.5*(lo[j] + hi[j]);
+        }
+    }
+
+    /**
+     * The error of linear interpolation is largest between grid points, so
+     * each interval is sampled at its quarter points. Samples where the
+     * analytic form is not finite are skipped.
+     */
+    void VoltageLookupTable::ComputeError(const VoltageFuncType &func)
+    {
+        std::vector<NekDouble> exact(m_nFunc), approx(m_nFunc);
+        std::vector<NekDouble> maxAbs(m_nFunc, 0.0);
+        std::vector<NekDouble> maxErr(m_nFunc, 0.0);
+
+        for (int i = 0; i < 2*m_nPoints; ++i)
+        {
+            for (int j = 0; j < m_nFunc; ++j)
+            {
+                maxAbs[j] = std::max(maxAbs[j], fabs(m_table[i*m_nFunc + j]));
+            }
+        }
+
+        for (int i = 0; i < m_nPoints - 1; ++i)
+        {
+            for (int q = 1; q < 4; ++q)
+            {
+                const NekDouble V = m_vMin + (i + 0.25*q)*m_step;
+                func(V, &exact[0]);
+                Evaluate(V, &approx[0]);
+                for (int j = 0; j < m_nFunc; ++j)
+                {
+                    if ((boost::math::isfinite)(exact[j]))
+                    {
+                        maxErr[j] = std::max(maxErr[j],
+                                             fabs(approx[j] - exact[j]));
+                    }
+                }
+            }
+        }
+
+        m_maxError.resize(m_nFunc);
+        for (int j = 0; j < m_nFunc; ++j)
+        {
+            m_maxError[j] = maxAbs[j] > 0.0 ? maxErr[j]/maxAbs[j] : maxErr[j];
+        }
+    }
+}
@@ -0,0 +1,155 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File VoltageLookupTable.h
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Lookup table for functions of the membrane potential.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef NEKTAR_SOLVERS_CARDIACEPSOLVER_CELLMODELS_VOLTAGELOOKUPTABLE
+#define NEKTAR_SOLVERS_CARDIACEPSOLVER_CELLMODELS_VOLTAGELOOKUPTABLE
+
+#include <vector>
+
+#include <boost/function.hpp>
+
+#include <LibUtilities/BasicConst/NektarUnivTypeDefs.hpp>
+
+namespace Nektar
+{
+    /// Computes all tabulated functions at the given membrane potential.
+    typedef boost::function<void (const NekDouble, NekDouble*)>
+                                                        VoltageFuncType;
+
+    /**
+     * @brief Tabulates a set of functions of the membrane potential on a
+     * uniform grid and evaluates them by linear interpolation.
+     *
+     * The values of all functions at both ends of a grid interval are
+     * stored contiguously, so a single evaluation reads two neighbouring
+     * rows of the table. Functions may switch between expressions at given
+     * break voltages, which are placed on grid points; the intervals either
+     * side of a break then hold the one-sided limits there, so that no
+     * interval interpolates across the switch. Voltages outside the
+     * tabulated range take the value at the nearest end of the table.
+     */
+    class VoltageLookupTable
+    {
+    public:
+        VoltageLookupTable();
+
+        /// Tabulates the @a nFunc functions computed by @a func on
+        /// [@a vMin, @a vMax] with spacing @a vStep, which are
+        /// discontinuous at the voltages in @a breaks.
+        void Build(
+                const int                     nFunc,
+                const VoltageFuncType        &func,
+                const NekDouble               vMin,
+                const NekDouble               vMax,
+                const NekDouble               vStep,
+                const std::vector<NekDouble> &breaks
+                                        = std::vector<NekDouble>());
+
+        /// Interpolates all functions at @a V into @a vals.
+        inline void Evaluate(const NekDouble V, NekDouble *vals) const
+        {
+            NekDouble x = (V - m_vMin)*m_invStep;
+            x = x < 0.0 ? 0.0 : (x > m_maxPos ? m_maxPos : x);
+
+            const int        row  = (int) x;
+            const NekDouble  frac = x - row;
+            const NekDouble *r0   = &m_table[2*row*m_nFunc];
+            const NekDouble *r1   = r0 + m_nFunc;
+
+            for (int j = 0; j < m_nFunc; ++j)
+            {
+                vals[j] = r0[j] + frac*(r1[j] - r0[j]);
+            }
+        }
+
+        int GetNumFunctions() const
+        {
+            return m_nFunc;
+        }
+
+        int GetNumPoints() const
+        {
+            return m_nPoints;
+        }
+
+        NekDouble GetVMin() const
+        {
+            return m_vMin;
+        }
+
+        NekDouble GetVMax() const
+        {
+            return m_vMin + (m_nPoints - 1)*m_step;
+        }
+
+        NekDouble GetStep() const
+        {
+            return m_step;
+        }
+
+        /// Maximum interpolation error of function @a j, relative to the
+        /// largest magnitude of the function over the table.
+        NekDouble GetMaxError(const int j) const
+        {
+            return m_maxError[j];
+        }
+
+        /// Maximum relative interpolation error over all functions.
+        NekDouble GetMaxError() const;
+
+    private:
+        int                    m_nFunc;
+        int                    m_nPoints;
+        NekDouble              m_vMin;
+        NekDouble              m_step;
+        NekDouble              m_invStep;
+        /// Largest scaled position, which is the last grid point.
+        NekDouble              m_maxPos;
+        /// Function values with rows 2i and 2i+1 holding all functions at
+        /// the two ends of interval i, plus an interval of zero width at
+        /// the last point so that it interpolates.
+        std::vector<NekDouble> m_table;
+        std::vector<NekDouble> m_maxError;
+
+        void EvaluateRegular(
+                const VoltageFuncType &func,
+                const NekDouble        V,
+                      NekDouble       *vals) const;
+
+        void ComputeError(const VoltageFuncType &func);
+    };
+}
+
+#endif
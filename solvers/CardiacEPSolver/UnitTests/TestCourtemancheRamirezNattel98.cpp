@@ -0,0 +1,222 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestCourtemancheRamirezNattel98.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the fused Courtemanche-Ramirez-Nattel kernel
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <CardiacEPSolver/CellModels/CourtemancheRamirezNattel98.h>
+#include <MultiRegions/ExpList0D.h>
+#include <SpatialDomains/MeshComponents.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+namespace Nektar
+{
+    namespace CourtemancheRamirezNattel98Tests
+    {
+        const int nPoints = 200;
+        const int nVar    = 21;
+        const int nGates  = 15;
+
+        /// Exposes the point-wise and fused kernels of the model.
+        class TestModel : public CourtemancheRamirezNattel98
+        {
+        public:
+            TestModel(const LibUtilities::SessionReaderSharedPtr &pSession,
+                      const MultiRegions::ExpListSharedPtr       &pField)
+                : CourtemancheRamirezNattel98(pSession, pField)
+            {
+            }
+
+            /// Evaluates v_Update at a single point, returning the gate
+            /// time constants in @a tau.
+            void UpdatePoint(const NekDouble *in, NekDouble *out,
+                             NekDouble *tau)
+            {
+                Array<OneD, Array<OneD, NekDouble> > vIn(nVar), vOut(nVar);
+                for (int k = 0; k < nVar; ++k)
+                {
+                    vIn [k] = Array<OneD, NekDouble>(1, in[k]);
+                    vOut[k] = Array<OneD, NekDouble>(1, 0.0);
+                }
+
+                v_Update(vIn, vOut, 0.0);
+
+                for (int k = 0; k < nVar; ++k)
+                {
+                    out[k] = vOut[k][0];
+                }
+                for (int k = 0; k < nGates; ++k)
+                {
+                    tau[k] = m_gates_tau[k][0];
+                }
+            }
+
+            void UpdateBlock(const int n, const NekDouble *const *in,
+                             NekDouble *const *out, NekDouble *const *tau)
+            {
+                v_UpdateBlock(n, in, out, tau);
+            }
+        };
+
+        /// Creates the model on a single vertex, from a session which
+        /// selects the given variant and disables the lookup table.
+        boost::shared_ptr<TestModel> CreateModel(const std::string &variant)
+        {
+            boost::filesystem::path file =
+                boost::filesystem::temp_directory_path() /
+                boost::filesystem::unique_path("crn98-%%%%-%%%%.xml");
+            {
+                std::ofstream os(file.string().c_str());
+                os << "<NEKTAR><CONDITIONS>"
+                   << "<PARAMETERS><P> Substeps = 1 </P></PARAMETERS>"
+                   << "<SOLVERINFO>"
+                   << "<I PROPERTY=\"CellModelVariant\" VALUE=\""
+                   << variant << "\" />"
+                   << "<I PROPERTY=\"CellModelLookupTable\" VALUE=\"False\" />"
+                   << "</SOLVERINFO>"
+                   << "</CONDITIONS></NEKTAR>" << std::endl;
+            }
+
+            std::string filename = file.string();
+            char  name[] = "CardiacEPSolverUnitTests";
+            char *argv[] = {name, &filename[0], 0};
+
+            LibUtilities::SessionReaderSharedPtr vSession =
+                LibUtilities::SessionReader::CreateInstance(2, argv);
+            boost::filesystem::remove(file);
+
+            SpatialDomains::PointGeomSharedPtr vPoint =
+                MemoryManager<SpatialDomains::PointGeom>
+                    ::AllocateSharedPtr(3, 0, 0.0, 0.0, 0.0);
+            MultiRegions::ExpListSharedPtr vExp =
+                MemoryManager<MultiRegions::ExpList0D>
+                    ::AllocateSharedPtr(vPoint);
+
+            boost::shared_ptr<TestModel> vCell =
+                MemoryManager<TestModel>::AllocateSharedPtr(vSession, vExp);
+            vCell->Initialise();
+            return vCell;
+        }
+
+        /// Compares the fused kernel with the point-wise evaluation on
+        /// random states spanning the physiological range of each variable.
+        void CheckBlockMatchesPoint(const std::string &variant)
+        {
+            boost::shared_ptr<TestModel> vCell = CreateModel(variant);
+
+            boost::random::mt19937 rng(1998);
+            boost::random::uniform_real_distribution<NekDouble> unit(0.0, 1.0);
+
+            // Ranges of the membrane potential, the gates and the
+            // concentrations Na_i, Ca_i, K_i, Ca_rel and Ca_up.
+            NekDouble lower[nVar], upper[nVar];
+            lower[0] = -90.0;
+            upper[0] =  40.0;
+            for (int k = 1; k <= nGates; ++k)
+            {
+                lower[k] = 0.0;
+                upper[k] = 1.0;
+            }
+            const NekDouble concLower[] = {10.0, 5e-5, 130.0, 0.2, 0.5};
+            const NekDouble concUpper[] = {13.0, 1e-3, 140.0, 2.0, 2.0};
+            for (int k = 0; k < 5; ++k)
+            {
+                lower[nGates+1+k] = concLower[k];
+                upper[nGates+1+k] = concUpper[k];
+            }
+
+            std::vector<NekDouble> data((2*nVar + nGates)*nPoints);
+            std::vector<NekDouble*> in(nVar), out(nVar), tau(nGates);
+            for (int k = 0; k < nVar; ++k)
+            {
+                in [k] = &data[k*nPoints];
+                out[k] = &data[(nVar + k)*nPoints];
+            }
+            for (int k = 0; k < nGates; ++k)
+            {
+                tau[k] = &data[(2*nVar + k)*nPoints];
+            }
+
+            for (int k = 0; k < nVar; ++k)
+            {
+                for (int i = 0; i < nPoints; ++i)
+                {
+                    in[k][i] = lower[k] + (upper[k] - lower[k])*unit(rng);
+                }
+            }
+
+            vCell->UpdateBlock(nPoints, &in[0], &out[0], &tau[0]);
+
+            NekDouble pIn[nVar], pOut[nVar], pTau[nGates];
+            for (int i = 0; i < nPoints; ++i)
+            {
+                for (int k = 0; k < nVar; ++k)
+                {
+                    pIn[k] = in[k][i];
+                }
+                vCell->UpdatePoint(pIn, pOut, pTau);
+
+                // The kernels sum the currents in a different order, so
+                // the derivatives agree to rounding of the largest current.
+                for (int k = 0; k < nVar; ++k)
+                {
+                    BOOST_CHECK_SMALL(out[k][i] - pOut[k],
+                                      1e-10*(fabs(pOut[k]) + 1.0));
+                }
+                for (int k = 0; k < nGates; ++k)
+                {
+                    BOOST_CHECK_SMALL(tau[k][i] - pTau[k],
+                                      1e-10*fabs(pTau[k]));
+                }
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestBlockMatchesPointOriginal)
+        {
+            CheckBlockMatchesPoint("Original");
+        }
+
+        BOOST_AUTO_TEST_CASE(TestBlockMatchesPointAF)
+        {
+            CheckBlockMatchesPoint("AF");
+        }
+    }
+}
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestVoltageLookupTable.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the lookup tables of gating rates
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <CardiacEPSolver/CellModels/VoltageLookupTable.h>
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/floating_point_comparison.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+
+namespace Nektar
+{
+    namespace VoltageLookupTableTests
+    {
+        const NekDouble vMin  = -100.0;
+        const NekDouble vMax  =   60.0;
+        const NekDouble vStep =   0.05;
+        const NekDouble vBreak = -40.0;
+
+        // Gating rates of the sodium current h and m gates of the
+        // Courtemanche et al. (1998) model. Those of the h gate switch
+        // between expressions at -40 mV, and alpha_m has a removable
+        // singularity at -47.13 mV.
+        void GatingRates(const NekDouble V, NekDouble *vals)
+        {
+            if (V < vBreak)
+            {
+                vals[0] = 0.135*exp((V + 80.0)/-6.8);
+                vals[1] = 3.56*exp(0.079*V) + 3.1e5*exp(0.35*V);
+            }
+            else
+            {
+                vals[0] = 0.0;
+                vals[1] = 1.0/(0.13*(1.0 + exp((V + 10.66)/-11.1)));
+            }
+            vals[2] = 0.32*(V + 47.13)/(1.0 - exp(-0.1*(V + 47.13)));
+        }
+
+        // Checks interpolated values against direct evaluation, relative
+        // to the magnitude of each rate.
+        void CheckAgainstDirect(const VoltageLookupTable &table,
+                                const NekDouble           V)
+        {
+            NekDouble exact[3], approx[3];
+            GatingRates(V, exact);
+            table.Evaluate(V, approx);
+
+            for (int j = 0; j < 3; ++j)
+            {
+                BOOST_CHECK_SMALL(approx[j] - exact[j],
+                                  1e-4*fabs(exact[j]) + 1e-10);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestInterpolationMatchesDirect)
+        {
+            std::vector<NekDouble> breaks(1, vBreak);
+            VoltageLookupTable table;
+            table.Build(3, &GatingRates, vMin, vMax, vStep, breaks);
+
+            BOOST_CHECK_EQUAL(table.GetNumFunctions(), 3);
+            BOOST_CHECK_LE(table.GetVMin(), vMin);
+            BOOST_CHECK_GE(table.GetVMax(), vMax);
+
+            // Sample off the grid points.
+            for (NekDouble V = vMin + 0.013; V < vMax; V += 0.37)
+            {
+                CheckAgainstDirect(table, V);
+            }
+
+            // The limit of alpha_m at its removable singularity is 3.2.
+            NekDouble vals[3];
+            table.Evaluate(-47.13, vals);
+            BOOST_CHECK_CLOSE(vals[2], 3.2, 1e-3);
+
+            BOOST_CHECK_SMALL(table.GetMaxError(), 1e-4);
+        }
+
+        BOOST_AUTO_TEST_CASE(TestBranchSwitch)
+        {
+            std::vector<NekDouble> breaks(1, vBreak);
+            VoltageLookupTable table;
+            table.Build(3, &GatingRates, vMin, vMax, vStep, breaks);
+
+            // Both sides of the switch, within the intervals adjacent to
+            // it, and at the break itself, which takes the upper branch.
+            const NekDouble offsets[] = {-0.9, -0.5, -0.1, -1e-4,
+                                          0.0, 1e-4, 0.1, 0.5, 0.9};
+            for (int i = 0; i < 9; ++i)
+            {
+                CheckAgainstDirect(table, vBreak + offsets[i]*vStep);
+            }
+
+            // The jump in each rate across the switch is kept.
+            NekDouble below[3], above[3], exactBelow[3], exactAbove[3];
+            table.Evaluate(vBreak - 1e-4*vStep, below);
+            table.Evaluate(vBreak + 1e-4*vStep, above);
+            GatingRates   (vBreak - 1e-4*vStep, exactBelow);
+            GatingRates   (vBreak + 1e-4*vStep, exactAbove);
+
+            for (int j = 0; j < 2; ++j)
+            {
+                BOOST_CHECK_CLOSE(above[j] - below[j],
+                                  exactAbove[j] - exactBelow[j], 1e-2);
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestSwitchWithoutBreak)
+        {
+            // Without the break, the interval containing the switch
+            // interpolates between the two branches.
+            VoltageLookupTable table;
+            table.Build(3, &GatingRates, vMin + 0.5*vStep, vMax, vStep);
+
+            std::vector<NekDouble> breaks(1, vBreak);
+            VoltageLookupTable tableBreak;
+            tableBreak.Build(3, &GatingRates, vMin, vMax, vStep, breaks);
+
+            BOOST_CHECK_GT(table.GetMaxError(1),
+                           100.0*tableBreak.GetMaxError(1));
+            BOOST_CHECK_SMALL(table.GetMaxError(2), 1e-4);
+        }
+    }
+}
@@ -0,0 +1,138 @@
+#include <cstdio>
+#include <cstdlib>
+
+#include <LibUtilities/BasicUtils/Timer.h>
+#include <SpatialDomains/MeshGraph.h>
+#include <MultiRegions/ExpList1D.h>
+#include <MultiRegions/ExpList2D.h>
+#include <MultiRegions/ExpList3D.h>
+#include <CardiacEPSolver/CellModels/CellModel.h>
+
+using namespace Nektar;
+
+/**
+ * Time integrates the cell model of a session at the points of its mesh,
+ * once using the array-at-a-time reference evaluation and once using the
+ * fused kernel, and reports the time per step and the largest difference
+ * between the final states.
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: CellModelTiming session.xml "
+                        "[-P TimingSteps=n]\n");
+        exit(1);
+    }
+
+    LibUtilities::SessionReaderSharedPtr vSession
+        = LibUtilities::SessionReader::CreateInstance(argc, argv);
+    SpatialDomains::MeshGraphSharedPtr vGraph
+        = SpatialDomains::MeshGraph::Read(vSession);
+
+    MultiRegions::ExpListSharedPtr vExp;
+    switch (vGraph->GetMeshDimension())
+    {
+        case 1:
+            vExp = MemoryManager<MultiRegions::ExpList1D>
+                ::AllocateSharedPtr(vSession, vGraph);
+            break;
+        case 2:
+            vExp = MemoryManager<MultiRegions::ExpList2D>
+                ::AllocateSharedPtr(vSession, vGraph);
+            break;
+        case 3:
+            vExp = MemoryManager<MultiRegions::ExpList3D>
+                ::AllocateSharedPtr(vSession, vGraph);
+            break;
+        default:
+            ASSERTL0(false, "Unsupported mesh dimension.");
+    }
+
+    std::string vCellModel;
+    vSession->LoadSolverInfo("CELLMODEL", vCellModel, "");
+    ASSERTL0(vCellModel != "", "Cell Model not specified.");
+
+    const int       nSteps  = vSession->DefinesParameter("TimingSteps") ?
+                        vSession->GetParameter("TimingSteps") : 100;
+    const int       nq      = vExp->GetNpoints();
+    const NekDouble vDeltaT = vSession->GetParameter("TimeStep");
+
+    // Reference, fused and fused with lookup table evaluation
+    CellModelSharedPtr vCell[3];
+    NekDouble          vTime[3];
+    int                nModes = 3;
+    for (int m = 0; m < nModes; ++m)
+    {
+        vCell[m] = GetCellModelFactory().CreateInstance(
+                                            vCellModel, vSession, vExp);
+        vCell[m]->SetFused(m > 0);
+        vCell[m]->SetLookupTable(m == 2);
+        if (m == 2 && !(vCell[m]->GetFused() && vCell[m]->GetLookupTable()))
+        {
+            nModes = 2;
+            break;
+        }
+        vCell[m]->Initialise();
+
+        Array<OneD, Array<OneD, NekDouble> > vSol(1), vWsp(1);
+        vSol[0] = Array<OneD, NekDouble>(nq, -81.0);
+        vWsp[0] = Array<OneD, NekDouble>(nq, 0.0);
+        if (vSession->DefinesFunction("InitialConditions", "u"))
+        {
+            Vmath::Fill(nq, vSession->GetFunction("InitialConditions", "u")
+                                ->Evaluate(0.0, 0.0, 0.0, 0.0),
+                        vSol[0], 1);
+        }
+
+        Timer t;
+        t.Start();
+        for (int i = 0; i < nSteps; ++i)
+        {
+            vCell[m]->TimeIntegrate(vSol, vWsp, (i+1)*vDeltaT);
+            Vmath::Svtvp(nq, vDeltaT, vWsp[0], 1, vSol[0], 1, vSol[0], 1);
+        }
+        t.Stop();
+        vTime[m] = t.TimePerTest(nSteps);
+    }
+
+    if (!vCell[1]->GetFused())
+    {
+        cout << vCellModel << " does not provide a fused kernel." << endl;
+    }
+
+    NekDouble maxDiff[3] = {0.0, 0.0, 0.0};
+    for (int m = 1; m < nModes; ++m)
+    {
+        for (unsigned int k = 0; k < vCell[0]->GetNumCellVariables(); ++k)
+        {
+            Array<OneD, NekDouble> ref   = vCell[0]->GetCellSolution(k);
+            Array<OneD, NekDouble> fused = vCell[m]->GetCellSolution(k);
+            for (int i = 0; i < ref.num_elements(); ++i)
+            {
+                NekDouble scale = max(fabs(ref[i]), 1e-12);
+                maxDiff[m] = max(maxDiff[m], fabs(ref[i] - fused[i])/scale);
+            }
+        }
+    }
+
+    printf("Cell model:          %s\n", vCellModel.c_str());
+    printf("Points:              %d\n", nq);
+    printf("Steps:               %d\n", nSteps);
+    printf("Vmath (ms/step):     %.4f\n", vTime[0]*1e3);
+    printf("Fused (ms/step):     %.4f\n", vTime[1]*1e3);
+    printf("Speedup:             %.2f\n", vTime[0]/vTime[1]);
+    printf("Max rel. difference: %g\n", maxDiff[1]);
+
+    if (nModes == 3)
+    {
+        const VoltageLookupTable &table = vCell[2]->GetVoltageLookupTable();
+        printf("Table (ms/step):     %.4f\n", vTime[2]*1e3);
+        printf("Table speedup:       %.2f\n", vTime[0]/vTime[2]);
+        printf("Table points:        %d\n", table.GetNumPoints());
+        printf("Table max. error:    %g\n", table.GetMaxError());
+        printf("Max rel. difference: %g\n", maxDiff[2]);
+    }
+
+    return 0;
+}
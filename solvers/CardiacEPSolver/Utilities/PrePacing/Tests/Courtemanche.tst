@@ -14,75 +14,75 @@
             <matches>
                 <match>
                     <field>u</field>
-                    <field tolerance="1e-06">-7.51776</field>
+                    <field tolerance="1e-06">-8.13404</field>
                 </match>
                 <match>
                     <field>m</field>
-                    <field tolerance="1e-06">0.987892</field>
+                    <field tolerance="1e-06">0.987019</field>
                 </match>
                 <match>
                     <field>h</field>
-                    <field tolerance="1e-06">2.03226e-178</field>
+                    <field tolerance="1e-06">1.89002e-177</field>
                 </match>
                 <match>
                     <field>j</field>
-                    <field tolerance="1e-06">3.67039e-12</field>
+                    <field tolerance="1e-06">3.77883e-12</field>
                 </match>
                 <match>
                     <field>o_a</field>
-                    <field tolerance="1e-06">0.677556</field>
+                    <field tolerance="1e-06">0.669866</field>
                 </match>
                 <match>
                     <field>o_i</field>
-                    <field tolerance="1e-06">0.00173797</field>
+                    <field tolerance="1e-06">0.00187463</field>
                 </match>
                 <match>
                     <field>u_a</field>
-                    <field tolerance="1e-06">0.915341</field>
+                    <field tolerance="1e-06">0.910255</field>
                 </match>
                 <match>
                     <field>u_i</field>
-                    <field tolerance="1e-06">0.993285</field>
+                    <field tolerance="1e-06">0.993327</field>
                 </match>
                 <match>
                     <field>x_r</field>
-                    <field tolerance="1e-06">0.213132</field>
+                    <field tolerance="1e-06">0.210676</field>
                 </match>
                 <match>
                     <field>x_s</field>
-                    <field tolerance="1e-06">0.0846056</field>
+                    <field tolerance="1e-06">0.084343</field>
                 </match>
                 <match>
                     <field>d</field>
-                    <field tolerance="1e-06">0.580487</field>
+                    <field tolerance="1e-06">0.561701</field>
                 </match>
                 <match>
                     <field>f</field>
-                    <field tolerance="1e-06">0.67841</field>
+                    <field tolerance="1e-06">0.67878</field>
                 </match>
                 <match>
                     <field>f_Ca</field>
-                    <field tolerance="1e-06">0.350083</field>
+                    <field tolerance="1e-06">0.344228</field>
                 </match>
                 <match>
                     <field>U</field>
-                    <field tolerance="1e-06">0.999994</field>
+                    <field tolerance="1e-06">0.000423629</field>
                 </match>
                 <match>
                     <field>V</field>
-                    <field tolerance="1e-06">2.5819e-11</field>
+                    <field tolerance="1e-06">1.48343e-18</field>
                 </match>
                 <match>
                     <field>W</field>
-                    <field tolerance="1e-06">0.94222</field>
+                    <field tolerance="1e-06">0.944163</field>
                 </match>
                 <match>
                     <field>Na_i</field>
-                    <field tolerance="1e-06">11.1712</field>
+                    <field tolerance="1e-06">11.1714</field>
                 </match>
                 <match>
                     <field>Ca_i</field>
-                    <field tolerance="1e-06">0.000645922</field>
+                    <field tolerance="1e-06">0.000662562</field>
                 </match>
                 <match>
                     <field>K_i</field>
@@ -90,11 +90,11 @@
                 </match>
                 <match>
                     <field>Ca_rel</field>
-                    <field tolerance="1e-06">0.218687</field>
+                    <field tolerance="1e-06">0.203011</field>
                 </match>
                 <match>
                     <field>Ca_up</field>
-                    <field tolerance="1e-06">1.58454</field>
+                    <field tolerance="1e-06">1.58676</field>
                 </match>
             </matches>
         </metric>
@@ -14,75 +14,75 @@
             <matches>
                 <match>
                     <field>u</field>
-                    <field tolerance="1e-06">-29.3514</field>
+                    <field tolerance="1e-06">-31.1108</field>
                 </match>
                 <match>
                     <field>m</field>
-                    <field tolerance="1e-06">0.856243</field>
+                    <field tolerance="1e-06">0.826523</field>
                 </match>
                 <match>
                     <field>h</field>
-                    <field tolerance="1e-06">6.68791e-119</field>
+                    <field tolerance="1e-06">7.21666e-122</field>
                 </match>
                 <match>
                     <field>j</field>
-                    <field tolerance="1e-06">1.61494e-10</field>
+                    <field tolerance="1e-06">1.60433e-10</field>
                 </match>
                 <match>
                     <field>o_a</field>
-                    <field tolerance="1e-06">0.388397</field>
+                    <field tolerance="1e-06">0.369012</field>
                 </match>
                 <match>
                     <field>o_i</field>
-                    <field tolerance="1e-06">0.0394704</field>
+                    <field tolerance="1e-06">0.0458609</field>
                 </match>
                 <match>
                     <field>u_a</field>
-                    <field tolerance="1e-06">0.548199</field>
+                    <field tolerance="1e-06">0.510611</field>
                 </match>
                 <match>
                     <field>u_i</field>
-                    <field tolerance="1e-06">0.994737</field>
+                    <field tolerance="1e-06">0.994597</field>
                 </match>
                 <match>
                     <field>x_r</field>
-                    <field tolerance="1e-06">0.119368</field>
+                    <field tolerance="1e-06">0.126016</field>
                 </match>
                 <match>
                     <field>x_s</field>
-                    <field tolerance="1e-06">0.070781</field>
+                    <field tolerance="1e-06">0.0711517</field>
                 </match>
                 <match>
                     <field>d</field>
-                    <field tolerance="1e-06">0.0847185</field>
+                    <field tolerance="1e-06">0.0696035</field>
                 </match>
                 <match>
                     <field>f</field>
-                    <field tolerance="1e-06">0.756132</field>
+                    <field tolerance="1e-06">0.757004</field>
                 </match>
                 <match>
                     <field>f_Ca</field>
-                    <field tolerance="1e-06">0.386251</field>
+                    <field tolerance="1e-06">0.450498</field>
                 </match>
                 <match>
                     <field>U</field>
-                    <field tolerance="1e-06">0.999994</field>
+                    <field tolerance="1e-06">0.000295536</field>
                 </match>
                 <match>
                     <field>V</field>
-                    <field tolerance="1e-06">2.58224e-11</field>
+                    <field tolerance="1e-06">0.999999</field>
                 </match>
                 <match>
                     <field>W</field>
-                    <field tolerance="1e-06">0.983249</field>
+                    <field tolerance="1e-06">0.984851</field>
                 </match>
                 <match>
                     <field>Na_i</field>
-                    <field tolerance="1e-06">11.173</field>
+                    <field tolerance="1e-06">11.1707</field>
                 </match>
                 <match>
                     <field>Ca_i</field>
-                    <field tolerance="1e-06">0.000550987</field>
+                    <field tolerance="1e-06">0.000423772</field>
                 </match>
                 <match>
                     <field>K_i</field>
@@ -90,11 +90,11 @@
                 </match>
                 <match>
                     <field>Ca_rel</field>
-                    <field tolerance="1e-06">0.222938</field>
+                    <field tolerance="1e-06">0.413369</field>
                 </match>
                 <match>
                     <field>Ca_up</field>
-                    <field tolerance="1e-06">1.57489</field>
+                    <field tolerance="1e-06">1.54756</field>
                 </match>
             </matches>
         </metric>
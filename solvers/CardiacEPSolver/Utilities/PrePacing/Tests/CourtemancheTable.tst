@@ -0,0 +1,106 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Courtemanche Cell model with voltage lookup tables</description>
+    <executable>PrePacing</executable>
+    <parameters>CourtemancheTable.xml</parameters>
+    <files>
+        <file description="Session File">CourtemancheTable.xml</file>
+    </files>
+    <metrics>
+        <metric type="Regex" id="1">
+            <regex>
+                ^#\s([\w]*)\s*([-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?)
+            </regex>
+            <matches>
+                <match>
+                    <field>u</field>
+                    <field tolerance="1e-04">-8.13404</field>
+                </match>
+                <match>
+                    <field>m</field>
+                    <field tolerance="1e-04">0.987019</field>
+                </match>
+                <match>
+                    <field>h</field>
+                    <field tolerance="1e-04">1.89002e-177</field>
+                </match>
+                <match>
+                    <field>j</field>
+                    <field tolerance="1e-04">3.77883e-12</field>
+                </match>
+                <match>
+                    <field>o_a</field>
+                    <field tolerance="1e-04">0.669866</field>
+                </match>
+                <match>
+                    <field>o_i</field>
+                    <field tolerance="1e-04">0.00187463</field>
+                </match>
+                <match>
+                    <field>u_a</field>
+                    <field tolerance="1e-04">0.910255</field>
+                </match>
+                <match>
+                    <field>u_i</field>
+                    <field tolerance="1e-04">0.993327</field>
+                </match>
+                <match>
+                    <field>x_r</field>
+                    <field tolerance="1e-04">0.210676</field>
+                </match>
+                <match>
+                    <field>x_s</field>
+                    <field tolerance="1e-04">0.084343</field>
+                </match>
+                <match>
+                    <field>d</field>
+                    <field tolerance="1e-04">0.561701</field>
+                </match>
+                <match>
+                    <field>f</field>
+                    <field tolerance="1e-04">0.67878</field>
+                </match>
+                <match>
+                    <field>f_Ca</field>
+                    <field tolerance="1e-04">0.344228</field>
+                </match>
+                <match>
+                    <field>U</field>
+                    <field tolerance="1e-04">0.000423629</field>
+                </match>
+                <match>
+                    <field>V</field>
+                    <field tolerance="1e-04">1.48343e-18</field>
+                </match>
+                <match>
+                    <field>W</field>
+                    <field tolerance="1e-04">0.944163</field>
+                </match>
+                <match>
+                    <field>Na_i</field>
+                    <field tolerance="1e-04">11.1714</field>
+                </match>
+                <match>
+                    <field>Ca_i</field>
+                    <field tolerance="1e-04">0.000662562</field>
+                </match>
+                <match>
+                    <field>K_i</field>
+                    <field tolerance="1e-04">138.991</field>
+                </match>
+                <match>
+                    <field>Ca_rel</field>
+                    <field tolerance="1e-04">0.203011</field>
+                </match>
+                <match>
+                    <field>Ca_up</field>
+                    <field tolerance="1e-04">1.58676</field>
+                </match>
+            </matches>
+        </metric>
+    </metrics>
+</test>
+
+
+
+
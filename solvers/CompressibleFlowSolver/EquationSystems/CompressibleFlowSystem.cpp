@@ -34,6 +34,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 #include <CompressibleFlowSolver/EquationSystems/CompressibleFlowSystem.h>
+#include <CompressibleFlowSolver/RiemannSolvers/CompressibleSolver.h>
 #include <LocalRegions/TriExp.h>
 #include <LocalRegions/QuadExp.h>
 #include <LocalRegions/HexExp.h>
@@ -174,6 +175,24 @@ namespace Nektar
                 m_riemannSolver = SolverUtils::GetRiemannSolverFactory()
                                             .CreateInstance(riemName);
 
+                // Batched flux evaluation is used unless the per-point
+                // reference implementation is requested.
+                std::string riemEval;
+                m_session->LoadSolverInfo(
+                    "RiemannEvaluation", riemEval, "Block");
+                ASSERTL0(boost::iequals(riemEval, "Block") ||
+                         boost::iequals(riemEval, "Point"),
+                         "RiemannEvaluation must be Block or Point.");
+
+                boost::shared_ptr<CompressibleSolver> compSolver =
+                    boost::dynamic_pointer_cast<CompressibleSolver>(
+                        m_riemannSolver);
+                if (compSolver)
+                {
+                    compSolver->SetBlockSolve(
+                        boost::iequals(riemEval, "Block"));
+                }
+
                 // Setting up upwind solver for diffusion operator
                 m_riemannSolverLDG = SolverUtils::GetRiemannSolverFactory()
                                                 .CreateInstance("UpwindLDG");
@@ -33,14 +33,27 @@
 //
 ///////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <CompressibleFlowSolver/RiemannSolvers/CompressibleSolver.h>
+#include <LibUtilities/BasicUtils/Vmath.hpp>
 
 namespace Nektar
 {
+    const int RiemannBlock::size;
+
     CompressibleSolver::CompressibleSolver() : RiemannSolver(),
-                                               m_pointSolve(true)
+                                               m_pointSolve(true),
+                                               m_blockSolve(true)
     {
         m_requiresRotation = true;
+
+        // Velocity components which are not copied in for 1D and 2D
+        // problems must read as zero.
+        std::fill(&m_block.uL[0][0], &m_block.uL[0][0] + 5*RiemannBlock::size,
+                  0.0);
+        std::fill(&m_block.uR[0][0], &m_block.uR[0][0] + 5*RiemannBlock::size,
+                  0.0);
     }
 
     void CompressibleSolver::v_Solve(
@@ -48,7 +61,39 @@ namespace Nektar
         const Array<OneD, const Array<OneD, NekDouble> > &Bwd,
               Array<OneD,       Array<OneD, NekDouble> > &flux)
     {
-        if (m_pointSolve)
+        if (m_pointSolve && m_blockSolve)
+        {
+            int expDim = Fwd.num_elements()-2;
+            int nPts   = Fwd[0].num_elements();
+
+            // Map the trace fields onto the (rho, rhou, rhov, rhow, E)
+            // ordering used by RiemannBlock.
+            int nFields = expDim+2;
+            int blockId[5] = { 0, 1, 2, 3, 4 };
+            blockId[expDim+1] = 4;
+
+            for (int i = 0; i < nPts; i += RiemannBlock::size)
+            {
+                int nBlock = std::min(RiemannBlock::size, nPts - i);
+
+                for (int n = 0; n < nFields; ++n)
+                {
+                    Vmath::Vcopy(nBlock, &Fwd[n][i], 1,
+                                 m_block.uL[blockId[n]], 1);
+                    Vmath::Vcopy(nBlock, &Bwd[n][i], 1,
+                                 m_block.uR[blockId[n]], 1);
+                }
+
+                v_BlockSolve(nBlock, m_block);
+
+                for (int n = 0; n < nFields; ++n)
+                {
+                    Vmath::Vcopy(nBlock, m_block.flux[blockId[n]], 1,
+                                 &flux[n][i], 1);
+                }
+            }
+        }
+        else if (m_pointSolve)
         {
             int expDim = Fwd.num_elements()-2;
             NekDouble rhouf, rhovf;
@@ -89,4 +134,27 @@ namespace Nektar
             v_ArraySolve(Fwd, Bwd, flux);
         }
     }
+
+    /**
+     * @brief Evaluate the Riemann flux for a block of trace points.
+     *
+     * The first @a npts entries of each row of @a block are valid. Subclasses
+     * override this with loops which the compiler is able to vectorise; the
+     * default implementation calls v_PointSolve for each point.
+     */
+    void CompressibleSolver::v_BlockSolve(
+        const int     npts,
+        RiemannBlock &block)
+    {
+        for (int i = 0; i < npts; ++i)
+        {
+            v_PointSolve(
+                block.uL  [0][i], block.uL  [1][i], block.uL  [2][i],
+                block.uL  [3][i], block.uL  [4][i],
+                block.uR  [0][i], block.uR  [1][i], block.uR  [2][i],
+                block.uR  [3][i], block.uR  [4][i],
+                block.flux[0][i], block.flux[1][i], block.flux[2][i],
+                block.flux[3][i], block.flux[4][i]);
+        }
+    }
 }
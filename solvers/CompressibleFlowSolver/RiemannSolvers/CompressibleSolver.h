@@ -42,10 +42,37 @@ using namespace Nektar::SolverUtils;
 
 namespace Nektar
 {
+    /**
+     * @brief Structure-of-arrays storage for a block of trace points.
+     *
+     * Conserved variables are stored in the order (rho, rhou, rhov, rhow, E);
+     * velocity components which are not present in the current dimension are
+     * zero. Keeping the left state, right state and flux in one object lets
+     * the compiler prove that they do not overlap when vectorising.
+     */
+    struct RiemannBlock
+    {
+        static const int size = 128;
+
+        NekDouble uL  [5][size];
+        NekDouble uR  [5][size];
+        NekDouble flux[5][size];
+    };
+
     class CompressibleSolver : public RiemannSolver
     {
+    public:
+        /// Select between the batched (v_BlockSolve) and the per-point
+        /// reference (v_PointSolve) evaluation of the flux.
+        void SetBlockSolve(bool blockSolve)
+        {
+            m_blockSolve = blockSolve;
+        }
+
     protected:
-        bool m_pointSolve;
+        bool         m_pointSolve;
+        bool         m_blockSolve;
+        RiemannBlock m_block;
         
         CompressibleSolver();
         
@@ -69,6 +96,10 @@ namespace Nektar
         {
             ASSERTL0(false, "This function should be defined by subclasses.");
         }
+
+        virtual void v_BlockSolve(
+            const int     npts,
+            RiemannBlock &block);
     };
 }
 
@@ -164,4 +164,126 @@ namespace Nektar
             }
         }
     }
+
+    /**
+     * @brief HLLC Riemann solver for a block of trace points.
+     *
+     * Performs the same computation as HLLCSolver::v_PointSolve. The
+     * upwind and star-state fluxes are evaluated for every point and the
+     * appropriate one is then selected, which avoids data-dependent
+     * branches in the loop and allows it to be vectorised.
+     */
+    void HLLCSolver::v_BlockSolve(
+        const int     npts,
+        RiemannBlock &block)
+    {
+        static NekDouble gamma = m_params["gamma"]();
+        const  NekDouble gm1   = gamma - 1.0;
+
+        const NekDouble *rhoL  = block.uL[0], *rhouL = block.uL[1];
+        const NekDouble *rhovL = block.uL[2], *rhowL = block.uL[3];
+        const NekDouble *EL    = block.uL[4];
+        const NekDouble *rhoR  = block.uR[0], *rhouR = block.uR[1];
+        const NekDouble *rhovR = block.uR[2], *rhowR = block.uR[3];
+        const NekDouble *ER    = block.uR[4];
+        NekDouble *rhof  = block.flux[0], *rhouf = block.flux[1];
+        NekDouble *rhovf = block.flux[2], *rhowf = block.flux[3];
+        NekDouble *Ef    = block.flux[4];
+
+        for (int i = 0; i < npts; ++i)
+        {
+            // Left and Right velocities
+            NekDouble uLi = rhouL[i] / rhoL[i];
+            NekDouble vLi = rhovL[i] / rhoL[i];
+            NekDouble wLi = rhowL[i] / rhoL[i];
+            NekDouble uRi = rhouR[i] / rhoR[i];
+            NekDouble vRi = rhovR[i] / rhoR[i];
+            NekDouble wRi = rhowR[i] / rhoR[i];
+
+            // Left and right pressure, sound speed and enthalpy.
+            NekDouble pL = gm1 * (EL[i] - 0.5 *
+                (rhouL[i] * uLi + rhovL[i] * vLi + rhowL[i] * wLi));
+            NekDouble pR = gm1 * (ER[i] - 0.5 *
+                (rhouR[i] * uRi + rhovR[i] * vRi + rhowR[i] * wRi));
+            NekDouble cL = sqrt(gamma * pL / rhoL[i]);
+            NekDouble cR = sqrt(gamma * pR / rhoR[i]);
+            NekDouble hL = (EL[i] + pL) / rhoL[i];
+            NekDouble hR = (ER[i] + pR) / rhoR[i];
+
+            // Velocity Roe averages
+            NekDouble srL  = sqrt(rhoL[i]);
+            NekDouble srR  = sqrt(rhoR[i]);
+            NekDouble srLR = srL + srR;
+            NekDouble uRoe = (srL * uLi + srR * uRi) / srLR;
+            NekDouble vRoe = (srL * vLi + srR * vRi) / srLR;
+            NekDouble wRoe = (srL * wLi + srR * wRi) / srLR;
+            NekDouble hRoe = (srL * hL  + srR * hR ) / srLR;
+            NekDouble cRoe = sqrt(gm1 * (hRoe - 0.5 *
+                (uRoe * uRoe + vRoe * vRoe + wRoe * wRoe)));
+
+            // Maximum wave speeds
+            NekDouble SL = std::min(uLi - cL, uRoe - cRoe);
+            NekDouble SR = std::max(uRi + cR, uRoe + cRoe);
+
+            // Left and right physical fluxes
+            NekDouble fL0 = rhouL[i];
+            NekDouble fL1 = rhouL[i] * uLi + pL;
+            NekDouble fL2 = rhouL[i] * vLi;
+            NekDouble fL3 = rhouL[i] * wLi;
+            NekDouble fL4 = uLi * (EL[i] + pL);
+            NekDouble fR0 = rhouR[i];
+            NekDouble fR1 = rhouR[i] * uRi + pR;
+            NekDouble fR2 = rhouR[i] * vRi;
+            NekDouble fR3 = rhouR[i] * wRi;
+            NekDouble fR4 = uRi * (ER[i] + pR);
+
+            // Contact wave speed and star states
+            NekDouble SM = (pR - pL + rhouL[i] * (SL - uLi)
+                                    - rhouR[i] * (SR - uRi)) /
+                (rhoL[i] * (SL - uLi) - rhoR[i] * (SR - uRi));
+            NekDouble rhoML = rhoL[i] * (SL - uLi) / (SL - SM);
+            NekDouble EML   = rhoML * (EL[i] / rhoL[i] +
+                (SM - uLi) * (SM + pL / (rhoL[i] * (SL - uLi))));
+            NekDouble rhoMR = rhoR[i] * (SR - uRi) / (SR - SM);
+            NekDouble EMR   = rhoMR * (ER[i] / rhoR[i] +
+                (SM - uRi) * (SM + pR / (rhoR[i] * (SR - uRi))));
+
+            // HLLC star fluxes either side of the contact
+            NekDouble fML0 = fL0 + SL * (rhoML - rhoL[i]);
+            NekDouble fML1 = fL1 + SL * (rhoML * SM  - rhouL[i]);
+            NekDouble fML2 = fL2 + SL * (rhoML * vLi - rhovL[i]);
+            NekDouble fML3 = fL3 + SL * (rhoML * wLi - rhowL[i]);
+            NekDouble fML4 = fL4 + SL * (EML - EL[i]);
+            NekDouble fMR0 = fR0 + SR * (rhoMR - rhoR[i]);
+            NekDouble fMR1 = fR1 + SR * (rhoMR * SM  - rhouR[i]);
+            NekDouble fMR2 = fR2 + SR * (rhoMR * vRi - rhovR[i]);
+            NekDouble fMR3 = fR3 + SR * (rhoMR * wRi - rhowR[i]);
+            NekDouble fMR4 = fR4 + SR * (EMR - ER[i]);
+
+            // Select the flux for the region containing the interface:
+            // left state if SL >= 0, right state if SR <= 0, otherwise the
+            // star state on the appropriate side of the contact.
+            bool left  = SL >= 0.0;
+            bool right = SR <= 0.0;
+            bool starL = SM >= 0.0;
+
+            NekDouble f0 = starL ? fML0 : fMR0;
+            NekDouble f1 = starL ? fML1 : fMR1;
+            NekDouble f2 = starL ? fML2 : fMR2;
+            NekDouble f3 = starL ? fML3 : fMR3;
+            NekDouble f4 = starL ? fML4 : fMR4;
+
+            f0 = right ? fR0 : f0;
+            f1 = right ? fR1 : f1;
+            f2 = right ? fR2 : f2;
+            f3 = right ? fR3 : f3;
+            f4 = right ? fR4 : f4;
+
+            rhof [i] = left ? fL0 : f0;
+            rhouf[i] = left ? fL1 : f1;
+            rhovf[i] = left ? fL2 : f2;
+            rhowf[i] = left ? fL3 : f3;
+            Ef   [i] = left ? fL4 : f4;
+        }
+    }
 }
@@ -138,4 +138,78 @@ namespace Nektar
         Ef    = 0.5 * ((uL * (EL + pL) + uR * (ER + pR)) - 
                         sign * S * (ER - EL));
     }
+
+    /**
+     * @brief Lax-Friedrichs Riemann solver for a block of trace points.
+     *
+     * Performs the same computation as LaxFriedrichsSolver::v_PointSolve
+     * over contiguous arrays of trace points so that the loop can be
+     * vectorised.
+     */
+    void LaxFriedrichsSolver::v_BlockSolve(
+        const int     npts,
+        RiemannBlock &block)
+    {
+        static NekDouble gamma = m_params["gamma"]();
+        const  NekDouble gm1   = gamma - 1.0;
+
+        const NekDouble *rhoL  = block.uL[0], *rhouL = block.uL[1];
+        const NekDouble *rhovL = block.uL[2], *rhowL = block.uL[3];
+        const NekDouble *EL    = block.uL[4];
+        const NekDouble *rhoR  = block.uR[0], *rhouR = block.uR[1];
+        const NekDouble *rhovR = block.uR[2], *rhowR = block.uR[3];
+        const NekDouble *ER    = block.uR[4];
+        NekDouble *rhof  = block.flux[0], *rhouf = block.flux[1];
+        NekDouble *rhovf = block.flux[2], *rhowf = block.flux[3];
+        NekDouble *Ef    = block.flux[4];
+
+        for (int i = 0; i < npts; ++i)
+        {
+            // Left and right velocities
+            NekDouble uLi = rhouL[i] / rhoL[i];
+            NekDouble vLi = rhovL[i] / rhoL[i];
+            NekDouble wLi = rhowL[i] / rhoL[i];
+            NekDouble uRi = rhouR[i] / rhoR[i];
+            NekDouble vRi = rhovR[i] / rhoR[i];
+            NekDouble wRi = rhowR[i] / rhoR[i];
+
+            // Left and right pressures, speeds of sound and enthalpies
+            NekDouble pL = gm1 * (EL[i] - 0.5 *
+                (rhouL[i] * uLi + rhovL[i] * vLi + rhowL[i] * wLi));
+            NekDouble pR = gm1 * (ER[i] - 0.5 *
+                (rhouR[i] * uRi + rhovR[i] * vRi + rhowR[i] * wRi));
+            NekDouble cL = sqrt(gamma * pL / rhoL[i]);
+            NekDouble cR = sqrt(gamma * pR / rhoR[i]);
+            NekDouble hL = (EL[i] + pL) / rhoL[i];
+            NekDouble hR = (ER[i] + pR) / rhoR[i];
+
+            // Velocity Roe averages
+            NekDouble srL  = sqrt(rhoL[i]);
+            NekDouble srR  = sqrt(rhoR[i]);
+            NekDouble srLR = srL + srR;
+            NekDouble uRoe = (srL * uLi + srR * uRi) / srLR;
+            NekDouble vRoe = (srL * vLi + srR * vRi) / srLR;
+            NekDouble wRoe = (srL * wLi + srR * wRi) / srLR;
+            NekDouble hRoe = (srL * hL  + srR * hR ) / srLR;
+            NekDouble cRoe = sqrt(gm1 * (hRoe - 0.5 *
+                (uRoe * uRoe + vRoe * vRoe + wRoe * wRoe)));
+
+            // Maximum wave speed, signed as in the point-wise solver.
+            NekDouble SLi = -uLi + cL;
+            NekDouble S   = std::max(uRoe + cRoe, std::max(uRi + cR, SLi));
+            NekDouble sS  = S == SLi ? -S : S;
+
+            rhof [i] = 0.5 * ((rhouL[i] + rhouR[i]) -
+                              sS * (rhoR[i] - rhoL[i]));
+            rhouf[i] = 0.5 * ((rhoL[i] * uLi * uLi + pL +
+                               rhoR[i] * uRi * uRi + pR) -
+                              sS * (rhouR[i] - rhouL[i]));
+            rhovf[i] = 0.5 * ((rhoL[i] * uLi * vLi + rhoR[i] * uRi * vRi) -
+                              sS * (rhovR[i] - rhovL[i]));
+            rhowf[i] = 0.5 * ((rhoL[i] * uLi * wLi + rhoR[i] * uRi * wRi) -
+                              sS * (rhowR[i] - rhowL[i]));
+            Ef   [i] = 0.5 * ((uLi * (EL[i] + pL) + uRi * (ER[i] + pR)) -
+                              sS * (ER[i] - EL[i]));
+        }
+    }
 }
@@ -171,4 +171,102 @@ namespace Nektar
             Ef    -= ahat*k[i][4];
         }
     }
+
+    /**
+     * @brief Roe Riemann solver for a block of trace points.
+     *
+     * Performs the same computation as RoeSolver::v_PointSolve with the
+     * eigenvector summation (11.29) written out explicitly, so that the loop
+     * body contains no inner loops or branches and can be vectorised.
+     */
+    void RoeSolver::v_BlockSolve(
+        const int     npts,
+        RiemannBlock &block)
+    {
+        static NekDouble gamma = m_params["gamma"]();
+        const  NekDouble gm1   = gamma - 1.0;
+
+        const NekDouble *rhoL  = block.uL[0], *rhouL = block.uL[1];
+        const NekDouble *rhovL = block.uL[2], *rhowL = block.uL[3];
+        const NekDouble *EL    = block.uL[4];
+        const NekDouble *rhoR  = block.uR[0], *rhouR = block.uR[1];
+        const NekDouble *rhovR = block.uR[2], *rhowR = block.uR[3];
+        const NekDouble *ER    = block.uR[4];
+        NekDouble *rhof  = block.flux[0], *rhouf = block.flux[1];
+        NekDouble *rhovf = block.flux[2], *rhowf = block.flux[3];
+        NekDouble *Ef    = block.flux[4];
+
+        for (int i = 0; i < npts; ++i)
+        {
+            // Left and right velocities
+            NekDouble uLi = rhouL[i] / rhoL[i];
+            NekDouble vLi = rhovL[i] / rhoL[i];
+            NekDouble wLi = rhowL[i] / rhoL[i];
+            NekDouble uRi = rhouR[i] / rhoR[i];
+            NekDouble vRi = rhovR[i] / rhoR[i];
+            NekDouble wRi = rhowR[i] / rhoR[i];
+
+            // Left and right pressures
+            NekDouble pL = gm1 * (EL[i] - 0.5 *
+                (rhouL[i] * uLi + rhovL[i] * vLi + rhowL[i] * wLi));
+            NekDouble pR = gm1 * (ER[i] - 0.5 *
+                (rhouR[i] * uRi + rhovR[i] * vRi + rhowR[i] * wRi));
+
+            // Left and right enthalpy
+            NekDouble hL = (EL[i] + pL) / rhoL[i];
+            NekDouble hR = (ER[i] + pR) / rhoR[i];
+
+            // Roe averages (equation 11.60).
+            NekDouble srL  = sqrt(rhoL[i]);
+            NekDouble srR  = sqrt(rhoR[i]);
+            NekDouble srLR = srL + srR;
+            NekDouble uRoe = (srL * uLi + srR * uRi) / srLR;
+            NekDouble vRoe = (srL * vLi + srR * vRi) / srLR;
+            NekDouble wRoe = (srL * wLi + srR * wRi) / srLR;
+            NekDouble hRoe = (srL * hL  + srR * hR ) / srLR;
+            NekDouble URoe = (uRoe * uRoe + vRoe * vRoe + wRoe * wRoe);
+            NekDouble cRoe = sqrt(gm1 * (hRoe - 0.5 * URoe));
+
+            // Jumps \Delta u_i and \Delta u_5 (equation 11.70).
+            NekDouble j0 = rhoR [i] - rhoL [i];
+            NekDouble j1 = rhouR[i] - rhouL[i];
+            NekDouble j2 = rhovR[i] - rhovL[i];
+            NekDouble j3 = rhowR[i] - rhowL[i];
+            NekDouble j4 = ER   [i] - EL   [i];
+            NekDouble jumpbar = j4 - (j2 - vRoe * j0) * vRoe -
+                (j3 - wRoe * j0) * wRoe;
+
+            // Wave amplitudes (equations 11.68, 11.69).
+            NekDouble alpha1 = gm1 * (j0 * (hRoe - uRoe * uRoe) +
+                uRoe * j1 - jumpbar) / (cRoe * cRoe);
+            NekDouble alpha0 = (j0 * (uRoe + cRoe) - j1 - cRoe * alpha1) /
+                (2.0 * cRoe);
+            NekDouble alpha4 = j0 - (alpha0 + alpha1);
+            NekDouble alpha2 = j2 - vRoe * j0;
+            NekDouble alpha3 = j3 - wRoe * j0;
+
+            // Wave strengths scaled by the eigenvalues (equation 11.58).
+            NekDouble uRoeAbs = fabs(uRoe);
+            NekDouble a0 = 0.5 * alpha0 * fabs(uRoe - cRoe);
+            NekDouble a1 = 0.5 * alpha1 * uRoeAbs;
+            NekDouble a2 = 0.5 * alpha2 * uRoeAbs;
+            NekDouble a3 = 0.5 * alpha3 * uRoeAbs;
+            NekDouble a4 = 0.5 * alpha4 * fabs(uRoe + cRoe);
+
+            // Average of left and right fluxes minus the summation over the
+            // eigenvectors of equation 11.59.
+            rhof [i] = 0.5 * (rhoL[i] * uLi + rhoR[i] * uRi)
+                - a0 - a1 - a4;
+            rhouf[i] = 0.5 * (pL + rhoL[i] * uLi * uLi +
+                              pR + rhoR[i] * uRi * uRi)
+                - a0 * (uRoe - cRoe) - a1 * uRoe - a4 * (uRoe + cRoe);
+            rhovf[i] = 0.5 * (rhoL[i] * uLi * vLi + rhoR[i] * uRi * vRi)
+                - a0 * vRoe - a1 * vRoe - a2 - a4 * vRoe;
+            rhowf[i] = 0.5 * (rhoL[i] * uLi * wLi + rhoR[i] * uRi * wRi)
+                - a0 * wRoe - a1 * wRoe - a3 - a4 * wRoe;
+            Ef   [i] = 0.5 * (uLi * (EL[i] + pL) + uRi * (ER[i] + pR))
+                - a0 * (hRoe - uRoe * cRoe) - a1 * (0.5 * URoe)
+                - a2 * vRoe - a3 * wRoe - a4 * (hRoe + uRoe * cRoe);
+        }
+    }
 }
@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////////////////////
+//
+// File: TestRiemannSolvers.cpp
+//
+// For more information, please see: http://www.nektar.info
+//
+// The MIT License
+//
+// Copyright (c) 2006 Division of Applied Mathematics, Brown University (USA),
+// Department of Aeronautics, Imperial College London (UK), and Scientific
+// Computing and Imaging Institute, University of Utah (USA).
+//
+// License for the specific language governing rights and limitations under
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included
+// in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+// Description: Tests for the batched compressible Riemann solvers
+//
+///////////////////////////////////////////////////////////////////////////////
+
+#include <CompressibleFlowSolver/RiemannSolvers/HLLCSolver.h>
+#include <CompressibleFlowSolver/RiemannSolvers/RoeSolver.h>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test.hpp>
+
+namespace Nektar
+{
+    namespace RiemannSolversTests
+    {
+        NekDouble Gamma()
+        {
+            return 1.4;
+        }
+
+        /// Exposes the point-wise and batched fluxes of a solver.
+        template<class SolverType>
+        class TestSolver : public SolverType
+        {
+        public:
+            TestSolver()
+            {
+                this->SetParam("gamma", &Gamma);
+            }
+
+            void PointSolve(const NekDouble *uL, const NekDouble *uR,
+                            NekDouble *flux)
+            {
+                this->v_PointSolve(uL[0], uL[1], uL[2], uL[3], uL[4],
+                                   uR[0], uR[1], uR[2], uR[3], uR[4],
+                                   flux[0], flux[1], flux[2], flux[3],
+                                   flux[4]);
+            }
+
+            void BlockSolve(const int npts, RiemannBlock &block)
+            {
+                this->v_BlockSolve(npts, block);
+            }
+        };
+
+        /// Conserved variables of a random state, with supersonic
+        /// velocities in either direction so that every wave pattern of
+        /// the solvers is reached.
+        void RandomState(boost::random::mt19937 &rng, NekDouble *u)
+        {
+            boost::random::uniform_real_distribution<NekDouble>
+                rho(0.2, 2.0), vel(-3.0, 3.0), p(0.2, 2.0);
+
+            const NekDouble r  = rho(rng);
+            const NekDouble vx = vel(rng);
+            const NekDouble vy = vel(rng);
+            const NekDouble vz = vel(rng);
+
+            u[0] = r;
+            u[1] = r*vx;
+            u[2] = r*vy;
+            u[3] = r*vz;
+            u[4] = p(rng)/(Gamma() - 1.0)
+                 + 0.5*r*(vx*vx + vy*vy + vz*vz);
+        }
+
+        /// Checks that the batched flux is bitwise equal to the point-wise
+        /// one on a block of random left and right states.
+        template<class SolverType>
+        void CheckBlockMatchesPoint()
+        {
+            TestSolver<SolverType> solver;
+            boost::random::mt19937 rng(2009);
+
+            // One block is kept on the heap, as RiemannBlock is large.
+            boost::shared_ptr<RiemannBlock> block(new RiemannBlock);
+            const int npts = RiemannBlock::size - 3;
+
+            NekDouble uL[5], uR[5];
+            for (int i = 0; i < npts; ++i)
+            {
+                RandomState(rng, uL);
+                RandomState(rng, uR);
+                for (int k = 0; k < 5; ++k)
+                {
+                    block->uL[k][i] = uL[k];
+                    block->uR[k][i] = uR[k];
+                }
+            }
+
+            solver.BlockSolve(npts, *block);
+
+            NekDouble flux[5];
+            for (int i = 0; i < npts; ++i)
+            {
+                for (int k = 0; k < 5; ++k)
+                {
+                    uL[k] = block->uL[k][i];
+                    uR[k] = block->uR[k][i];
+                }
+                solver.PointSolve(uL, uR, flux);
+
+                for (int k = 0; k < 5; ++k)
+                {
+                    BOOST_CHECK_EQUAL(block->flux[k][i], flux[k]);
+                }
+            }
+        }
+
+        BOOST_AUTO_TEST_CASE(TestRoeBlockMatchesPoint)
+        {
+            CheckBlockMatchesPoint<RoeSolver>();
+        }
+
+        BOOST_AUTO_TEST_CASE(TestHLLCBlockMatchesPoint)
+        {
+            CheckBlockMatchesPoint<HLLCSolver>();
+        }
+    }
+}
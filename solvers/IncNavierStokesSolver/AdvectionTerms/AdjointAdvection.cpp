@@ -866,8 +866,6 @@ namespace Nektar
 				Array<OneD, NekDouble> fft_in(npoints*m_slices);
 				Array<OneD, NekDouble> fft_out(npoints*m_slices);
 				
-				Array<OneD, NekDouble> m_tmpIN(m_slices);
-				Array<OneD, NekDouble> m_tmpOUT(m_slices);
 				
 				//Shuffle the data
 				for(int j= 0; j < m_slices; ++j)
@@ -878,11 +876,7 @@ namespace Nektar
 				m_FFT = LibUtilities::GetNektarFFTFactory().CreateInstance("NekFFTW", m_slices);
 				
 				//FFT Transform
-				for(int i=0; i<npoints; i++)
-				{
-					m_FFT->FFTFwdTrans(m_tmpIN =fft_in + i*m_slices, m_tmpOUT =fft_out + i*m_slices);
-					
-				}
+				m_FFT->FFTFwdTrans(npoints, fft_in, fft_out);
 				
 				//Reshuffle data
 				for(int s = 0; s < m_slices; ++s)
@@ -0,0 +1,22 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description>Kovasznay Flow P=8, iterative static condensation</description>
+    <executable>IncNavierStokesSolver</executable>
+    <parameters>KovaFlow_m8_iter.xml</parameters>
+    <files>
+        <file description="Session File">KovaFlow_m8_iter.xml</file>
+        <file description="Session File">KovaFlow_m8.rst</file>
+    </files>
+    <metrics>
+        <metric type="L2" id="1">
+            <value variable="u" tolerance="1e-8">4.70499e-05</value>
+            <value variable="v" tolerance="1e-8">0.000157969</value>
+            <value variable="p" tolerance="1e-8">0.00158632</value>
+        </metric>
+        <metric type="Linf" id="2">
+            <value variable="u" tolerance="1e-8">6.85934e-05</value>
+            <value variable="v" tolerance="1e-8">0.000191491</value>
+            <value variable="p" tolerance="1e-8">0.00500792</value>
+        </metric>
+    </metrics>
+</test>
@@ -224,8 +224,7 @@ namespace Nektar
 	{	  
 	  for (int i = 0; i < m_spacedim; ++i)
 	    {
-	      Vmath::Vmul(nq,m_bottomSlope[i],1,physarray[0],1,tmp,1);
-	      Vmath::Smul(nq,m_g,tmp,1,tmp,1);
+	      Vmath::Svvt(nq,m_g,m_bottomSlope[i],1,physarray[0],1,tmp,1);
 	      m_fields[0]->IProductWRTBase(tmp,mod);
 	      m_fields[0]->MultiplyByElmtInvMass(mod,mod);
 	      m_fields[0]->BwdTrans(mod,tmp);
@@ -238,9 +237,8 @@ namespace Nektar
 	{
 	 for (int i = 0; i < m_spacedim; ++i)
 	    {
-	      Vmath::Vmul(nq,m_bottomSlope[i],1,physarray[0],1,tmp,1);
-	      Vmath::Smul(nq,m_g,tmp,1,tmp,1);
-	      Vmath::Vadd(nq,tmp,1,outarray[i+1],1,outarray[i+1],1);
+	      Vmath::Svvtvp(nq,m_g,m_bottomSlope[i],1,physarray[0],1,
+			    outarray[i+1],1,outarray[i+1],1);
 	    }
 	}
 	break;
@@ -609,8 +607,7 @@ namespace Nektar
      
      // Put (0.5 g h h) in tmp
      Array<OneD, NekDouble> tmp(nq);
-     Vmath::Vmul(nq, physfield[0], 1, physfield[0], 1, tmp, 1);
-     Vmath::Smul(nq, 0.5*g, tmp, 1, tmp, 1);
+     Vmath::Svvt(nq, 0.5*g, physfield[0], 1, physfield[0], 1, tmp, 1);
      
      // Flux vector for the momentum equations
      for (i = 0; i < m_spacedim; ++i)
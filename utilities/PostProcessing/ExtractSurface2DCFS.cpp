@@ -304,7 +304,7 @@ int main(int argc, char *argv[])
         gloCoord[2] = z0 + i*dz;
         cout << gloCoord[0] << "   " << gloCoord[1] << "   " << gloCoord[2];
         
-        int ExpId = Exp[0]->GetExpIndex(gloCoord, NekConstants::kGeomFactorsTol);
+        int ExpId = Exp[0]->GetExpIndex(gloCoord, NekConstants::kGeomFactorsTol, true);
         
 
         for (int j = 0; j < nfields; ++j)
@@ -54,6 +54,8 @@ namespace Nektar
         
         OutputFld::OutputFld(FieldSharedPtr f) : OutputModule(f)
         {
+            m_config["format"] = ConfigOption(false, "Xml",
+                                    "Output format: Xml or Binary.");
         }
         
         OutputFld::~OutputFld()
@@ -64,6 +66,18 @@ namespace Nektar
         {         
             // Extract the output filename and extension
             string filename = m_config["outfile"].as<string>();
+
+            string format = m_config["format"].as<string>();
+            if (boost::iequals(format, "Binary"))
+            {
+                m_f->m_fld->SetFormat(LibUtilities::eFieldIOBinary);
+            }
+            else
+            {
+                ASSERTL0(boost::iequals(format, "Xml"),
+                         "Unknown output format '" + format + "'.");
+                m_f->m_fld->SetFormat(LibUtilities::eFieldIOXml);
+            }
             
             if (m_f->m_writeBndFld)
             {
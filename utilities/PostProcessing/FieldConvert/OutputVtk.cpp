@@ -39,6 +39,10 @@ using namespace std;
 
 #include "OutputVtk.h"
 
+#include <boost/algorithm/string/predicate.hpp>
+
+#include <MultiRegions/VtuWriter.h>
+
 namespace Nektar
 {
     namespace Utilities
@@ -51,6 +55,10 @@ namespace Nektar
         OutputVtk::OutputVtk(FieldSharedPtr f) : OutputModule(f)
         {
             m_requireEquiSpaced = true;
+            m_config["format"]   = ConfigOption(false, "Ascii",
+                "Output format: Ascii, Binary or Base64.");
+            m_config["compress"] = ConfigOption(true, "0",
+                "Compress Binary or Base64 output with zlib.");
         }
 
         OutputVtk::~OutputVtk()
@@ -72,6 +80,31 @@ namespace Nektar
 
             // Extract the output filename and extension
             string filename = m_config["outfile"].as<string>();
+            string format   = m_config["format"].as<string>();
+            ASSERTL0(boost::iequals(format, "Ascii")  ||
+                     boost::iequals(format, "Binary") ||
+                     boost::iequals(format, "Base64"),
+                     "Unknown output format '" + format + "'.");
+
+            // Homogeneous expansions are only written in the per-element
+            // ASCII format.
+            MultiRegions::ExpansionType expType = m_f->m_exp[0]->GetExpType();
+            if (!boost::iequals(format, "Ascii") &&
+                expType != MultiRegions::e3DH1D &&
+                expType != MultiRegions::e3DH2D)
+            {
+                MultiRegions::VtuWriter writer(m_f->m_exp[0]);
+                writer.SetBase64(boost::iequals(format, "Base64"));
+                writer.SetCompress(m_config["compress"].as<bool>());
+                for (j = 0; j < m_f->m_fielddef[0]->m_fields.size(); ++j)
+                {
+                    writer.AddField(m_f->m_fielddef[0]->m_fields[j],
+                                    m_f->m_exp[j]->GetPhys());
+                }
+                filename = writer.Write(filename);
+                cout << "Written file: " << filename << endl;
+                return;
+            }
             
             // amend for parallel output if required 
             if(m_f->m_session->GetComm()->GetSize() != 1)
@@ -0,0 +1,18 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Process 3D vtu output in appended raw binary format </description>
+    <executable>FieldConvert</executable>
+    <parameters> chan3D.xml chan3D.fld chan3D.vtu:vtu:format=Binary</parameters>
+    <files>
+        <file description="Session File">chan3D.xml</file>
+	<file description="Session File">chan3D.fld</file>
+    </files>
+     <metrics>
+        <metric type="file" id="1">
+            <file filename="chan3D.vtu">
+                <sha1>5dbaf252d8b33cc3f502e2dbd489dbfe0401c524</sha1>
+             </file>
+         </metric>
+    </metrics>
+</test>
+
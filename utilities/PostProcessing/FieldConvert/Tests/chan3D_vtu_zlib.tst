@@ -0,0 +1,18 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Process 3D vtu output in zlib compressed base64 format </description>
+    <executable>FieldConvert</executable>
+    <parameters> chan3D.xml chan3D.fld chan3D.vtu:vtu:format=Base64:compress</parameters>
+    <files>
+        <file description="Session File">chan3D.xml</file>
+	<file description="Session File">chan3D.fld</file>
+    </files>
+     <metrics>
+        <metric type="file" id="1">
+            <file filename="chan3D.vtu">
+                <sha1>27a9214d393e4ae48b39120dc8b9c2929ddaaa80</sha1>
+             </file>
+         </metric>
+    </metrics>
+</test>
+
@@ -443,27 +443,35 @@ void InterpolateField(
 {
     int expdim = (z == NullNekDouble1DArray)? 2: 3;
     
-    Array<OneD, NekDouble> coords(expdim), Lcoords(expdim);
+    Array<OneD, NekDouble> Lcoords(expdim);
     int nq1 = field1[0]->GetTotPoints();
     int elmtid, offset;
-    int r, f;
+    int r, f, d;
     static int intpts = 0;
     
     ASSERTL0(field0.num_elements() == field1.num_elements(), 
              "Input field dimension must be same as output dimension");
 
+    // Obtain Elements and LocalCoordinates to interpolate
+    Array<OneD, Array<OneD, NekDouble> > coords(expdim);
+    Array<OneD, Array<OneD, NekDouble> > locCoords;
+    Array<OneD, int>                     elmtIds;
+    coords[0] = x;
+    coords[1] = y;
+    if (expdim == 3)
+    {
+        coords[2] = z;
+    }
+    field0[0]->GetExpIndices(coords, elmtIds, locCoords, 1e-3, true);
+
     for (r = 0; r < nq1; r++)
     {
-        coords[0] = x[r];
-        coords[1] = y[r];
-        if (expdim == 3)
+        elmtid = elmtIds[r];
+        for (d = 0; d < expdim; ++d)
         {
-            coords[2] = z[r];
+            Lcoords[d] = locCoords[d][r];
         }
 
-        // Obtain Element and LocalCoordinate to interpolate
-        elmtid = field0[0]->GetExpIndex(coords, Lcoords, 1e-3);
-
         offset = field0[0]->GetPhys_Offset(field0[0]->
                                            GetOffset_Elmt_Id(elmtid));
 
@@ -513,7 +521,7 @@ void InterpolateFieldHomo(
         coords[0] = x1[r];
         coords[1] = y1[r];
         
-        elmtid = field0->GetPlane(0)->GetExpIndex(coords, 1e-3);
+        elmtid = field0->GetPlane(0)->GetExpIndex(coords, 1e-3, true);
         offset = field0->GetPlane(0)->GetPhys_Offset(elmtid);
         field1->GetPlane(0)->UpdatePhys()[r] = field0->GetPlane(0)->
             GetExp(elmtid)->PhysEvaluate(
@@ -534,7 +542,7 @@ void InterpolateFieldHomo(
         coords[0] = x1[r];
         coords[1] = y1[r];
         
-        elmtid = field0->GetPlane(1)->GetExpIndex(coords, 1e-3);
+        elmtid = field0->GetPlane(1)->GetExpIndex(coords, 1e-3, true);
         offset = field0->GetPlane(1)->GetPhys_Offset(elmtid);
         field1->GetPlane(1)->UpdatePhys()[r] = field0->GetPlane(1)->
             GetExp(elmtid)->PhysEvaluate(
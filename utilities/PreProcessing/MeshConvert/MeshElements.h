@@ -247,21 +247,34 @@ namespace Nektar
                 return m_edgeNodes.size() + 2;
             }
 
+            /// Lists all the nodes of the edge in the order of the Nektar++
+            /// curve definition.
+            void GetCurvedNodes(std::vector<NodeSharedPtr> &nodeList) const
+            {
+                nodeList.clear();
+                nodeList.push_back(m_n1);
+                nodeList.insert(nodeList.end(), m_edgeNodes.begin(),
+                                m_edgeNodes.end());
+                nodeList.push_back(m_n2);
+            }
+
             /// Creates a Nektar++ string listing the coordinates of all the
             /// nodes.
             std::string GetXmlCurveString() const
             {
+                std::vector<NodeSharedPtr> nodeList;
+                GetCurvedNodes(nodeList);
+
                 std::stringstream s;
-                std::string str;
-                s << std::scientific << std::setprecision(8) << "     "
-                  <<  m_n1->m_x << "  " << m_n1->m_y << "  " << m_n1->m_z << "     ";
-                for (int k = 0; k < m_edgeNodes.size(); ++k) {
+                for (int k = 0; k < nodeList.size(); ++k) {
                     s << std::scientific << std::setprecision(8) << "     "
-                      <<  m_edgeNodes[k]->m_x << "  " << m_edgeNodes[k]->m_y
-                      << "  " << m_edgeNodes[k]->m_z << "     ";
+                      <<  nodeList[k]->m_x << "  " << nodeList[k]->m_y
+                      << "  " << nodeList[k]->m_z;
+                    if (k < nodeList.size() - 1)
+                    {
+                        s << "     ";
+                    }
                 }
-                s << std::scientific << std::setprecision(8) << "     "
-                  <<  m_n2->m_x << "  " << m_n2->m_y << "  " << m_n2->m_z;
                 return s.str();
             }
 
@@ -398,13 +411,10 @@ namespace Nektar
                 return n;
             }
 
-            /// Generates a string listing the coordinates of all nodes
-            /// associated with this face.
-            std::string GetXmlCurveString() const
+            /// Lists all nodes associated with this face in the order of
+            /// the Nektar++ curve definition.
+            void GetCurvedNodes(std::vector<NodeSharedPtr> &nodeList) const
             {
-                std::stringstream s;
-                std::string str;
-                
                 // Treat 2D point distributions differently to 3D.
                 if (m_curveType == LibUtilities::eNodalTriFekete       || 
                     m_curveType == LibUtilities::eNodalTriEvenlySpaced ||
@@ -427,14 +437,8 @@ namespace Nektar
                         }
                     }
                     tmp.insert(tmp.end(), m_faceNodes.begin(), m_faceNodes.end());
-                    
-                    for (int k = 0; k < tmp.size(); ++k) {
-                        s << std::scientific << std::setprecision(8) << "    "
-                          <<  tmp[k]->m_x << "  " << tmp[k]->m_y
-                          << "  " << tmp[k]->m_z << "    ";
-                    }
-                    
-                    return s.str();
+
+                    nodeList = tmp;
                 }
                 else
                 {
@@ -487,14 +491,24 @@ namespace Nektar
                         }
                     }
 
-                    for (int k = 0; k < tmp.size(); ++k) {
-                        s << std::scientific << std::setprecision(8) << "    "
-                          <<  tmp[k]->m_x << "  " << tmp[k]->m_y
-                          << "  " << tmp[k]->m_z << "    ";
-                    }
-                    
-                    return s.str();
+                    nodeList = tmp;
+                }
+            }
+
+            /// Generates a string listing the coordinates of all nodes
+            /// associated with this face.
+            std::string GetXmlCurveString() const
+            {
+                std::vector<NodeSharedPtr> nodeList;
+                GetCurvedNodes(nodeList);
+
+                std::stringstream s;
+                for (int k = 0; k < nodeList.size(); ++k) {
+                    s << std::scientific << std::setprecision(8) << "    "
+                      <<  nodeList[k]->m_x << "  " << nodeList[k]->m_y
+                      << "  " << nodeList[k]->m_z << "    ";
                 }
+                return s.str();
             }
 
             /// Generate either SpatialDomains::TriGeom or
@@ -913,12 +927,11 @@ namespace Nektar
                 return nodeList;
             }
 
-            /// Generates a string listing the coordinates of all nodes
-            /// associated with this element.
-            std::string GetXmlCurveString() const
+            /// Lists all nodes associated with this element in the order of
+            /// the Nektar++ curve definition.
+            void GetCurvedNodes(std::vector<NodeSharedPtr> &nodeList) const
             {
-                // Temporary node list for reordering
-                std::vector<NodeSharedPtr> nodeList;
+                nodeList.clear();
 
                 // Node orderings are different for different elements.
                 // Triangle
@@ -980,9 +993,17 @@ namespace Nektar
                 }
                 else
                 {
-                    cerr << "GetXmlCurveString for a " << m_vertex.size()
+                    cerr << "GetCurvedNodes for a " << m_vertex.size()
                          << "-vertex element is not yet implemented." << endl;
                 }
+            }
+
+            /// Generates a string listing the coordinates of all nodes
+            /// associated with this element.
+            std::string GetXmlCurveString() const
+            {
+                std::vector<NodeSharedPtr> nodeList;
+                GetCurvedNodes(nodeList);
 
                 // Finally generate the XML string corresponding to our new
                 // node reordering.
@@ -43,6 +43,8 @@ using namespace std;
 namespace io = boost::iostreams;
 
 #include <tinyxml/tinyxml.h>
+#include <LibUtilities/BasicUtils/CompressData.h>
+#include <LibUtilities/BasicUtils/MeshEntities.hpp>
 
 #include "MeshElements.h"
 #include "OutputNekpp.h"
@@ -60,6 +62,9 @@ namespace Nektar
         {
             m_config["z"] = ConfigOption(true, "0",
                 "Compress output file and append a .gz extension.");
+            m_config["compress"] = ConfigOption(true, "0",
+                "Write the geometry sections as compressed binary data "
+                "rather than as text.");
         }
 
         OutputNekpp::~OutputNekpp()
@@ -131,6 +136,25 @@ namespace Nektar
                     m_mesh->m_vertexSet.begin(),
                     m_mesh->m_vertexSet.end());
 
+            if (m_config["compress"].as<bool>())
+            {
+                vector<LibUtilities::MeshVertex> vertData;
+                for (it = tmp.begin(); it != tmp.end(); ++it)
+                {
+                    LibUtilities::MeshVertex v;
+                    v.id  = (*it)->m_id;
+                    v.pad = 0;
+                    v.x   = (*it)->m_x;
+                    v.y   = (*it)->m_y;
+                    v.z   = (*it)->m_z;
+                    vertData.push_back(v);
+                }
+                LibUtilities::CompressData::WriteCompressedData(
+                    verTag, vertData);
+                pRoot->LinkEndChild(verTag);
+                return;
+            }
+
             for (it = tmp.begin(); it != tmp.end(); ++it)
             {
                 NodeSharedPtr n = *it;
@@ -153,6 +177,24 @@ namespace Nektar
                 std::set<EdgeSharedPtr>::iterator it;
                 std::set<EdgeSharedPtr> tmp(m_mesh->m_edgeSet.begin(),
                                             m_mesh->m_edgeSet.end());
+
+                if (m_config["compress"].as<bool>())
+                {
+                    vector<LibUtilities::MeshEdge> edgeData;
+                    for (it = tmp.begin(); it != tmp.end(); ++it)
+                    {
+                        LibUtilities::MeshEdge e;
+                        e.id = (*it)->m_id;
+                        e.v0 = (*it)->m_n1->m_id;
+                        e.v1 = (*it)->m_n2->m_id;
+                        edgeData.push_back(e);
+                    }
+                    LibUtilities::CompressData::WriteCompressedData(
+                        verTag, edgeData);
+                    pRoot->LinkEndChild(verTag);
+                    return;
+                }
+
                 for (it = tmp.begin(); it != tmp.end(); ++it)
                 {
                     EdgeSharedPtr ed = *it;
@@ -178,6 +220,51 @@ namespace Nektar
                         m_mesh->m_faceSet.begin(),
                         m_mesh->m_faceSet.end());
 
+                if (m_config["compress"].as<bool>())
+                {
+                    vector<LibUtilities::MeshTri>  triData;
+                    vector<LibUtilities::MeshQuad> quadData;
+
+                    for (it = tmp.begin(); it != tmp.end(); ++it)
+                    {
+                        FaceSharedPtr fa = *it;
+                        switch(fa->m_vertexList.size())
+                        {
+                            case 3:
+                            {
+                                LibUtilities::MeshTri f;
+                                f.id = fa->m_id;
+                                for (int j = 0; j < 3; ++j)
+                                {
+                                    f.e[j] = fa->m_edgeList[j]->m_id;
+                                }
+                                triData.push_back(f);
+                                break;
+                            }
+                            case 4:
+                            {
+                                LibUtilities::MeshQuad f;
+                                f.id = fa->m_id;
+                                for (int j = 0; j < 4; ++j)
+                                {
+                                    f.e[j] = fa->m_edgeList[j]->m_id;
+                                }
+                                quadData.push_back(f);
+                                break;
+                            }
+                            default:
+                                abort();
+                        }
+                    }
+
+                    verTag->SetAttribute("COMPRESSED",
+                        LibUtilities::CompressData::GetCompressString());
+                    WriteCompressedTag(verTag, "T", triData);
+                    WriteCompressedTag(verTag, "Q", quadData);
+                    pRoot->LinkEndChild(verTag);
+                    return;
+                }
+
                 for (it = tmp.begin(); it != tmp.end(); ++it)
                 {
                     stringstream s;
@@ -212,6 +299,78 @@ namespace Nektar
             TiXmlElement* verTag = new TiXmlElement( "ELEMENT" );
             vector<ElementSharedPtr> &elmt = m_mesh->m_element[m_mesh->m_expDim];
 
+            if (m_config["compress"].as<bool>())
+            {
+                vector<LibUtilities::MeshEdge>  segData;
+                vector<LibUtilities::MeshTri>   triData;
+                vector<LibUtilities::MeshQuad>  quadData;
+                vector<LibUtilities::MeshTet>   tetData;
+                vector<LibUtilities::MeshPyr>   pyrData;
+                vector<LibUtilities::MeshPrism> prismData;
+                vector<LibUtilities::MeshHex>   hexData;
+
+                for(int i = 0; i < elmt.size(); ++i)
+                {
+                    string tag = elmt[i]->GetTag();
+                    int    id  = elmt[i]->GetId();
+
+                    if (tag == "S")
+                    {
+                        LibUtilities::MeshEdge e;
+                        e.id = id;
+                        e.v0 = elmt[i]->GetVertex(0)->m_id;
+                        e.v1 = elmt[i]->GetVertex(1)->m_id;
+                        segData.push_back(e);
+                    }
+                    else if (tag == "T")
+                    {
+                        triData.push_back(
+                            GetElementRecord(elmt[i], &LibUtilities::MeshTri::e));
+                    }
+                    else if (tag == "Q")
+                    {
+                        quadData.push_back(
+                            GetElementRecord(elmt[i], &LibUtilities::MeshQuad::e));
+                    }
+                    else if (tag == "A")
+                    {
+                        tetData.push_back(
+                            GetElementRecord(elmt[i], &LibUtilities::MeshTet::f));
+                    }
+                    else if (tag == "P")
+                    {
+                        pyrData.push_back(
+                            GetElementRecord(elmt[i], &LibUtilities::MeshPyr::f));
+                    }
+                    else if (tag == "R")
+                    {
+                        prismData.push_back(
+                            GetElementRecord(elmt[i], &LibUtilities::MeshPrism::f));
+                    }
+                    else if (tag == "H")
+                    {
+                        hexData.push_back(
+                            GetElementRecord(elmt[i], &LibUtilities::MeshHex::f));
+                    }
+                    else
+                    {
+                        ASSERTL0(false, "Unknown element type: " + tag);
+                    }
+                }
+
+                verTag->SetAttribute("COMPRESSED",
+                    LibUtilities::CompressData::GetCompressString());
+                WriteCompressedTag(verTag, "S", segData);
+                WriteCompressedTag(verTag, "T", triData);
+                WriteCompressedTag(verTag, "Q", quadData);
+                WriteCompressedTag(verTag, "A", tetData);
+                WriteCompressedTag(verTag, "P", pyrData);
+                WriteCompressedTag(verTag, "R", prismData);
+                WriteCompressedTag(verTag, "H", hexData);
+                pRoot->LinkEndChild(verTag);
+                return;
+            }
+
             for(int i = 0; i < elmt.size(); ++i)
             {
                 TiXmlElement *elm_tag = new TiXmlElement(elmt[i]->GetTag());
@@ -240,6 +399,13 @@ namespace Nektar
 
             TiXmlElement * curved = new TiXmlElement ("CURVED" );
 
+            if (m_config["compress"].as<bool>())
+            {
+                WriteCompressedCurves(curved);
+                pRoot->LinkEndChild( curved );
+                return;
+            }
+
             for (it = m_mesh->m_edgeSet.begin(); it != m_mesh->m_edgeSet.end(); ++it)
             {
                 if ((*it)->m_edgeNodes.size() > 0)
@@ -304,6 +470,96 @@ namespace Nektar
             pRoot->LinkEndChild( curved );
         }
 
+        /**
+         * Uses the same curve and point ordering as the text format, with
+         * the points of all curves stored in a single POINTS tag.
+         */
+        void OutputNekpp::WriteCompressedCurves(TiXmlElement * pCurved)
+        {
+            vector<LibUtilities::MeshCurvedInfo> edgeInfo;
+            vector<LibUtilities::MeshCurvedInfo> faceInfo;
+            vector<NekDouble>                    points;
+            vector<NodeSharedPtr>                nodeList;
+
+            EdgeSet::iterator it;
+            for (it = m_mesh->m_edgeSet.begin(); it != m_mesh->m_edgeSet.end(); ++it)
+            {
+                if ((*it)->m_edgeNodes.size() > 0)
+                {
+                    (*it)->GetCurvedNodes(nodeList);
+                    edgeInfo.push_back(AddCurve(
+                        edgeInfo.size(), (*it)->m_id, (*it)->m_curveType,
+                        nodeList, points));
+                }
+            }
+
+            // 2D elements in 3-space, output face curvature information
+            if (m_mesh->m_expDim == 2 && m_mesh->m_spaceDim == 3)
+            {
+                vector<ElementSharedPtr>::iterator it;
+                for (it  = m_mesh->m_element[m_mesh->m_expDim].begin();
+                     it != m_mesh->m_element[m_mesh->m_expDim].end(); ++it)
+                {
+                    // Only generate face curve if there are volume nodes
+                    if ((*it)->GetVolumeNodes().size() > 0)
+                    {
+                        (*it)->GetCurvedNodes(nodeList);
+                        faceInfo.push_back(AddCurve(
+                            faceInfo.size(), (*it)->GetId(),
+                            (*it)->GetCurveType(), nodeList, points));
+                    }
+                }
+            }
+            else if (m_mesh->m_expDim == 3)
+            {
+                FaceSet::iterator it2;
+                for (it2 = m_mesh->m_faceSet.begin(); it2 != m_mesh->m_faceSet.end(); ++it2)
+                {
+                    if ((*it2)->m_faceNodes.size() > 0)
+                    {
+                        (*it2)->GetCurvedNodes(nodeList);
+                        faceInfo.push_back(AddCurve(
+                            faceInfo.size(), (*it2)->m_id,
+                            (*it2)->m_curveType, nodeList, points));
+                    }
+                }
+            }
+
+            pCurved->SetAttribute("COMPRESSED",
+                LibUtilities::CompressData::GetCompressString());
+            WriteCompressedTag(pCurved, "E",      edgeInfo);
+            WriteCompressedTag(pCurved, "F",      faceInfo);
+            WriteCompressedTag(pCurved, "POINTS", points);
+        }
+
+        /**
+         * Appends the coordinates of @a nodeList to @a points and returns
+         * the record of the curve.
+         */
+        LibUtilities::MeshCurvedInfo OutputNekpp::AddCurve(
+            int                          id,
+            int                          entityId,
+            LibUtilities::PointsType     type,
+            const vector<NodeSharedPtr> &nodeList,
+            vector<NekDouble>           &points)
+        {
+            LibUtilities::MeshCurvedInfo c;
+            c.id       = id;
+            c.entityid = entityId;
+            c.npoints  = nodeList.size();
+            c.ptoffset = points.size() / 3;
+            c.ptype    = type;
+
+            for (int k = 0; k < nodeList.size(); ++k)
+            {
+                points.push_back(nodeList[k]->m_x);
+                points.push_back(nodeList[k]->m_y);
+                points.push_back(nodeList[k]->m_z);
+            }
+
+            return c;
+        }
+
         void OutputNekpp::WriteXmlComposites(TiXmlElement * pRoot)
         {
             TiXmlElement* verTag = new TiXmlElement("COMPOSITE");
@@ -37,6 +37,8 @@
 #define UTILITIES_PREPROCESSING_MESHCONVERT_OUTPUTNEKPP
 
 #include <tinyxml/tinyxml.h>
+#include <LibUtilities/BasicUtils/CompressData.h>
+#include <LibUtilities/BasicUtils/MeshEntities.hpp>
 #include "Module.h"
 
 namespace Nektar
@@ -70,6 +72,16 @@ namespace Nektar
             void WriteXmlElements(TiXmlElement * pRoot);
             /// Writes the <CURVES> section of the XML file if needed.
             void WriteXmlCurves(TiXmlElement * pRoot);
+            /// Writes the contents of the <CURVES> section in compressed
+            /// form.
+            void WriteCompressedCurves(TiXmlElement * pCurved);
+            /// Adds a curve given by a list of nodes to the compressed data.
+            LibUtilities::MeshCurvedInfo AddCurve(
+                int                               id,
+                int                               entityId,
+                LibUtilities::PointsType          type,
+                const std::vector<NodeSharedPtr> &nodeList,
+                std::vector<NekDouble>           &points);
             /// Writes the <COMPOSITES> section of the XML file.
             void WriteXmlComposites(TiXmlElement * pRoot);
             /// Writes the <DOMAIN> section of the XML file.
@@ -78,6 +90,50 @@ namespace Nektar
             void WriteXmlExpansions(TiXmlElement * pRoot);
             /// Writes the <CONDITIONS> section of the XML file.
             void WriteXmlConditions(TiXmlElement * pRoot);
+
+            /// Writes a non-empty array of records as a compressed child
+            /// @a tag of @a pParent.
+            template<class T>
+            void WriteCompressedTag(TiXmlElement         *pParent,
+                                    const std::string    &tag,
+                                    const std::vector<T> &data)
+            {
+                if (data.size() > 0)
+                {
+                    TiXmlElement *x = new TiXmlElement(tag);
+                    LibUtilities::CompressData::WriteCompressedData(x, data);
+                    pParent->LinkEndChild(x);
+                }
+            }
+
+            /// Returns the record of a 2D element, listing its edges, or a
+            /// 3D element, listing its faces, in the array @a list.
+            template<class T, int N>
+            T GetElementRecord(ElementSharedPtr el, int (T::*list)[N])
+            {
+                T rec;
+                rec.id = el->GetId();
+
+                if (el->GetDim() == 2)
+                {
+                    ASSERTL0(el->GetEdgeCount() == N,
+                             "Element has the wrong number of edges.");
+                    for (int i = 0; i < N; ++i)
+                    {
+                        (rec.*list)[i] = el->GetEdge(i)->m_id;
+                    }
+                }
+                else
+                {
+                    ASSERTL0(el->GetFaceCount() == N,
+                             "Element has the wrong number of faces.");
+                    for (int i = 0; i < N; ++i)
+                    {
+                        (rec.*list)[i] = el->GetFace(i)->m_id;
+                    }
+                }
+                return rec;
+            }
         };
     }
 }
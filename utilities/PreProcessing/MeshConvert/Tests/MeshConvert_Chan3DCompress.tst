@@ -0,0 +1,16 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Meshconvert with compressed geometry output </description>
+    <executable>MeshConvert</executable>
+    <parameters> chan3D.xml chan3D_comp.xml:xml:compress </parameters>
+    <files>
+        <file description="Input File">chan3D.xml</file>
+    </files>
+     <metrics>
+        <metric type="file" id="1">
+            <file filename="chan3D_comp.xml">
+                <sha1>afb49937bd5a57ffbb233573f42406baa8748e42</sha1>
+             </file>
+         </metric>
+    </metrics>
+</test>
@@ -0,0 +1,16 @@
+<?xml version="1.0" encoding="utf-8"?>
+<test>
+    <description> Meshconvert from compressed geometry to text output </description>
+    <executable>MeshConvert</executable>
+    <parameters> chan3D_comp.xml chan3D_txt.xml </parameters>
+    <files>
+        <file description="Input File">chan3D_comp.xml</file>
+    </files>
+     <metrics>
+        <metric type="file" id="1">
+            <file filename="chan3D_txt.xml">
+                <sha1>8bb60284c024f4878c5241d2b4ac8d431373a454</sha1>
+             </file>
+         </metric>
+    </metrics>
+</test>